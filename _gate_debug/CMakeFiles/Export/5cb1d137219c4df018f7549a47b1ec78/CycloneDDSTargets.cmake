@@ -0,0 +1,145 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS CycloneDDS::libidlc CycloneDDS::idlc CycloneDDS::idl CycloneDDS::dds_security_ac CycloneDDS::dds_security_auth CycloneDDS::dds_security_crypto CycloneDDS::ddsc)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target CycloneDDS::libidlc
+add_library(CycloneDDS::libidlc SHARED IMPORTED)
+
+# Create imported target CycloneDDS::idlc
+add_executable(CycloneDDS::idlc IMPORTED)
+
+# Create imported target CycloneDDS::idl
+add_library(CycloneDDS::idl SHARED IMPORTED)
+
+set_target_properties(CycloneDDS::idl PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "CycloneDDS::ddsc"
+)
+
+# Create imported target CycloneDDS::dds_security_ac
+add_library(CycloneDDS::dds_security_ac SHARED IMPORTED)
+
+set_target_properties(CycloneDDS::dds_security_ac PROPERTIES
+  INTERFACE_LINK_LIBRARIES "CycloneDDS::ddsc;OpenSSL::SSL"
+)
+
+# Create imported target CycloneDDS::dds_security_auth
+add_library(CycloneDDS::dds_security_auth SHARED IMPORTED)
+
+set_target_properties(CycloneDDS::dds_security_auth PROPERTIES
+  INTERFACE_LINK_LIBRARIES "CycloneDDS::ddsc;OpenSSL::SSL"
+)
+
+# Create imported target CycloneDDS::dds_security_crypto
+add_library(CycloneDDS::dds_security_crypto SHARED IMPORTED)
+
+set_target_properties(CycloneDDS::dds_security_crypto PROPERTIES
+  INTERFACE_LINK_LIBRARIES "CycloneDDS::ddsc;OpenSSL::SSL"
+)
+
+# Create imported target CycloneDDS::ddsc
+add_library(CycloneDDS::ddsc SHARED IMPORTED)
+
+set_target_properties(CycloneDDS::ddsc PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_SOURCES "${_IMPORT_PREFIX}/include/dds//dds.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_error.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_impl.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_listener.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_loan_api.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_qos.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_qosdefs.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_public_status.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_statistics.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_rhc.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_internal_api.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_opcodes.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_loaned_sample.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_psmx.h;${_IMPORT_PREFIX}/include/dds//ddsc/dds_data_type_properties.h;${_IMPORT_PREFIX}/include/dds/ddsc/dds_public_dynamic_type.h;${_IMPORT_PREFIX}/include/dds/export.h"
+  TOPIC_DISCOVERY_IS_AVAILABLE "ON"
+  TYPELIB_IS_AVAILABLE "ON"
+  TYPE_DISCOVERY_IS_AVAILABLE "ON"
+)
+
+if(CMAKE_VERSION VERSION_LESS 3.1.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.1.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/CycloneDDSTargets-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
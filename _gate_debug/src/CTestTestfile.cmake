@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_gate_debug/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ucunit")
+subdirs("tools")
+subdirs("ddsrt")
+subdirs("idl")
+subdirs("security")
+subdirs("core")
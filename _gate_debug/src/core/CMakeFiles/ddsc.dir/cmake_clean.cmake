@@ -0,0 +1,353 @@
+file(REMOVE_RECURSE
+  "../../lib/libddsc.pdb"
+  "../../lib/libddsc.so"
+  "../../lib/libddsc.so.0"
+  "../../lib/libddsc.so.0.11.0"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/atomics.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/atomics.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/avl.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/avl.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/bits.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/bits.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/bswap.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/bswap.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/cdtors.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/cdtors.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/circlist.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/circlist.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/dynlib/posix/dynlib.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/dynlib/posix/dynlib.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/environ.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/environ.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/environ/posix/environ.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/environ/posix/environ.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/expand_vars.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/expand_vars.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/fibheap.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/fibheap.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/filesystem/posix/filesystem.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/filesystem/posix/filesystem.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/heap/posix/heap.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/heap/posix/heap.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/hopscotch.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/hopscotch.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs/posix/ifaddrs.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs/posix/ifaddrs.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/io.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/io.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/log.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/log.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/md5.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/md5.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/mh3.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/mh3.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/netstat/linux/netstat.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/netstat/linux/netstat.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/process/posix/process.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/process/posix/process.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/random.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/random.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/random/posix/random.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/random/posix/random.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/retcode.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/retcode.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/rusage/posix/rusage.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/rusage/posix/rusage.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/gethostname.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/gethostname.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/socket.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/socket.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/string.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/string.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/strtod.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/strtod.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/strtol.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/strtol.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sync/posix/sync.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/sync/posix/sync.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/threads.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/threads.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/threads/posix/threads.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/threads/posix/threads.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/time.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/time.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/time/posix/time.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/time/posix/time.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/timerwheel.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/timerwheel.c.o.d"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/xmlparser.c.o"
+  "CMakeFiles/ddsc.dir/__/ddsrt/src/xmlparser.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_fsm.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_fsm.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_plugins.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_plugins.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_serialize.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_serialize.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_shared_secret.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_shared_secret.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_timed_cb.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_timed_cb.c.o.d"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_utils.c.o"
+  "CMakeFiles/ddsc.dir/__/security/core/src/dds_security_utils.c.o.d"
+  "CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream.c.o"
+  "CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_alloc.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_alloc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_builtin.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_builtin.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_coherent.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_coherent.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_domain.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_domain.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_dynamic_type.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_dynamic_type.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_entity.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_entity.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_guardcond.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_guardcond.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_handles.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_handles.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_heap_loan.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_heap_loan.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_init.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_init.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_instance.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_instance.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_listener.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_listener.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_loaned_sample.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_loaned_sample.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_matched.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_matched.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_participant.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_participant.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_psmx.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_psmx.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_publisher.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_publisher.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_qos.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_qos.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_querycond.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_querycond.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_read.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_read.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_readcond.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_readcond.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_reader.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_reader.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_rhc.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_rhc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_default.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_default.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_builtintopic.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_builtintopic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_default.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_default.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_builtintopic.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_builtintopic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_default.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_default.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_statistics.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_statistics.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_subscriber.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_subscriber.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_topic.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_topic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_waitset.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_waitset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_whc.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_whc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_whc_builtintopic.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_whc_builtintopic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_write.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_write.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_writer.c.o"
+  "CMakeFiles/ddsc.dir/ddsc/src/dds_writer.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/defconfig.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/defconfig.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_acknack.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_acknack.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_addrset.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_addrset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_bitset.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_bitset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_bswap.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_bswap.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_config.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_config.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_crypto_pool.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_crypto_pool.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_deadline.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_deadline.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_debmon.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_debmon.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_deliver_locally.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_deliver_locally.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_addrset.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_addrset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_cache.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_cache.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_endpoint.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_endpoint.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_spdp.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_spdp.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_topic.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery_topic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_dynamic_type.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_dynamic_type.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint_match.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint_match.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity_index.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity_index.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_eth.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_eth.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_freelist.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_freelist.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_gc.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_gc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_guid.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_guid.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_handshake.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_handshake.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_hbcontrol.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_hbcontrol.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_iid.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_iid.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_init.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_init.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_inverse_uint32_set.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_inverse_uint32_set.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_ipaddr.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_ipaddr.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lat_estim.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lat_estim.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lease.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lease.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lifespan.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_lifespan.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_list_genptr.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_list_genptr.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_mcgroup.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_mcgroup.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_misc.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_misc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwinterfaces.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwinterfaces.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwpart.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwpart.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_participant.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_participant.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_pcap.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_pcap.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_plist.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_plist.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_pmd.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_pmd.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_portmapping.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_portmapping.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_endpoint.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_endpoint.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_participant.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_participant.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_qosmatch.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_qosmatch.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_radmin.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_radmin.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_raweth.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_raweth.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_receive.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_receive.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_rhc.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_rhc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_exchange.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_exchange.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_msg.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_msg.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_omg.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_omg.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_util.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_util.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_cdr.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_cdr.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_plist.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_plist.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_pserop.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_pserop.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_cdr.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_cdr.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_plist.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_plist.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_pserop.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_pserop.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sockwaitset.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sockwaitset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_ssl.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_ssl.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_statistics.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_statistics.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sysdeps.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_sysdeps.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tcp.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tcp.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_thread.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_thread.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_threadmon.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_threadmon.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_time.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_time.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tkmap.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tkmap.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_topic.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_topic.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tran.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_tran.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_transmit.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_transmit.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typebuilder.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typebuilder.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelib.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelib.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelookup.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelookup.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typewrap.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_typewrap.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_udp.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_udp.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_vendor.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_vendor.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_vnet.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_vnet.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_whc.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_whc.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_wraddrset.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_wraddrset.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xevent.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xevent.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xmsg.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xmsg.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typeinfo.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typeinfo.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typelookup.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typelookup.c.o.d"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typemap.c.o"
+  "CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typemap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ddsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
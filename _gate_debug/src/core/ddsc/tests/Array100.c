@@ -0,0 +1,63 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/Array100.c
+  Source: /root/repo/src/core/ddsc/tests/Array100.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "Array100.h"
+
+static const uint32_t Array100_ops [] =
+{
+  /* Array100 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Array100, data), 100u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 08204597aceee64c5e1be69c1e4f] (#deps: 0)
+  [COMPLETE 47f1aca1697c7dd627796382af90] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Array100 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x08, 0x20, 0x45, 0x97, 0xac, 0xee, 0xe6, 0x4c, 0x5e, 0x1b, 0xe6, \
+  0x9c, 0x1e, 0x4f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x47, 0xf1, 0xac, 0xa1, 0x69, 0x7c, 0x7d, 0xd6, 0x27, 0x79, 0x63, \
+  0x82, 0xaf, 0x90, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Array100 100u
+#define TYPE_MAP_CDR_Array100 (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x08, 0x20, 0x45, 0x97, 0xac, 0xee, 0xe6, \
+  0x4c, 0x5e, 0x1b, 0xe6, 0x9c, 0x1e, 0x4f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x64, 0x02, 0x8d, 0x77, 0x7f, 0x38, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x47, 0xf1, 0xac, 0xa1, 0x69, 0x7c, 0x7d, 0xd6, 0x27, 0x79, 0x63, \
+  0x82, 0xaf, 0x90, 0x00, 0x47, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x41, 0x72, 0x72, 0x61, 0x79, 0x31, 0x30, 0x30, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x64, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x47, 0xf1, 0xac, 0xa1, 0x69, 0x7c, 0x7d, \
+  0xd6, 0x27, 0x79, 0x63, 0x82, 0xaf, 0x90, 0xf1, 0x08, 0x20, 0x45, 0x97, 0xac, 0xee, 0xe6, 0x4c, \
+  0x5e, 0x1b, 0xe6, 0x9c, 0x1e, 0x4f\
+}
+#define TYPE_MAP_CDR_SZ_Array100 214u
+const dds_topic_descriptor_t Array100_desc =
+{
+  .m_size = sizeof (Array100),
+  .m_align = dds_alignof (Array100),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Array100",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = Array100_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Array100, .sz = TYPE_INFO_CDR_SZ_Array100 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Array100, .sz = TYPE_MAP_CDR_SZ_Array100 }
+};
+
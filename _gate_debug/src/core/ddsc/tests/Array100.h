@@ -0,0 +1,35 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/Array100.h
+  Source: /root/repo/src/core/ddsc/tests/Array100.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_ARRAY100_H_4E5D646FD47CCCAAF9D9E9FD76615BF0
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_ARRAY100_H_4E5D646FD47CCCAAF9D9E9FD76615BF0
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Array100
+{
+  uint8_t data[100];
+} Array100;
+
+extern const dds_topic_descriptor_t Array100_desc;
+
+#define Array100__alloc() \
+((Array100*) dds_alloc (sizeof (Array100)));
+
+#define Array100_free(d,o) \
+dds_sample_free ((d), &Array100_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_ARRAY100_H_4E5D646FD47CCCAAF9D9E9FD76615BF0 */
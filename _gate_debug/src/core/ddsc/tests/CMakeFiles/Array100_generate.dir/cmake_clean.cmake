@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "Array100.c"
+  "Array100.h"
+  "CMakeFiles/Array100_generate"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Array100_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
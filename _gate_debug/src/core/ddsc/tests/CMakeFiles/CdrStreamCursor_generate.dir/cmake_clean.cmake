@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamCursor_generate"
+  "CdrStreamCursor.c"
+  "CdrStreamCursor.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamCursor_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
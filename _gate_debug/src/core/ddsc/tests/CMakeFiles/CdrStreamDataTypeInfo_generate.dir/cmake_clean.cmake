@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamDataTypeInfo_generate"
+  "CdrStreamDataTypeInfo.c"
+  "CdrStreamDataTypeInfo.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamDataTypeInfo_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
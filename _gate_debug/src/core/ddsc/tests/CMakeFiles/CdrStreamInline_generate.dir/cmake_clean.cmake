@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamInline_generate"
+  "CdrStreamInline.c"
+  "CdrStreamInline.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamInline_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
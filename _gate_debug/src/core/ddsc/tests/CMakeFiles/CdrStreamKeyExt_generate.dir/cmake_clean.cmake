@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamKeyExt_generate"
+  "CdrStreamKeyExt.c"
+  "CdrStreamKeyExt.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamKeyExt_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamKeySize_generate"
+  "CdrStreamKeySize.c"
+  "CdrStreamKeySize.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamKeySize_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamLarge_generate"
+  "CdrStreamLarge.c"
+  "CdrStreamLarge.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamLarge_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
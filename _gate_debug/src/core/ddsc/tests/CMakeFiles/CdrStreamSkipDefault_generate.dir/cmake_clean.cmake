@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamSkipDefault_generate"
+  "CdrStreamSkipDefault.c"
+  "CdrStreamSkipDefault.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamSkipDefault_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CreateWriter_generate"
+  "CreateWriter.c"
+  "CreateWriter.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CreateWriter_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
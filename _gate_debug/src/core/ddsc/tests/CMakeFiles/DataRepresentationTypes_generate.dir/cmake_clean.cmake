@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DataRepresentationTypes_generate"
+  "DataRepresentationTypes.c"
+  "DataRepresentationTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DataRepresentationTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
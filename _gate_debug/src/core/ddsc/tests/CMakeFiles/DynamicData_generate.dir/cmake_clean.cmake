@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynamicData_generate"
+  "DynamicData.c"
+  "DynamicData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DynamicData_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynamicTypeTypes_generate"
+  "DynamicTypeTypes.c"
+  "DynamicTypeTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/DynamicTypeTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InstanceHandleTypes_generate"
+  "InstanceHandleTypes.c"
+  "InstanceHandleTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/InstanceHandleTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
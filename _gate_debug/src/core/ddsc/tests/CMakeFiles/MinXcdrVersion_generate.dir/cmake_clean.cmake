@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MinXcdrVersion_generate"
+  "MinXcdrVersion.c"
+  "MinXcdrVersion.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/MinXcdrVersion_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PsmxDataModels_generate"
+  "PsmxDataModels.c"
+  "PsmxDataModels.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/PsmxDataModels_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
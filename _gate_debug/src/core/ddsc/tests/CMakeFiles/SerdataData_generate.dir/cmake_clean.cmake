@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SerdataData_generate"
+  "SerdataData.c"
+  "SerdataData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/SerdataData_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
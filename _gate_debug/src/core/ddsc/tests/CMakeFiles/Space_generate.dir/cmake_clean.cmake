@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Space_generate"
+  "Space.c"
+  "Space.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Space_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
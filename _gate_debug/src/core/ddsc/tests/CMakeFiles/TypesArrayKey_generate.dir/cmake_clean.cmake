@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TypesArrayKey_generate"
+  "TypesArrayKey.c"
+  "TypesArrayKey.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/TypesArrayKey_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WriteTypes_generate"
+  "WriteTypes.c"
+  "WriteTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/WriteTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
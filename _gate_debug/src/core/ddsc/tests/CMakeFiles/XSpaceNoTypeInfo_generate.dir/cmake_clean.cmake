@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XSpaceNoTypeInfo_generate"
+  "XSpaceNoTypeInfo.c"
+  "XSpaceNoTypeInfo.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/XSpaceNoTypeInfo_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,153 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Array100.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/Array100.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/Array100.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamCursor.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamCursor.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamCursor.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamDataTypeInfo.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamDataTypeInfo.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamDataTypeInfo.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamInline.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamInline.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamInline.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeyExt.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamKeyExt.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamKeyExt.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeySize.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamKeySize.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamKeySize.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamLarge.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamLarge.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamLarge.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamOptimize.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamOptimize.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamOptimize.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamSkipDefault.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamSkipDefault.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CdrStreamSkipDefault.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CreateWriter.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CreateWriter.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/CreateWriter.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DataRepresentationTypes.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DataRepresentationTypes.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DataRepresentationTypes.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicData.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DynamicData.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DynamicData.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicTypeTypes.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DynamicTypeTypes.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DynamicTypeTypes.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/InstanceHandleTypes.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/InstanceHandleTypes.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/InstanceHandleTypes.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/MinXcdrVersion.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/MinXcdrVersion.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/MinXcdrVersion.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/PsmxDataModels.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/PsmxDataModels.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/PsmxDataModels.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RWData.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/RWData.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/RWData.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/RoundTrip.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/RoundTrip.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/SerdataData.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/SerdataData.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/SerdataData.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Space.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/Space.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/Space.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/TypeBuilderTypes.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/TypeBuilderTypes.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/TypeBuilderTypes.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/TypesArrayKey.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/TypesArrayKey.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/TypesArrayKey.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/WriteTypes.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/WriteTypes.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/WriteTypes.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpace.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpace.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpace.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceEnum.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceEnum.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceEnum.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceMustUnderstand.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceMustUnderstand.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceMustUnderstand.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceNoTypeInfo.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceNoTypeInfo.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceNoTypeInfo.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceTypeConsistencyEnforcement.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/XSpaceTypeConsistencyEnforcement.c.o.d"
+  "/root/repo/src/core/ddsc/tests/asymdisconnect.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/asymdisconnect.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/asymdisconnect.c.o.d"
+  "/root/repo/src/core/ddsc/tests/basic.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/basic.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/basic.c.o.d"
+  "/root/repo/src/core/ddsc/tests/builtin_topics.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/builtin_topics.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/builtin_topics.c.o.d"
+  "/root/repo/src/core/ddsc/tests/cdr.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cdr.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cdr.c.o.d"
+  "/root/repo/src/core/ddsc/tests/cdrstream.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cdrstream.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cdrstream.c.o.d"
+  "/root/repo/src/core/ddsc/tests/config.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/config.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/config.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/cunit_ddsc.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cunit_ddsc.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/cunit_ddsc.c.o.d"
+  "/root/repo/src/core/ddsc/tests/data_avail_stress.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/data_avail_stress.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/data_avail_stress.c.o.d"
+  "/root/repo/src/core/ddsc/tests/data_representation.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/data_representation.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/data_representation.c.o.d"
+  "/root/repo/src/core/ddsc/tests/deadline.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/deadline.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/deadline.c.o.d"
+  "/root/repo/src/core/ddsc/tests/destorder.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/destorder.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/destorder.c.o.d"
+  "/root/repo/src/core/ddsc/tests/discstress.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/discstress.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/discstress.c.o.d"
+  "/root/repo/src/core/ddsc/tests/dispose.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/dispose.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/dispose.c.o.d"
+  "/root/repo/src/core/ddsc/tests/domain.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/domain.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/domain.c.o.d"
+  "/root/repo/src/core/ddsc/tests/domain_torture.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/domain_torture.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/domain_torture.c.o.d"
+  "/root/repo/src/core/ddsc/tests/dynamic_type.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/dynamic_type.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/dynamic_type.c.o.d"
+  "/root/repo/src/core/ddsc/tests/entity_api.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_api.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_api.c.o.d"
+  "/root/repo/src/core/ddsc/tests/entity_hierarchy.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_hierarchy.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_hierarchy.c.o.d"
+  "/root/repo/src/core/ddsc/tests/entity_status.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_status.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/entity_status.c.o.d"
+  "/root/repo/src/core/ddsc/tests/filter.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/filter.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/filter.c.o.d"
+  "/root/repo/src/core/ddsc/tests/guardcondition.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/guardcondition.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/guardcondition.c.o.d"
+  "/root/repo/src/core/ddsc/tests/instance_get_key.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/instance_get_key.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/instance_get_key.c.o.d"
+  "/root/repo/src/core/ddsc/tests/instance_handle.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/instance_handle.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/instance_handle.c.o.d"
+  "/root/repo/src/core/ddsc/tests/lifespan.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/lifespan.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/lifespan.c.o.d"
+  "/root/repo/src/core/ddsc/tests/listener.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/listener.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/listener.c.o.d"
+  "/root/repo/src/core/ddsc/tests/liveliness.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/liveliness.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/liveliness.c.o.d"
+  "/root/repo/src/core/ddsc/tests/loan.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/loan.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/loan.c.o.d"
+  "/root/repo/src/core/ddsc/tests/multi_sertype.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/multi_sertype.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/multi_sertype.c.o.d"
+  "/root/repo/src/core/ddsc/tests/nwpart.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/nwpart.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/nwpart.c.o.d"
+  "/root/repo/src/core/ddsc/tests/participant.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/participant.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/participant.c.o.d"
+  "/root/repo/src/core/ddsc/tests/pp_lease_dur.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/pp_lease_dur.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/pp_lease_dur.c.o.d"
+  "/root/repo/src/core/ddsc/tests/psmx.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/psmx.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/psmx.c.o.d"
+  "/root/repo/src/core/ddsc/tests/publisher.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/publisher.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/publisher.c.o.d"
+  "/root/repo/src/core/ddsc/tests/qos.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/qos.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/qos.c.o.d"
+  "/root/repo/src/core/ddsc/tests/qosmatch.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/qosmatch.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/qosmatch.c.o.d"
+  "/root/repo/src/core/ddsc/tests/querycondition.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/querycondition.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/querycondition.c.o.d"
+  "/root/repo/src/core/ddsc/tests/read_instance.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/read_instance.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/read_instance.c.o.d"
+  "/root/repo/src/core/ddsc/tests/readcollect.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/readcollect.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/readcollect.c.o.d"
+  "/root/repo/src/core/ddsc/tests/readcondition.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/readcondition.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/readcondition.c.o.d"
+  "/root/repo/src/core/ddsc/tests/reader.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/reader.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/reader.c.o.d"
+  "/root/repo/src/core/ddsc/tests/reader_iterator.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/reader_iterator.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/reader_iterator.c.o.d"
+  "/root/repo/src/core/ddsc/tests/redundantnw.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/redundantnw.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/redundantnw.c.o.d"
+  "/root/repo/src/core/ddsc/tests/register.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/register.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/register.c.o.d"
+  "/root/repo/src/core/ddsc/tests/serdata_keys.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/serdata_keys.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/serdata_keys.c.o.d"
+  "/root/repo/src/core/ddsc/tests/subscriber.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/subscriber.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/subscriber.c.o.d"
+  "/root/repo/src/core/ddsc/tests/take_instance.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/take_instance.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/take_instance.c.o.d"
+  "/root/repo/src/core/ddsc/tests/test_common.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_common.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_common.c.o.d"
+  "/root/repo/src/core/ddsc/tests/test_oneliner.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_oneliner.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_oneliner.c.o.d"
+  "/root/repo/src/core/ddsc/tests/test_util.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_util.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/test_util.c.o.d"
+  "/root/repo/src/core/ddsc/tests/time.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/time.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/time.c.o.d"
+  "/root/repo/src/core/ddsc/tests/time_based_filter.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/time_based_filter.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/time_based_filter.c.o.d"
+  "/root/repo/src/core/ddsc/tests/topic.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic.c.o.d"
+  "/root/repo/src/core/ddsc/tests/topic_discovery.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_discovery.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_discovery.c.o.d"
+  "/root/repo/src/core/ddsc/tests/topic_find_global.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_find_global.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_find_global.c.o.d"
+  "/root/repo/src/core/ddsc/tests/topic_find_local.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_find_local.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/topic_find_local.c.o.d"
+  "/root/repo/src/core/ddsc/tests/transientlocal.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/transientlocal.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/transientlocal.c.o.d"
+  "/root/repo/src/core/ddsc/tests/typebuilder.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/typebuilder.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/typebuilder.c.o.d"
+  "/root/repo/src/core/ddsc/tests/types.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/types.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/types.c.o.d"
+  "/root/repo/src/core/ddsc/tests/uninitialized.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/uninitialized.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/uninitialized.c.o.d"
+  "/root/repo/src/core/ddsc/tests/unregister.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/unregister.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/unregister.c.o.d"
+  "/root/repo/src/core/ddsc/tests/unsupported.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/unsupported.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/unsupported.c.o.d"
+  "/root/repo/src/core/ddsc/tests/userdata.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/userdata.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/userdata.c.o.d"
+  "/root/repo/src/core/ddsc/tests/waitset.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/waitset.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/waitset.c.o.d"
+  "/root/repo/src/core/ddsc/tests/waitset_torture.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/waitset_torture.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/waitset_torture.c.o.d"
+  "/root/repo/src/core/ddsc/tests/whc.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/whc.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/whc.c.o.d"
+  "/root/repo/src/core/ddsc/tests/write.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/write.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/write.c.o.d"
+  "/root/repo/src/core/ddsc/tests/write_various_types.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/write_various_types.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/write_various_types.c.o.d"
+  "/root/repo/src/core/ddsc/tests/writer.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/writer.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/writer.c.o.d"
+  "/root/repo/src/core/ddsc/tests/xtypes_assignability.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_assignability.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_assignability.c.o.d"
+  "/root/repo/src/core/ddsc/tests/xtypes_common.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_common.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_common.c.o.d"
+  "/root/repo/src/core/ddsc/tests/xtypes_typeinfo.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_typeinfo.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_typeinfo.c.o.d"
+  "/root/repo/src/core/ddsc/tests/xtypes_typelookup.c" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_typelookup.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/xtypes_typelookup.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Array100.h" "/root/repo/_gate_debug/src/core/ddsc/tests/Array100.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamCursor.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamCursor.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamDataTypeInfo.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamDataTypeInfo.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamInline.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamInline.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeyExt.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeyExt.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeySize.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeySize.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamLarge.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamLarge.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamOptimize.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamOptimize.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamSkipDefault.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamSkipDefault.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/CreateWriter.h" "/root/repo/_gate_debug/src/core/ddsc/tests/CreateWriter.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DataRepresentationTypes.h" "/root/repo/_gate_debug/src/core/ddsc/tests/DataRepresentationTypes.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicData.h" "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicData.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicTypeTypes.h" "/root/repo/_gate_debug/src/core/ddsc/tests/DynamicTypeTypes.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/InstanceHandleTypes.h" "/root/repo/_gate_debug/src/core/ddsc/tests/InstanceHandleTypes.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/MinXcdrVersion.h" "/root/repo/_gate_debug/src/core/ddsc/tests/MinXcdrVersion.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/PsmxDataModels.h" "/root/repo/_gate_debug/src/core/ddsc/tests/PsmxDataModels.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RWData.h" "/root/repo/_gate_debug/src/core/ddsc/tests/RWData.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.h" "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/SerdataData.h" "/root/repo/_gate_debug/src/core/ddsc/tests/SerdataData.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Space.h" "/root/repo/_gate_debug/src/core/ddsc/tests/Space.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/TypeBuilderTypes.h" "/root/repo/_gate_debug/src/core/ddsc/tests/TypeBuilderTypes.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/TypesArrayKey.h" "/root/repo/_gate_debug/src/core/ddsc/tests/TypesArrayKey.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/WriteTypes.h" "/root/repo/_gate_debug/src/core/ddsc/tests/WriteTypes.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpace.h" "/root/repo/_gate_debug/src/core/ddsc/tests/XSpace.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceEnum.h" "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceEnum.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceMustUnderstand.h" "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceMustUnderstand.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceNoTypeInfo.h" "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceNoTypeInfo.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.h" "/root/repo/_gate_debug/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/ucunit/CMakeFiles/ucunit.dir/DependInfo.cmake"
+  "/root/repo/_gate_debug/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
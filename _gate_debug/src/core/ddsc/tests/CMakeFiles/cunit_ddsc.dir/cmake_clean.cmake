@@ -0,0 +1,265 @@
+file(REMOVE_RECURSE
+  "../../../../bin/cunit_ddsc"
+  "../../../../bin/cunit_ddsc.pdb"
+  "Array100.c"
+  "Array100.h"
+  "CMakeFiles/cunit_ddsc.dir/Array100.c.o"
+  "CMakeFiles/cunit_ddsc.dir/Array100.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamCursor.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamCursor.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamDataTypeInfo.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamDataTypeInfo.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamInline.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamInline.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamKeyExt.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamKeyExt.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamKeySize.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamKeySize.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamLarge.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamLarge.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamOptimize.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamOptimize.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamSkipDefault.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CdrStreamSkipDefault.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/CreateWriter.c.o"
+  "CMakeFiles/cunit_ddsc.dir/CreateWriter.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/DataRepresentationTypes.c.o"
+  "CMakeFiles/cunit_ddsc.dir/DataRepresentationTypes.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/DynamicData.c.o"
+  "CMakeFiles/cunit_ddsc.dir/DynamicData.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/DynamicTypeTypes.c.o"
+  "CMakeFiles/cunit_ddsc.dir/DynamicTypeTypes.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/InstanceHandleTypes.c.o"
+  "CMakeFiles/cunit_ddsc.dir/InstanceHandleTypes.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/MinXcdrVersion.c.o"
+  "CMakeFiles/cunit_ddsc.dir/MinXcdrVersion.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/PsmxDataModels.c.o"
+  "CMakeFiles/cunit_ddsc.dir/PsmxDataModels.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/RWData.c.o"
+  "CMakeFiles/cunit_ddsc.dir/RWData.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/RoundTrip.c.o"
+  "CMakeFiles/cunit_ddsc.dir/RoundTrip.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/SerdataData.c.o"
+  "CMakeFiles/cunit_ddsc.dir/SerdataData.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/Space.c.o"
+  "CMakeFiles/cunit_ddsc.dir/Space.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/TypeBuilderTypes.c.o"
+  "CMakeFiles/cunit_ddsc.dir/TypeBuilderTypes.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/TypesArrayKey.c.o"
+  "CMakeFiles/cunit_ddsc.dir/TypesArrayKey.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/WriteTypes.c.o"
+  "CMakeFiles/cunit_ddsc.dir/WriteTypes.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/XSpace.c.o"
+  "CMakeFiles/cunit_ddsc.dir/XSpace.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceEnum.c.o"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceEnum.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceMustUnderstand.c.o"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceMustUnderstand.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceNoTypeInfo.c.o"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceNoTypeInfo.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceTypeConsistencyEnforcement.c.o"
+  "CMakeFiles/cunit_ddsc.dir/XSpaceTypeConsistencyEnforcement.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/asymdisconnect.c.o"
+  "CMakeFiles/cunit_ddsc.dir/asymdisconnect.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/basic.c.o"
+  "CMakeFiles/cunit_ddsc.dir/basic.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/builtin_topics.c.o"
+  "CMakeFiles/cunit_ddsc.dir/builtin_topics.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/cdr.c.o"
+  "CMakeFiles/cunit_ddsc.dir/cdr.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/cdrstream.c.o"
+  "CMakeFiles/cunit_ddsc.dir/cdrstream.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/config.c.o"
+  "CMakeFiles/cunit_ddsc.dir/config.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/cunit_ddsc.c.o"
+  "CMakeFiles/cunit_ddsc.dir/cunit_ddsc.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/data_avail_stress.c.o"
+  "CMakeFiles/cunit_ddsc.dir/data_avail_stress.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/data_representation.c.o"
+  "CMakeFiles/cunit_ddsc.dir/data_representation.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/deadline.c.o"
+  "CMakeFiles/cunit_ddsc.dir/deadline.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/destorder.c.o"
+  "CMakeFiles/cunit_ddsc.dir/destorder.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/discstress.c.o"
+  "CMakeFiles/cunit_ddsc.dir/discstress.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/dispose.c.o"
+  "CMakeFiles/cunit_ddsc.dir/dispose.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/domain.c.o"
+  "CMakeFiles/cunit_ddsc.dir/domain.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/domain_torture.c.o"
+  "CMakeFiles/cunit_ddsc.dir/domain_torture.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/dynamic_type.c.o"
+  "CMakeFiles/cunit_ddsc.dir/dynamic_type.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/entity_api.c.o"
+  "CMakeFiles/cunit_ddsc.dir/entity_api.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/entity_hierarchy.c.o"
+  "CMakeFiles/cunit_ddsc.dir/entity_hierarchy.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/entity_status.c.o"
+  "CMakeFiles/cunit_ddsc.dir/entity_status.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/filter.c.o"
+  "CMakeFiles/cunit_ddsc.dir/filter.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/guardcondition.c.o"
+  "CMakeFiles/cunit_ddsc.dir/guardcondition.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/instance_get_key.c.o"
+  "CMakeFiles/cunit_ddsc.dir/instance_get_key.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/instance_handle.c.o"
+  "CMakeFiles/cunit_ddsc.dir/instance_handle.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/lifespan.c.o"
+  "CMakeFiles/cunit_ddsc.dir/lifespan.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/listener.c.o"
+  "CMakeFiles/cunit_ddsc.dir/listener.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/liveliness.c.o"
+  "CMakeFiles/cunit_ddsc.dir/liveliness.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/loan.c.o"
+  "CMakeFiles/cunit_ddsc.dir/loan.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/multi_sertype.c.o"
+  "CMakeFiles/cunit_ddsc.dir/multi_sertype.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/nwpart.c.o"
+  "CMakeFiles/cunit_ddsc.dir/nwpart.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/participant.c.o"
+  "CMakeFiles/cunit_ddsc.dir/participant.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/pp_lease_dur.c.o"
+  "CMakeFiles/cunit_ddsc.dir/pp_lease_dur.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/psmx.c.o"
+  "CMakeFiles/cunit_ddsc.dir/psmx.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/publisher.c.o"
+  "CMakeFiles/cunit_ddsc.dir/publisher.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/qos.c.o"
+  "CMakeFiles/cunit_ddsc.dir/qos.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/qosmatch.c.o"
+  "CMakeFiles/cunit_ddsc.dir/qosmatch.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/querycondition.c.o"
+  "CMakeFiles/cunit_ddsc.dir/querycondition.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/read_instance.c.o"
+  "CMakeFiles/cunit_ddsc.dir/read_instance.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/readcollect.c.o"
+  "CMakeFiles/cunit_ddsc.dir/readcollect.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/readcondition.c.o"
+  "CMakeFiles/cunit_ddsc.dir/readcondition.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/reader.c.o"
+  "CMakeFiles/cunit_ddsc.dir/reader.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/reader_iterator.c.o"
+  "CMakeFiles/cunit_ddsc.dir/reader_iterator.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/redundantnw.c.o"
+  "CMakeFiles/cunit_ddsc.dir/redundantnw.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/register.c.o"
+  "CMakeFiles/cunit_ddsc.dir/register.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/serdata_keys.c.o"
+  "CMakeFiles/cunit_ddsc.dir/serdata_keys.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/subscriber.c.o"
+  "CMakeFiles/cunit_ddsc.dir/subscriber.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/take_instance.c.o"
+  "CMakeFiles/cunit_ddsc.dir/take_instance.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/test_common.c.o"
+  "CMakeFiles/cunit_ddsc.dir/test_common.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/test_oneliner.c.o"
+  "CMakeFiles/cunit_ddsc.dir/test_oneliner.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/test_util.c.o"
+  "CMakeFiles/cunit_ddsc.dir/test_util.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/time.c.o"
+  "CMakeFiles/cunit_ddsc.dir/time.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/time_based_filter.c.o"
+  "CMakeFiles/cunit_ddsc.dir/time_based_filter.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/topic.c.o"
+  "CMakeFiles/cunit_ddsc.dir/topic.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/topic_discovery.c.o"
+  "CMakeFiles/cunit_ddsc.dir/topic_discovery.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/topic_find_global.c.o"
+  "CMakeFiles/cunit_ddsc.dir/topic_find_global.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/topic_find_local.c.o"
+  "CMakeFiles/cunit_ddsc.dir/topic_find_local.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/transientlocal.c.o"
+  "CMakeFiles/cunit_ddsc.dir/transientlocal.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/typebuilder.c.o"
+  "CMakeFiles/cunit_ddsc.dir/typebuilder.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/types.c.o"
+  "CMakeFiles/cunit_ddsc.dir/types.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/uninitialized.c.o"
+  "CMakeFiles/cunit_ddsc.dir/uninitialized.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/unregister.c.o"
+  "CMakeFiles/cunit_ddsc.dir/unregister.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/unsupported.c.o"
+  "CMakeFiles/cunit_ddsc.dir/unsupported.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/userdata.c.o"
+  "CMakeFiles/cunit_ddsc.dir/userdata.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/waitset.c.o"
+  "CMakeFiles/cunit_ddsc.dir/waitset.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/waitset_torture.c.o"
+  "CMakeFiles/cunit_ddsc.dir/waitset_torture.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/whc.c.o"
+  "CMakeFiles/cunit_ddsc.dir/whc.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/write.c.o"
+  "CMakeFiles/cunit_ddsc.dir/write.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/write_various_types.c.o"
+  "CMakeFiles/cunit_ddsc.dir/write_various_types.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/writer.c.o"
+  "CMakeFiles/cunit_ddsc.dir/writer.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_assignability.c.o"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_assignability.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_common.c.o"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_common.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_typeinfo.c.o"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_typeinfo.c.o.d"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_typelookup.c.o"
+  "CMakeFiles/cunit_ddsc.dir/xtypes_typelookup.c.o.d"
+  "CdrStreamCursor.c"
+  "CdrStreamCursor.h"
+  "CdrStreamDataTypeInfo.c"
+  "CdrStreamDataTypeInfo.h"
+  "CdrStreamInline.c"
+  "CdrStreamInline.h"
+  "CdrStreamKeyExt.c"
+  "CdrStreamKeyExt.h"
+  "CdrStreamKeySize.c"
+  "CdrStreamKeySize.h"
+  "CdrStreamLarge.c"
+  "CdrStreamLarge.h"
+  "CdrStreamOptimize.c"
+  "CdrStreamOptimize.h"
+  "CdrStreamSkipDefault.c"
+  "CdrStreamSkipDefault.h"
+  "CreateWriter.c"
+  "CreateWriter.h"
+  "DataRepresentationTypes.c"
+  "DataRepresentationTypes.h"
+  "DynamicData.c"
+  "DynamicData.h"
+  "DynamicTypeTypes.c"
+  "DynamicTypeTypes.h"
+  "InstanceHandleTypes.c"
+  "InstanceHandleTypes.h"
+  "MinXcdrVersion.c"
+  "MinXcdrVersion.h"
+  "PsmxDataModels.c"
+  "PsmxDataModels.h"
+  "RWData.c"
+  "RWData.h"
+  "RoundTrip.c"
+  "RoundTrip.h"
+  "SerdataData.c"
+  "SerdataData.h"
+  "Space.c"
+  "Space.h"
+  "TypeBuilderTypes.c"
+  "TypeBuilderTypes.h"
+  "TypesArrayKey.c"
+  "TypesArrayKey.h"
+  "WriteTypes.c"
+  "WriteTypes.h"
+  "XSpace.c"
+  "XSpace.h"
+  "XSpaceEnum.c"
+  "XSpaceEnum.h"
+  "XSpaceMustUnderstand.c"
+  "XSpaceMustUnderstand.h"
+  "XSpaceNoTypeInfo.c"
+  "XSpaceNoTypeInfo.h"
+  "XSpaceTypeConsistencyEnforcement.c"
+  "XSpaceTypeConsistencyEnforcement.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_ddsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.c" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/RoundTrip.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/RoundTrip.c.o.d"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Space.c" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/Space.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/Space.c.o.d"
+  "/root/repo/src/core/ddsc/tests/oneliner.c" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/oneliner.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/oneliner.c.o.d"
+  "/root/repo/src/core/ddsc/tests/test_oneliner.c" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/test_oneliner.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/test_oneliner.c.o.d"
+  "/root/repo/src/core/ddsc/tests/test_util.c" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/test_util.c.o" "gcc" "src/core/ddsc/tests/CMakeFiles/oneliner.dir/test_util.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.h" "/root/repo/_gate_debug/src/core/ddsc/tests/RoundTrip.c"
+  "/root/repo/_gate_debug/src/core/ddsc/tests/Space.h" "/root/repo/_gate_debug/src/core/ddsc/tests/Space.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libpsmx_cdds.pdb"
+  "../../../../lib/libpsmx_cdds.so"
+  "CMakeFiles/psmx_cdds.dir/psmx_cdds_data.c.o"
+  "CMakeFiles/psmx_cdds.dir/psmx_cdds_data.c.o.d"
+  "CMakeFiles/psmx_cdds.dir/psmx_cdds_impl.c.o"
+  "CMakeFiles/psmx_cdds.dir/psmx_cdds_impl.c.o.d"
+  "psmx_cdds_data.c"
+  "psmx_cdds_data.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/psmx_cdds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
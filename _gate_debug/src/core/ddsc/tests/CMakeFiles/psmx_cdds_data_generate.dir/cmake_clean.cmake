@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/psmx_cdds_data_generate"
+  "psmx_cdds_data.c"
+  "psmx_cdds_data.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/psmx_cdds_data_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1666 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/ddsc/tests
+# Build directory: /root/repo/_gate_debug/src/core/ddsc/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddsc_asymdisconnect_reader_keeps_nacking "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_asymdisconnect" "-t" "reader_keeps_nacking")
+set_tests_properties(CUnit_ddsc_asymdisconnect_reader_keeps_nacking PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_basic_test "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_basic" "-t" "test")
+set_tests_properties(CUnit_ddsc_basic_test PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_availability_builtin_topics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "availability_builtin_topics")
+set_tests_properties(CUnit_ddsc_builtin_topics_availability_builtin_topics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_read_publication_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "read_publication_data")
+set_tests_properties(CUnit_ddsc_builtin_topics_read_publication_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_read_subscription_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "read_subscription_data")
+set_tests_properties(CUnit_ddsc_builtin_topics_read_subscription_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_read_participant_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "read_participant_data")
+set_tests_properties(CUnit_ddsc_builtin_topics_read_participant_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_read_topic_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "read_topic_data")
+set_tests_properties(CUnit_ddsc_builtin_topics_read_topic_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_same_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "same_subscriber")
+set_tests_properties(CUnit_ddsc_builtin_topics_same_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_builtin_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "builtin_qos")
+set_tests_properties(CUnit_ddsc_builtin_topics_builtin_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_read_nothing "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "read_nothing")
+set_tests_properties(CUnit_ddsc_builtin_topics_read_nothing PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_topic")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_name "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_name")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_type_name "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_type_name")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_type_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_children "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_children")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_children PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_cant_use_real_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "cant_use_real_topic")
+set_tests_properties(CUnit_ddsc_builtin_topics_cant_use_real_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_qos")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_builtin_topics_get_matched_publication "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_builtin_topics" "-t" "get_matched_publication")
+set_tests_properties(CUnit_ddsc_builtin_topics_get_matched_publication PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "basic")
+set_tests_properties(CUnit_ddsc_cdr_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_forward "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "forward")
+set_tests_properties(CUnit_ddsc_cdr_forward PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_invalid_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "invalid_data")
+set_tests_properties(CUnit_ddsc_cdr_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_timeout "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "timeout")
+set_tests_properties(CUnit_ddsc_cdr_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_forward_conv_serdata "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "forward_conv_serdata")
+set_tests_properties(CUnit_ddsc_cdr_forward_conv_serdata PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdr_forward_equal_type "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdr" "-t" "forward_equal_type")
+set_tests_properties(CUnit_ddsc_cdr_forward_equal_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_simple_udp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "simple_udp")
+set_tests_properties(CUnit_ddsc_config_simple_udp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "CYCLONEDDS_URI=file:///root/repo/src/core/ddsc/tests/config_simple_udp.xml;MAX_PARTICIPANTS=0;LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" REQUIRED_FILES "/root/repo/src/core/ddsc/tests/config_simple_udp.xml" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_user_config "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "user_config")
+set_tests_properties(CUnit_ddsc_config_user_config PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_ignoredpartition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "ignoredpartition")
+set_tests_properties(CUnit_ddsc_config_ignoredpartition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_security_config_empty "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_security_config" "-t" "empty")
+set_tests_properties(CUnit_ddsc_security_config_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_security_qos_empty "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_security_qos" "-t" "empty")
+set_tests_properties(CUnit_ddsc_security_qos_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_invalid_envvar "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "invalid_envvar")
+set_tests_properties(CUnit_ddsc_config_invalid_envvar PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_too_deep_nesting "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "too_deep_nesting")
+set_tests_properties(CUnit_ddsc_config_too_deep_nesting PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_multiple_domains "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "multiple_domains")
+set_tests_properties(CUnit_ddsc_config_multiple_domains PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_bad_configs_listelems "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "bad_configs_listelems")
+set_tests_properties(CUnit_ddsc_config_bad_configs_listelems PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_config_discovery_cache "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_config" "-t" "discovery_cache")
+set_tests_properties(CUnit_ddsc_config_discovery_cache PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_avail_stress_local "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_avail_stress" "-t" "local")
+set_tests_properties(CUnit_ddsc_data_avail_stress_local PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_avail_stress_remote "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_avail_stress" "-t" "remote")
+set_tests_properties(CUnit_ddsc_data_avail_stress_remote PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "15" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_destorder_by_source "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_destorder" "-t" "by_source")
+set_tests_properties(CUnit_ddsc_destorder_by_source PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_destorder_by_reception "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_destorder" "-t" "by_reception")
+set_tests_properties(CUnit_ddsc_destorder_by_reception PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_destorder_by_source_history "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_destorder" "-t" "by_source_history")
+set_tests_properties(CUnit_ddsc_destorder_by_source_history PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_destorder_by_reception_history "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_destorder" "-t" "by_reception_history")
+set_tests_properties(CUnit_ddsc_destorder_by_reception_history PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_discstress_create_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_discstress" "-t" "create_writer")
+set_tests_properties(CUnit_ddsc_discstress_create_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "20" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_writedispose_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "null")
+set_tests_properties(CUnit_ddsc_writedispose_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_writedispose_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_disposing_new_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "disposing_new_instance")
+set_tests_properties(CUnit_ddsc_writedispose_disposing_new_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_timeout "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "timeout")
+set_tests_properties(CUnit_ddsc_writedispose_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_writedispose_ts_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "null")
+set_tests_properties(CUnit_ddsc_writedispose_ts_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_timeout "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "timeout")
+set_tests_properties(CUnit_ddsc_writedispose_ts_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_writedispose_ts_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_disposing_new_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "disposing_new_instance")
+set_tests_properties(CUnit_ddsc_writedispose_ts_disposing_new_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_disposing_past_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "disposing_past_sample")
+set_tests_properties(CUnit_ddsc_writedispose_ts_disposing_past_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_dispose_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "null")
+set_tests_properties(CUnit_ddsc_dispose_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_timeout "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "timeout")
+set_tests_properties(CUnit_ddsc_dispose_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_dispose_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_disposing_new_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "disposing_new_instance")
+set_tests_properties(CUnit_ddsc_dispose_disposing_new_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_dispose_ts_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "null")
+set_tests_properties(CUnit_ddsc_dispose_ts_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_timeout "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "timeout")
+set_tests_properties(CUnit_ddsc_dispose_ts_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_dispose_ts_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_disposing_new_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "disposing_new_instance")
+set_tests_properties(CUnit_ddsc_dispose_ts_disposing_new_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_disposing_past_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "disposing_past_sample")
+set_tests_properties(CUnit_ddsc_dispose_ts_disposing_past_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_dispose_ih_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_dispose_ih_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_disposing_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "disposing_old_instance")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_disposing_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_disposing_past_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "disposing_past_sample")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_disposing_past_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_writedispose_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_writedispose_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_writedispose_ts_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writedispose_ts_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writedispose_ts" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_writedispose_ts_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_dispose_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_dispose_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_dispose_ts_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ts_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ts" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_dispose_ts_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_dispose_ih_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_dispose_ih_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_dispose_ih_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dispose_ih_ts_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dispose_ih_ts" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_dispose_ih_ts_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_get_domainid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "get_domainid")
+set_tests_properties(CUnit_ddsc_domain_get_domainid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_delete_domain0 "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "delete_domain0")
+set_tests_properties(CUnit_ddsc_domain_delete_domain0 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_delete_domainM "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "delete_domainM")
+set_tests_properties(CUnit_ddsc_domain_delete_domainM PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_delete_cyclonedds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "delete_cyclonedds")
+set_tests_properties(CUnit_ddsc_domain_delete_cyclonedds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "valid")
+set_tests_properties(CUnit_ddsc_domain_create_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_mismatch "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "mismatch")
+set_tests_properties(CUnit_ddsc_domain_create_mismatch PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_empty "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "empty")
+set_tests_properties(CUnit_ddsc_domain_create_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "null")
+set_tests_properties(CUnit_ddsc_domain_create_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_after_domain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "after_domain")
+set_tests_properties(CUnit_ddsc_domain_create_after_domain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_after_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "after_participant")
+set_tests_properties(CUnit_ddsc_domain_create_after_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_diff "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "diff")
+set_tests_properties(CUnit_ddsc_domain_create_diff PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_domain_default "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "domain_default")
+set_tests_properties(CUnit_ddsc_domain_create_domain_default PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_invalid_xml "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "invalid_xml")
+set_tests_properties(CUnit_ddsc_domain_create_invalid_xml PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_create_raw_config "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain_create" "-t" "raw_config")
+set_tests_properties(CUnit_ddsc_domain_create_raw_config PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_serdata_pool_statistics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "serdata_pool_statistics")
+set_tests_properties(CUnit_ddsc_domain_serdata_pool_statistics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_torture_implicit "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "torture_implicit")
+set_tests_properties(CUnit_ddsc_domain_torture_implicit PROPERTIES  DISABLED "TRUE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_domain_torture_explicit "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_domain" "-t" "torture_explicit")
+set_tests_properties(CUnit_ddsc_domain_torture_explicit PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_create "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "create")
+set_tests_properties(CUnit_ddsc_entity_create PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_enable "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "enable")
+set_tests_properties(CUnit_ddsc_entity_enable PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "qos")
+set_tests_properties(CUnit_ddsc_entity_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_listener "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "listener")
+set_tests_properties(CUnit_ddsc_entity_listener PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_status "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "status")
+set_tests_properties(CUnit_ddsc_entity_status PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_guid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "guid")
+set_tests_properties(CUnit_ddsc_entity_guid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_instance_handle "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "instance_handle")
+set_tests_properties(CUnit_ddsc_entity_instance_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "get_entities")
+set_tests_properties(CUnit_ddsc_entity_get_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_domainid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "get_domainid")
+set_tests_properties(CUnit_ddsc_entity_get_domainid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_delete "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "delete")
+set_tests_properties(CUnit_ddsc_entity_delete PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_delete_recursive "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_delete" "-t" "recursive")
+set_tests_properties(CUnit_ddsc_entity_delete_recursive PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_delete_recursive_with_deleted_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_delete" "-t" "recursive_with_deleted_topic")
+set_tests_properties(CUnit_ddsc_entity_delete_recursive_with_deleted_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "reader")
+set_tests_properties(CUnit_ddsc_entity_get_parent_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "writer")
+set_tests_properties(CUnit_ddsc_entity_get_parent_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "participant")
+set_tests_properties(CUnit_ddsc_entity_get_parent_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "null")
+set_tests_properties(CUnit_ddsc_entity_get_children_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_invalid_size "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "invalid_size")
+set_tests_properties(CUnit_ddsc_entity_get_children_invalid_size PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_too_small "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "too_small")
+set_tests_properties(CUnit_ddsc_entity_get_children_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "participant")
+set_tests_properties(CUnit_ddsc_entity_get_children_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "topic")
+set_tests_properties(CUnit_ddsc_entity_get_children_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "publisher")
+set_tests_properties(CUnit_ddsc_entity_get_children_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "subscriber")
+set_tests_properties(CUnit_ddsc_entity_get_children_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "writer")
+set_tests_properties(CUnit_ddsc_entity_get_children_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "reader")
+set_tests_properties(CUnit_ddsc_entity_get_children_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_publisher_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_publisher" "-t" "writer")
+set_tests_properties(CUnit_ddsc_entity_get_publisher_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_publisher_deleted_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_publisher" "-t" "deleted_writer")
+set_tests_properties(CUnit_ddsc_entity_get_publisher_deleted_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_implicit_publisher_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_implicit_publisher" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_entity_implicit_publisher_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_implicit_publisher_invalid_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_implicit_publisher" "-t" "invalid_topic")
+set_tests_properties(CUnit_ddsc_entity_implicit_publisher_invalid_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_implicit_subscriber_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_implicit_subscriber" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_entity_implicit_subscriber_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_explicit_subscriber_invalid_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_explicit_subscriber" "-t" "invalid_topic")
+set_tests_properties(CUnit_ddsc_entity_explicit_subscriber_invalid_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_implicit_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "implicit_publisher")
+set_tests_properties(CUnit_ddsc_entity_get_children_implicit_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_implicit_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "implicit_subscriber")
+set_tests_properties(CUnit_ddsc_entity_get_children_implicit_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_implicit_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "implicit_publisher")
+set_tests_properties(CUnit_ddsc_entity_get_parent_implicit_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_implicit_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "implicit_subscriber")
+set_tests_properties(CUnit_ddsc_entity_get_parent_implicit_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_implicit_delete_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_implicit" "-t" "delete_publisher")
+set_tests_properties(CUnit_ddsc_entity_implicit_delete_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_implicit_delete_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_implicit" "-t" "delete_subscriber")
+set_tests_properties(CUnit_ddsc_entity_implicit_delete_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_participant_valid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_participant" "-t" "valid_entities")
+set_tests_properties(CUnit_ddsc_entity_get_participant_valid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_participant_deleted_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_participant" "-t" "deleted_entities")
+set_tests_properties(CUnit_ddsc_entity_get_participant_deleted_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_participant_invalid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_participant" "-t" "invalid_entities")
+set_tests_properties(CUnit_ddsc_entity_get_participant_invalid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "conditions")
+set_tests_properties(CUnit_ddsc_entity_get_parent_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_pubsubtop "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "pubsubtop")
+set_tests_properties(CUnit_ddsc_entity_get_parent_pubsubtop PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_deleted_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "deleted_entities")
+set_tests_properties(CUnit_ddsc_entity_get_parent_deleted_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_parent_invalid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_parent" "-t" "invalid_entities")
+set_tests_properties(CUnit_ddsc_entity_get_parent_invalid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "conditions")
+set_tests_properties(CUnit_ddsc_entity_get_children_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_deleted_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "deleted_entities")
+set_tests_properties(CUnit_ddsc_entity_get_children_deleted_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_children_invalid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_children" "-t" "invalid_entities")
+set_tests_properties(CUnit_ddsc_entity_get_children_invalid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_topic_data_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_topic" "-t" "data_entities")
+set_tests_properties(CUnit_ddsc_entity_get_topic_data_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_topic_deleted_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_topic" "-t" "deleted_entities")
+set_tests_properties(CUnit_ddsc_entity_get_topic_deleted_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_topic_invalid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_topic" "-t" "invalid_entities")
+set_tests_properties(CUnit_ddsc_entity_get_topic_invalid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_topic_non_data_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_topic" "-t" "non_data_entities")
+set_tests_properties(CUnit_ddsc_entity_get_topic_non_data_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_publisher_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_publisher" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_entity_get_publisher_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_publisher_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_publisher" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_entity_get_publisher_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_subscriber_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_subscriber" "-t" "readers")
+set_tests_properties(CUnit_ddsc_entity_get_subscriber_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_subscriber_deleted_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_subscriber" "-t" "deleted_readers")
+set_tests_properties(CUnit_ddsc_entity_get_subscriber_deleted_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_subscriber_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_subscriber" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_entity_get_subscriber_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_subscriber_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_subscriber" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_entity_get_subscriber_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_datareader_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_datareader" "-t" "conditions")
+set_tests_properties(CUnit_ddsc_entity_get_datareader_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_datareader_deleted_conds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_datareader" "-t" "deleted_conds")
+set_tests_properties(CUnit_ddsc_entity_get_datareader_deleted_conds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_datareader_invalid_conds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_datareader" "-t" "invalid_conds")
+set_tests_properties(CUnit_ddsc_entity_get_datareader_invalid_conds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_get_datareader_non_conds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_get_datareader" "-t" "non_conds")
+set_tests_properties(CUnit_ddsc_entity_get_datareader_non_conds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_status_publication_matched "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_status" "-t" "publication_matched")
+set_tests_properties(CUnit_ddsc_entity_status_publication_matched PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_status_subscription_matched "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity_status" "-t" "subscription_matched")
+set_tests_properties(CUnit_ddsc_entity_status_subscription_matched PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_incompatible_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "incompatible_qos")
+set_tests_properties(CUnit_ddsc_entity_incompatible_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_liveliness_changed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "liveliness_changed")
+set_tests_properties(CUnit_ddsc_entity_liveliness_changed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_sample_rejected "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "sample_rejected")
+set_tests_properties(CUnit_ddsc_entity_sample_rejected PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_sample_lost "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "sample_lost")
+set_tests_properties(CUnit_ddsc_entity_sample_lost PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_data_available "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "data_available")
+set_tests_properties(CUnit_ddsc_entity_data_available PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_entity_all_data_available "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_entity" "-t" "all_data_available")
+set_tests_properties(CUnit_ddsc_entity_all_data_available PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_enabled_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_enabled_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_enabled_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_enabled_status_illegal "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_enabled_status" "-t" "illegal")
+set_tests_properties(CUnit_ddsc_get_enabled_status_illegal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_set_enabled_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_set_enabled_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_set_enabled_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_set_enabled_status_illegal "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_set_enabled_status" "-t" "illegal")
+set_tests_properties(CUnit_ddsc_set_enabled_status_illegal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_read_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_illegal "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "illegal")
+set_tests_properties(CUnit_ddsc_read_status_illegal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_invalid_status_on_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "invalid_status_on_reader")
+set_tests_properties(CUnit_ddsc_read_status_invalid_status_on_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_invalid_status_on_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "invalid_status_on_writer")
+set_tests_properties(CUnit_ddsc_read_status_invalid_status_on_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_take_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_status_illegal "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_status" "-t" "illegal")
+set_tests_properties(CUnit_ddsc_take_status_illegal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_status_changes_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_status_changes" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_status_changes_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_status_changes_illegal "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_status_changes" "-t" "illegal")
+set_tests_properties(CUnit_ddsc_get_status_changes_illegal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_triggered_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_triggered" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_triggered_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_inconsistent_topic_status_inconsistent_topic_status "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_inconsistent_topic_status" "-t" "inconsistent_topic_status")
+set_tests_properties(CUnit_ddsc_get_inconsistent_topic_status_inconsistent_topic_status PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_inconsistent_topic_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_inconsistent_topic_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_inconsistent_topic_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_inconsistent_topic_status_deleted_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_inconsistent_topic_status" "-t" "deleted_topic")
+set_tests_properties(CUnit_ddsc_get_inconsistent_topic_status_deleted_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_publication_matched_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_publication_matched_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_publication_matched_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_publication_matched_status_deleted_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_publication_matched_status" "-t" "deleted_writer")
+set_tests_properties(CUnit_ddsc_get_publication_matched_status_deleted_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_lost_status_liveliness_lost_status "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_lost_status" "-t" "liveliness_lost_status")
+set_tests_properties(CUnit_ddsc_get_liveliness_lost_status_liveliness_lost_status PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_lost_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_lost_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_liveliness_lost_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_lost_status_deleted_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_lost_status" "-t" "deleted_writer")
+set_tests_properties(CUnit_ddsc_get_liveliness_lost_status_deleted_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_deadline_missed_status_offered_deadline_missed_status "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_deadline_missed_status" "-t" "offered_deadline_missed_status")
+set_tests_properties(CUnit_ddsc_get_offered_deadline_missed_status_offered_deadline_missed_status PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_deadline_missed_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_deadline_missed_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_offered_deadline_missed_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_deadline_missed_status_deleted_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_deadline_missed_status" "-t" "deleted_writer")
+set_tests_properties(CUnit_ddsc_get_offered_deadline_missed_status_deleted_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_incompatible_qos_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_incompatible_qos_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_offered_incompatible_qos_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_incompatible_qos_status_deleted_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_incompatible_qos_status" "-t" "deleted_writer")
+set_tests_properties(CUnit_ddsc_get_offered_incompatible_qos_status_deleted_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_subscription_matched_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_subscription_matched_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_subscription_matched_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_subscription_matched_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_subscription_matched_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_subscription_matched_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_changed_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_changed_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_liveliness_changed_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_changed_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_changed_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_liveliness_changed_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_rejected_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_rejected_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_sample_rejected_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_rejected_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_rejected_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_sample_rejected_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_lost_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_lost_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_sample_lost_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_lost_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_lost_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_sample_lost_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_deadline_missed_status_requested_deadline_missed_status "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_deadline_missed_status" "-t" "requested_deadline_missed_status")
+set_tests_properties(CUnit_ddsc_get_requested_deadline_missed_status_requested_deadline_missed_status PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_deadline_missed_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_deadline_missed_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_requested_deadline_missed_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_deadline_missed_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_deadline_missed_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_requested_deadline_missed_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_incompatible_qos_status_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_incompatible_qos_status" "-t" "null")
+set_tests_properties(CUnit_ddsc_get_requested_incompatible_qos_status_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_incompatible_qos_status_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_incompatible_qos_status" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_get_requested_incompatible_qos_status_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_enabled_status_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_enabled_status" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_get_enabled_status_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_enabled_status_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_enabled_status" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_get_enabled_status_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_set_enabled_status_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_set_enabled_status" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_set_enabled_status_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_set_enabled_status_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_set_enabled_status" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_set_enabled_status_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_read_status_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_status_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_status" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_read_status_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_status_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_status" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_take_status_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_status_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_status" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_take_status_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_status_changes_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_status_changes" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_get_status_changes_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_status_changes_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_status_changes" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_get_status_changes_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_triggered_bad_param "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_triggered" "-t" "bad_param")
+set_tests_properties(CUnit_ddsc_triggered_bad_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_triggered_status_ok "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_triggered" "-t" "status_ok")
+set_tests_properties(CUnit_ddsc_triggered_status_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_inconsistent_topic_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_inconsistent_topic_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_inconsistent_topic_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_inconsistent_topic_status_non_topics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_inconsistent_topic_status" "-t" "non_topics")
+set_tests_properties(CUnit_ddsc_get_inconsistent_topic_status_non_topics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_publication_matched_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_publication_matched_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_publication_matched_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_publication_matched_status_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_publication_matched_status" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_get_publication_matched_status_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_lost_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_lost_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_liveliness_lost_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_lost_status_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_lost_status" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_get_liveliness_lost_status_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_deadline_missed_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_deadline_missed_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_offered_deadline_missed_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_deadline_missed_status_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_deadline_missed_status" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_get_offered_deadline_missed_status_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_incompatible_qos_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_incompatible_qos_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_offered_incompatible_qos_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_offered_incompatible_qos_status_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_offered_incompatible_qos_status" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_get_offered_incompatible_qos_status_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_subscription_matched_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_subscription_matched_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_subscription_matched_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_subscription_matched_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_subscription_matched_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_subscription_matched_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_changed_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_changed_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_liveliness_changed_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_liveliness_changed_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_liveliness_changed_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_liveliness_changed_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_rejected_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_rejected_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_sample_rejected_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_rejected_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_rejected_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_sample_rejected_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_lost_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_lost_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_sample_lost_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_sample_lost_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_sample_lost_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_sample_lost_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_deadline_missed_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_deadline_missed_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_requested_deadline_missed_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_deadline_missed_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_deadline_missed_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_requested_deadline_missed_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_incompatible_qos_status_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_incompatible_qos_status" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_get_requested_incompatible_qos_status_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_get_requested_incompatible_qos_status_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_get_requested_incompatible_qos_status" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_get_requested_incompatible_qos_status_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_filter_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_filter" "-t" "basic")
+set_tests_properties(CUnit_ddsc_filter_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_filter_ownership "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_filter" "-t" "ownership")
+set_tests_properties(CUnit_ddsc_filter_ownership PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_filter_getset_extended "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_filter" "-t" "getset_extended")
+set_tests_properties(CUnit_ddsc_filter_getset_extended PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_filter_sampleinfo "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_filter" "-t" "sampleinfo")
+set_tests_properties(CUnit_ddsc_filter_sampleinfo PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_bad_entity "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "bad_entity")
+set_tests_properties(CUnit_ddsc_instance_get_key_bad_entity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_null_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "null_data")
+set_tests_properties(CUnit_ddsc_instance_get_key_null_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_null_handle "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "null_handle")
+set_tests_properties(CUnit_ddsc_instance_get_key_null_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_registered_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "registered_instance")
+set_tests_properties(CUnit_ddsc_instance_get_key_registered_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_instance_get_key_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_get_key_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_get_key" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_instance_get_key_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_handle_a "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_handle" "-t" "a")
+set_tests_properties(CUnit_ddsc_instance_handle_a PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_instance_handle_md5 "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_instance_handle" "-t" "md5")
+set_tests_properties(CUnit_ddsc_instance_handle_md5 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_create_and_delete "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "create_and_delete")
+set_tests_properties(CUnit_ddsc_listener_create_and_delete PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_reset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "reset")
+set_tests_properties(CUnit_ddsc_listener_reset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_copy "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "copy")
+set_tests_properties(CUnit_ddsc_listener_copy PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_merge "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "merge")
+set_tests_properties(CUnit_ddsc_listener_merge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_getters_setters "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "getters_setters")
+set_tests_properties(CUnit_ddsc_listener_getters_setters PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_propagation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "propagation")
+set_tests_properties(CUnit_ddsc_listener_propagation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_matched "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "matched")
+set_tests_properties(CUnit_ddsc_listener_matched PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_publication_matched "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "publication_matched")
+set_tests_properties(CUnit_ddsc_listener_publication_matched PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_subscription_matched "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "subscription_matched")
+set_tests_properties(CUnit_ddsc_listener_subscription_matched PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_incompatible_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "incompatible_qos")
+set_tests_properties(CUnit_ddsc_listener_incompatible_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_data_available "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "data_available")
+set_tests_properties(CUnit_ddsc_listener_data_available PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_data_available_delete_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "data_available_delete_writer")
+set_tests_properties(CUnit_ddsc_listener_data_available_delete_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_data_available_delete_writer_disposed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "data_available_delete_writer_disposed")
+set_tests_properties(CUnit_ddsc_listener_data_available_delete_writer_disposed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_data_on_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "data_on_readers")
+set_tests_properties(CUnit_ddsc_listener_data_on_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_sample_lost "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "sample_lost")
+set_tests_properties(CUnit_ddsc_listener_sample_lost PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_sample_rejected "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "sample_rejected")
+set_tests_properties(CUnit_ddsc_listener_sample_rejected PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_listener_liveliness_changed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_listener" "-t" "liveliness_changed")
+set_tests_properties(CUnit_ddsc_listener_liveliness_changed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_lease_duration "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "lease_duration")
+set_tests_properties(CUnit_ddsc_liveliness_lease_duration PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_lease_duration_pwr "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "lease_duration_pwr")
+set_tests_properties(CUnit_ddsc_liveliness_lease_duration_pwr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_create_delete_writer_stress "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "create_delete_writer_stress")
+set_tests_properties(CUnit_ddsc_liveliness_create_delete_writer_stress PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "15" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_status_counts "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "status_counts")
+set_tests_properties(CUnit_ddsc_liveliness_status_counts PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_lease_duration_zero_or_one "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "lease_duration_zero_or_one")
+set_tests_properties(CUnit_ddsc_liveliness_lease_duration_zero_or_one PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_listener_vs_getstatus "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "listener_vs_getstatus")
+set_tests_properties(CUnit_ddsc_liveliness_listener_vs_getstatus PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_pmd_count "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "pmd_count")
+set_tests_properties(CUnit_ddsc_liveliness_pmd_count PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_expire_liveliness_kinds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "expire_liveliness_kinds")
+set_tests_properties(CUnit_ddsc_liveliness_expire_liveliness_kinds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_liveliness_assert_liveliness "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_liveliness" "-t" "assert_liveliness")
+set_tests_properties(CUnit_ddsc_liveliness_assert_liveliness PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_loan_bad_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_loan" "-t" "bad_params")
+set_tests_properties(CUnit_ddsc_loan_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_loan_success "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_loan" "-t" "success")
+set_tests_properties(CUnit_ddsc_loan_success PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_loan_take_cleanup "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_loan" "-t" "take_cleanup")
+set_tests_properties(CUnit_ddsc_loan_take_cleanup PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_loan_read_cleanup "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_loan" "-t" "read_cleanup")
+set_tests_properties(CUnit_ddsc_loan_read_cleanup PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_multi_sertype_local "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_multi_sertype" "-t" "local")
+set_tests_properties(CUnit_ddsc_multi_sertype_local PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_multi_sertype_remote "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_multi_sertype" "-t" "remote")
+set_tests_properties(CUnit_ddsc_multi_sertype_remote PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_multi_sertype_local_slowpath "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_multi_sertype" "-t" "local_slowpath")
+set_tests_properties(CUnit_ddsc_multi_sertype_local_slowpath PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_multi_sertype_remote_slowpath "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_multi_sertype" "-t" "remote_slowpath")
+set_tests_properties(CUnit_ddsc_multi_sertype_remote_slowpath PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_multi_sertype_transient_local "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_multi_sertype" "-t" "transient_local")
+set_tests_properties(CUnit_ddsc_multi_sertype_transient_local PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_duplicate "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "duplicate")
+set_tests_properties(CUnit_ddsc_nwpart_duplicate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_mapping_undefined "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "mapping_undefined")
+set_tests_properties(CUnit_ddsc_nwpart_mapping_undefined PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_mapping_multiple "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "mapping_multiple")
+set_tests_properties(CUnit_ddsc_nwpart_mapping_multiple PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_definition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "definition")
+set_tests_properties(CUnit_ddsc_nwpart_definition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_selected_addrs "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "selected_addrs")
+set_tests_properties(CUnit_ddsc_nwpart_selected_addrs PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_nwpart_full_stack_init "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_nwpart" "-t" "full_stack_init")
+set_tests_properties(CUnit_ddsc_nwpart_full_stack_init PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_create_and_delete "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant" "-t" "create_and_delete")
+set_tests_properties(CUnit_ddsc_participant_create_and_delete PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_create_with_no_conf_no_env "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant" "-t" "create_with_no_conf_no_env")
+set_tests_properties(CUnit_ddsc_participant_create_with_no_conf_no_env PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_create_multiple_domains "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant" "-t" "create_multiple_domains")
+set_tests_properties(CUnit_ddsc_participant_create_multiple_domains PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_create_with_conf_no_env "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant" "-t" "create_with_conf_no_env")
+set_tests_properties(CUnit_ddsc_participant_create_with_conf_no_env PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_one "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "one")
+set_tests_properties(CUnit_ddsc_participant_lookup_one PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_multiple "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "multiple")
+set_tests_properties(CUnit_ddsc_participant_lookup_multiple PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_array_too_small "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "array_too_small")
+set_tests_properties(CUnit_ddsc_participant_lookup_array_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_null_zero "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "null_zero")
+set_tests_properties(CUnit_ddsc_participant_lookup_null_zero PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_null_nonzero "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "null_nonzero")
+set_tests_properties(CUnit_ddsc_participant_lookup_null_nonzero PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_unknown_id "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "unknown_id")
+set_tests_properties(CUnit_ddsc_participant_lookup_unknown_id PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_none "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "none")
+set_tests_properties(CUnit_ddsc_participant_lookup_none PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_no_more "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "no_more")
+set_tests_properties(CUnit_ddsc_participant_lookup_no_more PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lookup_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lookup" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_participant_lookup_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lease_duration_invalid_setting "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lease_duration" "-t" "invalid_setting")
+set_tests_properties(CUnit_ddsc_participant_lease_duration_invalid_setting PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lease_duration_builtin_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lease_duration" "-t" "builtin_topic")
+set_tests_properties(CUnit_ddsc_participant_lease_duration_builtin_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lease_duration_expiry "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lease_duration" "-t" "expiry")
+set_tests_properties(CUnit_ddsc_participant_lease_duration_expiry PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_participant_lease_duration_unchanged_spdp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_participant_lease_duration" "-t" "unchanged_spdp")
+set_tests_properties(CUnit_ddsc_participant_lease_duration_unchanged_spdp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_publisher_create "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_publisher" "-t" "create")
+set_tests_properties(CUnit_ddsc_publisher_create PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_publisher_invalid_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_publisher" "-t" "invalid_qos")
+set_tests_properties(CUnit_ddsc_publisher_invalid_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_publisher_suspend_resume "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_publisher" "-t" "suspend_resume")
+set_tests_properties(CUnit_ddsc_publisher_suspend_resume PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_publisher_wait_for_acks "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_publisher" "-t" "wait_for_acks")
+set_tests_properties(CUnit_ddsc_publisher_wait_for_acks PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_publisher_coherency "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_publisher" "-t" "coherency")
+set_tests_properties(CUnit_ddsc_publisher_coherency PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_copy_bad_source "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "copy_bad_source")
+set_tests_properties(CUnit_ddsc_qos_copy_bad_source PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_copy_bad_destination "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "copy_bad_destination")
+set_tests_properties(CUnit_ddsc_qos_copy_bad_destination PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_copy_with_partition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "copy_with_partition")
+set_tests_properties(CUnit_ddsc_qos_copy_with_partition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_userdata "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "userdata")
+set_tests_properties(CUnit_ddsc_qos_userdata PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_topicdata "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "topicdata")
+set_tests_properties(CUnit_ddsc_qos_topicdata PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_groupdata "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "groupdata")
+set_tests_properties(CUnit_ddsc_qos_groupdata PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_durability "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "durability")
+set_tests_properties(CUnit_ddsc_qos_durability PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_history "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "history")
+set_tests_properties(CUnit_ddsc_qos_history PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_resource_limits "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "resource_limits")
+set_tests_properties(CUnit_ddsc_qos_resource_limits PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_presentation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "presentation")
+set_tests_properties(CUnit_ddsc_qos_presentation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_lifespan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "lifespan")
+set_tests_properties(CUnit_ddsc_qos_lifespan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_deadline "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "deadline")
+set_tests_properties(CUnit_ddsc_qos_deadline PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_latency_budget "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "latency_budget")
+set_tests_properties(CUnit_ddsc_qos_latency_budget PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_ownership "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "ownership")
+set_tests_properties(CUnit_ddsc_qos_ownership PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_ownership_strength "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "ownership_strength")
+set_tests_properties(CUnit_ddsc_qos_ownership_strength PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_liveliness "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "liveliness")
+set_tests_properties(CUnit_ddsc_qos_liveliness PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_time_base_filter "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "time_base_filter")
+set_tests_properties(CUnit_ddsc_qos_time_base_filter PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_partition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "partition")
+set_tests_properties(CUnit_ddsc_qos_partition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_reliability "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "reliability")
+set_tests_properties(CUnit_ddsc_qos_reliability PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_transport_priority "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "transport_priority")
+set_tests_properties(CUnit_ddsc_qos_transport_priority PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_destination_order "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "destination_order")
+set_tests_properties(CUnit_ddsc_qos_destination_order PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_writer_data_lifecycle "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "writer_data_lifecycle")
+set_tests_properties(CUnit_ddsc_qos_writer_data_lifecycle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_reader_data_lifecycle "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "reader_data_lifecycle")
+set_tests_properties(CUnit_ddsc_qos_reader_data_lifecycle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_durability_service "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "durability_service")
+set_tests_properties(CUnit_ddsc_qos_durability_service PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_property "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "property")
+set_tests_properties(CUnit_ddsc_qos_property PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_bproperty "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "bproperty")
+set_tests_properties(CUnit_ddsc_qos_bproperty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_property_mixed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "property_mixed")
+set_tests_properties(CUnit_ddsc_qos_property_mixed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qos_type_consistency "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qos" "-t" "type_consistency")
+set_tests_properties(CUnit_ddsc_qos_type_consistency PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qosmatch_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qosmatch" "-t" "basic")
+set_tests_properties(CUnit_ddsc_qosmatch_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qosmatch_partitions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qosmatch" "-t" "partitions")
+set_tests_properties(CUnit_ddsc_qosmatch_partitions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_qosmatch_sedp_templates "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_qosmatch" "-t" "sedp_templates")
+set_tests_properties(CUnit_ddsc_qosmatch_sedp_templates PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_create_second "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_create" "-t" "second")
+set_tests_properties(CUnit_ddsc_querycondition_create_second PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_create_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_create" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_querycondition_create_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_get_mask_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_get_mask" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_querycondition_get_mask_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_get_mask_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_get_mask" "-t" "null")
+set_tests_properties(CUnit_ddsc_querycondition_get_mask_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "any")
+set_tests_properties(CUnit_ddsc_querycondition_read_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_read_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_querycondition_read_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_none "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "none")
+set_tests_properties(CUnit_ddsc_querycondition_read_none PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_with_mask "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "with_mask")
+set_tests_properties(CUnit_ddsc_querycondition_read_with_mask PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_read_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_read" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_querycondition_read_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "any")
+set_tests_properties(CUnit_ddsc_querycondition_take_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_querycondition_take_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_querycondition_take_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_none "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "none")
+set_tests_properties(CUnit_ddsc_querycondition_take_none PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_with_mask "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "with_mask")
+set_tests_properties(CUnit_ddsc_querycondition_take_with_mask PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_querycondition_take_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_take_some_from_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_take" "-t" "some_from_instance")
+set_tests_properties(CUnit_ddsc_querycondition_take_some_from_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_create_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_create" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_querycondition_create_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_create_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_create" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_querycondition_create_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_get_mask_invalid_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_get_mask" "-t" "invalid_conditions")
+set_tests_properties(CUnit_ddsc_querycondition_get_mask_invalid_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_get_mask_non_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_get_mask" "-t" "non_conditions")
+set_tests_properties(CUnit_ddsc_querycondition_get_mask_non_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_querycondition_get_mask_various_masks "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_querycondition_get_mask" "-t" "various_masks")
+set_tests_properties(CUnit_ddsc_querycondition_get_mask_various_masks PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_create_cyclonedds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond_create" "-t" "cyclonedds")
+set_tests_properties(CUnit_ddsc_guardcond_create_cyclonedds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_create_domain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond_create" "-t" "domain")
+set_tests_properties(CUnit_ddsc_guardcond_create_domain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_create_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond_create" "-t" "participant")
+set_tests_properties(CUnit_ddsc_guardcond_create_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_set_trigger "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond" "-t" "set_trigger")
+set_tests_properties(CUnit_ddsc_guardcond_set_trigger PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_take_trigger "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond" "-t" "take_trigger")
+set_tests_properties(CUnit_ddsc_guardcond_take_trigger PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond" "-t" "waitset")
+set_tests_properties(CUnit_ddsc_guardcond_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_guardcond_waitset_thread "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_guardcond" "-t" "waitset_thread")
+set_tests_properties(CUnit_ddsc_guardcond_waitset_thread PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_with_collector_peek "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_with_collector" "-t" "peek")
+set_tests_properties(CUnit_ddsc_read_with_collector_peek PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_with_collector_read "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_with_collector" "-t" "read")
+set_tests_properties(CUnit_ddsc_read_with_collector_read PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_with_collector_take "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_with_collector" "-t" "take")
+set_tests_properties(CUnit_ddsc_read_with_collector_take PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_create_second "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_create" "-t" "second")
+set_tests_properties(CUnit_ddsc_readcondition_create_second PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_create_deleted_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_create" "-t" "deleted_reader")
+set_tests_properties(CUnit_ddsc_readcondition_create_deleted_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_get_mask_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_get_mask" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_readcondition_get_mask_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_get_mask_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_get_mask" "-t" "null")
+set_tests_properties(CUnit_ddsc_readcondition_get_mask_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_read_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_read" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_readcondition_read_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_take_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_take" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_readcondition_take_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_read "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition" "-t" "read")
+set_tests_properties(CUnit_ddsc_readcondition_read PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_take "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition" "-t" "take")
+set_tests_properties(CUnit_ddsc_readcondition_take PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_stress "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition" "-t" "stress")
+set_tests_properties(CUnit_ddsc_readcondition_stress PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_create_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_create" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_readcondition_create_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_create_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_create" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_readcondition_create_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_get_mask_invalid_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_get_mask" "-t" "invalid_conditions")
+set_tests_properties(CUnit_ddsc_readcondition_get_mask_invalid_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_get_mask_non_conditions "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_get_mask" "-t" "non_conditions")
+set_tests_properties(CUnit_ddsc_readcondition_get_mask_non_conditions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_readcondition_get_mask_various_masks "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_readcondition_get_mask" "-t" "various_masks")
+set_tests_properties(CUnit_ddsc_readcondition_get_mask_various_masks PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_invalid_qos_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "invalid_qos_participant")
+set_tests_properties(CUnit_ddsc_reader_create_invalid_qos_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_invalid_qos_subscriber "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "invalid_qos_subscriber")
+set_tests_properties(CUnit_ddsc_reader_create_invalid_qos_subscriber PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_wrong_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "wrong_participant")
+set_tests_properties(CUnit_ddsc_reader_create_wrong_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_participant_mismatch "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "participant_mismatch")
+set_tests_properties(CUnit_ddsc_reader_create_participant_mismatch PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_topic_lifespan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "topic_lifespan")
+set_tests_properties(CUnit_ddsc_reader_create_topic_lifespan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "valid")
+set_tests_properties(CUnit_ddsc_read_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_wl_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_wl" "-t" "valid")
+set_tests_properties(CUnit_ddsc_read_wl_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_mask_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "any")
+set_tests_properties(CUnit_ddsc_read_mask_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_read_mask_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_read_mask_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_read_mask_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_read_mask_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_not_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "not_alive_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_not_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_read_mask_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_mask_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "any")
+set_tests_properties(CUnit_ddsc_read_mask_wl_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_not_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "not_alive_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_not_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_read_mask_wl_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_read_mask_wl_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "valid")
+set_tests_properties(CUnit_ddsc_take_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_wl_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_wl" "-t" "valid")
+set_tests_properties(CUnit_ddsc_take_wl_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_mask_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "any")
+set_tests_properties(CUnit_ddsc_take_mask_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_take_mask_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_take_mask_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_take_mask_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_take_mask_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_not_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "not_alive_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_not_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_take_mask_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_take_instance_last_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "take_instance_last_sample")
+set_tests_properties(CUnit_ddsc_take_mask_take_instance_last_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_mask_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_any "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "any")
+set_tests_properties(CUnit_ddsc_take_mask_wl_any PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_not_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "not_read_sample_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_not_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_read_sample_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "read_sample_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_read_sample_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "new_view_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_not_new_view_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "not_new_view_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_not_new_view_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "alive_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_not_alive_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "not_alive_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_not_alive_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_disposed_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "disposed_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_disposed_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_no_writers_instance_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "no_writers_instance_state")
+set_tests_properties(CUnit_ddsc_take_mask_wl_no_writers_instance_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_combination_of_states "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "combination_of_states")
+set_tests_properties(CUnit_ddsc_take_mask_wl_combination_of_states PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_sample_rank "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "sample_rank")
+set_tests_properties(CUnit_ddsc_read_sample_rank PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_sample_rank "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "sample_rank")
+set_tests_properties(CUnit_ddsc_take_sample_rank PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_peek_plain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_peek" "-t" "plain")
+set_tests_properties(CUnit_ddsc_peek_plain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_peek_mask "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_peek" "-t" "mask")
+set_tests_properties(CUnit_ddsc_peek_mask PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_peek_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_peek" "-t" "instance")
+set_tests_properties(CUnit_ddsc_peek_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_peek_instance_mask "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_peek" "-t" "instance_mask")
+set_tests_properties(CUnit_ddsc_peek_instance_mask PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_peek_next "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_peek" "-t" "next")
+set_tests_properties(CUnit_ddsc_peek_next PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "valid")
+set_tests_properties(CUnit_ddsc_reader_create_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_reader_create_non_participants_non_topics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_reader_create" "-t" "non_participants_non_topics")
+set_tests_properties(CUnit_ddsc_reader_create_non_participants_non_topics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_mask_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_mask_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_mask_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_mask_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_mask_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_mask_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_mask_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_mask_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_mask_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_mask_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_mask_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_mask_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_mask_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_mask_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_mask_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_mask_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_next_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_next_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_next_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_next_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_next_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_next_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_next_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_next_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_next_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_next_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_next_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_next_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_next_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_read_next_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_next_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_next_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_next_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_next_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_next_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_next_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_next_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_next_wl_invalid_buffers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_next_wl" "-t" "invalid_buffers")
+set_tests_properties(CUnit_ddsc_take_next_wl_invalid_buffers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_instance_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_instance_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_instance_mask_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_read_instance_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_read_instance_wl_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_read_instance_mask_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_read_instance_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_read_instance_wl_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_read_instance_mask_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_read_instance_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_read_instance_wl_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_read_instance_mask_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_read_instance_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_read_instance_wl_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_read_instance_mask_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_instance_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_instance_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_instance_mask_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_instance_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_instance_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_instance_mask_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_instance_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_instance_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_instance_mask_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_read_instance_mask_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_read_instance_mask_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_read_instance_mask_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_redundant_networking_uc_data_on_all_intfs "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_redundant_networking" "-t" "uc_data_on_all_intfs")
+set_tests_properties(CUnit_ddsc_redundant_networking_uc_data_on_all_intfs PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_deleted_entity "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "deleted_entity")
+set_tests_properties(CUnit_ddsc_register_instance_deleted_entity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_registering_new_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "registering_new_instance")
+set_tests_properties(CUnit_ddsc_register_instance_registering_new_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_data_already_available "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "data_already_available")
+set_tests_properties(CUnit_ddsc_register_instance_data_already_available PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_register_instance_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_register_instance_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_register_instance_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_register_instance" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_register_instance_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_subscriber_notify_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_subscriber" "-t" "notify_readers")
+set_tests_properties(CUnit_ddsc_subscriber_notify_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_subscriber_create "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_subscriber" "-t" "create")
+set_tests_properties(CUnit_ddsc_subscriber_create PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_subscriber_invalid_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_subscriber" "-t" "invalid_qos")
+set_tests_properties(CUnit_ddsc_subscriber_invalid_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_instance_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_instance_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_instance_mask_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "reader")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_take_instance_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_take_instance_wl_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_take_instance_mask_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "readcondition")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_take_instance_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_take_instance_wl_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_take_instance_mask_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_querycondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "querycondition")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_querycondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_take_instance_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_take_instance_wl_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_take_instance_mask_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_take_instance_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_take_instance_wl_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_take_instance_mask_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_instance_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_instance_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_instance_mask_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_invalid_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "invalid_readers")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_invalid_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_instance_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_instance_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_instance_mask_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_non_readers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "non_readers")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_non_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_instance_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_instance_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_instance_mask_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_take_instance_mask_wl_already_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_take_instance_mask_wl" "-t" "already_deleted")
+set_tests_properties(CUnit_ddsc_take_instance_mask_wl_already_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_request_time "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time" "-t" "request_time")
+set_tests_properties(CUnit_ddsc_time_request_time PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_reception_no_separation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_reception_no_separation")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_reception_no_separation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_reception_separation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_reception_separation")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_reception_separation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_source_no_separation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_source_no_separation")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_source_no_separation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_source_separation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_source_separation")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_source_separation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_reception_invalid_timestamp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_reception_invalid_timestamp")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_reception_invalid_timestamp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_time_based_filter_filter_source_invalid_timestamp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_time_based_filter" "-t" "filter_source_invalid_timestamp")
+set_tests_properties(CUnit_ddsc_time_based_filter_filter_source_invalid_timestamp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_invalid_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "invalid_qos")
+set_tests_properties(CUnit_ddsc_topic_create_invalid_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_non_participants "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "non_participants")
+set_tests_properties(CUnit_ddsc_topic_create_non_participants PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_duplicate "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "duplicate")
+set_tests_properties(CUnit_ddsc_topic_create_duplicate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_same_name "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "same_name")
+set_tests_properties(CUnit_ddsc_topic_create_same_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_recreate "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "recreate")
+set_tests_properties(CUnit_ddsc_topic_create_recreate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_desc_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "desc_null")
+set_tests_properties(CUnit_ddsc_topic_create_desc_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_name_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_name" "-t" "valid")
+set_tests_properties(CUnit_ddsc_topic_get_name_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_name_too_small "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_name" "-t" "too_small")
+set_tests_properties(CUnit_ddsc_topic_get_name_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_name_non_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_name" "-t" "non_topic")
+set_tests_properties(CUnit_ddsc_topic_get_name_non_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_name_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_name" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_topic_get_name_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_type_name_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_type_name" "-t" "valid")
+set_tests_properties(CUnit_ddsc_topic_get_type_name_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_type_name_too_small "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_type_name" "-t" "too_small")
+set_tests_properties(CUnit_ddsc_topic_get_type_name_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_type_name_non_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_type_name" "-t" "non_topic")
+set_tests_properties(CUnit_ddsc_topic_get_type_name_non_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_type_name_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_type_name" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_topic_get_type_name_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_set_qos_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_set_qos" "-t" "valid")
+set_tests_properties(CUnit_ddsc_topic_set_qos_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_set_qos_inconsistent "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_set_qos" "-t" "inconsistent")
+set_tests_properties(CUnit_ddsc_topic_set_qos_inconsistent PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_set_qos_immutable "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_set_qos" "-t" "immutable")
+set_tests_properties(CUnit_ddsc_topic_set_qos_immutable PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "valid")
+set_tests_properties(CUnit_ddsc_topic_create_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_create_invalid_names "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_create" "-t" "invalid_names")
+set_tests_properties(CUnit_ddsc_topic_create_invalid_names PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_name_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_name" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_topic_get_name_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_get_type_name_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_get_type_name" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_topic_get_type_name_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_domain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "domain")
+set_tests_properties(CUnit_ddsc_topic_find_local_domain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_domain_delete_reversed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "domain_delete_reversed")
+set_tests_properties(CUnit_ddsc_topic_find_local_domain_delete_reversed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_domain_delete_pp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "domain_delete_pp")
+set_tests_properties(CUnit_ddsc_topic_find_local_domain_delete_pp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_domain_delete_pp_reversed "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "domain_delete_pp_reversed")
+set_tests_properties(CUnit_ddsc_topic_find_local_domain_delete_pp_reversed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "participant")
+set_tests_properties(CUnit_ddsc_topic_find_local_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_non_participants "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "non_participants")
+set_tests_properties(CUnit_ddsc_topic_find_local_non_participants PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "null")
+set_tests_properties(CUnit_ddsc_topic_find_local_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_unknown "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "unknown")
+set_tests_properties(CUnit_ddsc_topic_find_local_unknown PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_local_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_local" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_topic_find_local_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_transient_local_late_joiner "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_transient_local" "-t" "late_joiner")
+set_tests_properties(CUnit_ddsc_transient_local_late_joiner PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_long_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "long_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_long_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_longlong_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "longlong_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_longlong_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_unsignedshort_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "unsignedshort_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_unsignedshort_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_unsignedlong_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "unsignedlong_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_unsignedlong_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_unsignedlonglong_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "unsignedlonglong_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_unsignedlonglong_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_float_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "float_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_float_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_double_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "double_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_double_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_char_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "char_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_char_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_boolean_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "boolean_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_boolean_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_octet_arraytypekey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "octet_arraytypekey")
+set_tests_properties(CUnit_ddsc_types_octet_arraytypekey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_types_alltypeskey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_types" "-t" "alltypeskey")
+set_tests_properties(CUnit_ddsc_types_alltypeskey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_uninitialized_various "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_uninitialized" "-t" "various")
+set_tests_properties(CUnit_ddsc_uninitialized_various PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_unregister_instance_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "null")
+set_tests_properties(CUnit_ddsc_unregister_instance_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_unregistering_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "unregistering_old_instance")
+set_tests_properties(CUnit_ddsc_unregister_instance_unregistering_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_null "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "null")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_unregistering_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "unregistering_old_instance")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_unregistering_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_unregistering_past_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "unregistering_past_sample")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_unregistering_past_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_unregistering_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih" "-t" "unregistering_old_instance")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_unregistering_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_deleted "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "deleted")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_deleted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_unregistering_old_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "unregistering_old_instance")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_unregistering_old_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_unregistering_past_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "unregistering_past_sample")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_unregistering_past_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_unregistering_instance "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "unregistering_instance")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_unregistering_instance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_dispose_unregistered_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "dispose_unregistered_sample")
+set_tests_properties(CUnit_ddsc_unregister_instance_dispose_unregistered_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_dispose_unregistered_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "dispose_unregistered_sample")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_dispose_unregistered_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ts_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ts" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ts_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_invalid_handles "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "invalid_handles")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_invalid_handles PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_invalid_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "invalid_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_invalid_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unregister_instance_ih_ts_non_writers "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unregister_instance_ih_ts" "-t" "non_writers")
+set_tests_properties(CUnit_ddsc_unregister_instance_ih_ts_non_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unsupported_dds_begin_end_coherent "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unsupported" "-t" "dds_begin_end_coherent")
+set_tests_properties(CUnit_ddsc_unsupported_dds_begin_end_coherent PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unsupported_dds_suspend_resume "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unsupported" "-t" "dds_suspend_resume")
+set_tests_properties(CUnit_ddsc_unsupported_dds_suspend_resume PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unsupported_dds_get_instance_handle "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unsupported" "-t" "dds_get_instance_handle")
+set_tests_properties(CUnit_ddsc_unsupported_dds_get_instance_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_unsupported_dds_set_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_unsupported" "-t" "dds_set_qos")
+set_tests_properties(CUnit_ddsc_unsupported_dds_set_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_userdata_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_userdata" "-t" "participant")
+set_tests_properties(CUnit_ddsc_userdata_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_userdata_endpoint "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_userdata" "-t" "endpoint")
+set_tests_properties(CUnit_ddsc_userdata_endpoint PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_userdata_group "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_userdata" "-t" "group")
+set_tests_properties(CUnit_ddsc_userdata_group PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_userdata_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_userdata" "-t" "topic")
+set_tests_properties(CUnit_ddsc_userdata_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_second "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "second")
+set_tests_properties(CUnit_ddsc_waitset_create_second PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_deleted_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "deleted_participant")
+set_tests_properties(CUnit_ddsc_waitset_create_deleted_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_domain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "domain")
+set_tests_properties(CUnit_ddsc_waitset_create_domain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_cyclonedds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "cyclonedds")
+set_tests_properties(CUnit_ddsc_waitset_create_cyclonedds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_deleted_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach" "-t" "deleted_waitset")
+set_tests_properties(CUnit_ddsc_waitset_attach_deleted_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_detach_second "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach_detach" "-t" "second")
+set_tests_properties(CUnit_ddsc_waitset_attach_detach_second PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_detach_various "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach_detach" "-t" "various")
+set_tests_properties(CUnit_ddsc_waitset_attach_detach_various PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_detach_combinations "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach_detach" "-t" "combinations")
+set_tests_properties(CUnit_ddsc_waitset_attach_detach_combinations PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_delete_attached_self "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_delete_attached" "-t" "self")
+set_tests_properties(CUnit_ddsc_waitset_delete_attached_self PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_delete_attached_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_delete_attached" "-t" "participant")
+set_tests_properties(CUnit_ddsc_waitset_delete_attached_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_delete_attached_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_delete_attached" "-t" "reader")
+set_tests_properties(CUnit_ddsc_waitset_delete_attached_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_delete_attached_various "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_delete_attached" "-t" "various")
+set_tests_properties(CUnit_ddsc_waitset_delete_attached_various PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_set_trigger_deleted_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_set_trigger" "-t" "deleted_waitset")
+set_tests_properties(CUnit_ddsc_waitset_set_trigger_deleted_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_deleted_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait" "-t" "deleted_waitset")
+set_tests_properties(CUnit_ddsc_waitset_wait_deleted_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_until_deleted_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait_until" "-t" "deleted_waitset")
+set_tests_properties(CUnit_ddsc_waitset_wait_until_deleted_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_until_past "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait_until" "-t" "past")
+set_tests_properties(CUnit_ddsc_waitset_wait_until_past PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_get_entities_no_array "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_get_entities" "-t" "no_array")
+set_tests_properties(CUnit_ddsc_waitset_get_entities_no_array PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_get_entities_deleted_waitset "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_get_entities" "-t" "deleted_waitset")
+set_tests_properties(CUnit_ddsc_waitset_get_entities_deleted_waitset PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_triggering_on_self "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_triggering" "-t" "on_self")
+set_tests_properties(CUnit_ddsc_waitset_triggering_on_self PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_triggering_on_reader "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_triggering" "-t" "on_reader")
+set_tests_properties(CUnit_ddsc_waitset_triggering_on_reader PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_triggering_on_readcondition "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_triggering" "-t" "on_readcondition")
+set_tests_properties(CUnit_ddsc_waitset_triggering_on_readcondition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_create_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_create_non_participants "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_create" "-t" "non_participants")
+set_tests_properties(CUnit_ddsc_waitset_create_non_participants PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_attach_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_invalid_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach" "-t" "invalid_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_attach_invalid_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_non_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach" "-t" "non_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_attach_non_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_scoping "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach" "-t" "scoping")
+set_tests_properties(CUnit_ddsc_waitset_attach_scoping PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_attach_detach_valid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_attach_detach" "-t" "valid_entities")
+set_tests_properties(CUnit_ddsc_waitset_attach_detach_valid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_detach_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_detach" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_detach_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_detach_invalid_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_detach" "-t" "invalid_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_detach_invalid_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_detach_valid_entities "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_detach" "-t" "valid_entities")
+set_tests_properties(CUnit_ddsc_waitset_detach_valid_entities PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_set_trigger_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_set_trigger" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_set_trigger_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_set_trigger_non_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_set_trigger" "-t" "non_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_set_trigger_non_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_invalid_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait" "-t" "invalid_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_wait_invalid_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_non_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait" "-t" "non_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_wait_non_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_wait_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_until_invalid_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait_until" "-t" "invalid_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_wait_until_invalid_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_until_non_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait_until" "-t" "non_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_wait_until_non_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_wait_until_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_wait_until" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_wait_until_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_get_entities_array_sizes "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_get_entities" "-t" "array_sizes")
+set_tests_properties(CUnit_ddsc_waitset_get_entities_array_sizes PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_get_entities_invalid_params "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_get_entities" "-t" "invalid_params")
+set_tests_properties(CUnit_ddsc_waitset_get_entities_invalid_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_get_entities_non_waitsets "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_get_entities" "-t" "non_waitsets")
+set_tests_properties(CUnit_ddsc_waitset_get_entities_non_waitsets PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_triggering_after_listener "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset_triggering" "-t" "after_listener")
+set_tests_properties(CUnit_ddsc_waitset_triggering_after_listener PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_waitset_torture "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_waitset" "-t" "torture")
+set_tests_properties(CUnit_ddsc_waitset_torture PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_whc_check_end_state "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_whc" "-t" "check_end_state")
+set_tests_properties(CUnit_ddsc_whc_check_end_state PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "basic")
+set_tests_properties(CUnit_ddsc_write_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_null_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "null_writer")
+set_tests_properties(CUnit_ddsc_write_null_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_bad_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "bad_writer")
+set_tests_properties(CUnit_ddsc_write_bad_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_closed_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "closed_writer")
+set_tests_properties(CUnit_ddsc_write_closed_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_null_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "null_sample")
+set_tests_properties(CUnit_ddsc_write_null_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_ts_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write_ts" "-t" "basic")
+set_tests_properties(CUnit_ddsc_write_ts_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_ts_bad_timestamp "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write_ts" "-t" "bad_timestamp")
+set_tests_properties(CUnit_ddsc_write_ts_bad_timestamp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_simpletypes "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "simpletypes")
+set_tests_properties(CUnit_ddsc_write_simpletypes PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_invalid_data "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "invalid_data")
+set_tests_properties(CUnit_ddsc_write_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_relwr_unrelrd_network "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "relwr_unrelrd_network")
+set_tests_properties(CUnit_ddsc_write_relwr_unrelrd_network PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_batch_flush "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "batch_flush")
+set_tests_properties(CUnit_ddsc_write_batch_flush PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_write_async_one_unrel_sample "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_write" "-t" "async_one_unrel_sample")
+set_tests_properties(CUnit_ddsc_write_async_one_unrel_sample PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_writetypes_various "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_writetypes" "-t" "various")
+set_tests_properties(CUnit_ddsc_writetypes_various PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "basic")
+set_tests_properties(CUnit_ddsc_create_writer_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_null_parent "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "null_parent")
+set_tests_properties(CUnit_ddsc_create_writer_null_parent PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_bad_parent "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "bad_parent")
+set_tests_properties(CUnit_ddsc_create_writer_bad_parent PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "participant")
+set_tests_properties(CUnit_ddsc_create_writer_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_wrong_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "wrong_participant")
+set_tests_properties(CUnit_ddsc_create_writer_wrong_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "publisher")
+set_tests_properties(CUnit_ddsc_create_writer_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_deleted_publisher "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "deleted_publisher")
+set_tests_properties(CUnit_ddsc_create_writer_deleted_publisher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_null_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "null_topic")
+set_tests_properties(CUnit_ddsc_create_writer_null_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_bad_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "bad_topic")
+set_tests_properties(CUnit_ddsc_create_writer_bad_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_deleted_topic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "deleted_topic")
+set_tests_properties(CUnit_ddsc_create_writer_deleted_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_create_writer_participant_mismatch "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_create_writer" "-t" "participant_mismatch")
+set_tests_properties(CUnit_ddsc_create_writer_participant_mismatch PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_large_fragmented "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "large_fragmented")
+set_tests_properties(CUnit_ddsc_cdrstream_large_fragmented PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_check_optimize "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "check_optimize")
+set_tests_properties(CUnit_ddsc_cdrstream_check_optimize PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_data_type_info "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "data_type_info")
+set_tests_properties(CUnit_ddsc_cdrstream_data_type_info PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_skip_default "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "skip_default")
+set_tests_properties(CUnit_ddsc_cdrstream_skip_default PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_key_size "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "key_size")
+set_tests_properties(CUnit_ddsc_cdrstream_key_size PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_key_flags_ext "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "key_flags_ext")
+set_tests_properties(CUnit_ddsc_cdrstream_key_flags_ext PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_cursor_final "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "cursor_final")
+set_tests_properties(CUnit_ddsc_cdrstream_cursor_final PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_cursor_appendable "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "cursor_appendable")
+set_tests_properties(CUnit_ddsc_cdrstream_cursor_appendable PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_cursor_unsupported "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "cursor_unsupported")
+set_tests_properties(CUnit_ddsc_cdrstream_cursor_unsupported PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_inline_sequence "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "inline_sequence")
+set_tests_properties(CUnit_ddsc_cdrstream_inline_sequence PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_ser_des "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "ser_des")
+set_tests_properties(CUnit_ddsc_cdrstream_ser_des PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_ser_des_multiple "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "ser_des_multiple")
+set_tests_properties(CUnit_ddsc_cdrstream_ser_des_multiple PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_ser_des_segmented "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "ser_des_segmented")
+set_tests_properties(CUnit_ddsc_cdrstream_ser_des_segmented PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_appendable_mutable "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "appendable_mutable")
+set_tests_properties(CUnit_ddsc_cdrstream_appendable_mutable PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_cdrstream_min_xcdr_version "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_cdrstream" "-t" "min_xcdr_version")
+set_tests_properties(CUnit_ddsc_cdrstream_min_xcdr_version PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_serdata_key_write_xcdrv "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_serdata" "-t" "key_write_xcdrv")
+set_tests_properties(CUnit_ddsc_serdata_key_write_xcdrv PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_serdata_key_serialization "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_serdata" "-t" "key_serialization")
+set_tests_properties(CUnit_ddsc_serdata_key_serialization PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer")
+set_tests_properties(CUnit_ddsc_psmx_one_writer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_dynsize "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_dynsize")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_dynsize PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_dynsize_strkey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_dynsize_strkey")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_dynsize_strkey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_fastpath "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_fastpath")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_fastpath PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_slowpath "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_slowpath")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_slowpath PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_wloan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_wloan")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_wloan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_rloan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_rloan")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_rloan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_wrloan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_wrloan")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_wrloan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_forwardcdr "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_forwardcdr")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_forwardcdr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_forwardcdr_dynsize "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_forwardcdr_dynsize")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_forwardcdr_dynsize PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_one_writer_forwardcdr_dynsize_strkey "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "one_writer_forwardcdr_dynsize_strkey")
+set_tests_properties(CUnit_ddsc_psmx_one_writer_forwardcdr_dynsize_strkey PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "240" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_return_loan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "return_loan")
+set_tests_properties(CUnit_ddsc_psmx_return_loan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_partition_xtalk "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "partition_xtalk")
+set_tests_properties(CUnit_ddsc_psmx_partition_xtalk PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "basic")
+set_tests_properties(CUnit_ddsc_psmx_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_zero_copy "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "zero_copy")
+set_tests_properties(CUnit_ddsc_psmx_zero_copy PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_psmx_writer_loan "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_psmx" "-t" "writer_loan")
+set_tests_properties(CUnit_ddsc_psmx_writer_loan PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_lifespan_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_lifespan" "-t" "basic")
+set_tests_properties(CUnit_ddsc_lifespan_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "basic")
+set_tests_properties(CUnit_ddsc_deadline_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_update "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "update")
+set_tests_properties(CUnit_ddsc_deadline_update PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_insanely_short "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "insanely_short")
+set_tests_properties(CUnit_ddsc_deadline_insanely_short PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_insanely_long "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "insanely_long")
+set_tests_properties(CUnit_ddsc_deadline_insanely_long PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_writer_types "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "writer_types")
+set_tests_properties(CUnit_ddsc_deadline_writer_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_deadline_instances "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_deadline" "-t" "instances")
+set_tests_properties(CUnit_ddsc_deadline_instances PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" RUN_SERIAL "TRUE" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_local_hash "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_typeinfo" "-t" "invalid_top_level_local_hash")
+set_tests_properties(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_local_hash PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_local_non_hash "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_typeinfo" "-t" "invalid_top_level_local_non_hash")
+set_tests_properties(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_local_non_hash PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_remote_hash "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_typeinfo" "-t" "invalid_top_level_remote_hash")
+set_tests_properties(CUnit_ddsc_xtypes_typeinfo_invalid_top_level_remote_hash PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_typeinfo_get_type_info "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_typeinfo" "-t" "get_type_info")
+set_tests_properties(CUnit_ddsc_xtypes_typeinfo_get_type_info PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_typeinfo_invalid_type_object_local "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_typeinfo" "-t" "invalid_type_object_local")
+set_tests_properties(CUnit_ddsc_xtypes_typeinfo_invalid_type_object_local PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_invalid_type_object_remote "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "invalid_type_object_remote")
+set_tests_properties(CUnit_ddsc_typelookup_invalid_type_object_remote PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_representation_xcdr1_xcdr2 "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_representation" "-t" "xcdr1_xcdr2")
+set_tests_properties(CUnit_ddsc_data_representation_xcdr1_xcdr2 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_representation_matching "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_representation" "-t" "matching")
+set_tests_properties(CUnit_ddsc_data_representation_matching PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_representation_extensibility "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_representation" "-t" "extensibility")
+set_tests_properties(CUnit_ddsc_data_representation_extensibility PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_representation_update_qos "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_representation" "-t" "update_qos")
+set_tests_properties(CUnit_ddsc_data_representation_update_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_data_representation_qos_annotation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_data_representation" "-t" "qos_annotation")
+set_tests_properties(CUnit_ddsc_data_representation_qos_annotation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typebuilder_invalid_toplevel "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typebuilder" "-t" "invalid_toplevel")
+set_tests_properties(CUnit_ddsc_typebuilder_invalid_toplevel PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typebuilder_topic_desc "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typebuilder" "-t" "topic_desc")
+set_tests_properties(CUnit_ddsc_typebuilder_topic_desc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "basic")
+set_tests_properties(CUnit_ddsc_dynamic_type_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_entity_kinds "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "entity_kinds")
+set_tests_properties(CUnit_ddsc_dynamic_type_entity_kinds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_type_create "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "type_create")
+set_tests_properties(CUnit_ddsc_dynamic_type_type_create PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_struct_member_id "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "struct_member_id")
+set_tests_properties(CUnit_ddsc_dynamic_type_struct_member_id PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_extensibility_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "extensibility_invalid")
+set_tests_properties(CUnit_ddsc_dynamic_type_extensibility_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_extensibility_valid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "extensibility_valid")
+set_tests_properties(CUnit_ddsc_dynamic_type_extensibility_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_bit_bound "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "bit_bound")
+set_tests_properties(CUnit_ddsc_dynamic_type_bit_bound PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_bitmask "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "bitmask")
+set_tests_properties(CUnit_ddsc_dynamic_type_bitmask PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_bitmask_field_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "bitmask_field_invalid")
+set_tests_properties(CUnit_ddsc_dynamic_type_bitmask_field_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_enum_type "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "enum_type")
+set_tests_properties(CUnit_ddsc_dynamic_type_enum_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_enum_literal_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "enum_literal_invalid")
+set_tests_properties(CUnit_ddsc_dynamic_type_enum_literal_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_struct_member_prop "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "struct_member_prop")
+set_tests_properties(CUnit_ddsc_dynamic_type_struct_member_prop PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_struct_member_prop_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "struct_member_prop_invalid")
+set_tests_properties(CUnit_ddsc_dynamic_type_struct_member_prop_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_union_member_prop "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "union_member_prop")
+set_tests_properties(CUnit_ddsc_dynamic_type_union_member_prop PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_union_member_prop_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "union_member_prop_invalid")
+set_tests_properties(CUnit_ddsc_dynamic_type_union_member_prop_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_no_members "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "no_members")
+set_tests_properties(CUnit_ddsc_dynamic_type_no_members PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_existing "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "existing")
+set_tests_properties(CUnit_ddsc_dynamic_type_existing PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_existing_constructing "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "existing_constructing")
+set_tests_properties(CUnit_ddsc_dynamic_type_existing_constructing PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_dynamic_type_type_info "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_dynamic_type" "-t" "type_info")
+set_tests_properties(CUnit_ddsc_dynamic_type_type_info PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_get_typeobj "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "get_typeobj")
+set_tests_properties(CUnit_ddsc_typelookup_get_typeobj PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_api_resolve "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "api_resolve")
+set_tests_properties(CUnit_ddsc_typelookup_api_resolve PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_api_resolve_invalid "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "api_resolve_invalid")
+set_tests_properties(CUnit_ddsc_typelookup_api_resolve_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_resolve_dep_type "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "resolve_dep_type")
+set_tests_properties(CUnit_ddsc_typelookup_resolve_dep_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_typelookup_typeobj_cache "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_typelookup" "-t" "typeobj_cache")
+set_tests_properties(CUnit_ddsc_typelookup_typeobj_cache PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_assignability_type_consistency_enforcement_force_validation "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_assignability" "-t" "type_consistency_enforcement_force_validation")
+set_tests_properties(CUnit_ddsc_xtypes_assignability_type_consistency_enforcement_force_validation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_assignability_basic "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_assignability" "-t" "basic")
+set_tests_properties(CUnit_ddsc_xtypes_assignability_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_assignability_must_understand "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_assignability" "-t" "must_understand")
+set_tests_properties(CUnit_ddsc_xtypes_assignability_must_understand PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_assignability_type_consistency_enforcement "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_assignability" "-t" "type_consistency_enforcement")
+set_tests_properties(CUnit_ddsc_xtypes_assignability_type_consistency_enforcement PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_xtypes_assignability_enum_extensibility "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_xtypes_assignability" "-t" "enum_extensibility")
+set_tests_properties(CUnit_ddsc_xtypes_assignability_enum_extensibility PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_discovery_single_topic_def "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_discovery" "-t" "single_topic_def")
+set_tests_properties(CUnit_ddsc_topic_discovery_single_topic_def PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_discovery_different_type "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_discovery" "-t" "different_type")
+set_tests_properties(CUnit_ddsc_topic_discovery_different_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_discovery_topic_qos_update "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_discovery" "-t" "topic_qos_update")
+set_tests_properties(CUnit_ddsc_topic_discovery_topic_qos_update PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_discovery_remote_topics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_discovery" "-t" "remote_topics")
+set_tests_properties(CUnit_ddsc_topic_discovery_remote_topics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_global_domain "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_global" "-t" "domain")
+set_tests_properties(CUnit_ddsc_topic_find_global_domain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_global_participant "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_global" "-t" "participant")
+set_tests_properties(CUnit_ddsc_topic_find_global_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_global_same_name "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_global" "-t" "same_name")
+set_tests_properties(CUnit_ddsc_topic_find_global_same_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsc_topic_find_global_find_delete_topics "/root/repo/_gate_debug/bin/cunit_ddsc" "-s" "ddsc_topic_find_global" "-t" "find_delete_topics")
+set_tests_properties(CUnit_ddsc_topic_find_global_find_delete_topics PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsc/tests/CMakeLists.txt;140;add_cunit_executable;/root/repo/src/core/ddsc/tests/CMakeLists.txt;0;")
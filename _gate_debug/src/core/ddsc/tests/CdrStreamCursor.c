@@ -0,0 +1,251 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamCursor.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamCursor.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamCursor.h"
+
+static const uint32_t CdrStreamCursor_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t1, a),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamCursor_t1, b),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamCursor_t1, c), (3u << 16u) + 16u /* sub */,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamCursor_t1, d),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t1, e),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamCursor_t1, f), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t1, g), 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t1, h),
+  DDS_OP_RTS,
+
+  /* sub */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_sub, a),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamCursor_sub, b),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 57194065bb7b916b9693581f2c6d] (#deps: 2)
+   - [MINIMAL a5175a78f29d0d8b9a44524c81b8]
+   - [MINIMAL 2b43db441f93a75bfc4d70b62b83]
+  [COMPLETE a4d09a3e3692cf1e0f02ef1ee7cc] (#deps: 2)
+   - [COMPLETE 1a451664582acb87836d6662d872]
+   - [COMPLETE c8ef35b5e92ec3d0179180b83ab4]
+*/
+#define TYPE_INFO_CDR_CdrStreamCursor_t1 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x57, 0x19, 0x40, 0x65, 0xbb, 0x7b, 0x91, 0x6b, 0x96, 0x93, 0x58, \
+  0x1f, 0x2c, 0x6d, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa5, 0x17, 0x5a, 0x78, 0xf2, 0x9d, 0x0d, \
+  0x8b, 0x9a, 0x44, 0x52, 0x4c, 0x81, 0xb8, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x2b, 0x43, 0xdb, 0x44, 0x1f, 0x93, 0xa7, 0x5b, 0xfc, 0x4d, 0x70, 0xb6, 0x2b, 0x83, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa4, 0xd0, 0x9a, 0x3e, 0x36, 0x92, 0xcf, 0x1e, 0x0f, 0x02, 0xef, \
+  0x1e, 0xe7, 0xcc, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x45, 0x16, 0x64, 0x58, 0x2a, 0xcb, \
+  0x87, 0x83, 0x6d, 0x66, 0x62, 0xd8, 0x72, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc8, 0xef, 0x35, 0xb5, 0xe9, 0x2e, 0xc3, 0xd0, 0x17, 0x91, 0x80, 0xb8, 0x3a, 0xb4, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamCursor_t1 196u
+#define TYPE_MAP_CDR_CdrStreamCursor_t1 (const unsigned char []){ \
+  0x8a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x57, 0x19, 0x40, 0x65, 0xbb, 0x7b, 0x91, \
+  0x6b, 0x96, 0x93, 0x58, 0x1f, 0x2c, 0x6d, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa5, 0x17, 0x5a, 0x78, 0xf2, \
+  0x9d, 0x0d, 0x8b, 0x9a, 0x44, 0x52, 0x4c, 0x81, 0xb8, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x0a, \
+  0x82, 0x77, 0xe0, 0x91, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xe1, \
+  0x67, 0x17, 0x97, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x2b, \
+  0x43, 0xdb, 0x44, 0x1f, 0x93, 0xa7, 0x5b, 0xfc, 0x4d, 0x70, 0xb6, 0x2b, 0x83, 0x8f, 0xa1, 0x4c, \
+  0xdd, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0xb2, 0xf5, 0xff, 0x47, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0x25, 0x10, 0xc3, 0x90, 0xf1, 0xa5, 0x17, 0x5a, 0x78, 0xf2, 0x9d, 0x0d, 0x8b, 0x9a, 0x44, 0x52, \
+  0x4c, 0x81, 0xb8, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x2b, 0x43, 0xdb, \
+  0x44, 0x1f, 0x93, 0xa7, 0x5b, 0xfc, 0x4d, 0x70, 0xb6, 0x2b, 0x83, 0x00, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x0e, 0x51, 0xa8, 0x7e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0x00, 0x00, \
+  0x15, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xa4, 0xd0, 0x9a, 0x3e, 0x36, 0x92, 0xcf, \
+  0x1e, 0x0f, 0x02, 0xef, 0x1e, 0xe7, 0xcc, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x3a, 0x74, 0x31, 0x00, \
+  0xd8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x1a, 0x45, 0x16, 0x64, 0x58, \
+  0x2a, 0xcb, 0x87, 0x83, 0x6d, 0x66, 0x62, 0xd8, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc8, 0xef, 0x35, 0xb5, 0xe9, \
+  0x2e, 0xc3, 0xd0, 0x17, 0x91, 0x80, 0xb8, 0x3a, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x67, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x45, 0x16, \
+  0x64, 0x58, 0x2a, 0xcb, 0x87, 0x83, 0x6d, 0x66, 0x62, 0xd8, 0x72, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, \
+  0x3a, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0xef, 0x35, 0xb5, 0xe9, 0x2e, 0xc3, \
+  0xd0, 0x17, 0x91, 0x80, 0xb8, 0x3a, 0xb4, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x3a, 0x65, 0x6e, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xa4, 0xd0, 0x9a, 0x3e, 0x36, 0x92, 0xcf, 0x1e, 0x0f, 0x02, 0xef, \
+  0x1e, 0xe7, 0xcc, 0xf1, 0x57, 0x19, 0x40, 0x65, 0xbb, 0x7b, 0x91, 0x6b, 0x96, 0x93, 0x58, 0x1f, \
+  0x2c, 0x6d, 0xf2, 0x1a, 0x45, 0x16, 0x64, 0x58, 0x2a, 0xcb, 0x87, 0x83, 0x6d, 0x66, 0x62, 0xd8, \
+  0x72, 0xf1, 0xa5, 0x17, 0x5a, 0x78, 0xf2, 0x9d, 0x0d, 0x8b, 0x9a, 0x44, 0x52, 0x4c, 0x81, 0xb8, \
+  0xf2, 0xc8, 0xef, 0x35, 0xb5, 0xe9, 0x2e, 0xc3, 0xd0, 0x17, 0x91, 0x80, 0xb8, 0x3a, 0xb4, 0xf1, \
+  0x2b, 0x43, 0xdb, 0x44, 0x1f, 0x93, 0xa7, 0x5b, 0xfc, 0x4d, 0x70, 0xb6, 0x2b, 0x83\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamCursor_t1 1038u
+const dds_topic_descriptor_t CdrStreamCursor_t1_desc =
+{
+  .m_size = sizeof (CdrStreamCursor_t1),
+  .m_align = dds_alignof (CdrStreamCursor_t1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamCursor::t1",
+  .m_keys = NULL,
+  .m_nops = 12,
+  .m_ops = CdrStreamCursor_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamCursor_t1, .sz = TYPE_INFO_CDR_SZ_CdrStreamCursor_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamCursor_t1, .sz = TYPE_MAP_CDR_SZ_CdrStreamCursor_t1 }
+};
+
+static const uint32_t CdrStreamCursor_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t2, a),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t2, b),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamCursor_t2, c),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 3fd96148ae97ecd7236fbba266d6] (#deps: 0)
+  [COMPLETE 37960d02c27d2914b173d2f917af] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamCursor_t2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0xd9, 0x61, 0x48, 0xae, 0x97, 0xec, 0xd7, 0x23, 0x6f, 0xbb, \
+  0xa2, 0x66, 0xd6, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x96, 0x0d, 0x02, 0xc2, 0x7d, 0x29, 0x14, 0xb1, 0x73, 0xd2, \
+  0xf9, 0x17, 0xaf, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamCursor_t2 100u
+#define TYPE_MAP_CDR_CdrStreamCursor_t2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0xd9, 0x61, 0x48, 0xae, 0x97, 0xec, \
+  0xd7, 0x23, 0x6f, 0xbb, 0xa2, 0x66, 0xd6, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x05, \
+  0x92, 0xeb, 0x5f, 0xfe, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x4a, 0x8a, 0x08, 0xf0, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x96, 0x0d, \
+  0x02, 0xc2, 0x7d, 0x29, 0x14, 0xb1, 0x73, 0xd2, 0xf9, 0x17, 0xaf, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, \
+  0x3a, 0x74, 0x32, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x05, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x96, 0x0d, 0x02, 0xc2, 0x7d, 0x29, 0x14, 0xb1, 0x73, 0xd2, \
+  0xf9, 0x17, 0xaf, 0xf1, 0x3f, 0xd9, 0x61, 0x48, 0xae, 0x97, 0xec, 0xd7, 0x23, 0x6f, 0xbb, 0xa2, \
+  0x66, 0xd6\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamCursor_t2 274u
+const dds_topic_descriptor_t CdrStreamCursor_t2_desc =
+{
+  .m_size = sizeof (CdrStreamCursor_t2),
+  .m_align = dds_alignof (CdrStreamCursor_t2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamCursor::t2",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamCursor_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamCursor_t2, .sz = TYPE_INFO_CDR_SZ_CdrStreamCursor_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamCursor_t2, .sz = TYPE_MAP_CDR_SZ_CdrStreamCursor_t2 }
+};
+
+static const uint32_t CdrStreamCursor_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamCursor_t3, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bb960921dcd5df8752701b8433d1] (#deps: 0)
+  [COMPLETE 8f5f6df577b8f6a00e0e2cf56198] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamCursor_t3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, \
+  0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5f, 0x6d, 0xf5, 0x77, 0xb8, 0xf6, 0xa0, 0x0e, 0x0e, 0x2c, \
+  0xf5, 0x61, 0x98, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamCursor_t3 100u
+#define TYPE_MAP_CDR_CdrStreamCursor_t3 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5f, 0x6d, 0xf5, 0x77, 0xb8, 0xf6, \
+  0xa0, 0x0e, 0x0e, 0x2c, 0xf5, 0x61, 0x98, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x3a, 0x74, 0x33, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5f, 0x6d, 0xf5, 0x77, 0xb8, 0xf6, 0xa0, 0x0e, 0x0e, 0x2c, \
+  0xf5, 0x61, 0x98, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, \
+  0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamCursor_t3 194u
+const dds_topic_descriptor_t CdrStreamCursor_t3_desc =
+{
+  .m_size = sizeof (CdrStreamCursor_t3),
+  .m_align = dds_alignof (CdrStreamCursor_t3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamCursor::t3",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamCursor_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamCursor_t3, .sz = TYPE_INFO_CDR_SZ_CdrStreamCursor_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamCursor_t3, .sz = TYPE_MAP_CDR_SZ_CdrStreamCursor_t3 }
+};
+
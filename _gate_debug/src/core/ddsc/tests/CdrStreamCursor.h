@@ -0,0 +1,137 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamCursor.h
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamCursor.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMCURSOR_H_C7C3DCC10D10416576875EFE7D8D334D
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMCURSOR_H_C7C3DCC10D10416576875EFE7D8D334D
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum CdrStreamCursor_en
+{
+  CdrStreamCursor_E0,
+  CdrStreamCursor_E1,
+  CdrStreamCursor_E2
+} CdrStreamCursor_en;
+
+#define CdrStreamCursor_en__alloc() \
+((CdrStreamCursor_en*) dds_alloc (sizeof (CdrStreamCursor_en)));
+
+typedef struct CdrStreamCursor_sub
+{
+  int32_t a;
+  char * b;
+} CdrStreamCursor_sub;
+
+#ifndef DDS_SEQUENCE_DOUBLE_DEFINED
+#define DDS_SEQUENCE_DOUBLE_DEFINED
+typedef struct dds_sequence_double
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  double *_buffer;
+  bool _release;
+} dds_sequence_double;
+
+#define dds_sequence_double__alloc() \
+((dds_sequence_double*) dds_alloc (sizeof (dds_sequence_double)));
+
+#define dds_sequence_double_allocbuf(l) \
+((double *) dds_alloc ((l) * sizeof (double)))
+#endif /* DDS_SEQUENCE_DOUBLE_DEFINED */
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+typedef struct CdrStreamCursor_t1
+{
+  int32_t a;
+  char * b;
+  struct CdrStreamCursor_sub c;
+  dds_sequence_double d;
+  int16_t e;
+  CdrStreamCursor_en f;
+  int32_t g[4];
+  dds_sequence_long h;
+} CdrStreamCursor_t1;
+
+extern const dds_topic_descriptor_t CdrStreamCursor_t1_desc;
+
+#define CdrStreamCursor_t1__alloc() \
+((CdrStreamCursor_t1*) dds_alloc (sizeof (CdrStreamCursor_t1)));
+
+#define CdrStreamCursor_t1_free(d,o) \
+dds_sample_free ((d), &CdrStreamCursor_t1_desc, (o))
+
+#ifndef DDS_SEQUENCE_LONG_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_LONG_DEFINED
+typedef struct dds_sequence_long_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int64_t *_buffer;
+  bool _release;
+} dds_sequence_long_long;
+
+#define dds_sequence_long_long__alloc() \
+((dds_sequence_long_long*) dds_alloc (sizeof (dds_sequence_long_long)));
+
+#define dds_sequence_long_long_allocbuf(l) \
+((int64_t *) dds_alloc ((l) * sizeof (int64_t)))
+#endif /* DDS_SEQUENCE_LONG_LONG_DEFINED */
+
+typedef struct CdrStreamCursor_t2
+{
+  int32_t a;
+  dds_sequence_long_long b;
+  char * c;
+} CdrStreamCursor_t2;
+
+extern const dds_topic_descriptor_t CdrStreamCursor_t2_desc;
+
+#define CdrStreamCursor_t2__alloc() \
+((CdrStreamCursor_t2*) dds_alloc (sizeof (CdrStreamCursor_t2)));
+
+#define CdrStreamCursor_t2_free(d,o) \
+dds_sample_free ((d), &CdrStreamCursor_t2_desc, (o))
+
+typedef struct CdrStreamCursor_t3
+{
+  int32_t a;
+} CdrStreamCursor_t3;
+
+extern const dds_topic_descriptor_t CdrStreamCursor_t3_desc;
+
+#define CdrStreamCursor_t3__alloc() \
+((CdrStreamCursor_t3*) dds_alloc (sizeof (CdrStreamCursor_t3)));
+
+#define CdrStreamCursor_t3_free(d,o) \
+dds_sample_free ((d), &CdrStreamCursor_t3_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMCURSOR_H_C7C3DCC10D10416576875EFE7D8D334D */
@@ -0,0 +1,1263 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamDataTypeInfo.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamDataTypeInfo.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamDataTypeInfo.h"
+
+static const uint32_t CdrStreamDataTypeInfo_dti_struct_ops [] =
+{
+  /* dti_struct */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_struct, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE a0a86a54799dd46c30a8c608727d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, \
+  0x08, 0x72, 0x7d, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, \
+  0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, \
+  0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct 214u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_struct_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_struct),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_struct),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_struct",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_struct_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_string_ops [] =
+{
+  /* dti_string */
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamDataTypeInfo_dti_string, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d312da0775747bc77f062064d85c] (#deps: 0)
+  [COMPLETE 341070bbc9f4f78df9720bcb7765] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_string (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, 0xc7, 0x7f, 0x06, 0x20, \
+  0x64, 0xd8, 0x5c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x34, 0x10, 0x70, 0xbb, 0xc9, 0xf4, 0xf7, 0x8d, 0xf9, 0x72, 0x0b, \
+  0xcb, 0x77, 0x65, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_string 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_string (const unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, \
+  0xc7, 0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xbd, 0x19, 0x83, 0x6d, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x34, 0x10, 0x70, 0xbb, 0xc9, 0xf4, 0xf7, \
+  0x8d, 0xf9, 0x72, 0x0b, 0xcb, 0x77, 0x65, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x34, 0x10, 0x70, 0xbb, 0xc9, 0xf4, 0xf7, \
+  0x8d, 0xf9, 0x72, 0x0b, 0xcb, 0x77, 0x65, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, 0xc7, \
+  0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_string 214u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_string_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_string),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_string),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_string",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_string_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_string, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_string },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_string, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_string }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_bstring_ops [] =
+{
+  /* dti_bstring */
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (CdrStreamDataTypeInfo_dti_bstring, f1), 6u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b5cec2b90cc9ae6c260142d8d5c3] (#deps: 0)
+  [COMPLETE 76a37d99063147219bc07708977a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_bstring (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, 0x0c, 0xc9, 0xae, 0x6c, 0x26, 0x01, 0x42, \
+  0xd8, 0xd5, 0xc3, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x76, 0xa3, 0x7d, 0x99, 0x06, 0x31, 0x47, 0x21, 0x9b, 0xc0, 0x77, \
+  0x08, 0x97, 0x7a, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_bstring 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_bstring (const unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, 0x0c, 0xc9, 0xae, \
+  0x6c, 0x26, 0x01, 0x42, 0xd8, 0xd5, 0xc3, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, 0xbd, 0x19, 0x83, 0x6d, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x76, 0xa3, 0x7d, 0x99, 0x06, 0x31, 0x47, \
+  0x21, 0x9b, 0xc0, 0x77, 0x08, 0x97, 0x7a, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x05, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x76, 0xa3, 0x7d, 0x99, 0x06, 0x31, 0x47, \
+  0x21, 0x9b, 0xc0, 0x77, 0x08, 0x97, 0x7a, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, 0x0c, 0xc9, 0xae, 0x6c, \
+  0x26, 0x01, 0x42, 0xd8, 0xd5, 0xc3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_bstring 214u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_bstring_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_bstring),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_bstring),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_bstring",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_bstring_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_bstring, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_bstring },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_bstring, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_bstring }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_seq_ops [] =
+{
+  /* dti_seq */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_seq, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 496bd415ff7e9c8371a9e454906a] (#deps: 0)
+  [COMPLETE c21aa7835d24e0434ec6a6c68219] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_seq (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, \
+  0x54, 0x90, 0x6a, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc2, 0x1a, 0xa7, 0x83, 0x5d, 0x24, 0xe0, 0x43, 0x4e, 0xc6, 0xa6, \
+  0xc6, 0x82, 0x19, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_seq 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_seq (const unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, \
+  0x83, 0x71, 0xa9, 0xe4, 0x54, 0x90, 0x6a, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc2, 0x1a, 0xa7, \
+  0x83, 0x5d, 0x24, 0xe0, 0x43, 0x4e, 0xc6, 0xa6, 0xc6, 0x82, 0x19, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x65, 0x71, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc2, 0x1a, 0xa7, \
+  0x83, 0x5d, 0x24, 0xe0, 0x43, 0x4e, 0xc6, 0xa6, 0xc6, 0x82, 0x19, 0xf1, 0x49, 0x6b, 0xd4, 0x15, \
+  0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, 0x54, 0x90, 0x6a\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_seq 218u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_seq_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_seq),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_seq),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_seq",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_seq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_seq, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_seq },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_seq, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_seq }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_bseq_ops [] =
+{
+  /* dti_bseq */
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_bseq, f1), 5u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5c84762000545c754504d390fc31] (#deps: 0)
+  [COMPLETE ddcaca59a60ca80688a168a0eb78] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_bseq (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0x84, 0x76, 0x20, 0x00, 0x54, 0x5c, 0x75, 0x45, 0x04, 0xd3, \
+  0x90, 0xfc, 0x31, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xdd, 0xca, 0xca, 0x59, 0xa6, 0x0c, 0xa8, 0x06, 0x88, 0xa1, 0x68, \
+  0xa0, 0xeb, 0x78, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_bseq 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_bseq (const unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0x84, 0x76, 0x20, 0x00, 0x54, 0x5c, \
+  0x75, 0x45, 0x04, 0xd3, 0x90, 0xfc, 0x31, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdd, 0xca, 0xca, \
+  0x59, 0xa6, 0x0c, 0xa8, 0x06, 0x88, 0xa1, 0x68, 0xa0, 0xeb, 0x78, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x62, 0x73, 0x65, 0x71, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdd, 0xca, 0xca, \
+  0x59, 0xa6, 0x0c, 0xa8, 0x06, 0x88, 0xa1, 0x68, 0xa0, 0xeb, 0x78, 0xf1, 0x5c, 0x84, 0x76, 0x20, \
+  0x00, 0x54, 0x5c, 0x75, 0x45, 0x04, 0xd3, 0x90, 0xfc, 0x31\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_bseq 218u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_bseq_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_bseq),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_bseq),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_bseq",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_bseq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_bseq, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_bseq },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_bseq, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_bseq }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_seq_str_ops [] =
+{
+  /* dti_seq_str */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (CdrStreamDataTypeInfo_dti_seq_str, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 25b003a5a278750857d560e437df] (#deps: 0)
+  [COMPLETE ec4ccd9fb128764a48b89118462e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_seq_str (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xb0, 0x03, 0xa5, 0xa2, 0x78, 0x75, 0x08, 0x57, 0xd5, 0x60, \
+  0xe4, 0x37, 0xdf, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x4c, 0xcd, 0x9f, 0xb1, 0x28, 0x76, 0x4a, 0x48, 0xb8, 0x91, \
+  0x18, 0x46, 0x2e, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_seq_str 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_seq_str (const unsigned char []){ \
+  0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xb0, 0x03, 0xa5, 0xa2, 0x78, 0x75, \
+  0x08, 0x57, 0xd5, 0x60, 0xe4, 0x37, 0xdf, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xec, 0x4c, 0xcd, 0x9f, 0xb1, 0x28, 0x76, 0x4a, 0x48, 0xb8, 0x91, 0x18, 0x46, 0x2e, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, \
+  0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, \
+  0x65, 0x71, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x4c, 0xcd, 0x9f, 0xb1, 0x28, 0x76, \
+  0x4a, 0x48, 0xb8, 0x91, 0x18, 0x46, 0x2e, 0xf1, 0x25, 0xb0, 0x03, 0xa5, 0xa2, 0x78, 0x75, 0x08, \
+  0x57, 0xd5, 0x60, 0xe4, 0x37, 0xdf\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_seq_str 230u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_seq_str_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_seq_str),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_seq_str),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_seq_str",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_seq_str_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_seq_str, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_seq_str },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_seq_str, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_seq_str }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_arr_ops [] =
+{
+  /* dti_arr */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_arr, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 59aa91c63c11a55d0c8fcef44d5c] (#deps: 0)
+  [COMPLETE 478ae7d32af946269cd87b65c67b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_arr (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x59, 0xaa, 0x91, 0xc6, 0x3c, 0x11, 0xa5, 0x5d, 0x0c, 0x8f, 0xce, \
+  0xf4, 0x4d, 0x5c, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x47, 0x8a, 0xe7, 0xd3, 0x2a, 0xf9, 0x46, 0x26, 0x9c, 0xd8, 0x7b, \
+  0x65, 0xc6, 0x7b, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_arr 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_arr (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x59, 0xaa, 0x91, 0xc6, 0x3c, 0x11, 0xa5, \
+  0x5d, 0x0c, 0x8f, 0xce, 0xf4, 0x4d, 0x5c, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x47, 0x8a, 0xe7, 0xd3, 0x2a, 0xf9, 0x46, 0x26, 0x9c, 0xd8, 0x7b, \
+  0x65, 0xc6, 0x7b, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x61, 0x72, 0x72, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x47, 0x8a, 0xe7, \
+  0xd3, 0x2a, 0xf9, 0x46, 0x26, 0x9c, 0xd8, 0x7b, 0x65, 0xc6, 0x7b, 0xf1, 0x59, 0xaa, 0x91, 0xc6, \
+  0x3c, 0x11, 0xa5, 0x5d, 0x0c, 0x8f, 0xce, 0xf4, 0x4d, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_arr 234u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_arr_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_arr),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_arr),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_arr",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_arr_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_arr, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_arr },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_arr, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_arr }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_arr_bstr_ops [] =
+{
+  /* dti_arr_bstr */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BST, offsetof (CdrStreamDataTypeInfo_dti_arr_bstr, f1), 3u, 0u, 6u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL eb865d111e1fcda1e607ea058a3e] (#deps: 0)
+  [COMPLETE 549df7a85b461e87f3758066fe95] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_arr_bstr (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xeb, 0x86, 0x5d, 0x11, 0x1e, 0x1f, 0xcd, 0xa1, 0xe6, 0x07, 0xea, \
+  0x05, 0x8a, 0x3e, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x9d, 0xf7, 0xa8, 0x5b, 0x46, 0x1e, 0x87, 0xf3, 0x75, 0x80, \
+  0x66, 0xfe, 0x95, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_arr_bstr 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_arr_bstr (const unsigned char []){ \
+  0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xeb, 0x86, 0x5d, 0x11, 0x1e, 0x1f, 0xcd, \
+  0xa1, 0xe6, 0x07, 0xea, 0x05, 0x8a, 0x3e, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x70, 0x05, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x9d, 0xf7, 0xa8, 0x5b, 0x46, 0x1e, 0x87, 0xf3, 0x75, 0x80, \
+  0x66, 0xfe, 0x95, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x61, 0x72, 0x72, 0x5f, 0x62, 0x73, 0x74, 0x72, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x70, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x54, 0x9d, 0xf7, 0xa8, 0x5b, 0x46, 0x1e, 0x87, 0xf3, 0x75, 0x80, 0x66, 0xfe, 0x95, 0xf1, \
+  0xeb, 0x86, 0x5d, 0x11, 0x1e, 0x1f, 0xcd, 0xa1, 0xe6, 0x07, 0xea, 0x05, 0x8a, 0x3e\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_arr_bstr 238u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_arr_bstr_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_arr_bstr),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_arr_bstr),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_arr_bstr",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_arr_bstr_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_arr_bstr, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_arr_bstr },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_arr_bstr, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_arr_bstr }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_opt_ops [] =
+{
+  /* dti_opt */
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_opt, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 840c3a0b79ee76e4f99e2b04bb06] (#deps: 0)
+  [COMPLETE 296d1c0eb90a8e4cd2214fa95c8b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_opt (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, 0x79, 0xee, 0x76, 0xe4, 0xf9, 0x9e, 0x2b, \
+  0x04, 0xbb, 0x06, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x29, 0x6d, 0x1c, 0x0e, 0xb9, 0x0a, 0x8e, 0x4c, 0xd2, 0x21, 0x4f, \
+  0xa9, 0x5c, 0x8b, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_opt 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_opt (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, 0x79, 0xee, 0x76, \
+  0xe4, 0xf9, 0x9e, 0x2b, 0x04, 0xbb, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x29, 0x6d, 0x1c, 0x0e, 0xb9, 0x0a, 0x8e, \
+  0x4c, 0xd2, 0x21, 0x4f, 0xa9, 0x5c, 0x8b, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x29, 0x6d, 0x1c, 0x0e, 0xb9, 0x0a, 0x8e, 0x4c, 0xd2, 0x21, 0x4f, \
+  0xa9, 0x5c, 0x8b, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, 0x79, 0xee, 0x76, 0xe4, 0xf9, 0x9e, 0x2b, 0x04, \
+  0xbb, 0x06\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_opt 210u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_opt_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_opt),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_opt),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_opt",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_opt_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_opt, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_opt },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_opt, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_opt }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_ext_ops [] =
+{
+  /* dti_ext */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_ext, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7c842a9f6488c0b49fad299b4c3b] (#deps: 0)
+  [COMPLETE ee8ec5b0f8de3261520607a9e0d5] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_ext (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, \
+  0x9b, 0x4c, 0x3b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xee, 0x8e, 0xc5, 0xb0, 0xf8, 0xde, 0x32, 0x61, 0x52, 0x06, 0x07, \
+  0xa9, 0xe0, 0xd5, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_ext 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_ext (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, \
+  0xb4, 0x9f, 0xad, 0x29, 0x9b, 0x4c, 0x3b, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xee, 0x8e, 0xc5, 0xb0, 0xf8, 0xde, 0x32, \
+  0x61, 0x52, 0x06, 0x07, 0xa9, 0xe0, 0xd5, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x65, 0x78, 0x74, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xee, 0x8e, 0xc5, 0xb0, 0xf8, 0xde, 0x32, 0x61, 0x52, 0x06, 0x07, \
+  0xa9, 0xe0, 0xd5, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, 0x9b, \
+  0x4c, 0x3b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_ext 210u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_ext_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_ext),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_ext),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_ext",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_ext_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_ext, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_ext },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_ext, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_ext }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_inl_bseq_ops [] =
+{
+  /* dti_inl_bseq */
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_inl_bseq, f1), 5u,
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BST, offsetof (CdrStreamDataTypeInfo_dti_inl_bseq, f2), 2u, 6u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 57ab8e65501933717f13ef9262b1] (#deps: 0)
+  [COMPLETE f891451adb322c7eaf3b0ee01523] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_inl_bseq (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x57, 0xab, 0x8e, 0x65, 0x50, 0x19, 0x33, 0x71, 0x7f, 0x13, 0xef, \
+  0x92, 0x62, 0xb1, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x91, 0x45, 0x1a, 0xdb, 0x32, 0x2c, 0x7e, 0xaf, 0x3b, 0x0e, \
+  0xe0, 0x15, 0x23, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_bseq 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_inl_bseq (const unsigned char []){ \
+  0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x57, 0xab, 0x8e, 0x65, 0x50, 0x19, 0x33, \
+  0x71, 0x7f, 0x13, 0xef, 0x92, 0x62, 0xb1, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x02, 0x70, 0x05, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x91, 0x45, 0x1a, 0xdb, 0x32, 0x2c, 0x7e, 0xaf, 0x3b, 0x0e, \
+  0xe0, 0x15, 0x23, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x69, 0x6e, 0x6c, 0x5f, 0x62, 0x73, 0x65, 0x71, 0x00, 0x3d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, \
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x91, 0x45, 0x1a, 0xdb, 0x32, 0x2c, \
+  0x7e, 0xaf, 0x3b, 0x0e, 0xe0, 0x15, 0x23, 0xf1, 0x57, 0xab, 0x8e, 0x65, 0x50, 0x19, 0x33, 0x71, \
+  0x7f, 0x13, 0xef, 0x92, 0x62, 0xb1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_bseq 278u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_inl_bseq_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_inl_bseq),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_inl_bseq),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_inl_bseq",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamDataTypeInfo_dti_inl_bseq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_inl_bseq, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_bseq },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_inl_bseq, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_bseq }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_inl_str_ops [] =
+{
+  /* dti_inl_str */
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STR, offsetof (CdrStreamDataTypeInfo_dti_inl_str, f1), 5u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 62c1940ff3012f68efff766915fe] (#deps: 0)
+  [COMPLETE f4ae4c7b7f186bb5edfa81e5bea8] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_inl_str (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x62, 0xc1, 0x94, 0x0f, 0xf3, 0x01, 0x2f, 0x68, 0xef, 0xff, 0x76, \
+  0x69, 0x15, 0xfe, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf4, 0xae, 0x4c, 0x7b, 0x7f, 0x18, 0x6b, 0xb5, 0xed, 0xfa, 0x81, \
+  0xe5, 0xbe, 0xa8, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_str 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_inl_str (const unsigned char []){ \
+  0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x62, 0xc1, 0x94, 0x0f, 0xf3, 0x01, 0x2f, \
+  0x68, 0xef, 0xff, 0x76, 0x69, 0x15, 0xfe, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x70, \
+  0x00, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xf4, 0xae, 0x4c, 0x7b, 0x7f, 0x18, 0x6b, 0xb5, 0xed, 0xfa, 0x81, 0xe5, 0xbe, 0xa8, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, \
+  0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x69, \
+  0x6e, 0x6c, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x70, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf4, 0xae, 0x4c, 0x7b, 0x7f, 0x18, 0x6b, \
+  0xb5, 0xed, 0xfa, 0x81, 0xe5, 0xbe, 0xa8, 0xf1, 0x62, 0xc1, 0x94, 0x0f, 0xf3, 0x01, 0x2f, 0x68, \
+  0xef, 0xff, 0x76, 0x69, 0x15, 0xfe\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_str 230u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_inl_str_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_inl_str),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_inl_str),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_inl_str",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_inl_str_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_inl_str, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_str },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_inl_str, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_inl_str }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_struct_key_ops [] =
+{
+  /* dti_struct_key */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_struct_key, f1),
+  DDS_OP_RTS,
+  
+  /* key: f1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamDataTypeInfo_dti_struct_key_keys[1] =
+{
+  { "f1", 3, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 779dff7e2145f418b5fa6b015eb3] (#deps: 0)
+  [COMPLETE b9ef4660cdd4ed1e6a9645d669d0] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_key (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x77, 0x9d, 0xff, 0x7e, 0x21, 0x45, 0xf4, 0x18, 0xb5, 0xfa, 0x6b, \
+  0x01, 0x5e, 0xb3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xef, 0x46, 0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, \
+  0xd6, 0x69, 0xd0, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_key 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_key (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x77, 0x9d, 0xff, 0x7e, 0x21, 0x45, 0xf4, \
+  0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xef, 0x46, 0x60, 0xcd, 0xd4, 0xed, \
+  0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, 0xd0, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x6b, 0x65, \
+  0x79, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xef, 0x46, \
+  0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, 0xd0, 0xf1, 0x77, 0x9d, 0xff, 0x7e, \
+  0x21, 0x45, 0xf4, 0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_key 218u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_struct_key_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_struct_key),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_struct_key),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_struct_key",
+  .m_keys = CdrStreamDataTypeInfo_dti_struct_key_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamDataTypeInfo_dti_struct_key_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_key, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_key },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_key, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_key }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_struct_nested_key_ops [] =
+{
+  /* dti_struct_nested_key */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamDataTypeInfo_dti_struct_nested_key, f1), (3u << 16u) + 4u /* dti_struct */,
+  DDS_OP_RTS,
+
+  /* dti_struct */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_struct, f1),
+  DDS_OP_RTS,
+  
+  /* key: f1.f1 */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamDataTypeInfo_dti_struct_nested_key_keys[1] =
+{
+  { "f1.f1", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 301a8ed73ad47d1d0f80db677a16] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE 8459995c37e418d62287d3e0c73f] (#deps: 1)
+   - [COMPLETE a0a86a54799dd46c30a8c608727d]
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_nested_key (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x1a, 0x8e, 0xd7, 0x3a, 0xd4, 0x7d, 0x1d, 0x0f, 0x80, 0xdb, \
+  0x67, 0x7a, 0x16, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x84, 0x59, 0x99, \
+  0x5c, 0x37, 0xe4, 0x18, 0xd6, 0x22, 0x87, 0xd3, 0xe0, 0xc7, 0x3f, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x00, \
+  0x55, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_key 148u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_nested_key (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x1a, 0x8e, 0xd7, 0x3a, 0xd4, 0x7d, \
+  0x1d, 0x0f, 0x80, 0xdb, 0x67, 0x7a, 0x16, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xf5, 0x4b, \
+  0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x84, 0x59, 0x99, \
+  0x5c, 0x37, 0xe4, 0x18, 0xd6, 0x22, 0x87, 0xd3, 0xe0, 0xc7, 0x3f, 0x00, 0x6d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, \
+  0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, \
+  0x7d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xa8, \
+  0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x51, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, \
+  0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x84, 0x59, 0x99, \
+  0x5c, 0x37, 0xe4, 0x18, 0xd6, 0x22, 0x87, 0xd3, 0xe0, 0xc7, 0x3f, 0xf1, 0x30, 0x1a, 0x8e, 0xd7, \
+  0x3a, 0xd4, 0x7d, 0x1d, 0x0f, 0x80, 0xdb, 0x67, 0x7a, 0x16, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, \
+  0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_key 440u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_struct_nested_key_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_struct_nested_key),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_struct_nested_key),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_struct_nested_key",
+  .m_keys = CdrStreamDataTypeInfo_dti_struct_nested_key_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamDataTypeInfo_dti_struct_nested_key_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_nested_key, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_key },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_nested_key, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_key }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_struct_nested_nokey_ops [] =
+{
+  /* dti_struct_nested_nokey */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamDataTypeInfo_dti_struct_nested_nokey, f1), (3u << 16u) + 4u /* dti_struct_key */,
+  DDS_OP_RTS,
+
+  /* dti_struct_key */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_struct_key, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2b27fa58e0119fec70f05ca8ed66] (#deps: 1)
+   - [MINIMAL 779dff7e2145f418b5fa6b015eb3]
+  [COMPLETE 761f024afa88e27586c7bbd4f2a2] (#deps: 1)
+   - [COMPLETE b9ef4660cdd4ed1e6a9645d669d0]
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_nested_nokey (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0x27, 0xfa, 0x58, 0xe0, 0x11, 0x9f, 0xec, 0x70, 0xf0, 0x5c, \
+  0xa8, 0xed, 0x66, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x77, 0x9d, 0xff, 0x7e, 0x21, 0x45, 0xf4, \
+  0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x1f, 0x02, \
+  0x4a, 0xfa, 0x88, 0xe2, 0x75, 0x86, 0xc7, 0xbb, 0xd4, 0xf2, 0xa2, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xb9, 0xef, 0x46, 0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, 0xd0, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_nokey 148u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_nested_nokey (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0x27, 0xfa, 0x58, 0xe0, 0x11, 0x9f, \
+  0xec, 0x70, 0xf0, 0x5c, 0xa8, 0xed, 0x66, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x77, 0x9d, 0xff, 0x7e, 0x21, \
+  0x45, 0xf4, 0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x77, 0x9d, \
+  0xff, 0x7e, 0x21, 0x45, 0xf4, 0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xed, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x1f, 0x02, \
+  0x4a, 0xfa, 0x88, 0xe2, 0x75, 0x86, 0xc7, 0xbb, 0xd4, 0xf2, 0xa2, 0x00, 0x6d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, \
+  0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x5f, 0x6e, 0x6f, 0x6b, 0x65, 0x79, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xb9, 0xef, 0x46, 0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, \
+  0xd0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xef, \
+  0x46, 0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, 0xd0, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, \
+  0x74, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x76, 0x1f, 0x02, 0x4a, 0xfa, 0x88, 0xe2, 0x75, 0x86, 0xc7, 0xbb, 0xd4, 0xf2, 0xa2, 0xf1, \
+  0x2b, 0x27, 0xfa, 0x58, 0xe0, 0x11, 0x9f, 0xec, 0x70, 0xf0, 0x5c, 0xa8, 0xed, 0x66, 0xf2, 0xb9, \
+  0xef, 0x46, 0x60, 0xcd, 0xd4, 0xed, 0x1e, 0x6a, 0x96, 0x45, 0xd6, 0x69, 0xd0, 0xf1, 0x77, 0x9d, \
+  0xff, 0x7e, 0x21, 0x45, 0xf4, 0x18, 0xb5, 0xfa, 0x6b, 0x01, 0x5e, 0xb3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_nokey 444u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_struct_nested_nokey_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_struct_nested_nokey),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_struct_nested_nokey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_struct_nested_nokey",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamDataTypeInfo_dti_struct_nested_nokey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_struct_nested_nokey, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_nokey },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_struct_nested_nokey, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_struct_nested_nokey }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_ops [] =
+{
+  /* dti_union */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_union, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (CdrStreamDataTypeInfo_dti_union, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 6e08bdf9d28c50fea0d5d8a85aad] (#deps: 0)
+  [COMPLETE d20088dfe90b0809b8831aaa7f93] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, 0xd2, 0x8c, 0x50, 0xfe, 0xa0, 0xd5, 0xd8, \
+  0xa8, 0x5a, 0xad, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0x00, 0x88, 0xdf, 0xe9, 0x0b, 0x08, 0x09, 0xb8, 0x83, 0x1a, \
+  0xaa, 0x7f, 0x93, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, 0xd2, 0x8c, 0x50, \
+  0xfe, 0xa0, 0xd5, 0xd8, 0xa8, 0x5a, 0xad, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x7d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0x00, 0x88, 0xdf, 0xe9, 0x0b, 0x08, 0x09, 0xb8, 0x83, 0x1a, \
+  0xaa, 0x7f, 0x93, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0x00, 0x88, 0xdf, 0xe9, 0x0b, 0x08, \
+  0x09, 0xb8, 0x83, 0x1a, 0xaa, 0x7f, 0x93, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, 0xd2, 0x8c, 0x50, 0xfe, \
+  0xa0, 0xd5, 0xd8, 0xa8, 0x5a, 0xad\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union 246u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_string_ops [] =
+{
+  /* dti_union_string */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_union_string, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 1, offsetof (CdrStreamDataTypeInfo_dti_union_string, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 12965efb60e48074175697fcd7e3] (#deps: 0)
+  [COMPLETE ebe21034f82c8d28b352af0c6cec] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_string (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x12, 0x96, 0x5e, 0xfb, 0x60, 0xe4, 0x80, 0x74, 0x17, 0x56, 0x97, \
+  0xfc, 0xd7, 0xe3, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xe2, 0x10, 0x34, 0xf8, 0x2c, 0x8d, 0x28, 0xb3, 0x52, 0xaf, \
+  0x0c, 0x6c, 0xec, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_string 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_string (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x12, 0x96, 0x5e, 0xfb, 0x60, 0xe4, 0x80, \
+  0x74, 0x17, 0x56, 0x97, 0xfc, 0xd7, 0xe3, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x81, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xe2, 0x10, 0x34, 0xf8, 0x2c, 0x8d, 0x28, 0xb3, 0x52, 0xaf, \
+  0x0c, 0x6c, 0xec, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xe2, 0x10, \
+  0x34, 0xf8, 0x2c, 0x8d, 0x28, 0xb3, 0x52, 0xaf, 0x0c, 0x6c, 0xec, 0xf1, 0x12, 0x96, 0x5e, 0xfb, \
+  0x60, 0xe4, 0x80, 0x74, 0x17, 0x56, 0x97, 0xfc, 0xd7, 0xe3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_string 250u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_string_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union_string),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union_string),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union_string",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_string_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_string, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_string },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_string, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_string }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_enum_ops [] =
+{
+  /* dti_union_enum */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamDataTypeInfo_dti_union_enum, _d), 1u, (9u << 16u) + 5u, 1u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, CdrStreamDataTypeInfo_E1, offsetof (CdrStreamDataTypeInfo_dti_union_enum, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL fb693540b7a8504d1b3025cddc13] (#deps: 1)
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+  [COMPLETE 7c4f9847dc2f7b2c642a7a72e13f] (#deps: 1)
+   - [COMPLETE 1b1ee1251528c38788f0a4b2dee7]
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_enum (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xfb, 0x69, 0x35, 0x40, 0xb7, 0xa8, 0x50, 0x4d, 0x1b, 0x30, 0x25, \
+  0xcd, 0xdc, 0x13, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x4f, 0x98, \
+  0x47, 0xdc, 0x2f, 0x7b, 0x2c, 0x64, 0x2a, 0x7a, 0x72, 0xe1, 0x3f, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x1b, 0x1e, 0xe1, 0x25, 0x15, 0x28, 0xc3, 0x87, 0x88, 0xf0, 0xa4, 0xb2, 0xde, 0xe7, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_enum 148u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_enum (const unsigned char []){ \
+  0xa6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xfb, 0x69, 0x35, 0x40, 0xb7, 0xa8, 0x50, \
+  0x4d, 0x1b, 0x30, 0x25, 0xcd, 0xdc, 0x13, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, \
+  0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x16, 0xce, 0x50, \
+  0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x4f, 0x98, 0x47, 0xdc, 0x2f, 0x7b, 0x2c, 0x64, 0x2a, 0x7a, \
+  0x72, 0xe1, 0x3f, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, \
+  0x74, 0x69, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x11, 0x00, 0xf2, 0x1b, 0x1e, 0xe1, 0x25, 0x15, 0x28, 0xc3, 0x87, 0x88, \
+  0xf0, 0xa4, 0xb2, 0xde, 0xe7, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x1b, 0x1e, \
+  0xe1, 0x25, 0x15, 0x28, 0xc3, 0x87, 0x88, 0xf0, 0xa4, 0xb2, 0xde, 0xe7, 0x69, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x4f, 0x98, 0x47, 0xdc, 0x2f, 0x7b, 0x2c, 0x64, 0x2a, 0x7a, \
+  0x72, 0xe1, 0x3f, 0xf1, 0xfb, 0x69, 0x35, 0x40, 0xb7, 0xa8, 0x50, 0x4d, 0x1b, 0x30, 0x25, 0xcd, \
+  0xdc, 0x13, 0xf2, 0x1b, 0x1e, 0xe1, 0x25, 0x15, 0x28, 0xc3, 0x87, 0x88, 0xf0, 0xa4, 0xb2, 0xde, \
+  0xe7, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_enum 512u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_enum_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union_enum),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union_enum),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union_enum",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_enum_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_enum, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_enum },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_enum, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_enum }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_seq_ops [] =
+{
+  /* dti_union_seq */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_union_seq, _d), 1u, (11u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 4, 1, offsetof (CdrStreamDataTypeInfo_dti_union_seq, _u.f1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 76aaed97b5cdad652b1f43984194] (#deps: 0)
+  [COMPLETE f95cb42da7d1f467a9c2c5a744cd] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_seq (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x76, 0xaa, 0xed, 0x97, 0xb5, 0xcd, 0xad, 0x65, 0x2b, 0x1f, 0x43, \
+  0x98, 0x41, 0x94, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xb4, 0x2d, 0xa7, 0xd1, 0xf4, 0x67, 0xa9, 0xc2, 0xc5, \
+  0xa7, 0x44, 0xcd, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_seq 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_seq (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x76, 0xaa, 0xed, 0x97, 0xb5, 0xcd, 0xad, \
+  0x65, 0x2b, 0x1f, 0x43, 0x98, 0x41, 0x94, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, \
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xb4, 0x2d, 0xa7, 0xd1, 0xf4, \
+  0x67, 0xa9, 0xc2, 0xc5, 0xa7, 0x44, 0xcd, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x65, 0x71, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xb4, 0x2d, 0xa7, 0xd1, 0xf4, 0x67, 0xa9, 0xc2, 0xc5, \
+  0xa7, 0x44, 0xcd, 0xf1, 0x76, 0xaa, 0xed, 0x97, 0xb5, 0xcd, 0xad, 0x65, 0x2b, 0x1f, 0x43, 0x98, \
+  0x41, 0x94\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_seq 258u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_seq_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union_seq),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union_seq),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union_seq",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_seq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_seq, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_seq },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_seq, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_seq }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_arr_ops [] =
+{
+  /* dti_union_arr */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_union_arr, _d), 1u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 4, 1, offsetof (CdrStreamDataTypeInfo_dti_union_arr, _u.f1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5297e233ba739632ae0c961dbded] (#deps: 0)
+  [COMPLETE 0f91d6a3243a5622470fea18922a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_arr (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x97, 0xe2, 0x33, 0xba, 0x73, 0x96, 0x32, 0xae, 0x0c, 0x96, \
+  0x1d, 0xbd, 0xed, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x91, 0xd6, 0xa3, 0x24, 0x3a, 0x56, 0x22, 0x47, 0x0f, 0xea, \
+  0x18, 0x92, 0x2a, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_arr 100u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_arr (const unsigned char []){ \
+  0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x97, 0xe2, 0x33, 0xba, 0x73, 0x96, \
+  0x32, 0xae, 0x0c, 0x96, 0x1d, 0xbd, 0xed, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x0f, 0x91, 0xd6, 0xa3, 0x24, 0x3a, 0x56, 0x22, 0x47, 0x0f, 0xea, 0x18, 0x92, 0x2a, 0x00, \
+  0x75, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, \
+  0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x75, \
+  0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x91, 0xd6, 0xa3, 0x24, 0x3a, 0x56, 0x22, 0x47, 0x0f, 0xea, \
+  0x18, 0x92, 0x2a, 0xf1, 0x52, 0x97, 0xe2, 0x33, 0xba, 0x73, 0x96, 0x32, 0xae, 0x0c, 0x96, 0x1d, \
+  0xbd, 0xed\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_arr 274u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_arr_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union_arr),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union_arr),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union_arr",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_arr_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_arr, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_arr },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_arr, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_arr }
+};
+
+static const uint32_t CdrStreamDataTypeInfo_dti_union_struct_ops [] =
+{
+  /* dti_union_struct */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_union_struct, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 5 /* dti_struct */, 1, offsetof (CdrStreamDataTypeInfo_dti_union_struct, _u.f1), 0u,
+  DDS_OP_RTS,
+
+  /* dti_struct */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamDataTypeInfo_dti_struct, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 1a85374e36b44dca2e5401e89be0] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE f823c5ccb9f9966d9e583dafc2b6] (#deps: 1)
+   - [COMPLETE a0a86a54799dd46c30a8c608727d]
+*/
+#define TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_struct (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1a, 0x85, 0x37, 0x4e, 0x36, 0xb4, 0x4d, 0xca, 0x2e, 0x54, 0x01, \
+  0xe8, 0x9b, 0xe0, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x23, 0xc5, \
+  0xcc, 0xb9, 0xf9, 0x96, 0x6d, 0x9e, 0x58, 0x3d, 0xaf, 0xc2, 0xb6, 0x00, 0x7d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x00, \
+  0x55, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_struct 148u
+#define TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_struct (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x1a, 0x85, 0x37, 0x4e, 0x36, 0xb4, 0x4d, \
+  0xca, 0x2e, 0x54, 0x01, 0xe8, 0x9b, 0xe0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xf5, 0x4b, 0x39, \
+  0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x23, 0xc5, \
+  0xcc, 0xb9, 0xf9, 0x96, 0x6d, 0x9e, 0x58, 0x3d, 0xaf, 0xc2, 0xb6, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, \
+  0x65, 0x49, 0x6e, 0x66, 0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, \
+  0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, \
+  0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, \
+  0xd4, 0x6c, 0x30, 0xa8, 0xc6, 0x08, 0x72, 0x7d, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x49, 0x6e, 0x66, \
+  0x6f, 0x3a, 0x3a, 0x64, 0x74, 0x69, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x23, 0xc5, 0xcc, 0xb9, 0xf9, 0x96, \
+  0x6d, 0x9e, 0x58, 0x3d, 0xaf, 0xc2, 0xb6, 0xf1, 0x1a, 0x85, 0x37, 0x4e, 0x36, 0xb4, 0x4d, 0xca, \
+  0x2e, 0x54, 0x01, 0xe8, 0x9b, 0xe0, 0xf2, 0xa0, 0xa8, 0x6a, 0x54, 0x79, 0x9d, 0xd4, 0x6c, 0x30, \
+  0xa8, 0xc6, 0x08, 0x72, 0x7d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, \
+  0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_struct 468u
+const dds_topic_descriptor_t CdrStreamDataTypeInfo_dti_union_struct_desc =
+{
+  .m_size = sizeof (CdrStreamDataTypeInfo_dti_union_struct),
+  .m_align = dds_alignof (CdrStreamDataTypeInfo_dti_union_struct),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamDataTypeInfo::dti_union_struct",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamDataTypeInfo_dti_union_struct_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamDataTypeInfo_dti_union_struct, .sz = TYPE_INFO_CDR_SZ_CdrStreamDataTypeInfo_dti_union_struct },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamDataTypeInfo_dti_union_struct, .sz = TYPE_MAP_CDR_SZ_CdrStreamDataTypeInfo_dti_union_struct }
+};
+
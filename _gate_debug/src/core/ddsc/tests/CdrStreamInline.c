@@ -0,0 +1,258 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamInline.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamInline.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamInline.h"
+
+static const uint32_t CdrStreamInline_sub_ops [] =
+{
+  /* sub */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_sub, x),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamInline_sub, s),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a37a5aefd9ffad87516c32f2c325] (#deps: 0)
+  [COMPLETE 663d87801c574abc985e2f802185] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamInline_sub (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, 0x32, \
+  0xf2, 0xc3, 0x25, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, \
+  0x80, 0x21, 0x85, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamInline_sub 100u
+#define TYPE_MAP_CDR_CdrStreamInline_sub (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, \
+  0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, \
+  0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x3a, 0x73, 0x75, 0x62, \
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x73, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x66, 0x3d, 0x87, \
+  0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, \
+  0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamInline_sub 234u
+const dds_topic_descriptor_t CdrStreamInline_sub_desc =
+{
+  .m_size = sizeof (CdrStreamInline_sub),
+  .m_align = dds_alignof (CdrStreamInline_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamInline::sub",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamInline_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamInline_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamInline_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamInline_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamInline_sub }
+};
+
+static const uint32_t CdrStreamInline_t_ops [] =
+{
+  /* t */
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_t, a), 5u,
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_1BY, offsetof (CdrStreamInline_t, b), 3u,
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BST, offsetof (CdrStreamInline_t, c), 2u, 5u,
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STR, offsetof (CdrStreamInline_t, d), 3u,
+  DDS_OP_ADR | DDS_OP_FLAG_INL | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STU, offsetof (CdrStreamInline_t, e), 2u, sizeof (CdrStreamInline_sub), (5u << 16u) + 8u /* sub */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_t, f),
+  DDS_OP_RTS,
+
+  /* sub */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_sub, x),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamInline_sub, s),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5817a4feb5e043edc0e1f6e9c930] (#deps: 1)
+   - [MINIMAL a37a5aefd9ffad87516c32f2c325]
+  [COMPLETE d4e6f64660fbd5e6b67138978cb6] (#deps: 1)
+   - [COMPLETE 663d87801c574abc985e2f802185]
+*/
+#define TYPE_INFO_CDR_CdrStreamInline_t (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, 0xed, 0xc0, 0xe1, 0xf6, \
+  0xe9, 0xc9, 0x30, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, \
+  0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0xe6, 0xf6, \
+  0x46, 0x60, 0xfb, 0xd5, 0xe6, 0xb6, 0x71, 0x38, 0x97, 0x8c, 0xb6, 0x00, 0xd4, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0x00, \
+  0x5c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamInline_t 148u
+#define TYPE_MAP_CDR_CdrStreamInline_t (const unsigned char []){ \
+  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, \
+  0xed, 0xc0, 0xe1, 0xf6, 0xe9, 0xc9, 0x30, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0x0c, 0xc1, 0x75, 0xb9, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x03, 0x02, 0x92, 0xeb, 0x5f, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, 0x04, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x70, \
+  0x00, 0x82, 0x77, 0xe0, 0x91, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x02, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, 0x87, \
+  0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8f, 0xa1, 0x4c, 0xdd, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, \
+  0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x9d, \
+  0xd4, 0xe4, 0x61, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x03, 0xc7, 0xc0, 0xac, 0x54, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0xe6, 0xf6, \
+  0x46, 0x60, 0xfb, 0xd5, 0xe6, 0xb6, 0x71, 0x38, 0x97, 0x8c, 0xb6, 0x00, 0xd0, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x3a, \
+  0x3a, 0x74, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, 0x04, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, \
+  0x01, 0x00, 0x02, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, \
+  0x21, 0x85, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, \
+  0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x49, 0x6e, 0x6c, \
+  0x69, 0x6e, 0x65, 0x3a, 0x3a, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0xe6, 0xf6, 0x46, 0x60, 0xfb, 0xd5, 0xe6, 0xb6, 0x71, 0x38, \
+  0x97, 0x8c, 0xb6, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, 0xed, 0xc0, 0xe1, 0xf6, 0xe9, \
+  0xc9, 0x30, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, \
+  0x85, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamInline_t 672u
+const dds_topic_descriptor_t CdrStreamInline_t_desc =
+{
+  .m_size = sizeof (CdrStreamInline_t),
+  .m_align = dds_alignof (CdrStreamInline_t),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamInline::t",
+  .m_keys = NULL,
+  .m_nops = 10,
+  .m_ops = CdrStreamInline_t_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamInline_t, .sz = TYPE_INFO_CDR_SZ_CdrStreamInline_t },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamInline_t, .sz = TYPE_MAP_CDR_SZ_CdrStreamInline_t }
+};
+
+static const uint32_t CdrStreamInline_t_ref_ops [] =
+{
+  /* t_ref */
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_t_ref, a), 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_1BY, offsetof (CdrStreamInline_t_ref, b), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BST, offsetof (CdrStreamInline_t_ref, c), 2u, 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STR, offsetof (CdrStreamInline_t_ref, d), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STU, offsetof (CdrStreamInline_t_ref, e), 2u, sizeof (CdrStreamInline_sub), (5u << 16u) + 8u /* sub */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_t_ref, f),
+  DDS_OP_RTS,
+
+  /* sub */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamInline_sub, x),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamInline_sub, s),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5817a4feb5e043edc0e1f6e9c930] (#deps: 1)
+   - [MINIMAL a37a5aefd9ffad87516c32f2c325]
+  [COMPLETE 6b26d9724028c3d822fda963fa7a] (#deps: 1)
+   - [COMPLETE 663d87801c574abc985e2f802185]
+*/
+#define TYPE_INFO_CDR_CdrStreamInline_t_ref (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, 0xed, 0xc0, 0xe1, 0xf6, \
+  0xe9, 0xc9, 0x30, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, \
+  0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0x26, 0xd9, \
+  0x72, 0x40, 0x28, 0xc3, 0xd8, 0x22, 0xfd, 0xa9, 0x63, 0xfa, 0x7a, 0x00, 0xd8, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0x00, \
+  0x5c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamInline_t_ref 148u
+#define TYPE_MAP_CDR_CdrStreamInline_t_ref (const unsigned char []){ \
+  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, \
+  0xed, 0xc0, 0xe1, 0xf6, 0xe9, 0xc9, 0x30, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0x0c, 0xc1, 0x75, 0xb9, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x03, 0x02, 0x92, 0xeb, 0x5f, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, 0x04, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x70, \
+  0x00, 0x82, 0x77, 0xe0, 0x91, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x02, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, 0x87, \
+  0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8f, 0xa1, 0x4c, 0xdd, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, \
+  0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, 0x32, 0xf2, 0xc3, 0x25, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x9d, \
+  0xd4, 0xe4, 0x61, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x03, 0xc7, 0xc0, 0xac, 0x58, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0x26, 0xd9, \
+  0x72, 0x40, 0x28, 0xc3, 0xd8, 0x22, 0xfd, 0xa9, 0x63, 0xfa, 0x7a, 0x00, 0xd4, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x3a, \
+  0x3a, 0x74, 0x5f, 0x72, 0x65, 0x66, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, \
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x02, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, \
+  0x98, 0x5e, 0x2f, 0x80, 0x21, 0x85, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, 0x5e, 0x2f, \
+  0x80, 0x21, 0x85, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x3a, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0x26, 0xd9, 0x72, 0x40, 0x28, 0xc3, \
+  0xd8, 0x22, 0xfd, 0xa9, 0x63, 0xfa, 0x7a, 0xf1, 0x58, 0x17, 0xa4, 0xfe, 0xb5, 0xe0, 0x43, 0xed, \
+  0xc0, 0xe1, 0xf6, 0xe9, 0xc9, 0x30, 0xf2, 0x66, 0x3d, 0x87, 0x80, 0x1c, 0x57, 0x4a, 0xbc, 0x98, \
+  0x5e, 0x2f, 0x80, 0x21, 0x85, 0xf1, 0xa3, 0x7a, 0x5a, 0xef, 0xd9, 0xff, 0xad, 0x87, 0x51, 0x6c, \
+  0x32, 0xf2, 0xc3, 0x25\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamInline_t_ref 676u
+const dds_topic_descriptor_t CdrStreamInline_t_ref_desc =
+{
+  .m_size = sizeof (CdrStreamInline_t_ref),
+  .m_align = dds_alignof (CdrStreamInline_t_ref),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamInline::t_ref",
+  .m_keys = NULL,
+  .m_nops = 10,
+  .m_ops = CdrStreamInline_t_ref_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamInline_t_ref, .sz = TYPE_INFO_CDR_SZ_CdrStreamInline_t_ref },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamInline_t_ref, .sz = TYPE_MAP_CDR_SZ_CdrStreamInline_t_ref }
+};
+
@@ -0,0 +1,157 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamInline.h
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamInline.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMINLINE_H_D2178128AD0156D4640BD0AF69CE59CB
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMINLINE_H_D2178128AD0156D4640BD0AF69CE59CB
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CdrStreamInline_sub
+{
+  int32_t x;
+  char * s;
+} CdrStreamInline_sub;
+
+extern const dds_topic_descriptor_t CdrStreamInline_sub_desc;
+
+#define CdrStreamInline_sub__alloc() \
+((CdrStreamInline_sub*) dds_alloc (sizeof (CdrStreamInline_sub)));
+
+#define CdrStreamInline_sub_free(d,o) \
+dds_sample_free ((d), &CdrStreamInline_sub_desc, (o))
+
+typedef struct CdrStreamInline_t
+{
+  struct { int32_t _buffer[5]; uint32_t _length; } a;
+  struct { uint8_t _buffer[3]; uint32_t _length; } b;
+  struct { char _buffer[2][5]; uint32_t _length; } c;
+  struct { char * _buffer[3]; uint32_t _length; } d;
+  struct { struct CdrStreamInline_sub _buffer[2]; uint32_t _length; } e;
+  int32_t f;
+} CdrStreamInline_t;
+
+extern const dds_topic_descriptor_t CdrStreamInline_t_desc;
+
+#define CdrStreamInline_t__alloc() \
+((CdrStreamInline_t*) dds_alloc (sizeof (CdrStreamInline_t)));
+
+#define CdrStreamInline_t_free(d,o) \
+dds_sample_free ((d), &CdrStreamInline_t_desc, (o))
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+#ifndef DDS_SEQUENCE_OCTET_DEFINED
+#define DDS_SEQUENCE_OCTET_DEFINED
+typedef struct dds_sequence_octet
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  uint8_t *_buffer;
+  bool _release;
+} dds_sequence_octet;
+
+#define dds_sequence_octet__alloc() \
+((dds_sequence_octet*) dds_alloc (sizeof (dds_sequence_octet)));
+
+#define dds_sequence_octet_allocbuf(l) \
+((uint8_t *) dds_alloc ((l) * sizeof (uint8_t)))
+#endif /* DDS_SEQUENCE_OCTET_DEFINED */
+
+#ifndef DDS_SEQUENCE_STRING4_DEFINED
+#define DDS_SEQUENCE_STRING4_DEFINED
+typedef struct dds_sequence_string4
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  char (*_buffer)[5];
+  bool _release;
+} dds_sequence_string4;
+
+#define dds_sequence_string4__alloc() \
+((dds_sequence_string4*) dds_alloc (sizeof (dds_sequence_string4)));
+
+#define dds_sequence_string4_allocbuf(l) \
+((char (*)[5]) dds_alloc ((l) * sizeof (char[5])))
+#endif /* DDS_SEQUENCE_STRING4_DEFINED */
+
+#ifndef DDS_SEQUENCE_STRING_DEFINED
+#define DDS_SEQUENCE_STRING_DEFINED
+typedef struct dds_sequence_string
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  char **_buffer;
+  bool _release;
+} dds_sequence_string;
+
+#define dds_sequence_string__alloc() \
+((dds_sequence_string*) dds_alloc (sizeof (dds_sequence_string)));
+
+#define dds_sequence_string_allocbuf(l) \
+((char **) dds_alloc ((l) * sizeof (char*)))
+#endif /* DDS_SEQUENCE_STRING_DEFINED */
+
+#ifndef DDS_SEQUENCE_CDRSTREAMINLINE_SUB_DEFINED
+#define DDS_SEQUENCE_CDRSTREAMINLINE_SUB_DEFINED
+typedef struct dds_sequence_CdrStreamInline_sub
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  struct CdrStreamInline_sub *_buffer;
+  bool _release;
+} dds_sequence_CdrStreamInline_sub;
+
+#define dds_sequence_CdrStreamInline_sub__alloc() \
+((dds_sequence_CdrStreamInline_sub*) dds_alloc (sizeof (dds_sequence_CdrStreamInline_sub)));
+
+#define dds_sequence_CdrStreamInline_sub_allocbuf(l) \
+((struct CdrStreamInline_sub *) dds_alloc ((l) * sizeof (struct CdrStreamInline_sub)))
+#endif /* DDS_SEQUENCE_CDRSTREAMINLINE_SUB_DEFINED */
+
+typedef struct CdrStreamInline_t_ref
+{
+  dds_sequence_long a;
+  dds_sequence_octet b;
+  dds_sequence_string4 c;
+  dds_sequence_string d;
+  dds_sequence_CdrStreamInline_sub e;
+  int32_t f;
+} CdrStreamInline_t_ref;
+
+extern const dds_topic_descriptor_t CdrStreamInline_t_ref_desc;
+
+#define CdrStreamInline_t_ref__alloc() \
+((CdrStreamInline_t_ref*) dds_alloc (sizeof (CdrStreamInline_t_ref)));
+
+#define CdrStreamInline_t_ref_free(d,o) \
+dds_sample_free ((d), &CdrStreamInline_t_ref_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMINLINE_H_D2178128AD0156D4640BD0AF69CE59CB */
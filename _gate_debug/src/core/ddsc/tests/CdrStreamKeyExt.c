@@ -0,0 +1,1604 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeyExt.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamKeyExt.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamKeyExt.h"
+
+static const uint32_t CdrStreamKeyExt_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t1, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t1_keys[1] =
+{
+  { "a", 3, 0 }
+};
+
+/* Type Information:
+  [MINIMAL a1d83db279f5c2e8e01af86a1a94] (#deps: 0)
+  [COMPLETE 2b36d4dcc7f1bcc27f3c8510217e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0xd8, 0x3d, 0xb2, 0x79, 0xf5, 0xc2, 0xe8, 0xe0, 0x1a, 0xf8, \
+  0x6a, 0x1a, 0x94, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0x36, 0xd4, 0xdc, 0xc7, 0xf1, 0xbc, 0xc2, 0x7f, 0x3c, 0x85, \
+  0x10, 0x21, 0x7e, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t1 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0xd8, 0x3d, 0xb2, 0x79, 0xf5, 0xc2, \
+  0xe8, 0xe0, 0x1a, 0xf8, 0x6a, 0x1a, 0x94, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0x36, 0xd4, 0xdc, 0xc7, 0xf1, 0xbc, \
+  0xc2, 0x7f, 0x3c, 0x85, 0x10, 0x21, 0x7e, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x74, 0x31, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0x36, 0xd4, 0xdc, 0xc7, 0xf1, 0xbc, 0xc2, 0x7f, 0x3c, 0x85, \
+  0x10, 0x21, 0x7e, 0xf1, 0xa1, 0xd8, 0x3d, 0xb2, 0x79, 0xf5, 0xc2, 0xe8, 0xe0, 0x1a, 0xf8, 0x6a, \
+  0x1a, 0x94\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t1 194u
+const dds_topic_descriptor_t CdrStreamKeyExt_t1_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t1),
+  .m_align = dds_alignof (CdrStreamKeyExt_t1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t1",
+  .m_keys = CdrStreamKeyExt_t1_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeyExt_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t1, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t1, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t1 }
+};
+
+static const uint32_t CdrStreamKeyExt_t1a_ops [] =
+{
+  /* t1a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t1a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t1a_keys[1] =
+{
+  { "a", 3, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 29c0468b7c0f182968ed3368a65a] (#deps: 0)
+  [COMPLETE 0c16813a51d513d4f072d48950ec] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t1a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x29, 0xc0, 0x46, 0x8b, 0x7c, 0x0f, 0x18, 0x29, 0x68, 0xed, 0x33, \
+  0x68, 0xa6, 0x5a, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0c, 0x16, 0x81, 0x3a, 0x51, 0xd5, 0x13, 0xd4, 0xf0, 0x72, 0xd4, \
+  0x89, 0x50, 0xec, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t1a 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t1a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x29, 0xc0, 0x46, 0x8b, 0x7c, 0x0f, 0x18, \
+  0x29, 0x68, 0xed, 0x33, 0x68, 0xa6, 0x5a, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0c, 0x16, 0x81, 0x3a, 0x51, 0xd5, 0x13, \
+  0xd4, 0xf0, 0x72, 0xd4, 0x89, 0x50, 0xec, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x74, 0x31, 0x61, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0c, 0x16, 0x81, 0x3a, 0x51, 0xd5, 0x13, \
+  0xd4, 0xf0, 0x72, 0xd4, 0x89, 0x50, 0xec, 0xf1, 0x29, 0xc0, 0x46, 0x8b, 0x7c, 0x0f, 0x18, 0x29, \
+  0x68, 0xed, 0x33, 0x68, 0xa6, 0x5a\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t1a 198u
+const dds_topic_descriptor_t CdrStreamKeyExt_t1a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t1a),
+  .m_align = dds_alignof (CdrStreamKeyExt_t1a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t1a",
+  .m_keys = CdrStreamKeyExt_t1a_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeyExt_t1a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t1a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t1a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t1a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t1a }
+};
+
+static const uint32_t CdrStreamKeyExt_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t2, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t2_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL cb759af86b19d1d45ed10355053c] (#deps: 0)
+  [COMPLETE 7ea9194b9a6125b14db5a4a94f2a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, \
+  0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xa9, 0x19, 0x4b, 0x9a, 0x61, 0x25, 0xb1, 0x4d, 0xb5, 0xa4, \
+  0xa9, 0x4f, 0x2a, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t2 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t2 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xa9, 0x19, 0x4b, 0x9a, 0x61, 0x25, \
+  0xb1, 0x4d, 0xb5, 0xa4, 0xa9, 0x4f, 0x2a, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x74, 0x32, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xa9, 0x19, 0x4b, 0x9a, 0x61, 0x25, 0xb1, 0x4d, 0xb5, 0xa4, \
+  0xa9, 0x4f, 0x2a, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, \
+  0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t2 194u
+const dds_topic_descriptor_t CdrStreamKeyExt_t2_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t2),
+  .m_align = dds_alignof (CdrStreamKeyExt_t2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t2",
+  .m_keys = CdrStreamKeyExt_t2_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeyExt_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t2, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t2, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t2 }
+};
+
+static const uint32_t CdrStreamKeyExt_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t3, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t3_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE b5f31dcba9f64d7d16622a5757df] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xf3, 0x1d, 0xcb, 0xa9, 0xf6, 0x4d, 0x7d, 0x16, 0x62, 0x2a, \
+  0x57, 0x57, 0xdf, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t3 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t3 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xf3, 0x1d, 0xcb, 0xa9, 0xf6, 0x4d, \
+  0x7d, 0x16, 0x62, 0x2a, 0x57, 0x57, 0xdf, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x74, 0x33, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xf3, 0x1d, 0xcb, 0xa9, 0xf6, 0x4d, 0x7d, 0x16, 0x62, 0x2a, \
+  0x57, 0x57, 0xdf, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, \
+  0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t3 194u
+const dds_topic_descriptor_t CdrStreamKeyExt_t3_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t3),
+  .m_align = dds_alignof (CdrStreamKeyExt_t3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t3",
+  .m_keys = CdrStreamKeyExt_t3_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t3, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t3, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t3 }
+};
+
+static const uint32_t CdrStreamKeyExt_nested4_ops [] =
+{
+  /* nested4 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested4_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL cb759af86b19d1d45ed10355053c] (#deps: 0)
+  [COMPLETE 0e347fff716aa340cb7d60387945] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested4 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, \
+  0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, 0x6a, 0xa3, 0x40, 0xcb, 0x7d, 0x60, \
+  0x38, 0x79, 0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested4 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, 0x6a, 0xa3, \
+  0x40, 0xcb, 0x7d, 0x60, 0x38, 0x79, 0x45, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x34, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x34, 0x7f, \
+  0xff, 0x71, 0x6a, 0xa3, 0x40, 0xcb, 0x7d, 0x60, 0x38, 0x79, 0x45, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, \
+  0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested4_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested4),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested4",
+  .m_keys = CdrStreamKeyExt_nested4_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeyExt_nested4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested4, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested4, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4 }
+};
+
+static const uint32_t CdrStreamKeyExt_t4_ops [] =
+{
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t4, a),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t4, b), (3u << 16u) + 4u /* nested4 */,
+  DDS_OP_RTS,
+
+  /* nested4 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t4_keys[1] =
+{
+  { "a", 10, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 61a548ae6be2b6c1edfc1fcc65b9] (#deps: 1)
+   - [MINIMAL cb759af86b19d1d45ed10355053c]
+  [COMPLETE bd761abd29239f23b6f2d9587378] (#deps: 1)
+   - [COMPLETE 0e347fff716aa340cb7d60387945]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t4 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x61, 0xa5, 0x48, 0xae, 0x6b, 0xe2, 0xb6, 0xc1, 0xed, 0xfc, 0x1f, \
+  0xcc, 0x65, 0xb9, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x76, 0x1a, \
+  0xbd, 0x29, 0x23, 0x9f, 0x23, 0xb6, 0xf2, 0xd9, 0x58, 0x73, 0x78, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, 0x6a, 0xa3, 0x40, 0xcb, 0x7d, 0x60, 0x38, 0x79, 0x45, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t4 (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x61, 0xa5, 0x48, 0xae, 0x6b, 0xe2, 0xb6, \
+  0xc1, 0xed, 0xfc, 0x1f, 0xcc, 0x65, 0xb9, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, \
+  0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xcb, 0x75, \
+  0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x76, 0x1a, \
+  0xbd, 0x29, 0x23, 0x9f, 0x23, 0xb6, 0xf2, 0xd9, 0x58, 0x73, 0x78, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x34, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, \
+  0x6a, 0xa3, 0x40, 0xcb, 0x7d, 0x60, 0x38, 0x79, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, 0x6a, 0xa3, 0x40, 0xcb, 0x7d, 0x60, \
+  0x38, 0x79, 0x45, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x34, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x76, 0x1a, 0xbd, 0x29, 0x23, 0x9f, \
+  0x23, 0xb6, 0xf2, 0xd9, 0x58, 0x73, 0x78, 0xf1, 0x61, 0xa5, 0x48, 0xae, 0x6b, 0xe2, 0xb6, 0xc1, \
+  0xed, 0xfc, 0x1f, 0xcc, 0x65, 0xb9, 0xf2, 0x0e, 0x34, 0x7f, 0xff, 0x71, 0x6a, 0xa3, 0x40, 0xcb, \
+  0x7d, 0x60, 0x38, 0x79, 0x45, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, \
+  0x03, 0x55, 0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4 436u
+const dds_topic_descriptor_t CdrStreamKeyExt_t4_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t4),
+  .m_align = dds_alignof (CdrStreamKeyExt_t4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t4",
+  .m_keys = CdrStreamKeyExt_t4_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeyExt_t4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t4, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t4, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4 }
+};
+
+static const uint32_t CdrStreamKeyExt_nested4a_ops [] =
+{
+  /* nested4a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested4a_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL cb759af86b19d1d45ed10355053c] (#deps: 0)
+  [COMPLETE 7dd8374e085edb1f20333a2b8f9b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested4a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, \
+  0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0xd8, 0x37, 0x4e, 0x08, 0x5e, 0xdb, 0x1f, 0x20, 0x33, 0x3a, \
+  0x2b, 0x8f, 0x9b, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4a 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested4a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0xd8, 0x37, 0x4e, 0x08, 0x5e, 0xdb, \
+  0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x34, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0xd8, 0x37, \
+  0x4e, 0x08, 0x5e, 0xdb, 0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, \
+  0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4a 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested4a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested4a),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested4a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested4a",
+  .m_keys = CdrStreamKeyExt_nested4a_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeyExt_nested4a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested4a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested4a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4a }
+};
+
+static const uint32_t CdrStreamKeyExt_t4a_ops [] =
+{
+  /* t4a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t4a, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t4a, b), (3u << 16u) + 4u /* nested4a */,
+  DDS_OP_RTS,
+
+  /* nested4a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 2u /* order: 1 */, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t4a_keys[2] =
+{
+  { "a", 10, 0 },
+  { "b.a", 12, 1 }
+};
+
+/* Type Information:
+  [MINIMAL d06287dd69028436e0a8c0d2ff34] (#deps: 1)
+   - [MINIMAL cb759af86b19d1d45ed10355053c]
+  [COMPLETE 3b33129a387005728655ae329a4c] (#deps: 1)
+   - [COMPLETE 7dd8374e085edb1f20333a2b8f9b]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t4a (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd0, 0x62, 0x87, 0xdd, 0x69, 0x02, 0x84, 0x36, 0xe0, 0xa8, 0xc0, \
+  0xd2, 0xff, 0x34, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x33, 0x12, \
+  0x9a, 0x38, 0x70, 0x05, 0x72, 0x86, 0x55, 0xae, 0x32, 0x9a, 0x4c, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7d, 0xd8, 0x37, 0x4e, 0x08, 0x5e, 0xdb, 0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4a 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t4a (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd0, 0x62, 0x87, 0xdd, 0x69, 0x02, 0x84, \
+  0x36, 0xe0, 0xa8, 0xc0, 0xd2, 0xff, 0x34, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, \
+  0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xcb, 0x75, \
+  0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x33, 0x12, \
+  0x9a, 0x38, 0x70, 0x05, 0x72, 0x86, 0x55, 0xae, 0x32, 0x9a, 0x4c, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x34, 0x61, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x7d, \
+  0xd8, 0x37, 0x4e, 0x08, 0x5e, 0xdb, 0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0xd8, 0x37, 0x4e, 0x08, 0x5e, 0xdb, \
+  0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x34, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x33, 0x12, \
+  0x9a, 0x38, 0x70, 0x05, 0x72, 0x86, 0x55, 0xae, 0x32, 0x9a, 0x4c, 0xf1, 0xd0, 0x62, 0x87, 0xdd, \
+  0x69, 0x02, 0x84, 0x36, 0xe0, 0xa8, 0xc0, 0xd2, 0xff, 0x34, 0xf2, 0x7d, 0xd8, 0x37, 0x4e, 0x08, \
+  0x5e, 0xdb, 0x1f, 0x20, 0x33, 0x3a, 0x2b, 0x8f, 0x9b, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, \
+  0xd1, 0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4a 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t4a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t4a),
+  .m_align = dds_alignof (CdrStreamKeyExt_t4a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t4a",
+  .m_keys = CdrStreamKeyExt_t4a_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeyExt_t4a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t4a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t4a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4a }
+};
+
+static const uint32_t CdrStreamKeyExt_nested4b_ops [] =
+{
+  /* nested4b */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4b, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a44a43efce1eca96e18936f7d24d] (#deps: 0)
+  [COMPLETE 45d61319e260d4b74ec1342641ef] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested4b (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, \
+  0xf7, 0xd2, 0x4d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x45, 0xd6, 0x13, 0x19, 0xe2, 0x60, 0xd4, 0xb7, 0x4e, 0xc1, 0x34, \
+  0x26, 0x41, 0xef, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4b 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested4b (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, \
+  0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x45, 0xd6, 0x13, 0x19, 0xe2, 0x60, 0xd4, \
+  0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x34, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x45, 0xd6, 0x13, \
+  0x19, 0xe2, 0x60, 0xd4, 0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0xf1, 0xa4, 0x4a, 0x43, 0xef, \
+  0xce, 0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4b 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested4b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested4b),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested4b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamKeyExt::nested4b",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeyExt_nested4b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested4b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested4b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested4b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested4b }
+};
+
+static const uint32_t CdrStreamKeyExt_t4b_ops [] =
+{
+  /* t4b */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t4b, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t4b, b), (3u << 16u) + 4u /* nested4b */,
+  DDS_OP_RTS,
+
+  /* nested4b */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested4b, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 2u /* order: 1 */, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t4b_keys[2] =
+{
+  { "a", 10, 0 },
+  { "b.a", 12, 1 }
+};
+
+/* Type Information:
+  [MINIMAL ca76345d25acd38e4b7221a9db29] (#deps: 1)
+   - [MINIMAL a44a43efce1eca96e18936f7d24d]
+  [COMPLETE ac13a51ce218a15d5a0f2b11f375] (#deps: 1)
+   - [COMPLETE 45d61319e260d4b74ec1342641ef]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t4b (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xca, 0x76, 0x34, 0x5d, 0x25, 0xac, 0xd3, 0x8e, 0x4b, 0x72, 0x21, \
+  0xa9, 0xdb, 0x29, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, \
+  0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x13, 0xa5, \
+  0x1c, 0xe2, 0x18, 0xa1, 0x5d, 0x5a, 0x0f, 0x2b, 0x11, 0xf3, 0x75, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x45, 0xd6, 0x13, 0x19, 0xe2, 0x60, 0xd4, 0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4b 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t4b (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xca, 0x76, 0x34, 0x5d, 0x25, 0xac, 0xd3, \
+  0x8e, 0x4b, 0x72, 0x21, 0xa9, 0xdb, 0x29, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, \
+  0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xa4, 0x4a, \
+  0x43, 0xef, 0xce, 0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x13, 0xa5, \
+  0x1c, 0xe2, 0x18, 0xa1, 0x5d, 0x5a, 0x0f, 0x2b, 0x11, 0xf3, 0x75, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x34, 0x62, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x45, \
+  0xd6, 0x13, 0x19, 0xe2, 0x60, 0xd4, 0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0x45, 0xd6, 0x13, 0x19, 0xe2, 0x60, 0xd4, \
+  0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x34, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x13, 0xa5, \
+  0x1c, 0xe2, 0x18, 0xa1, 0x5d, 0x5a, 0x0f, 0x2b, 0x11, 0xf3, 0x75, 0xf1, 0xca, 0x76, 0x34, 0x5d, \
+  0x25, 0xac, 0xd3, 0x8e, 0x4b, 0x72, 0x21, 0xa9, 0xdb, 0x29, 0xf2, 0x45, 0xd6, 0x13, 0x19, 0xe2, \
+  0x60, 0xd4, 0xb7, 0x4e, 0xc1, 0x34, 0x26, 0x41, 0xef, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, \
+  0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4b 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t4b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t4b),
+  .m_align = dds_alignof (CdrStreamKeyExt_t4b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t4b",
+  .m_keys = CdrStreamKeyExt_t4b_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeyExt_t4b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t4b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t4b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t4b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t4b }
+};
+
+static const uint32_t CdrStreamKeyExt_nested5_ops [] =
+{
+  /* nested5 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested5_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE 386e1132496c1b3e9563ea317a6c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested5 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, 0x6c, 0x1b, 0x3e, 0x95, 0x63, 0xea, \
+  0x31, 0x7a, 0x6c, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested5 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, 0x6c, 0x1b, \
+  0x3e, 0x95, 0x63, 0xea, 0x31, 0x7a, 0x6c, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x35, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x38, 0x6e, 0x11, \
+  0x32, 0x49, 0x6c, 0x1b, 0x3e, 0x95, 0x63, 0xea, 0x31, 0x7a, 0x6c, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, \
+  0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested5_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested5),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested5",
+  .m_keys = CdrStreamKeyExt_nested5_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested5, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested5, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5 }
+};
+
+static const uint32_t CdrStreamKeyExt_t5_ops [] =
+{
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t5, a),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t5, b), (3u << 16u) + 4u /* nested5 */,
+  DDS_OP_RTS,
+
+  /* nested5 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t5_keys[1] =
+{
+  { "a", 13, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 02b055c2ab7eded0f301b293b634] (#deps: 1)
+   - [MINIMAL 8ed004a8b6ef7f879094d486b650]
+  [COMPLETE c5f70366772d48441fd0e863af17] (#deps: 1)
+   - [COMPLETE 386e1132496c1b3e9563ea317a6c]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t5 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x02, 0xb0, 0x55, 0xc2, 0xab, 0x7e, 0xde, 0xd0, 0xf3, 0x01, 0xb2, \
+  0x93, 0xb6, 0x34, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xf7, 0x03, \
+  0x66, 0x77, 0x2d, 0x48, 0x44, 0x1f, 0xd0, 0xe8, 0x63, 0xaf, 0x17, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, 0x6c, 0x1b, 0x3e, 0x95, 0x63, 0xea, 0x31, 0x7a, 0x6c, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t5 (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x02, 0xb0, 0x55, 0xc2, 0xab, 0x7e, 0xde, \
+  0xd0, 0xf3, 0x01, 0xb2, 0x93, 0xb6, 0x34, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, \
+  0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x8e, 0xd0, \
+  0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xf7, 0x03, \
+  0x66, 0x77, 0x2d, 0x48, 0x44, 0x1f, 0xd0, 0xe8, 0x63, 0xaf, 0x17, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x35, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, \
+  0x6c, 0x1b, 0x3e, 0x95, 0x63, 0xea, 0x31, 0x7a, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, 0x6c, 0x1b, 0x3e, 0x95, 0x63, 0xea, \
+  0x31, 0x7a, 0x6c, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x35, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xf7, 0x03, 0x66, 0x77, 0x2d, 0x48, \
+  0x44, 0x1f, 0xd0, 0xe8, 0x63, 0xaf, 0x17, 0xf1, 0x02, 0xb0, 0x55, 0xc2, 0xab, 0x7e, 0xde, 0xd0, \
+  0xf3, 0x01, 0xb2, 0x93, 0xb6, 0x34, 0xf2, 0x38, 0x6e, 0x11, 0x32, 0x49, 0x6c, 0x1b, 0x3e, 0x95, \
+  0x63, 0xea, 0x31, 0x7a, 0x6c, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, \
+  0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5 436u
+const dds_topic_descriptor_t CdrStreamKeyExt_t5_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t5),
+  .m_align = dds_alignof (CdrStreamKeyExt_t5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t5",
+  .m_keys = CdrStreamKeyExt_t5_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeyExt_t5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t5, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t5, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5 }
+};
+
+static const uint32_t CdrStreamKeyExt_nested5a_ops [] =
+{
+  /* nested5a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested5a_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE bcc6f8e8c74ced856bbb0fdeb23d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested5a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xc6, 0xf8, 0xe8, 0xc7, 0x4c, 0xed, 0x85, 0x6b, 0xbb, 0x0f, \
+  0xde, 0xb2, 0x3d, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5a 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested5a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xc6, 0xf8, 0xe8, 0xc7, 0x4c, 0xed, \
+  0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x35, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xc6, 0xf8, \
+  0xe8, 0xc7, 0x4c, 0xed, 0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, \
+  0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5a 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested5a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested5a),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested5a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested5a",
+  .m_keys = CdrStreamKeyExt_nested5a_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested5a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested5a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested5a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5a }
+};
+
+static const uint32_t CdrStreamKeyExt_t5a_ops [] =
+{
+  /* t5a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t5a, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t5a, b), (3u << 16u) + 4u /* nested5a */,
+  DDS_OP_RTS,
+
+  /* nested5a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 2u /* order: 1 */, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t5a_keys[2] =
+{
+  { "a", 13, 0 },
+  { "b.a", 15, 1 }
+};
+
+/* Type Information:
+  [MINIMAL b4ef370b17dfef8664cca03ddcc9] (#deps: 1)
+   - [MINIMAL 8ed004a8b6ef7f879094d486b650]
+  [COMPLETE 4547b514f2191a044503e92ed5b0] (#deps: 1)
+   - [COMPLETE bcc6f8e8c74ced856bbb0fdeb23d]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t5a (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb4, 0xef, 0x37, 0x0b, 0x17, 0xdf, 0xef, 0x86, 0x64, 0xcc, 0xa0, \
+  0x3d, 0xdc, 0xc9, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x45, 0x47, 0xb5, \
+  0x14, 0xf2, 0x19, 0x1a, 0x04, 0x45, 0x03, 0xe9, 0x2e, 0xd5, 0xb0, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xbc, 0xc6, 0xf8, 0xe8, 0xc7, 0x4c, 0xed, 0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5a 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t5a (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xb4, 0xef, 0x37, 0x0b, 0x17, 0xdf, 0xef, \
+  0x86, 0x64, 0xcc, 0xa0, 0x3d, 0xdc, 0xc9, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, \
+  0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x8e, 0xd0, \
+  0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x45, 0x47, 0xb5, \
+  0x14, 0xf2, 0x19, 0x1a, 0x04, 0x45, 0x03, 0xe9, 0x2e, 0xd5, 0xb0, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x35, 0x61, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xbc, \
+  0xc6, 0xf8, 0xe8, 0xc7, 0x4c, 0xed, 0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xc6, 0xf8, 0xe8, 0xc7, 0x4c, 0xed, \
+  0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x35, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x45, 0x47, 0xb5, \
+  0x14, 0xf2, 0x19, 0x1a, 0x04, 0x45, 0x03, 0xe9, 0x2e, 0xd5, 0xb0, 0xf1, 0xb4, 0xef, 0x37, 0x0b, \
+  0x17, 0xdf, 0xef, 0x86, 0x64, 0xcc, 0xa0, 0x3d, 0xdc, 0xc9, 0xf2, 0xbc, 0xc6, 0xf8, 0xe8, 0xc7, \
+  0x4c, 0xed, 0x85, 0x6b, 0xbb, 0x0f, 0xde, 0xb2, 0x3d, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, \
+  0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5a 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t5a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t5a),
+  .m_align = dds_alignof (CdrStreamKeyExt_t5a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t5a",
+  .m_keys = CdrStreamKeyExt_t5a_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeyExt_t5a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t5a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t5a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5a }
+};
+
+static const uint32_t CdrStreamKeyExt_nested5b_ops [] =
+{
+  /* nested5b */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5b, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bb960921dcd5df8752701b8433d1] (#deps: 0)
+  [COMPLETE 3107cad283c308150bcda785d995] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested5b (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, \
+  0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x07, 0xca, 0xd2, 0x83, 0xc3, 0x08, 0x15, 0x0b, 0xcd, 0xa7, \
+  0x85, 0xd9, 0x95, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5b 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested5b (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x07, 0xca, 0xd2, 0x83, 0xc3, 0x08, \
+  0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x35, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x07, 0xca, \
+  0xd2, 0x83, 0xc3, 0x08, 0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0xf1, 0xbb, 0x96, 0x09, 0x21, \
+  0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5b 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested5b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested5b),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested5b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamKeyExt::nested5b",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested5b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested5b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested5b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested5b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested5b }
+};
+
+static const uint32_t CdrStreamKeyExt_t5b_ops [] =
+{
+  /* t5b */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t5b, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t5b, b), (3u << 16u) + 4u /* nested5b */,
+  DDS_OP_RTS,
+
+  /* nested5b */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested5b, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 2u /* order: 1 */, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t5b_keys[2] =
+{
+  { "a", 13, 0 },
+  { "b.a", 15, 1 }
+};
+
+/* Type Information:
+  [MINIMAL bd8cbfdc985576d5b2aa9e84a8c2] (#deps: 1)
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE 7ecdbfb34904c3dd009f78a1dc50] (#deps: 1)
+   - [COMPLETE 3107cad283c308150bcda785d995]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t5b (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0x8c, 0xbf, 0xdc, 0x98, 0x55, 0x76, 0xd5, 0xb2, 0xaa, 0x9e, \
+  0x84, 0xa8, 0xc2, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xcd, 0xbf, \
+  0xb3, 0x49, 0x04, 0xc3, 0xdd, 0x00, 0x9f, 0x78, 0xa1, 0xdc, 0x50, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x31, 0x07, 0xca, 0xd2, 0x83, 0xc3, 0x08, 0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5b 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t5b (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0x8c, 0xbf, 0xdc, 0x98, 0x55, 0x76, \
+  0xd5, 0xb2, 0xaa, 0x9e, 0x84, 0xa8, 0xc2, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, \
+  0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xbb, 0x96, \
+  0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xcd, 0xbf, \
+  0xb3, 0x49, 0x04, 0xc3, 0xdd, 0x00, 0x9f, 0x78, 0xa1, 0xdc, 0x50, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x35, 0x62, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x31, \
+  0x07, 0xca, 0xd2, 0x83, 0xc3, 0x08, 0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x07, 0xca, 0xd2, 0x83, 0xc3, 0x08, \
+  0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x35, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xcd, 0xbf, \
+  0xb3, 0x49, 0x04, 0xc3, 0xdd, 0x00, 0x9f, 0x78, 0xa1, 0xdc, 0x50, 0xf1, 0xbd, 0x8c, 0xbf, 0xdc, \
+  0x98, 0x55, 0x76, 0xd5, 0xb2, 0xaa, 0x9e, 0x84, 0xa8, 0xc2, 0xf2, 0x31, 0x07, 0xca, 0xd2, 0x83, \
+  0xc3, 0x08, 0x15, 0x0b, 0xcd, 0xa7, 0x85, 0xd9, 0x95, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, \
+  0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5b 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t5b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t5b),
+  .m_align = dds_alignof (CdrStreamKeyExt_t5b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t5b",
+  .m_keys = CdrStreamKeyExt_t5b_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeyExt_t5b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t5b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t5b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t5b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t5b }
+};
+
+static const uint32_t CdrStreamKeyExt_nested6_ops [] =
+{
+  /* nested6 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested6_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE 1a1d4bbcffd2c3e3a3aaecd4c62d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested6 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, 0xd2, 0xc3, 0xe3, 0xa3, 0xaa, 0xec, \
+  0xd4, 0xc6, 0x2d, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested6 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, 0xd2, 0xc3, \
+  0xe3, 0xa3, 0xaa, 0xec, 0xd4, 0xc6, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x36, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x1d, 0x4b, \
+  0xbc, 0xff, 0xd2, 0xc3, 0xe3, 0xa3, 0xaa, 0xec, 0xd4, 0xc6, 0x2d, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, \
+  0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested6_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested6),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested6),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested6",
+  .m_keys = CdrStreamKeyExt_nested6_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested6, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested6, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6 }
+};
+
+static const uint32_t CdrStreamKeyExt_t6_ops [] =
+{
+  /* t6 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t6, a),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t6, b), (3u << 16u) + 4u /* nested6 */,
+  DDS_OP_RTS,
+
+  /* nested6 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t6_keys[1] =
+{
+  { "a", 14, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 1d7dcce9071bbafdf36b1daf21c0] (#deps: 1)
+   - [MINIMAL 8ed004a8b6ef7f879094d486b650]
+  [COMPLETE 49d16838afff01e08026373fd956] (#deps: 1)
+   - [COMPLETE 1a1d4bbcffd2c3e3a3aaecd4c62d]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t6 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x7d, 0xcc, 0xe9, 0x07, 0x1b, 0xba, 0xfd, 0xf3, 0x6b, 0x1d, \
+  0xaf, 0x21, 0xc0, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xd1, 0x68, \
+  0x38, 0xaf, 0xff, 0x01, 0xe0, 0x80, 0x26, 0x37, 0x3f, 0xd9, 0x56, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, 0xd2, 0xc3, 0xe3, 0xa3, 0xaa, 0xec, 0xd4, 0xc6, 0x2d, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t6 (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x7d, 0xcc, 0xe9, 0x07, 0x1b, 0xba, \
+  0xfd, 0xf3, 0x6b, 0x1d, 0xaf, 0x21, 0xc0, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, \
+  0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x8e, 0xd0, \
+  0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xd1, 0x68, \
+  0x38, 0xaf, 0xff, 0x01, 0xe0, 0x80, 0x26, 0x37, 0x3f, 0xd9, 0x56, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x36, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, \
+  0xd2, 0xc3, 0xe3, 0xa3, 0xaa, 0xec, 0xd4, 0xc6, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, 0xd2, 0xc3, 0xe3, 0xa3, 0xaa, 0xec, \
+  0xd4, 0xc6, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x36, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xd1, 0x68, 0x38, 0xaf, 0xff, 0x01, \
+  0xe0, 0x80, 0x26, 0x37, 0x3f, 0xd9, 0x56, 0xf1, 0x1d, 0x7d, 0xcc, 0xe9, 0x07, 0x1b, 0xba, 0xfd, \
+  0xf3, 0x6b, 0x1d, 0xaf, 0x21, 0xc0, 0xf2, 0x1a, 0x1d, 0x4b, 0xbc, 0xff, 0xd2, 0xc3, 0xe3, 0xa3, \
+  0xaa, 0xec, 0xd4, 0xc6, 0x2d, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, \
+  0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6 436u
+const dds_topic_descriptor_t CdrStreamKeyExt_t6_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t6),
+  .m_align = dds_alignof (CdrStreamKeyExt_t6),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::t6",
+  .m_keys = CdrStreamKeyExt_t6_keys,
+  .m_nops = 8,
+  .m_ops = CdrStreamKeyExt_t6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t6, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t6, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6 }
+};
+
+static const uint32_t CdrStreamKeyExt_nested6a_ops [] =
+{
+  /* nested6a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_nested6a_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE eb7799646cf0dc072b975c6aea23] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested6a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x77, 0x99, 0x64, 0x6c, 0xf0, 0xdc, 0x07, 0x2b, 0x97, 0x5c, \
+  0x6a, 0xea, 0x23, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6a 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested6a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x77, 0x99, 0x64, 0x6c, 0xf0, 0xdc, \
+  0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x36, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x77, 0x99, \
+  0x64, 0x6c, 0xf0, 0xdc, 0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, \
+  0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6a 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested6a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested6a),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested6a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeyExt::nested6a",
+  .m_keys = CdrStreamKeyExt_nested6a_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested6a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested6a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested6a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6a }
+};
+
+static const uint32_t CdrStreamKeyExt_t6a_ops [] =
+{
+  /* t6a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t6a, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t6a, b), (3u << 16u) + 4u /* nested6a */,
+  DDS_OP_RTS,
+
+  /* nested6a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6a, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 3u /* order: 1 */, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t6a_keys[2] =
+{
+  { "a", 14, 0 },
+  { "b.a", 16, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 54fedb8ea818eaaafd8c55724982] (#deps: 1)
+   - [MINIMAL 8ed004a8b6ef7f879094d486b650]
+  [COMPLETE 6524f6290677a1ca2d1b25e8c1e2] (#deps: 1)
+   - [COMPLETE eb7799646cf0dc072b975c6aea23]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t6a (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xfe, 0xdb, 0x8e, 0xa8, 0x18, 0xea, 0xaa, 0xfd, 0x8c, 0x55, \
+  0x72, 0x49, 0x82, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x24, 0xf6, \
+  0x29, 0x06, 0x77, 0xa1, 0xca, 0x2d, 0x1b, 0x25, 0xe8, 0xc1, 0xe2, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xeb, 0x77, 0x99, 0x64, 0x6c, 0xf0, 0xdc, 0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6a 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t6a (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xfe, 0xdb, 0x8e, 0xa8, 0x18, 0xea, \
+  0xaa, 0xfd, 0x8c, 0x55, 0x72, 0x49, 0x82, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, \
+  0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x8e, 0xd0, \
+  0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x24, 0xf6, \
+  0x29, 0x06, 0x77, 0xa1, 0xca, 0x2d, 0x1b, 0x25, 0xe8, 0xc1, 0xe2, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x36, 0x61, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xeb, \
+  0x77, 0x99, 0x64, 0x6c, 0xf0, 0xdc, 0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x77, 0x99, 0x64, 0x6c, 0xf0, 0xdc, \
+  0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x36, 0x61, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x24, 0xf6, \
+  0x29, 0x06, 0x77, 0xa1, 0xca, 0x2d, 0x1b, 0x25, 0xe8, 0xc1, 0xe2, 0xf1, 0x54, 0xfe, 0xdb, 0x8e, \
+  0xa8, 0x18, 0xea, 0xaa, 0xfd, 0x8c, 0x55, 0x72, 0x49, 0x82, 0xf2, 0xeb, 0x77, 0x99, 0x64, 0x6c, \
+  0xf0, 0xdc, 0x07, 0x2b, 0x97, 0x5c, 0x6a, 0xea, 0x23, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, \
+  0x7f, 0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6a 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t6a_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t6a),
+  .m_align = dds_alignof (CdrStreamKeyExt_t6a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t6a",
+  .m_keys = CdrStreamKeyExt_t6a_keys,
+  .m_nops = 8,
+  .m_ops = CdrStreamKeyExt_t6a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t6a, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t6a, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6a }
+};
+
+static const uint32_t CdrStreamKeyExt_nested6b_ops [] =
+{
+  /* nested6b */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6b, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bb960921dcd5df8752701b8433d1] (#deps: 0)
+  [COMPLETE f6387f1fabece4a0c6303bfa0a4b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_nested6b (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, \
+  0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x38, 0x7f, 0x1f, 0xab, 0xec, 0xe4, 0xa0, 0xc6, 0x30, 0x3b, \
+  0xfa, 0x0a, 0x4b, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6b 100u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_nested6b (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x38, 0x7f, 0x1f, 0xab, 0xec, 0xe4, \
+  0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x36, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x38, 0x7f, \
+  0x1f, 0xab, 0xec, 0xe4, 0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0xf1, 0xbb, 0x96, 0x09, 0x21, \
+  0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6b 202u
+const dds_topic_descriptor_t CdrStreamKeyExt_nested6b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_nested6b),
+  .m_align = dds_alignof (CdrStreamKeyExt_nested6b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamKeyExt::nested6b",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeyExt_nested6b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_nested6b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_nested6b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_nested6b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_nested6b }
+};
+
+static const uint32_t CdrStreamKeyExt_t6b_ops [] =
+{
+  /* t6b */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_t6b, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeyExt_t6b, b), (3u << 16u) + 4u /* nested6b */,
+  DDS_OP_RTS,
+
+  /* nested6b */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeyExt_nested6b, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 3u /* order: 1 */, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeyExt_t6b_keys[2] =
+{
+  { "a", 14, 0 },
+  { "b.a", 16, 1 }
+};
+
+/* Type Information:
+  [MINIMAL d5868f9d1a56bf99c2c49a403bf1] (#deps: 1)
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE 1ee475d38596634be212fe96460a] (#deps: 1)
+   - [COMPLETE f6387f1fabece4a0c6303bfa0a4b]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeyExt_t6b (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd5, 0x86, 0x8f, 0x9d, 0x1a, 0x56, 0xbf, 0x99, 0xc2, 0xc4, 0x9a, \
+  0x40, 0x3b, 0xf1, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0xe4, 0x75, \
+  0xd3, 0x85, 0x96, 0x63, 0x4b, 0xe2, 0x12, 0xfe, 0x96, 0x46, 0x0a, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x38, 0x7f, 0x1f, 0xab, 0xec, 0xe4, 0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6b 148u
+#define TYPE_MAP_CDR_CdrStreamKeyExt_t6b (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd5, 0x86, 0x8f, 0x9d, 0x1a, 0x56, 0xbf, \
+  0x99, 0xc2, 0xc4, 0x9a, 0x40, 0x3b, 0xf1, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, \
+  0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xbb, 0x96, \
+  0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0xe4, 0x75, \
+  0xd3, 0x85, 0x96, 0x63, 0x4b, 0xe2, 0x12, 0xfe, 0x96, 0x46, 0x0a, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, \
+  0x3a, 0x74, 0x36, 0x62, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xf6, \
+  0x38, 0x7f, 0x1f, 0xab, 0xec, 0xe4, 0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x38, 0x7f, 0x1f, 0xab, 0xec, 0xe4, \
+  0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x45, 0x78, 0x74, 0x3a, 0x3a, 0x6e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x36, 0x62, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0xe4, 0x75, \
+  0xd3, 0x85, 0x96, 0x63, 0x4b, 0xe2, 0x12, 0xfe, 0x96, 0x46, 0x0a, 0xf1, 0xd5, 0x86, 0x8f, 0x9d, \
+  0x1a, 0x56, 0xbf, 0x99, 0xc2, 0xc4, 0x9a, 0x40, 0x3b, 0xf1, 0xf2, 0xf6, 0x38, 0x7f, 0x1f, 0xab, \
+  0xec, 0xe4, 0xa0, 0xc6, 0x30, 0x3b, 0xfa, 0x0a, 0x4b, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, \
+  0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6b 440u
+const dds_topic_descriptor_t CdrStreamKeyExt_t6b_desc =
+{
+  .m_size = sizeof (CdrStreamKeyExt_t6b),
+  .m_align = dds_alignof (CdrStreamKeyExt_t6b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeyExt::t6b",
+  .m_keys = CdrStreamKeyExt_t6b_keys,
+  .m_nops = 8,
+  .m_ops = CdrStreamKeyExt_t6b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeyExt_t6b, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeyExt_t6b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeyExt_t6b, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeyExt_t6b }
+};
+
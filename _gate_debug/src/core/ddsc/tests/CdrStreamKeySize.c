@@ -0,0 +1,2378 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamKeySize.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamKeySize.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamKeySize.h"
+
+static const uint32_t CdrStreamKeySize_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t1, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t1, b),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t1_keys[2] =
+{
+  { "a", 5, 0 },
+  { "b", 7, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 1d9e8c95dfed21718122429bcb85] (#deps: 0)
+  [COMPLETE 368f4dfa6477697ed7cd1f137640] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x9e, 0x8c, 0x95, 0xdf, 0xed, 0x21, 0x71, 0x81, 0x22, 0x42, \
+  0x9b, 0xcb, 0x85, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x36, 0x8f, 0x4d, 0xfa, 0x64, 0x77, 0x69, 0x7e, 0xd7, 0xcd, 0x1f, \
+  0x13, 0x76, 0x40, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t1 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t1 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x9e, 0x8c, 0x95, 0xdf, 0xed, 0x21, \
+  0x71, 0x81, 0x22, 0x42, 0x9b, 0xcb, 0x85, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x36, 0x8f, 0x4d, 0xfa, 0x64, 0x77, 0x69, \
+  0x7e, 0xd7, 0xcd, 0x1f, 0x13, 0x76, 0x40, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x36, 0x8f, 0x4d, \
+  0xfa, 0x64, 0x77, 0x69, 0x7e, 0xd7, 0xcd, 0x1f, 0x13, 0x76, 0x40, 0xf1, 0x1d, 0x9e, 0x8c, 0x95, \
+  0xdf, 0xed, 0x21, 0x71, 0x81, 0x22, 0x42, 0x9b, 0xcb, 0x85\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t1 234u
+const dds_topic_descriptor_t CdrStreamKeySize_t1_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t1),
+  .m_align = dds_alignof (CdrStreamKeySize_t1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeySize::t1",
+  .m_keys = CdrStreamKeySize_t1_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeySize_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t1, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t1, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t1 }
+};
+
+static const uint32_t CdrStreamKeySize_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t2, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t2, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t2, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t2_keys[3] =
+{
+  { "a", 7, 0 },
+  { "b", 9, 1 },
+  { "c", 11, 2 }
+};
+
+/* Type Information:
+  [MINIMAL a1697b773d6c724ec7a442d1600b] (#deps: 0)
+  [COMPLETE 881f635ae0ec19d68a0d311247b7] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x69, 0x7b, 0x77, 0x3d, 0x6c, 0x72, 0x4e, 0xc7, 0xa4, 0x42, \
+  0xd1, 0x60, 0x0b, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x88, 0x1f, 0x63, 0x5a, 0xe0, 0xec, 0x19, 0xd6, 0x8a, 0x0d, 0x31, \
+  0x12, 0x47, 0xb7, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t2 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t2 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x69, 0x7b, 0x77, 0x3d, 0x6c, 0x72, \
+  0x4e, 0xc7, 0xa4, 0x42, 0xd1, 0x60, 0x0b, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x88, 0x1f, 0x63, 0x5a, 0xe0, 0xec, 0x19, \
+  0xd6, 0x8a, 0x0d, 0x31, 0x12, 0x47, 0xb7, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x88, 0x1f, 0x63, 0x5a, 0xe0, 0xec, 0x19, 0xd6, 0x8a, 0x0d, 0x31, 0x12, 0x47, 0xb7, 0xf1, \
+  0xa1, 0x69, 0x7b, 0x77, 0x3d, 0x6c, 0x72, 0x4e, 0xc7, 0xa4, 0x42, 0xd1, 0x60, 0x0b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t2 270u
+const dds_topic_descriptor_t CdrStreamKeySize_t2_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t2),
+  .m_align = dds_alignof (CdrStreamKeySize_t2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t2",
+  .m_keys = CdrStreamKeySize_t2_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t2, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t2, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t2 }
+};
+
+static const uint32_t CdrStreamKeySize_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t3, a), (3u << 16u) + 4u /* nested3 */,
+  DDS_OP_RTS,
+
+  /* nested3 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested3, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested3, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested3, c),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: a.b */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 2u /* order: 1 */,
+  
+  /* key: a.c */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t3_keys[3] =
+{
+  { "a.a", 11, 0 },
+  { "a.b", 14, 1 },
+  { "a.c", 17, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 7f61abfee3a941b1a1b111c671af] (#deps: 1)
+   - [MINIMAL 169a3b47b28f364432bf2af89adb]
+  [COMPLETE bb069884412aff25c6312ee298e1] (#deps: 1)
+   - [COMPLETE 84468c1bfe631b776e71d5a8450e]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t3 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x61, 0xab, 0xfe, 0xe3, 0xa9, 0x41, 0xb1, 0xa1, 0xb1, 0x11, \
+  0xc6, 0x71, 0xaf, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x9a, 0x3b, 0x47, 0xb2, 0x8f, 0x36, \
+  0x44, 0x32, 0xbf, 0x2a, 0xf8, 0x9a, 0xdb, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0x06, 0x98, \
+  0x84, 0x41, 0x2a, 0xff, 0x25, 0xc6, 0x31, 0x2e, 0xe2, 0x98, 0xe1, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x84, 0x46, 0x8c, 0x1b, 0xfe, 0x63, 0x1b, 0x77, 0x6e, 0x71, 0xd5, 0xa8, 0x45, 0x0e, 0x00, \
+  0x74, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t3 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t3 (const unsigned char []){ \
+  0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x61, 0xab, 0xfe, 0xe3, 0xa9, 0x41, \
+  0xb1, 0xa1, 0xb1, 0x11, 0xc6, 0x71, 0xaf, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x16, 0x9a, 0x3b, 0x47, 0xb2, \
+  0x8f, 0x36, 0x44, 0x32, 0xbf, 0x2a, 0xf8, 0x9a, 0xdb, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x16, 0x9a, \
+  0x3b, 0x47, 0xb2, 0x8f, 0x36, 0x44, 0x32, 0xbf, 0x2a, 0xf8, 0x9a, 0xdb, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0x06, 0x98, \
+  0x84, 0x41, 0x2a, 0xff, 0x25, 0xc6, 0x31, 0x2e, 0xe2, 0x98, 0xe1, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x84, 0x46, 0x8c, 0x1b, 0xfe, \
+  0x63, 0x1b, 0x77, 0x6e, 0x71, 0xd5, 0xa8, 0x45, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x84, 0x46, 0x8c, 0x1b, 0xfe, 0x63, 0x1b, 0x77, 0x6e, 0x71, 0xd5, \
+  0xa8, 0x45, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x33, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xbb, 0x06, 0x98, 0x84, 0x41, 0x2a, 0xff, 0x25, 0xc6, 0x31, 0x2e, 0xe2, 0x98, 0xe1, 0xf1, \
+  0x7f, 0x61, 0xab, 0xfe, 0xe3, 0xa9, 0x41, 0xb1, 0xa1, 0xb1, 0x11, 0xc6, 0x71, 0xaf, 0xf2, 0x84, \
+  0x46, 0x8c, 0x1b, 0xfe, 0x63, 0x1b, 0x77, 0x6e, 0x71, 0xd5, 0xa8, 0x45, 0x0e, 0xf1, 0x16, 0x9a, \
+  0x3b, 0x47, 0xb2, 0x8f, 0x36, 0x44, 0x32, 0xbf, 0x2a, 0xf8, 0x9a, 0xdb\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t3 476u
+const dds_topic_descriptor_t CdrStreamKeySize_t3_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t3),
+  .m_align = dds_alignof (CdrStreamKeySize_t3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t3",
+  .m_keys = CdrStreamKeySize_t3_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeySize_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t3, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t3, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t3 }
+};
+
+static const uint32_t CdrStreamKeySize_t4_ops [] =
+{
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t4, a), (3u << 16u) + 8u /* nested4 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t4, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t4, c),
+  DDS_OP_RTS,
+
+  /* nested4 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested4, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested4, b),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: a.b */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 2u /* order: 1 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 3u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 5u /* order: 2 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t4_keys[4] =
+{
+  { "a.a", 13, 0 },
+  { "a.b", 16, 1 },
+  { "b", 19, 2 },
+  { "c", 21, 3 }
+};
+
+/* Type Information:
+  [MINIMAL d309a09783eb25544b3759abe827] (#deps: 1)
+   - [MINIMAL 5cd2c83bdd5e3b0bfb5d34f66a60]
+  [COMPLETE 40e682b8ceaf830439bc0e90fc64] (#deps: 1)
+   - [COMPLETE 8035adfc4c1356ad96d01fdf9096]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t4 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x09, 0xa0, 0x97, 0x83, 0xeb, 0x25, 0x54, 0x4b, 0x37, 0x59, \
+  0xab, 0xe8, 0x27, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0xd2, 0xc8, 0x3b, 0xdd, 0x5e, 0x3b, \
+  0x0b, 0xfb, 0x5d, 0x34, 0xf6, 0x6a, 0x60, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x40, 0xe6, 0x82, \
+  0xb8, 0xce, 0xaf, 0x83, 0x04, 0x39, 0xbc, 0x0e, 0x90, 0xfc, 0x64, 0x00, 0x80, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x80, 0x35, 0xad, 0xfc, 0x4c, 0x13, 0x56, 0xad, 0x96, 0xd0, 0x1f, 0xdf, 0x90, 0x96, 0x00, \
+  0x60, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t4 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t4 (const unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x09, 0xa0, 0x97, 0x83, 0xeb, 0x25, \
+  0x54, 0x4b, 0x37, 0x59, 0xab, 0xe8, 0x27, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x5c, 0xd2, 0xc8, 0x3b, 0xdd, \
+  0x5e, 0x3b, 0x0b, 0xfb, 0x5d, 0x34, 0xf6, 0x6a, 0x60, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0xf1, \
+  0x5c, 0xd2, 0xc8, 0x3b, 0xdd, 0x5e, 0x3b, 0x0b, 0xfb, 0x5d, 0x34, 0xf6, 0x6a, 0x60, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x03, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0xe6, 0x82, 0xb8, 0xce, 0xaf, 0x83, 0x04, 0x39, 0xbc, 0x0e, 0x90, 0xfc, 0x64, 0x00, \
+  0x7c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, \
+  0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x80, \
+  0x35, 0xad, 0xfc, 0x4c, 0x13, 0x56, 0xad, 0x96, 0xd0, 0x1f, 0xdf, 0x90, 0x96, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0xf2, 0x80, 0x35, 0xad, 0xfc, 0x4c, 0x13, 0x56, 0xad, 0x96, 0xd0, 0x1f, 0xdf, 0x90, 0x96, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, \
+  0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x34, 0x00, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x40, 0xe6, 0x82, 0xb8, 0xce, 0xaf, 0x83, \
+  0x04, 0x39, 0xbc, 0x0e, 0x90, 0xfc, 0x64, 0xf1, 0xd3, 0x09, 0xa0, 0x97, 0x83, 0xeb, 0x25, 0x54, \
+  0x4b, 0x37, 0x59, 0xab, 0xe8, 0x27, 0xf2, 0x80, 0x35, 0xad, 0xfc, 0x4c, 0x13, 0x56, 0xad, 0x96, \
+  0xd0, 0x1f, 0xdf, 0x90, 0x96, 0xf1, 0x5c, 0xd2, 0xc8, 0x3b, 0xdd, 0x5e, 0x3b, 0x0b, 0xfb, 0x5d, \
+  0x34, 0xf6, 0x6a, 0x60\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t4 516u
+const dds_topic_descriptor_t CdrStreamKeySize_t4_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t4),
+  .m_align = dds_alignof (CdrStreamKeySize_t4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 4u,
+  .m_typename = "CdrStreamKeySize::t4",
+  .m_keys = CdrStreamKeySize_t4_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeySize_t4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t4, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t4, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t4 }
+};
+
+static const uint32_t CdrStreamKeySize_t5_ops [] =
+{
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t5, a), 5u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t5_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL bf20b9f88753b30ac216cd7de912] (#deps: 0)
+  [COMPLETE 4de73bad6f777ea36ec5c7952792] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t5 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbf, 0x20, 0xb9, 0xf8, 0x87, 0x53, 0xb3, 0x0a, 0xc2, 0x16, 0xcd, \
+  0x7d, 0xe9, 0x12, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x4d, 0xe7, 0x3b, 0xad, 0x6f, 0x77, 0x7e, 0xa3, 0x6e, 0xc5, 0xc7, \
+  0x95, 0x27, 0x92, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t5 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t5 (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbf, 0x20, 0xb9, 0xf8, 0x87, 0x53, 0xb3, \
+  0x0a, 0xc2, 0x16, 0xcd, 0x7d, 0xe9, 0x12, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x4d, 0xe7, 0x3b, 0xad, 0x6f, 0x77, 0x7e, 0xa3, 0x6e, 0xc5, 0xc7, \
+  0x95, 0x27, 0x92, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x4d, 0xe7, 0x3b, 0xad, 0x6f, 0x77, 0x7e, 0xa3, 0x6e, 0xc5, 0xc7, 0x95, 0x27, 0x92, 0xf1, \
+  0xbf, 0x20, 0xb9, 0xf8, 0x87, 0x53, 0xb3, 0x0a, 0xc2, 0x16, 0xcd, 0x7d, 0xe9, 0x12\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t5 222u
+const dds_topic_descriptor_t CdrStreamKeySize_t5_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t5),
+  .m_align = dds_alignof (CdrStreamKeySize_t5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t5",
+  .m_keys = CdrStreamKeySize_t5_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t5, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t5, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t5 }
+};
+
+static const uint32_t CdrStreamKeySize_t6_ops [] =
+{
+  /* t6 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t6, a), (3u << 16u) + 11u /* nested6 */,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t6, b), 5u,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t6, c),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (CdrStreamKeySize_t6, d),
+  DDS_OP_RTS,
+
+  /* nested6 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested6, a),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 6u /* order: 2 */,
+  
+  /* key: d */
+  DDS_OP_KOF | 1, 8u /* order: 3 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t6_keys[3] =
+{
+  { "a.a", 14, 0 },
+  { "c", 17, 1 },
+  { "d", 19, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 66dcc1fab386050d7c3b1f07cb45] (#deps: 1)
+   - [MINIMAL 8e7ace52a75bc1692c38b3958545]
+  [COMPLETE 1e25114bea0d8c5df8768fb2bab8] (#deps: 1)
+   - [COMPLETE 17af1f654c596b24b538d761e9b7]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t6 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xdc, 0xc1, 0xfa, 0xb3, 0x86, 0x05, 0x0d, 0x7c, 0x3b, 0x1f, \
+  0x07, 0xcb, 0x45, 0x00, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, 0x5b, 0xc1, \
+  0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0x25, 0x11, \
+  0x4b, 0xea, 0x0d, 0x8c, 0x5d, 0xf8, 0x76, 0x8f, 0xb2, 0xba, 0xb8, 0x00, 0xa0, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x17, 0xaf, 0x1f, 0x65, 0x4c, 0x59, 0x6b, 0x24, 0xb5, 0x38, 0xd7, 0x61, 0xe9, 0xb7, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t6 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t6 (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xdc, 0xc1, 0xfa, 0xb3, 0x86, 0x05, \
+  0x0d, 0x7c, 0x3b, 0x1f, 0x07, 0xcb, 0x45, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, \
+  0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x82, 0x77, 0xe0, 0x91, 0xf1, 0x8e, 0x7a, 0xce, 0x52, \
+  0xa7, 0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0x25, 0x11, \
+  0x4b, 0xea, 0x0d, 0x8c, 0x5d, 0xf8, 0x76, 0x8f, 0xb2, 0xba, 0xb8, 0x00, 0x9c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x36, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x17, 0xaf, 0x1f, 0x65, 0x4c, \
+  0x59, 0x6b, 0x24, 0xb5, 0x38, 0xd7, 0x61, 0xe9, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x17, 0xaf, 0x1f, \
+  0x65, 0x4c, 0x59, 0x6b, 0x24, 0xb5, 0x38, 0xd7, 0x61, 0xe9, 0xb7, 0x00, 0x48, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x36, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x1e, 0x25, 0x11, 0x4b, 0xea, 0x0d, 0x8c, 0x5d, 0xf8, 0x76, 0x8f, 0xb2, 0xba, 0xb8, 0xf1, \
+  0x66, 0xdc, 0xc1, 0xfa, 0xb3, 0x86, 0x05, 0x0d, 0x7c, 0x3b, 0x1f, 0x07, 0xcb, 0x45, 0xf2, 0x17, \
+  0xaf, 0x1f, 0x65, 0x4c, 0x59, 0x6b, 0x24, 0xb5, 0x38, 0xd7, 0x61, 0xe9, 0xb7, 0xf1, 0x8e, 0x7a, \
+  0xce, 0x52, 0xa7, 0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t6 540u
+const dds_topic_descriptor_t CdrStreamKeySize_t6_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t6),
+  .m_align = dds_alignof (CdrStreamKeySize_t6),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t6",
+  .m_keys = CdrStreamKeySize_t6_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeySize_t6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t6, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t6, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t6 }
+};
+
+static const uint32_t CdrStreamKeySize_t7_ops [] =
+{
+  /* t7 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t7, a), (3u << 16u) + 12u /* nested7_1 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t7, b), (3u << 16u) + 12u /* nested7_2 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t7, c),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t7, d), (3u << 16u) + 4u /* nested7_1 */,
+  DDS_OP_RTS,
+
+  /* nested7_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested7_1, a),
+  DDS_OP_RTS,
+
+  /* nested7_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested7_2, a),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 3u /* order: 1 */, 0u /* order: 0 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 6u /* order: 2 */,
+  
+  /* key: d.a */
+  DDS_OP_KOF | 2, 8u /* order: 3 */, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t7_keys[4] =
+{
+  { "a.a", 18, 0 },
+  { "b.a", 21, 1 },
+  { "c", 24, 2 },
+  { "d.a", 26, 3 }
+};
+
+/* Type Information:
+  [MINIMAL 3d4657042d7a25e3e90967e25b55] (#deps: 2)
+   - [MINIMAL 8947af7a0d11cfe46744abc1fe5d]
+   - [MINIMAL 8e7ace52a75bc1692c38b3958545]
+  [COMPLETE c0c03b72a150f7b247bab7325182] (#deps: 2)
+   - [COMPLETE 91fe80f2a471aa2e1f2d0306ae78]
+   - [COMPLETE ed22b2da062216ee0316fc7a4b2d]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t7 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3d, 0x46, 0x57, 0x04, 0x2d, 0x7a, 0x25, 0xe3, 0xe9, 0x09, 0x67, \
+  0xe2, 0x5b, 0x55, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x89, 0x47, 0xaf, 0x7a, 0x0d, 0x11, 0xcf, \
+  0xe4, 0x67, 0x44, 0xab, 0xc1, 0xfe, 0x5d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, 0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0xc0, 0x3b, 0x72, 0xa1, 0x50, 0xf7, 0xb2, 0x47, 0xba, 0xb7, \
+  0x32, 0x51, 0x82, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x91, 0xfe, 0x80, 0xf2, 0xa4, 0x71, 0xaa, \
+  0x2e, 0x1f, 0x2d, 0x03, 0x06, 0xae, 0x78, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xed, 0x22, 0xb2, 0xda, 0x06, 0x22, 0x16, 0xee, 0x03, 0x16, 0xfc, 0x7a, 0x4b, 0x2d, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t7 196u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t7 (const unsigned char []){ \
+  0x07, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x3d, 0x46, 0x57, 0x04, 0x2d, 0x7a, 0x25, \
+  0xe3, 0xe9, 0x09, 0x67, 0xe2, 0x5b, 0x55, 0x00, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x89, 0x47, 0xaf, 0x7a, 0x0d, \
+  0x11, 0xcf, 0xe4, 0x67, 0x44, 0xab, 0xc1, 0xfe, 0x5d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, \
+  0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, 0x85, 0x45, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x89, 0x47, 0xaf, 0x7a, 0x0d, \
+  0x11, 0xcf, 0xe4, 0x67, 0x44, 0xab, 0xc1, 0xfe, 0x5d, 0x82, 0x77, 0xe0, 0x91, 0xf1, 0x89, 0x47, \
+  0xaf, 0x7a, 0x0d, 0x11, 0xcf, 0xe4, 0x67, 0x44, 0xab, 0xc1, 0xfe, 0x5d, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x0c, \
+  0xc1, 0x75, 0xb9, 0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, 0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, \
+  0x85, 0x45, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x80, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0xc0, 0x3b, 0x72, 0xa1, 0x50, 0xf7, 0xb2, 0x47, 0xba, 0xb7, \
+  0x32, 0x51, 0x82, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x91, 0xfe, 0x80, 0xf2, 0xa4, 0x71, 0xaa, 0x2e, 0x1f, 0x2d, 0x03, 0x06, 0xae, \
+  0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xed, 0x22, 0xb2, 0xda, 0x06, 0x22, 0x16, 0xee, 0x03, \
+  0x16, 0xfc, 0x7a, 0x4b, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x91, \
+  0xfe, 0x80, 0xf2, 0xa4, 0x71, 0xaa, 0x2e, 0x1f, 0x2d, 0x03, 0x06, 0xae, 0x78, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x91, 0xfe, 0x80, 0xf2, 0xa4, 0x71, 0xaa, \
+  0x2e, 0x1f, 0x2d, 0x03, 0x06, 0xae, 0x78, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, \
+  0x73, 0x74, 0x65, 0x64, 0x37, 0x5f, 0x31, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0xed, 0x22, 0xb2, 0xda, 0x06, 0x22, 0x16, 0xee, 0x03, 0x16, 0xfc, \
+  0x7a, 0x4b, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x37, 0x5f, 0x32, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0xc0, 0x3b, 0x72, 0xa1, 0x50, 0xf7, \
+  0xb2, 0x47, 0xba, 0xb7, 0x32, 0x51, 0x82, 0xf1, 0x3d, 0x46, 0x57, 0x04, 0x2d, 0x7a, 0x25, 0xe3, \
+  0xe9, 0x09, 0x67, 0xe2, 0x5b, 0x55, 0xf2, 0x91, 0xfe, 0x80, 0xf2, 0xa4, 0x71, 0xaa, 0x2e, 0x1f, \
+  0x2d, 0x03, 0x06, 0xae, 0x78, 0xf1, 0x89, 0x47, 0xaf, 0x7a, 0x0d, 0x11, 0xcf, 0xe4, 0x67, 0x44, \
+  0xab, 0xc1, 0xfe, 0x5d, 0xf2, 0xed, 0x22, 0xb2, 0xda, 0x06, 0x22, 0x16, 0xee, 0x03, 0x16, 0xfc, \
+  0x7a, 0x4b, 0x2d, 0xf1, 0x8e, 0x7a, 0xce, 0x52, 0xa7, 0x5b, 0xc1, 0x69, 0x2c, 0x38, 0xb3, 0x95, \
+  0x85, 0x45\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t7 754u
+const dds_topic_descriptor_t CdrStreamKeySize_t7_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t7),
+  .m_align = dds_alignof (CdrStreamKeySize_t7),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 4u,
+  .m_typename = "CdrStreamKeySize::t7",
+  .m_keys = CdrStreamKeySize_t7_keys,
+  .m_nops = 9,
+  .m_ops = CdrStreamKeySize_t7_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t7, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t7 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t7, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t7 }
+};
+
+static const uint32_t CdrStreamKeySize_t8_ops [] =
+{
+  /* t8 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t8, a), 15u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t8_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 0aaa7e3b3babe8c15c9bc178eff0] (#deps: 0)
+  [COMPLETE e449c3f7fd9686a4188cabeb4c53] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t8 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0a, 0xaa, 0x7e, 0x3b, 0x3b, 0xab, 0xe8, 0xc1, 0x5c, 0x9b, 0xc1, \
+  0x78, 0xef, 0xf0, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe4, 0x49, 0xc3, 0xf7, 0xfd, 0x96, 0x86, 0xa4, 0x18, 0x8c, 0xab, \
+  0xeb, 0x4c, 0x53, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t8 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t8 (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0a, 0xaa, 0x7e, 0x3b, 0x3b, 0xab, 0xe8, \
+  0xc1, 0x5c, 0x9b, 0xc1, 0x78, 0xef, 0xf0, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xe4, 0x49, 0xc3, 0xf7, 0xfd, 0x96, 0x86, 0xa4, 0x18, 0x8c, 0xab, \
+  0xeb, 0x4c, 0x53, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x38, 0x00, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xe4, 0x49, 0xc3, 0xf7, 0xfd, 0x96, 0x86, 0xa4, 0x18, 0x8c, 0xab, 0xeb, 0x4c, 0x53, 0xf1, \
+  0x0a, 0xaa, 0x7e, 0x3b, 0x3b, 0xab, 0xe8, 0xc1, 0x5c, 0x9b, 0xc1, 0x78, 0xef, 0xf0\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t8 222u
+const dds_topic_descriptor_t CdrStreamKeySize_t8_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t8),
+  .m_align = dds_alignof (CdrStreamKeySize_t8),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t8",
+  .m_keys = CdrStreamKeySize_t8_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t8_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t8, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t8 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t8, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t8 }
+};
+
+static const uint32_t CdrStreamKeySize_t9_ops [] =
+{
+  /* t9 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t9, a), 6u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t9_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL dd7400a1b7f876aa07faa418434f] (#deps: 0)
+  [COMPLETE 742e640e41549165fcfea48a0bee] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t9 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x74, 0x00, 0xa1, 0xb7, 0xf8, 0x76, 0xaa, 0x07, 0xfa, 0xa4, \
+  0x18, 0x43, 0x4f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x74, 0x2e, 0x64, 0x0e, 0x41, 0x54, 0x91, 0x65, 0xfc, 0xfe, 0xa4, \
+  0x8a, 0x0b, 0xee, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t9 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t9 (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x74, 0x00, 0xa1, 0xb7, 0xf8, 0x76, \
+  0xaa, 0x07, 0xfa, 0xa4, 0x18, 0x43, 0x4f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x74, 0x2e, 0x64, 0x0e, 0x41, 0x54, 0x91, 0x65, 0xfc, 0xfe, 0xa4, \
+  0x8a, 0x0b, 0xee, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x74, 0x2e, 0x64, 0x0e, 0x41, 0x54, 0x91, 0x65, 0xfc, 0xfe, 0xa4, 0x8a, 0x0b, 0xee, 0xf1, \
+  0xdd, 0x74, 0x00, 0xa1, 0xb7, 0xf8, 0x76, 0xaa, 0x07, 0xfa, 0xa4, 0x18, 0x43, 0x4f\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t9 222u
+const dds_topic_descriptor_t CdrStreamKeySize_t9_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t9),
+  .m_align = dds_alignof (CdrStreamKeySize_t9),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t9",
+  .m_keys = CdrStreamKeySize_t9_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t9_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t9, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t9 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t9, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t9 }
+};
+
+static const uint32_t CdrStreamKeySize_t10_ops [] =
+{
+  /* t10 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t10, a), (3u << 16u) + 7u /* nested10 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t10, b), (3u << 16u) + 4u /* nested10 */,
+  DDS_OP_RTS,
+
+  /* nested10 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested10, a),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested10, b),
+  DDS_OP_RTS,
+  
+  /* key: b.a */
+  DDS_OP_KOF | 2, 3u /* order: 1 */, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t10_keys[1] =
+{
+  { "b.a", 12, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 627747bc7ae32a98d91cd30b6dac] (#deps: 1)
+   - [MINIMAL dc8893552f5c46d5dfafd15797d0]
+  [COMPLETE 650611a054cbe5c1b43280bc2731] (#deps: 1)
+   - [COMPLETE dab28dfac6ca8867ed065e030a1a]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t10 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x62, 0x77, 0x47, 0xbc, 0x7a, 0xe3, 0x2a, 0x98, 0xd9, 0x1c, 0xd3, \
+  0x0b, 0x6d, 0xac, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdc, 0x88, 0x93, 0x55, 0x2f, 0x5c, 0x46, \
+  0xd5, 0xdf, 0xaf, 0xd1, 0x57, 0x97, 0xd0, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x06, 0x11, \
+  0xa0, 0x54, 0xcb, 0xe5, 0xc1, 0xb4, 0x32, 0x80, 0xbc, 0x27, 0x31, 0x00, 0x7c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xda, 0xb2, 0x8d, 0xfa, 0xc6, 0xca, 0x88, 0x67, 0xed, 0x06, 0x5e, 0x03, 0x0a, 0x1a, 0x00, \
+  0x60, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t10 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t10 (const unsigned char []){ \
+  0xaf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x62, 0x77, 0x47, 0xbc, 0x7a, 0xe3, 0x2a, \
+  0x98, 0xd9, 0x1c, 0xd3, 0x0b, 0x6d, 0xac, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdc, 0x88, 0x93, 0x55, 0x2f, \
+  0x5c, 0x46, 0xd5, 0xdf, 0xaf, 0xd1, 0x57, 0x97, 0xd0, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xdc, 0x88, 0x93, 0x55, 0x2f, \
+  0x5c, 0x46, 0xd5, 0xdf, 0xaf, 0xd1, 0x57, 0x97, 0xd0, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xdc, 0x88, \
+  0x93, 0x55, 0x2f, 0x5c, 0x46, 0xd5, 0xdf, 0xaf, 0xd1, 0x57, 0x97, 0xd0, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x06, 0x11, \
+  0xa0, 0x54, 0xcb, 0xe5, 0xc1, 0xb4, 0x32, 0x80, 0xbc, 0x27, 0x31, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xda, 0xb2, 0x8d, 0xfa, 0xc6, \
+  0xca, 0x88, 0x67, 0xed, 0x06, 0x5e, 0x03, 0x0a, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xda, \
+  0xb2, 0x8d, 0xfa, 0xc6, 0xca, 0x88, 0x67, 0xed, 0x06, 0x5e, 0x03, 0x0a, 0x1a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xda, 0xb2, 0x8d, 0xfa, 0xc6, 0xca, 0x88, \
+  0x67, 0xed, 0x06, 0x5e, 0x03, 0x0a, 0x1a, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, \
+  0x73, 0x74, 0x65, 0x64, 0x31, 0x30, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x65, 0x06, 0x11, 0xa0, 0x54, 0xcb, 0xe5, 0xc1, 0xb4, 0x32, 0x80, 0xbc, 0x27, 0x31, 0xf1, \
+  0x62, 0x77, 0x47, 0xbc, 0x7a, 0xe3, 0x2a, 0x98, 0xd9, 0x1c, 0xd3, 0x0b, 0x6d, 0xac, 0xf2, 0xda, \
+  0xb2, 0x8d, 0xfa, 0xc6, 0xca, 0x88, 0x67, 0xed, 0x06, 0x5e, 0x03, 0x0a, 0x1a, 0xf1, 0xdc, 0x88, \
+  0x93, 0x55, 0x2f, 0x5c, 0x46, 0xd5, 0xdf, 0xaf, 0xd1, 0x57, 0x97, 0xd0\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t10 508u
+const dds_topic_descriptor_t CdrStreamKeySize_t10_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t10),
+  .m_align = dds_alignof (CdrStreamKeySize_t10),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t10",
+  .m_keys = CdrStreamKeySize_t10_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeySize_t10_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t10, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t10 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t10, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t10 }
+};
+
+static const uint32_t CdrStreamKeySize_t11_ops [] =
+{
+  /* t11 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (CdrStreamKeySize_t11, a), 4u,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t11, b),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t11_keys[2] =
+{
+  { "a", 6, 0 },
+  { "b", 8, 1 }
+};
+
+/* Type Information:
+  [MINIMAL b203eea977f39c0fb526bcdec339] (#deps: 0)
+  [COMPLETE 20bfab7c4e748974d6fdd99253c2] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t11 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x03, 0xee, 0xa9, 0x77, 0xf3, 0x9c, 0x0f, 0xb5, 0x26, 0xbc, \
+  0xde, 0xc3, 0x39, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x20, 0xbf, 0xab, 0x7c, 0x4e, 0x74, 0x89, 0x74, 0xd6, 0xfd, 0xd9, \
+  0x92, 0x53, 0xc2, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t11 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t11 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x03, 0xee, 0xa9, 0x77, 0xf3, 0x9c, \
+  0x0f, 0xb5, 0x26, 0xbc, 0xde, 0xc3, 0x39, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x0c, 0xc1, 0x75, 0xb9, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x20, 0xbf, 0xab, 0x7c, 0x4e, 0x74, 0x89, \
+  0x74, 0xd6, 0xfd, 0xd9, 0x92, 0x53, 0xc2, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x31, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x20, 0xbf, 0xab, \
+  0x7c, 0x4e, 0x74, 0x89, 0x74, 0xd6, 0xfd, 0xd9, 0x92, 0x53, 0xc2, 0xf1, 0xb2, 0x03, 0xee, 0xa9, \
+  0x77, 0xf3, 0x9c, 0x0f, 0xb5, 0x26, 0xbc, 0xde, 0xc3, 0x39\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t11 234u
+const dds_topic_descriptor_t CdrStreamKeySize_t11_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t11),
+  .m_align = dds_alignof (CdrStreamKeySize_t11),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeySize::t11",
+  .m_keys = CdrStreamKeySize_t11_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeySize_t11_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t11, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t11 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t11, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t11 }
+};
+
+static const uint32_t CdrStreamKeySize_t12_ops [] =
+{
+  /* t12 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t12, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (CdrStreamKeySize_t12, b), 4u,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t12, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 5u /* order: 2 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t12_keys[3] =
+{
+  { "a", 8, 0 },
+  { "b", 10, 1 },
+  { "c", 12, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 5408f66da4d65016272bf8732cf3] (#deps: 0)
+  [COMPLETE 5ce48f8d6f513fe5fb51a6d4ce2e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t12 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x08, 0xf6, 0x6d, 0xa4, 0xd6, 0x50, 0x16, 0x27, 0x2b, 0xf8, \
+  0x73, 0x2c, 0xf3, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0xe4, 0x8f, 0x8d, 0x6f, 0x51, 0x3f, 0xe5, 0xfb, 0x51, 0xa6, \
+  0xd4, 0xce, 0x2e, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t12 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t12 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x08, 0xf6, 0x6d, 0xa4, 0xd6, 0x50, \
+  0x16, 0x27, 0x2b, 0xf8, 0x73, 0x2c, 0xf3, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0xe4, 0x8f, 0x8d, 0x6f, 0x51, 0x3f, \
+  0xe5, 0xfb, 0x51, 0xa6, 0xd4, 0xce, 0x2e, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x5c, 0xe4, 0x8f, 0x8d, 0x6f, 0x51, 0x3f, 0xe5, 0xfb, 0x51, 0xa6, 0xd4, 0xce, 0x2e, 0xf1, \
+  0x54, 0x08, 0xf6, 0x6d, 0xa4, 0xd6, 0x50, 0x16, 0x27, 0x2b, 0xf8, 0x73, 0x2c, 0xf3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t12 270u
+const dds_topic_descriptor_t CdrStreamKeySize_t12_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t12),
+  .m_align = dds_alignof (CdrStreamKeySize_t12),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t12",
+  .m_keys = CdrStreamKeySize_t12_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t12_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t12, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t12 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t12, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t12 }
+};
+
+static const uint32_t CdrStreamKeySize_t13_ops [] =
+{
+  /* t13 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (CdrStreamKeySize_t13, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t13, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamKeySize_t13, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 2 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t13_keys[3] =
+{
+  { "c", 11, 2 },
+  { "b", 9, 1 },
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL ab4e40e221bcf7027e303dbc7b08] (#deps: 0)
+  [COMPLETE 0de8c1ab6081a8aaeb556b272d1a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t13 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xab, 0x4e, 0x40, 0xe2, 0x21, 0xbc, 0xf7, 0x02, 0x7e, 0x30, 0x3d, \
+  0xbc, 0x7b, 0x08, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0xe8, 0xc1, 0xab, 0x60, 0x81, 0xa8, 0xaa, 0xeb, 0x55, 0x6b, \
+  0x27, 0x2d, 0x1a, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t13 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t13 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xab, 0x4e, 0x40, 0xe2, 0x21, 0xbc, 0xf7, \
+  0x02, 0x7e, 0x30, 0x3d, 0xbc, 0x7b, 0x08, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0xe8, 0xc1, 0xab, 0x60, 0x81, 0xa8, \
+  0xaa, 0xeb, 0x55, 0x6b, 0x27, 0x2d, 0x1a, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x33, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x0d, 0xe8, 0xc1, 0xab, 0x60, 0x81, 0xa8, 0xaa, 0xeb, 0x55, 0x6b, 0x27, 0x2d, 0x1a, 0xf1, \
+  0xab, 0x4e, 0x40, 0xe2, 0x21, 0xbc, 0xf7, 0x02, 0x7e, 0x30, 0x3d, 0xbc, 0x7b, 0x08\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t13 270u
+const dds_topic_descriptor_t CdrStreamKeySize_t13_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t13),
+  .m_align = dds_alignof (CdrStreamKeySize_t13),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t13",
+  .m_keys = CdrStreamKeySize_t13_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t13_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t13, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t13 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t13, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t13 }
+};
+
+static const uint32_t CdrStreamKeySize_t14_ops [] =
+{
+  /* t14 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t14, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamKeySize_t14, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (CdrStreamKeySize_t14, c),
+  DDS_OP_RTS,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t14_keys[3] =
+{
+  { "b", 7, 0 },
+  { "a", 9, 1 },
+  { "c", 11, 2 }
+};
+
+/* Type Information:
+  [MINIMAL a434c492115909004fe2b028f35d] (#deps: 0)
+  [COMPLETE 9daeec0b1318bcaebd72b11d179d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t14 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x34, 0xc4, 0x92, 0x11, 0x59, 0x09, 0x00, 0x4f, 0xe2, 0xb0, \
+  0x28, 0xf3, 0x5d, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x9d, 0xae, 0xec, 0x0b, 0x13, 0x18, 0xbc, 0xae, 0xbd, 0x72, 0xb1, \
+  0x1d, 0x17, 0x9d, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t14 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t14 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x34, 0xc4, 0x92, 0x11, 0x59, 0x09, \
+  0x00, 0x4f, 0xe2, 0xb0, 0x28, 0xf3, 0x5d, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x9d, 0xae, 0xec, 0x0b, 0x13, 0x18, 0xbc, \
+  0xae, 0xbd, 0x72, 0xb1, 0x1d, 0x17, 0x9d, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x34, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x9d, 0xae, 0xec, 0x0b, 0x13, 0x18, 0xbc, 0xae, 0xbd, 0x72, 0xb1, 0x1d, 0x17, 0x9d, 0xf1, \
+  0xa4, 0x34, 0xc4, 0x92, 0x11, 0x59, 0x09, 0x00, 0x4f, 0xe2, 0xb0, 0x28, 0xf3, 0x5d\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t14 270u
+const dds_topic_descriptor_t CdrStreamKeySize_t14_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t14),
+  .m_align = dds_alignof (CdrStreamKeySize_t14),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "CdrStreamKeySize::t14",
+  .m_keys = CdrStreamKeySize_t14_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t14_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t14, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t14 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t14, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t14 }
+};
+
+static const uint32_t CdrStreamKeySize_t15_ops [] =
+{
+  /* t15 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t15, c1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t15, c2),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t15, c3),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t15, l1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t15, l2),
+  DDS_OP_RTS,
+  
+  /* key: c1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: c2 */
+  DDS_OP_KOF | 1, 2u /* order: 2 */,
+  
+  /* key: c3 */
+  DDS_OP_KOF | 1, 4u /* order: 4 */,
+  
+  /* key: l1 */
+  DDS_OP_KOF | 1, 6u /* order: 1 */,
+  
+  /* key: l2 */
+  DDS_OP_KOF | 1, 8u /* order: 3 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t15_keys[5] =
+{
+  { "c1", 11, 0 },
+  { "l1", 17, 3 },
+  { "c2", 13, 1 },
+  { "l2", 19, 4 },
+  { "c3", 15, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 6f6e57ccf35e01c66240f3a8ed27] (#deps: 0)
+  [COMPLETE ffe2cf55fde4a2088e1b8e3c1344] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t15 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6f, 0x6e, 0x57, 0xcc, 0xf3, 0x5e, 0x01, 0xc6, 0x62, 0x40, 0xf3, \
+  0xa8, 0xed, 0x27, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xe2, 0xcf, 0x55, 0xfd, 0xe4, 0xa2, 0x08, 0x8e, 0x1b, 0x8e, \
+  0x3c, 0x13, 0x44, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t15 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t15 (const unsigned char []){ \
+  0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6f, 0x6e, 0x57, 0xcc, 0xf3, 0x5e, 0x01, \
+  0xc6, 0x62, 0x40, 0xf3, 0xa8, 0xed, 0x27, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0xa9, 0xf7, 0xe9, 0x79, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x9a, 0xb6, 0x2b, 0x5e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0a, 0x3d, 0x72, 0x13, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x37, 0x7f, 0xd5, 0x69, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xbe, 0xc2, 0x56, 0x75, 0x00, \
+  0xbd, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xe2, 0xcf, 0x55, 0xfd, 0xe4, 0xa2, \
+  0x08, 0x8e, 0x1b, 0x8e, 0x3c, 0x13, 0x44, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, \
+  0x35, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x63, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xe2, 0xcf, \
+  0x55, 0xfd, 0xe4, 0xa2, 0x08, 0x8e, 0x1b, 0x8e, 0x3c, 0x13, 0x44, 0xf1, 0x6f, 0x6e, 0x57, 0xcc, \
+  0xf3, 0x5e, 0x01, 0xc6, 0x62, 0x40, 0xf3, 0xa8, 0xed, 0x27\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t15 362u
+const dds_topic_descriptor_t CdrStreamKeySize_t15_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t15),
+  .m_align = dds_alignof (CdrStreamKeySize_t15),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 5u,
+  .m_typename = "CdrStreamKeySize::t15",
+  .m_keys = CdrStreamKeySize_t15_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeySize_t15_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t15, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t15 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t15, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t15 }
+};
+
+static const uint32_t CdrStreamKeySize_t16_ops [] =
+{
+  /* t16 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t16, a), 1u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t16_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 45bb5614f75a27159f471bcfe701] (#deps: 1)
+   - [MINIMAL c4293174d9ec21db23fdf9198609]
+  [COMPLETE a54ed190c3b85c066de7d64bb41f] (#deps: 1)
+   - [COMPLETE 4444f04abc4bc7bef7a16864def0]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t16 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x45, 0xbb, 0x56, 0x14, 0xf7, 0x5a, 0x27, 0x15, 0x9f, 0x47, 0x1b, \
+  0xcf, 0xe7, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x29, 0x31, 0x74, 0xd9, 0xec, 0x21, \
+  0xdb, 0x23, 0xfd, 0xf9, 0x19, 0x86, 0x09, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x4e, 0xd1, \
+  0x90, 0xc3, 0xb8, 0x5c, 0x06, 0x6d, 0xe7, 0xd6, 0x4b, 0xb4, 0x1f, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x44, 0x44, 0xf0, 0x4a, 0xbc, 0x4b, 0xc7, 0xbe, 0xf7, 0xa1, 0x68, 0x64, 0xde, 0xf0, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t16 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t16 (const unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x45, 0xbb, 0x56, 0x14, 0xf7, 0x5a, 0x27, \
+  0x15, 0x9f, 0x47, 0x1b, 0xcf, 0xe7, 0x01, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xc4, 0x29, 0x31, 0x74, 0xd9, \
+  0xec, 0x21, 0xdb, 0x23, 0xfd, 0xf9, 0x19, 0x86, 0x09, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xc4, 0x29, \
+  0x31, 0x74, 0xd9, 0xec, 0x21, 0xdb, 0x23, 0xfd, 0xf9, 0x19, 0x86, 0x09, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xc9, 0x18, 0xf6, 0x53, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xc6, 0x83, 0xfd, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x4e, 0xd1, 0x90, 0xc3, 0xb8, 0x5c, 0x06, 0x6d, 0xe7, 0xd6, \
+  0x4b, 0xb4, 0x1f, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x44, 0x44, 0xf0, 0x4a, 0xbc, 0x4b, 0xc7, 0xbe, 0xf7, 0xa1, 0x68, 0x64, 0xde, \
+  0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x44, 0x44, 0xf0, \
+  0x4a, 0xbc, 0x4b, 0xc7, 0xbe, 0xf7, 0xa1, 0x68, 0x64, 0xde, 0xf0, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x65, 0x31, 0x36, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x36, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x36, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xa5, 0x4e, 0xd1, 0x90, 0xc3, 0xb8, 0x5c, 0x06, 0x6d, 0xe7, 0xd6, 0x4b, 0xb4, 0x1f, 0xf1, \
+  0x45, 0xbb, 0x56, 0x14, 0xf7, 0x5a, 0x27, 0x15, 0x9f, 0x47, 0x1b, 0xcf, 0xe7, 0x01, 0xf2, 0x44, \
+  0x44, 0xf0, 0x4a, 0xbc, 0x4b, 0xc7, 0xbe, 0xf7, 0xa1, 0x68, 0x64, 0xde, 0xf0, 0xf1, 0xc4, 0x29, \
+  0x31, 0x74, 0xd9, 0xec, 0x21, 0xdb, 0x23, 0xfd, 0xf9, 0x19, 0x86, 0x09\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t16 460u
+const dds_topic_descriptor_t CdrStreamKeySize_t16_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t16),
+  .m_align = dds_alignof (CdrStreamKeySize_t16),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t16",
+  .m_keys = CdrStreamKeySize_t16_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t16_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t16, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t16 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t16, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t16 }
+};
+
+static const uint32_t CdrStreamKeySize_t17_ops [] =
+{
+  /* t17 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t17, a), 1u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t17_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 77a352a97ea875a56a14c70ab948] (#deps: 1)
+   - [MINIMAL 63102a55cedfc767b3a8877cd085]
+  [COMPLETE bba6e5f5f3ce00ca6f83ef92fcfa] (#deps: 1)
+   - [COMPLETE 4a3a23dc24aee0cac036cb53a5bb]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t17 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x77, 0xa3, 0x52, 0xa9, 0x7e, 0xa8, 0x75, 0xa5, 0x6a, 0x14, 0xc7, \
+  0x0a, 0xb9, 0x48, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x63, 0x10, 0x2a, 0x55, 0xce, 0xdf, 0xc7, \
+  0x67, 0xb3, 0xa8, 0x87, 0x7c, 0xd0, 0x85, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0xa6, 0xe5, \
+  0xf5, 0xf3, 0xce, 0x00, 0xca, 0x6f, 0x83, 0xef, 0x92, 0xfc, 0xfa, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x4a, 0x3a, 0x23, 0xdc, 0x24, 0xae, 0xe0, 0xca, 0xc0, 0x36, 0xcb, 0x53, 0xa5, 0xbb, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t17 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t17 (const unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x77, 0xa3, 0x52, 0xa9, 0x7e, 0xa8, 0x75, \
+  0xa5, 0x6a, 0x14, 0xc7, 0x0a, 0xb9, 0x48, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x63, 0x10, 0x2a, 0x55, 0xce, \
+  0xdf, 0xc7, 0x67, 0xb3, 0xa8, 0x87, 0x7c, 0xd0, 0x85, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x63, 0x10, \
+  0x2a, 0x55, 0xce, 0xdf, 0xc7, 0x67, 0xb3, 0xa8, 0x87, 0x7c, 0xd0, 0x85, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x88, 0xc7, 0x8b, 0xeb, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x4a, 0x08, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0xa6, 0xe5, 0xf5, 0xf3, 0xce, 0x00, 0xca, 0x6f, 0x83, 0xef, \
+  0x92, 0xfc, 0xfa, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x37, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x4a, 0x3a, 0x23, 0xdc, 0x24, 0xae, 0xe0, 0xca, 0xc0, 0x36, 0xcb, 0x53, 0xa5, \
+  0xbb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x4a, 0x3a, 0x23, \
+  0xdc, 0x24, 0xae, 0xe0, 0xca, 0xc0, 0x36, 0xcb, 0x53, 0xa5, 0xbb, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x65, 0x31, 0x37, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x37, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x37, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xbb, 0xa6, 0xe5, 0xf5, 0xf3, 0xce, 0x00, 0xca, 0x6f, 0x83, 0xef, 0x92, 0xfc, 0xfa, 0xf1, \
+  0x77, 0xa3, 0x52, 0xa9, 0x7e, 0xa8, 0x75, 0xa5, 0x6a, 0x14, 0xc7, 0x0a, 0xb9, 0x48, 0xf2, 0x4a, \
+  0x3a, 0x23, 0xdc, 0x24, 0xae, 0xe0, 0xca, 0xc0, 0x36, 0xcb, 0x53, 0xa5, 0xbb, 0xf1, 0x63, 0x10, \
+  0x2a, 0x55, 0xce, 0xdf, 0xc7, 0x67, 0xb3, 0xa8, 0x87, 0x7c, 0xd0, 0x85\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t17 460u
+const dds_topic_descriptor_t CdrStreamKeySize_t17_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t17),
+  .m_align = dds_alignof (CdrStreamKeySize_t17),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t17",
+  .m_keys = CdrStreamKeySize_t17_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t17_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t17, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t17 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t17, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t17 }
+};
+
+static const uint32_t CdrStreamKeySize_t18_ops [] =
+{
+  /* t18 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t18, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t18, b), 4u, 1u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t18_keys[2] =
+{
+  { "a", 7, 0 },
+  { "b", 9, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 16b6f31333bea841b653ee3319e1] (#deps: 1)
+   - [MINIMAL e3507ec1178efbfcb97ff05a3c80]
+  [COMPLETE d1c50474931391dbd868bde5af3b] (#deps: 1)
+   - [COMPLETE 4b1d698496c7eaf9d339ea222e01]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t18 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xb6, 0xf3, 0x13, 0x33, 0xbe, 0xa8, 0x41, 0xb6, 0x53, 0xee, \
+  0x33, 0x19, 0xe1, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0x50, 0x7e, 0xc1, 0x17, 0x8e, 0xfb, \
+  0xfc, 0xb9, 0x7f, 0xf0, 0x5a, 0x3c, 0x80, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0xc5, 0x04, \
+  0x74, 0x93, 0x13, 0x91, 0xdb, 0xd8, 0x68, 0xbd, 0xe5, 0xaf, 0x3b, 0x00, 0x74, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x4b, 0x1d, 0x69, 0x84, 0x96, 0xc7, 0xea, 0xf9, 0xd3, 0x39, 0xea, 0x22, 0x2e, 0x01, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t18 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t18 (const unsigned char []){ \
+  0xb2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xb6, 0xf3, 0x13, 0x33, 0xbe, 0xa8, \
+  0x41, 0xb6, 0x53, 0xee, 0x33, 0x19, 0xe1, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0xf1, 0xe3, 0x50, 0x7e, 0xc1, 0x17, 0x8e, 0xfb, 0xfc, 0xb9, 0x7f, \
+  0xf0, 0x5a, 0x3c, 0x80, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0xe3, 0x50, 0x7e, 0xc1, 0x17, 0x8e, 0xfb, \
+  0xfc, 0xb9, 0x7f, 0xf0, 0x5a, 0x3c, 0x80, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xb0, 0xad, \
+  0xce, 0x3a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x7e, 0xc5, 0x1d, 0x79, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xd1, 0xc5, 0x04, 0x74, 0x93, 0x13, 0x91, 0xdb, 0xd8, 0x68, 0xbd, 0xe5, 0xaf, 0x3b, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, \
+  0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x38, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x4b, 0x1d, \
+  0x69, 0x84, 0x96, 0xc7, 0xea, 0xf9, 0xd3, 0x39, 0xea, 0x22, 0x2e, 0x01, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0xf2, 0x4b, 0x1d, 0x69, 0x84, 0x96, 0xc7, 0xea, 0xf9, 0xd3, 0x39, 0xea, \
+  0x22, 0x2e, 0x01, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x65, 0x31, 0x38, 0x00, 0x00, 0x00, \
+  0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x38, 0x5f, \
+  0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x38, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0xc5, 0x04, 0x74, 0x93, 0x13, 0x91, \
+  0xdb, 0xd8, 0x68, 0xbd, 0xe5, 0xaf, 0x3b, 0xf1, 0x16, 0xb6, 0xf3, 0x13, 0x33, 0xbe, 0xa8, 0x41, \
+  0xb6, 0x53, 0xee, 0x33, 0x19, 0xe1, 0xf2, 0x4b, 0x1d, 0x69, 0x84, 0x96, 0xc7, 0xea, 0xf9, 0xd3, \
+  0x39, 0xea, 0x22, 0x2e, 0x01, 0xf1, 0xe3, 0x50, 0x7e, 0xc1, 0x17, 0x8e, 0xfb, 0xfc, 0xb9, 0x7f, \
+  0xf0, 0x5a, 0x3c, 0x80\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t18 516u
+const dds_topic_descriptor_t CdrStreamKeySize_t18_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t18),
+  .m_align = dds_alignof (CdrStreamKeySize_t18),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeySize::t18",
+  .m_keys = CdrStreamKeySize_t18_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeySize_t18_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t18, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t18 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t18, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t18 }
+};
+
+static const uint32_t CdrStreamKeySize_t19_ops [] =
+{
+  /* t19 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t19, a), 0u, 3u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t19_keys[1] =
+{
+  { "a", 5, 0 }
+};
+
+/* Type Information:
+  [MINIMAL acbd4ebd497e2c28e1689f0e2082] (#deps: 1)
+   - [MINIMAL e57248134f83ba4132d3bcaa3799]
+  [COMPLETE b0cf5332754a4c78036a20c49766] (#deps: 1)
+   - [COMPLETE 41bcdea9e90e6fd969de6c931819]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t19 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xac, 0xbd, 0x4e, 0xbd, 0x49, 0x7e, 0x2c, 0x28, 0xe1, 0x68, 0x9f, \
+  0x0e, 0x20, 0x82, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe5, 0x72, 0x48, 0x13, 0x4f, 0x83, 0xba, \
+  0x41, 0x32, 0xd3, 0xbc, 0xaa, 0x37, 0x99, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xcf, 0x53, \
+  0x32, 0x75, 0x4a, 0x4c, 0x78, 0x03, 0x6a, 0x20, 0xc4, 0x97, 0x66, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0xbc, 0xde, 0xa9, 0xe9, 0x0e, 0x6f, 0xd9, 0x69, 0xde, 0x6c, 0x93, 0x18, 0x19, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t19 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t19 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xac, 0xbd, 0x4e, 0xbd, 0x49, 0x7e, 0x2c, \
+  0x28, 0xe1, 0x68, 0x9f, 0x0e, 0x20, 0x82, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xe5, 0x72, 0x48, 0x13, 0x4f, \
+  0x83, 0xba, 0x41, 0x32, 0xd3, 0xbc, 0xaa, 0x37, 0x99, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xe5, 0x72, \
+  0x48, 0x13, 0x4f, 0x83, 0xba, 0x41, 0x32, 0xd3, 0xbc, 0xaa, 0x37, 0x99, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x33, 0xfa, 0x36, 0xd1, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xee, 0x37, 0xba, 0x3f, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xcf, 0x53, \
+  0x32, 0x75, 0x4a, 0x4c, 0x78, 0x03, 0x6a, 0x20, 0xc4, 0x97, 0x66, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x31, 0x39, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x41, 0xbc, 0xde, 0xa9, 0xe9, \
+  0x0e, 0x6f, 0xd9, 0x69, 0xde, 0x6c, 0x93, 0x18, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x41, 0xbc, 0xde, 0xa9, 0xe9, 0x0e, 0x6f, 0xd9, 0x69, 0xde, 0x6c, \
+  0x93, 0x18, 0x19, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x39, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x39, \
+  0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x39, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xcf, 0x53, 0x32, 0x75, 0x4a, 0x4c, \
+  0x78, 0x03, 0x6a, 0x20, 0xc4, 0x97, 0x66, 0xf1, 0xac, 0xbd, 0x4e, 0xbd, 0x49, 0x7e, 0x2c, 0x28, \
+  0xe1, 0x68, 0x9f, 0x0e, 0x20, 0x82, 0xf2, 0x41, 0xbc, 0xde, 0xa9, 0xe9, 0x0e, 0x6f, 0xd9, 0x69, \
+  0xde, 0x6c, 0x93, 0x18, 0x19, 0xf1, 0xe5, 0x72, 0x48, 0x13, 0x4f, 0x83, 0xba, 0x41, 0x32, 0xd3, \
+  0xbc, 0xaa, 0x37, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t19 452u
+const dds_topic_descriptor_t CdrStreamKeySize_t19_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t19),
+  .m_align = dds_alignof (CdrStreamKeySize_t19),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t19",
+  .m_keys = CdrStreamKeySize_t19_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t19_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t19, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t19 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t19, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t19 }
+};
+
+static const uint32_t CdrStreamKeySize_t20_ops [] =
+{
+  /* t20 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BMK | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t20, a), 0u, 3u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t20_keys[1] =
+{
+  { "a", 5, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 42b304ac4a7a2629968350b05a61] (#deps: 1)
+   - [MINIMAL 9cdde733432a0c0d915ec045c454]
+  [COMPLETE 26338460f19083cca223c5dbbc13] (#deps: 1)
+   - [COMPLETE 7b953c1b18cb5afd57507587900f]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t20 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xb3, 0x04, 0xac, 0x4a, 0x7a, 0x26, 0x29, 0x96, 0x83, 0x50, \
+  0xb0, 0x5a, 0x61, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0xdd, 0xe7, 0x33, 0x43, 0x2a, 0x0c, \
+  0x0d, 0x91, 0x5e, 0xc0, 0x45, 0xc4, 0x54, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x33, 0x84, \
+  0x60, 0xf1, 0x90, 0x83, 0xcc, 0xa2, 0x23, 0xc5, 0xdb, 0xbc, 0x13, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7b, 0x95, 0x3c, 0x1b, 0x18, 0xcb, 0x5a, 0xfd, 0x57, 0x50, 0x75, 0x87, 0x90, 0x0f, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t20 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t20 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xb3, 0x04, 0xac, 0x4a, 0x7a, 0x26, \
+  0x29, 0x96, 0x83, 0x50, 0xb0, 0x5a, 0x61, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x9c, 0xdd, 0xe7, 0x33, 0x43, \
+  0x2a, 0x0c, 0x0d, 0x91, 0x5e, 0xc0, 0x45, 0xc4, 0x54, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x9c, 0xdd, \
+  0xe7, 0x33, 0x43, 0x2a, 0x0c, 0x0d, 0x91, 0x5e, 0xc0, 0x45, 0xc4, 0x54, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xcd, 0x99, 0x27, 0x4b, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x85, 0x50, 0x2c, 0xec, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x33, 0x84, \
+  0x60, 0xf1, 0x90, 0x83, 0xcc, 0xa2, 0x23, 0xc5, 0xdb, 0xbc, 0x13, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x7b, 0x95, 0x3c, 0x1b, 0x18, \
+  0xcb, 0x5a, 0xfd, 0x57, 0x50, 0x75, 0x87, 0x90, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x7b, 0x95, 0x3c, 0x1b, 0x18, 0xcb, 0x5a, 0xfd, 0x57, 0x50, 0x75, \
+  0x87, 0x90, 0x0f, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x32, 0x30, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x30, \
+  0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x30, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x33, 0x84, 0x60, 0xf1, 0x90, 0x83, \
+  0xcc, 0xa2, 0x23, 0xc5, 0xdb, 0xbc, 0x13, 0xf1, 0x42, 0xb3, 0x04, 0xac, 0x4a, 0x7a, 0x26, 0x29, \
+  0x96, 0x83, 0x50, 0xb0, 0x5a, 0x61, 0xf2, 0x7b, 0x95, 0x3c, 0x1b, 0x18, 0xcb, 0x5a, 0xfd, 0x57, \
+  0x50, 0x75, 0x87, 0x90, 0x0f, 0xf1, 0x9c, 0xdd, 0xe7, 0x33, 0x43, 0x2a, 0x0c, 0x0d, 0x91, 0x5e, \
+  0xc0, 0x45, 0xc4, 0x54\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t20 452u
+const dds_topic_descriptor_t CdrStreamKeySize_t20_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t20),
+  .m_align = dds_alignof (CdrStreamKeySize_t20),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t20",
+  .m_keys = CdrStreamKeySize_t20_keys,
+  .m_nops = 2,
+  .m_ops = CdrStreamKeySize_t20_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t20, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t20 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t20, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t20 }
+};
+
+static const uint32_t CdrStreamKeySize_t21_ops [] =
+{
+  /* t21 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t21, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BMK | (3 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t21, b), 1u, 0u, 3u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t21_keys[2] =
+{
+  { "a", 8, 0 },
+  { "b", 10, 1 }
+};
+
+/* Type Information:
+  [MINIMAL fb86b6195bfcc7213c6b401c0f91] (#deps: 1)
+   - [MINIMAL 8c27d8bc08048de674244cb2b2f6]
+  [COMPLETE 9f4e80d26a382d411f2e1ccb41f3] (#deps: 1)
+   - [COMPLETE 1b7709d363d1a8e1c3a20b3fea74]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t21 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xfb, 0x86, 0xb6, 0x19, 0x5b, 0xfc, 0xc7, 0x21, 0x3c, 0x6b, 0x40, \
+  0x1c, 0x0f, 0x91, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0x27, 0xd8, 0xbc, 0x08, 0x04, 0x8d, \
+  0xe6, 0x74, 0x24, 0x4c, 0xb2, 0xb2, 0xf6, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x9f, 0x4e, 0x80, \
+  0xd2, 0x6a, 0x38, 0x2d, 0x41, 0x1f, 0x2e, 0x1c, 0xcb, 0x41, 0xf3, 0x00, 0x74, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x1b, 0x77, 0x09, 0xd3, 0x63, 0xd1, 0xa8, 0xe1, 0xc3, 0xa2, 0x0b, 0x3f, 0xea, 0x74, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t21 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t21 (const unsigned char []){ \
+  0xac, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xfb, 0x86, 0xb6, 0x19, 0x5b, 0xfc, 0xc7, \
+  0x21, 0x3c, 0x6b, 0x40, 0x1c, 0x0f, 0x91, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x8c, 0x27, 0xd8, 0xbc, 0x08, 0x04, 0x8d, 0xe6, 0x74, 0x24, \
+  0x4c, 0xb2, 0xb2, 0xf6, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x8c, 0x27, 0xd8, 0xbc, 0x08, 0x04, 0x8d, \
+  0xe6, 0x74, 0x24, 0x4c, 0xb2, 0xb2, 0xf6, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x9a, 0x1d, 0x98, 0x34, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0x7a, 0x0d, 0x7d, \
+  0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9f, 0x4e, 0x80, 0xd2, 0x6a, 0x38, 0x2d, \
+  0x41, 0x1f, 0x2e, 0x1c, 0xcb, 0x41, 0xf3, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, \
+  0x31, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0xf2, 0x1b, 0x77, 0x09, 0xd3, 0x63, 0xd1, 0xa8, 0xe1, 0xc3, 0xa2, \
+  0x0b, 0x3f, 0xea, 0x74, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0x1b, 0x77, 0x09, \
+  0xd3, 0x63, 0xd1, 0xa8, 0xe1, 0xc3, 0xa2, 0x0b, 0x3f, 0xea, 0x74, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x32, 0x31, 0x00, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x31, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x31, \
+  0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x9f, 0x4e, 0x80, 0xd2, 0x6a, 0x38, 0x2d, 0x41, 0x1f, 0x2e, 0x1c, 0xcb, 0x41, 0xf3, 0xf1, \
+  0xfb, 0x86, 0xb6, 0x19, 0x5b, 0xfc, 0xc7, 0x21, 0x3c, 0x6b, 0x40, 0x1c, 0x0f, 0x91, 0xf2, 0x1b, \
+  0x77, 0x09, 0xd3, 0x63, 0xd1, 0xa8, 0xe1, 0xc3, 0xa2, 0x0b, 0x3f, 0xea, 0x74, 0xf1, 0x8c, 0x27, \
+  0xd8, 0xbc, 0x08, 0x04, 0x8d, 0xe6, 0x74, 0x24, 0x4c, 0xb2, 0xb2, 0xf6\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t21 508u
+const dds_topic_descriptor_t CdrStreamKeySize_t21_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t21),
+  .m_align = dds_alignof (CdrStreamKeySize_t21),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CdrStreamKeySize::t21",
+  .m_keys = CdrStreamKeySize_t21_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeySize_t21_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t21, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t21 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t21, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t21 }
+};
+
+static const uint32_t CdrStreamKeySize_t22_ops [] =
+{
+  /* t22 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t22, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t22_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL cb759af86b19d1d45ed10355053c] (#deps: 0)
+  [COMPLETE c00a577ebc2523f3ca34c641bcf1] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t22 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, 0x5e, 0xd1, 0x03, \
+  0x55, 0x05, 0x3c, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0x0a, 0x57, 0x7e, 0xbc, 0x25, 0x23, 0xf3, 0xca, 0x34, 0xc6, \
+  0x41, 0xbc, 0xf1, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t22 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t22 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, \
+  0xd4, 0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0x0a, 0x57, 0x7e, 0xbc, 0x25, 0x23, \
+  0xf3, 0xca, 0x34, 0xc6, 0x41, 0xbc, 0xf1, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, \
+  0x32, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc0, 0x0a, 0x57, 0x7e, 0xbc, 0x25, 0x23, \
+  0xf3, 0xca, 0x34, 0xc6, 0x41, 0xbc, 0xf1, 0xf1, 0xcb, 0x75, 0x9a, 0xf8, 0x6b, 0x19, 0xd1, 0xd4, \
+  0x5e, 0xd1, 0x03, 0x55, 0x05, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t22 198u
+const dds_topic_descriptor_t CdrStreamKeySize_t22_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t22),
+  .m_align = dds_alignof (CdrStreamKeySize_t22),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t22",
+  .m_keys = CdrStreamKeySize_t22_keys,
+  .m_nops = 3,
+  .m_ops = CdrStreamKeySize_t22_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t22, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t22 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t22, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t22 }
+};
+
+static const uint32_t CdrStreamKeySize_t23_ops [] =
+{
+  /* t23 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t23, a),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t23_keys[1] =
+{
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8ed004a8b6ef7f879094d486b650] (#deps: 0)
+  [COMPLETE 8215250d3585ebde5a709132062e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t23 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, 0x90, 0x94, 0xd4, \
+  0x86, 0xb6, 0x50, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x82, 0x15, 0x25, 0x0d, 0x35, 0x85, 0xeb, 0xde, 0x5a, 0x70, 0x91, \
+  0x32, 0x06, 0x2e, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t23 100u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t23 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, \
+  0x87, 0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x82, 0x15, 0x25, 0x0d, 0x35, 0x85, 0xeb, \
+  0xde, 0x5a, 0x70, 0x91, 0x32, 0x06, 0x2e, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, \
+  0x33, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x82, 0x15, 0x25, 0x0d, 0x35, 0x85, 0xeb, \
+  0xde, 0x5a, 0x70, 0x91, 0x32, 0x06, 0x2e, 0xf1, 0x8e, 0xd0, 0x04, 0xa8, 0xb6, 0xef, 0x7f, 0x87, \
+  0x90, 0x94, 0xd4, 0x86, 0xb6, 0x50\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t23 198u
+const dds_topic_descriptor_t CdrStreamKeySize_t23_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t23),
+  .m_align = dds_alignof (CdrStreamKeySize_t23),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t23",
+  .m_keys = CdrStreamKeySize_t23_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t23_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t23, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t23 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t23, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t23 }
+};
+
+static const uint32_t CdrStreamKeySize_t24_ops [] =
+{
+  /* t24 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t24, a), (3u << 16u) + 4u /* nested24 */,
+  DDS_OP_RTS,
+
+  /* nested24 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested24, a),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 1u /* order: 0 */, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t24_keys[1] =
+{
+  { "a.a", 9, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 380392d193fff76fab28c5763c99] (#deps: 1)
+   - [MINIMAL 54c0732102846981ab93daf8ca18]
+  [COMPLETE 379564df6b62c7e16665ec2ffd7d] (#deps: 1)
+   - [COMPLETE b249205950d0a5dfa38a951585a3]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t24 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x38, 0x03, 0x92, 0xd1, 0x93, 0xff, 0xf7, 0x6f, 0xab, 0x28, 0xc5, \
+  0x76, 0x3c, 0x99, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xc0, 0x73, 0x21, 0x02, 0x84, 0x69, \
+  0x81, 0xab, 0x93, 0xda, 0xf8, 0xca, 0x18, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x95, 0x64, \
+  0xdf, 0x6b, 0x62, 0xc7, 0xe1, 0x66, 0x65, 0xec, 0x2f, 0xfd, 0x7d, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xb2, 0x49, 0x20, 0x59, 0x50, 0xd0, 0xa5, 0xdf, 0xa3, 0x8a, 0x95, 0x15, 0x85, 0xa3, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t24 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t24 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x38, 0x03, 0x92, 0xd1, 0x93, 0xff, 0xf7, \
+  0x6f, 0xab, 0x28, 0xc5, 0x76, 0x3c, 0x99, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x54, 0xc0, 0x73, 0x21, 0x02, \
+  0x84, 0x69, 0x81, 0xab, 0x93, 0xda, 0xf8, 0xca, 0x18, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x54, 0xc0, \
+  0x73, 0x21, 0x02, 0x84, 0x69, 0x81, 0xab, 0x93, 0xda, 0xf8, 0xca, 0x18, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x95, 0x64, \
+  0xdf, 0x6b, 0x62, 0xc7, 0xe1, 0x66, 0x65, 0xec, 0x2f, 0xfd, 0x7d, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xb2, 0x49, 0x20, 0x59, 0x50, \
+  0xd0, 0xa5, 0xdf, 0xa3, 0x8a, 0x95, 0x15, 0x85, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0xb2, 0x49, 0x20, 0x59, 0x50, 0xd0, 0xa5, 0xdf, 0xa3, 0x8a, 0x95, \
+  0x15, 0x85, 0xa3, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x32, 0x34, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x37, 0x95, 0x64, 0xdf, 0x6b, 0x62, 0xc7, \
+  0xe1, 0x66, 0x65, 0xec, 0x2f, 0xfd, 0x7d, 0xf1, 0x38, 0x03, 0x92, 0xd1, 0x93, 0xff, 0xf7, 0x6f, \
+  0xab, 0x28, 0xc5, 0x76, 0x3c, 0x99, 0xf2, 0xb2, 0x49, 0x20, 0x59, 0x50, 0xd0, 0xa5, 0xdf, 0xa3, \
+  0x8a, 0x95, 0x15, 0x85, 0xa3, 0xf1, 0x54, 0xc0, 0x73, 0x21, 0x02, 0x84, 0x69, 0x81, 0xab, 0x93, \
+  0xda, 0xf8, 0xca, 0x18\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t24 404u
+const dds_topic_descriptor_t CdrStreamKeySize_t24_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t24),
+  .m_align = dds_alignof (CdrStreamKeySize_t24),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t24",
+  .m_keys = CdrStreamKeySize_t24_keys,
+  .m_nops = 6,
+  .m_ops = CdrStreamKeySize_t24_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t24, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t24 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t24, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t24 }
+};
+
+static const uint32_t CdrStreamKeySize_t25_ops [] =
+{
+  /* t25 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t25, a), (3u << 16u) + 4u /* nested25 */,
+  DDS_OP_RTS,
+
+  /* nested25 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested25, a),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 4u /* order: 0 */, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t25_keys[1] =
+{
+  { "a.a", 15, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 1e8517ecd9033babbc2a6519dea5] (#deps: 1)
+   - [MINIMAL bde83db506783dc38394ab428b46]
+  [COMPLETE 9c8699cd96c754a7e5af1a14d397] (#deps: 1)
+   - [COMPLETE 310e7c5d8f1ad160f531265b0cf1]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t25 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1e, 0x85, 0x17, 0xec, 0xd9, 0x03, 0x3b, 0xab, 0xbc, 0x2a, 0x65, \
+  0x19, 0xde, 0xa5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0xe8, 0x3d, 0xb5, 0x06, 0x78, 0x3d, \
+  0xc3, 0x83, 0x94, 0xab, 0x42, 0x8b, 0x46, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x86, 0x99, \
+  0xcd, 0x96, 0xc7, 0x54, 0xa7, 0xe5, 0xaf, 0x1a, 0x14, 0xd3, 0x97, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x31, 0x0e, 0x7c, 0x5d, 0x8f, 0x1a, 0xd1, 0x60, 0xf5, 0x31, 0x26, 0x5b, 0x0c, 0xf1, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t25 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t25 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x1e, 0x85, 0x17, 0xec, 0xd9, 0x03, 0x3b, \
+  0xab, 0xbc, 0x2a, 0x65, 0x19, 0xde, 0xa5, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xbd, 0xe8, 0x3d, 0xb5, 0x06, \
+  0x78, 0x3d, 0xc3, 0x83, 0x94, 0xab, 0x42, 0x8b, 0x46, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xbd, 0xe8, \
+  0x3d, 0xb5, 0x06, 0x78, 0x3d, 0xc3, 0x83, 0x94, 0xab, 0x42, 0x8b, 0x46, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x86, 0x99, \
+  0xcd, 0x96, 0xc7, 0x54, 0xa7, 0xe5, 0xaf, 0x1a, 0x14, 0xd3, 0x97, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x35, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x31, 0x0e, 0x7c, 0x5d, 0x8f, \
+  0x1a, 0xd1, 0x60, 0xf5, 0x31, 0x26, 0x5b, 0x0c, 0xf1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x0e, 0x7c, 0x5d, 0x8f, 0x1a, 0xd1, 0x60, 0xf5, 0x31, 0x26, \
+  0x5b, 0x0c, 0xf1, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x32, 0x35, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x86, 0x99, 0xcd, 0x96, 0xc7, 0x54, \
+  0xa7, 0xe5, 0xaf, 0x1a, 0x14, 0xd3, 0x97, 0xf1, 0x1e, 0x85, 0x17, 0xec, 0xd9, 0x03, 0x3b, 0xab, \
+  0xbc, 0x2a, 0x65, 0x19, 0xde, 0xa5, 0xf2, 0x31, 0x0e, 0x7c, 0x5d, 0x8f, 0x1a, 0xd1, 0x60, 0xf5, \
+  0x31, 0x26, 0x5b, 0x0c, 0xf1, 0xf1, 0xbd, 0xe8, 0x3d, 0xb5, 0x06, 0x78, 0x3d, 0xc3, 0x83, 0x94, \
+  0xab, 0x42, 0x8b, 0x46\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t25 404u
+const dds_topic_descriptor_t CdrStreamKeySize_t25_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t25),
+  .m_align = dds_alignof (CdrStreamKeySize_t25),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t25",
+  .m_keys = CdrStreamKeySize_t25_keys,
+  .m_nops = 8,
+  .m_ops = CdrStreamKeySize_t25_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t25, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t25 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t25, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t25 }
+};
+
+static const uint32_t CdrStreamKeySize_t26_ops [] =
+{
+  /* t26 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t26, a), (3u << 16u) + 4u /* nested26 */,
+  DDS_OP_RTS,
+
+  /* nested26 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested26, a),
+  DDS_OP_RTS,
+  
+  /* key: a.a */
+  DDS_OP_KOF | 2, 4u /* order: 0 */, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t26_keys[1] =
+{
+  { "a.a", 12, 0 }
+};
+
+/* Type Information:
+  [MINIMAL ba1463f52d0400bbf71deb6dfee6] (#deps: 1)
+   - [MINIMAL 840e0f9dfa619dc928528c44438b]
+  [COMPLETE 6f58859819bdd300c505cd45aba1] (#deps: 1)
+   - [COMPLETE 44fb37b2bbd8d0deb29ff902ca68]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t26 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xba, 0x14, 0x63, 0xf5, 0x2d, 0x04, 0x00, 0xbb, 0xf7, 0x1d, 0xeb, \
+  0x6d, 0xfe, 0xe6, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x0e, 0x0f, 0x9d, 0xfa, 0x61, 0x9d, \
+  0xc9, 0x28, 0x52, 0x8c, 0x44, 0x43, 0x8b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6f, 0x58, 0x85, \
+  0x98, 0x19, 0xbd, 0xd3, 0x00, 0xc5, 0x05, 0xcd, 0x45, 0xab, 0xa1, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x44, 0xfb, 0x37, 0xb2, 0xbb, 0xd8, 0xd0, 0xde, 0xb2, 0x9f, 0xf9, 0x02, 0xca, 0x68, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t26 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t26 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xba, 0x14, 0x63, 0xf5, 0x2d, 0x04, 0x00, \
+  0xbb, 0xf7, 0x1d, 0xeb, 0x6d, 0xfe, 0xe6, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x84, 0x0e, 0x0f, 0x9d, 0xfa, \
+  0x61, 0x9d, 0xc9, 0x28, 0x52, 0x8c, 0x44, 0x43, 0x8b, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x84, 0x0e, \
+  0x0f, 0x9d, 0xfa, 0x61, 0x9d, 0xc9, 0x28, 0x52, 0x8c, 0x44, 0x43, 0x8b, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x6f, 0x58, 0x85, \
+  0x98, 0x19, 0xbd, 0xd3, 0x00, 0xc5, 0x05, 0xcd, 0x45, 0xab, 0xa1, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x44, 0xfb, 0x37, 0xb2, 0xbb, \
+  0xd8, 0xd0, 0xde, 0xb2, 0x9f, 0xf9, 0x02, 0xca, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x44, 0xfb, 0x37, 0xb2, 0xbb, 0xd8, 0xd0, 0xde, 0xb2, 0x9f, 0xf9, \
+  0x02, 0xca, 0x68, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x32, 0x36, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x6f, 0x58, 0x85, 0x98, 0x19, 0xbd, 0xd3, \
+  0x00, 0xc5, 0x05, 0xcd, 0x45, 0xab, 0xa1, 0xf1, 0xba, 0x14, 0x63, 0xf5, 0x2d, 0x04, 0x00, 0xbb, \
+  0xf7, 0x1d, 0xeb, 0x6d, 0xfe, 0xe6, 0xf2, 0x44, 0xfb, 0x37, 0xb2, 0xbb, 0xd8, 0xd0, 0xde, 0xb2, \
+  0x9f, 0xf9, 0x02, 0xca, 0x68, 0xf1, 0x84, 0x0e, 0x0f, 0x9d, 0xfa, 0x61, 0x9d, 0xc9, 0x28, 0x52, \
+  0x8c, 0x44, 0x43, 0x8b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t26 404u
+const dds_topic_descriptor_t CdrStreamKeySize_t26_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t26),
+  .m_align = dds_alignof (CdrStreamKeySize_t26),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t26",
+  .m_keys = CdrStreamKeySize_t26_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeySize_t26_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t26, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t26 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t26, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t26 }
+};
+
+static const uint32_t CdrStreamKeySize_t27_ops [] =
+{
+  /* t27 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (CdrStreamKeySize_t27, a), (3u << 16u) + 4u /* nested27 */,
+  DDS_OP_RTS,
+
+  /* nested27 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_nested27, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (CdrStreamKeySize_nested27, b),
+  DDS_OP_RTS,
+  
+  /* key: a.b */
+  DDS_OP_KOF | 2, 1u /* order: 0 */, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t27_keys[1] =
+{
+  { "a.b", 11, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 6dc8dc3e82b60b75967101cc15e8] (#deps: 1)
+   - [MINIMAL 4b5bfed34498de214ac85df69c41]
+  [COMPLETE e6fb25071cdb66b6cb67e4c4f891] (#deps: 1)
+   - [COMPLETE e519581316d62e3b223c11fc5faa]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t27 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6d, 0xc8, 0xdc, 0x3e, 0x82, 0xb6, 0x0b, 0x75, 0x96, 0x71, 0x01, \
+  0xcc, 0x15, 0xe8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4b, 0x5b, 0xfe, 0xd3, 0x44, 0x98, 0xde, \
+  0x21, 0x4a, 0xc8, 0x5d, 0xf6, 0x9c, 0x41, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe6, 0xfb, 0x25, \
+  0x07, 0x1c, 0xdb, 0x66, 0xb6, 0xcb, 0x67, 0xe4, 0xc4, 0xf8, 0x91, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xe5, 0x19, 0x58, 0x13, 0x16, 0xd6, 0x2e, 0x3b, 0x22, 0x3c, 0x11, 0xfc, 0x5f, 0xaa, 0x00, \
+  0x60, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t27 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t27 (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x6d, 0xc8, 0xdc, 0x3e, 0x82, 0xb6, 0x0b, \
+  0x75, 0x96, 0x71, 0x01, 0xcc, 0x15, 0xe8, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x4b, 0x5b, 0xfe, 0xd3, 0x44, \
+  0x98, 0xde, 0x21, 0x4a, 0xc8, 0x5d, 0xf6, 0x9c, 0x41, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x4b, 0x5b, \
+  0xfe, 0xd3, 0x44, 0x98, 0xde, 0x21, 0x4a, 0xc8, 0x5d, 0xf6, 0x9c, 0x41, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe6, 0xfb, 0x25, \
+  0x07, 0x1c, 0xdb, 0x66, 0xb6, 0xcb, 0x67, 0xe4, 0xc4, 0xf8, 0x91, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x37, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xe5, 0x19, 0x58, 0x13, 0x16, \
+  0xd6, 0x2e, 0x3b, 0x22, 0x3c, 0x11, 0xfc, 0x5f, 0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0xe5, 0x19, 0x58, 0x13, 0x16, 0xd6, 0x2e, 0x3b, 0x22, 0x3c, 0x11, \
+  0xfc, 0x5f, 0xaa, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x32, 0x37, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe6, 0xfb, 0x25, \
+  0x07, 0x1c, 0xdb, 0x66, 0xb6, 0xcb, 0x67, 0xe4, 0xc4, 0xf8, 0x91, 0xf1, 0x6d, 0xc8, 0xdc, 0x3e, \
+  0x82, 0xb6, 0x0b, 0x75, 0x96, 0x71, 0x01, 0xcc, 0x15, 0xe8, 0xf2, 0xe5, 0x19, 0x58, 0x13, 0x16, \
+  0xd6, 0x2e, 0x3b, 0x22, 0x3c, 0x11, 0xfc, 0x5f, 0xaa, 0xf1, 0x4b, 0x5b, 0xfe, 0xd3, 0x44, 0x98, \
+  0xde, 0x21, 0x4a, 0xc8, 0x5d, 0xf6, 0x9c, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t27 440u
+const dds_topic_descriptor_t CdrStreamKeySize_t27_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t27),
+  .m_align = dds_alignof (CdrStreamKeySize_t27),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t27",
+  .m_keys = CdrStreamKeySize_t27_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamKeySize_t27_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t27, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t27 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t27, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t27 }
+};
+
+static const uint32_t CdrStreamKeySize_t28_ops [] =
+{
+  /* t28 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamKeySize_t28, a), 2u, 1u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 4u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t28_keys[1] =
+{
+  { "a", 9, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 6c16dfab7d2f2aeff03183653436] (#deps: 1)
+   - [MINIMAL 4e69bdc0cb652a3c99f74e017a32]
+  [COMPLETE 5241e7d674d80645528350e038fa] (#deps: 1)
+   - [COMPLETE 0fe327a5b1c712417ba9a3d3f1c2]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t28 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0x16, 0xdf, 0xab, 0x7d, 0x2f, 0x2a, 0xef, 0xf0, 0x31, 0x83, \
+  0x65, 0x34, 0x36, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4e, 0x69, 0xbd, 0xc0, 0xcb, 0x65, 0x2a, \
+  0x3c, 0x99, 0xf7, 0x4e, 0x01, 0x7a, 0x32, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x41, 0xe7, \
+  0xd6, 0x74, 0xd8, 0x06, 0x45, 0x52, 0x83, 0x50, 0xe0, 0x38, 0xfa, 0x00, 0x60, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x0f, 0xe3, 0x27, 0xa5, 0xb1, 0xc7, 0x12, 0x41, 0x7b, 0xa9, 0xa3, 0xd3, 0xf1, 0xc2, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t28 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t28 (const unsigned char []){ \
+  0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0x16, 0xdf, 0xab, 0x7d, 0x2f, 0x2a, \
+  0xef, 0xf0, 0x31, 0x83, 0x65, 0x34, 0x36, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x4e, 0x69, 0xbd, 0xc0, 0xcb, 0x65, 0x2a, 0x3c, 0x99, 0xf7, \
+  0x4e, 0x01, 0x7a, 0x32, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0x4e, 0x69, 0xbd, 0xc0, 0xcb, 0x65, 0x2a, \
+  0x3c, 0x99, 0xf7, 0x4e, 0x01, 0x7a, 0x32, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xea, 0x4f, \
+  0x08, 0x1a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xa3, 0x10, 0x19, 0x5d, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x41, 0xe7, 0xd6, 0x74, 0xd8, 0x06, 0x45, 0x52, 0x83, 0x50, 0xe0, 0x38, 0xfa, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, \
+  0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x0f, 0xe3, 0x27, 0xa5, 0xb1, 0xc7, \
+  0x12, 0x41, 0x7b, 0xa9, 0xa3, 0xd3, 0xf1, 0xc2, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0xf2, 0x0f, 0xe3, 0x27, 0xa5, 0xb1, 0xc7, 0x12, 0x41, 0x7b, 0xa9, 0xa3, 0xd3, 0xf1, 0xc2, 0x00, \
+  0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, \
+  0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x65, 0x32, 0x38, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x38, 0x5f, 0x30, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x38, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x41, 0xe7, 0xd6, 0x74, 0xd8, 0x06, 0x45, 0x52, 0x83, 0x50, \
+  0xe0, 0x38, 0xfa, 0xf1, 0x6c, 0x16, 0xdf, 0xab, 0x7d, 0x2f, 0x2a, 0xef, 0xf0, 0x31, 0x83, 0x65, \
+  0x34, 0x36, 0xf2, 0x0f, 0xe3, 0x27, 0xa5, 0xb1, 0xc7, 0x12, 0x41, 0x7b, 0xa9, 0xa3, 0xd3, 0xf1, \
+  0xc2, 0xf1, 0x4e, 0x69, 0xbd, 0xc0, 0xcb, 0x65, 0x2a, 0x3c, 0x99, 0xf7, 0x4e, 0x01, 0x7a, 0x32\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t28 480u
+const dds_topic_descriptor_t CdrStreamKeySize_t28_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t28),
+  .m_align = dds_alignof (CdrStreamKeySize_t28),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t28",
+  .m_keys = CdrStreamKeySize_t28_keys,
+  .m_nops = 4,
+  .m_ops = CdrStreamKeySize_t28_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t28, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t28 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t28, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t28 }
+};
+
+static const uint32_t CdrStreamKeySize_t29_ops [] =
+{
+  /* t29 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | (DDS_OP_FLAG_BASE << 16) | 8 /* base29 */, 0u,
+  DDS_OP_PLM | 3, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_t29, a),
+  DDS_OP_RTS,
+
+  /* base29 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamKeySize_base29, k),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 13u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamKeySize_t29_keys[1] =
+{
+  { "k", 16, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 0184603e69a59428f0cbf8d1389a] (#deps: 1)
+   - [MINIMAL e21bd03aeb0d7d3f5b0570f886f0]
+  [COMPLETE cdd1bf51b76f5bbecf41b9bd0e2d] (#deps: 1)
+   - [COMPLETE a639580bb08f6bc6682d3f4e6af3]
+*/
+#define TYPE_INFO_CDR_CdrStreamKeySize_t29 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x84, 0x60, 0x3e, 0x69, 0xa5, 0x94, 0x28, 0xf0, 0xcb, 0xf8, \
+  0xd1, 0x38, 0x9a, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe2, 0x1b, 0xd0, 0x3a, 0xeb, 0x0d, 0x7d, \
+  0x3f, 0x5b, 0x05, 0x70, 0xf8, 0x86, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xcd, 0xd1, 0xbf, \
+  0x51, 0xb7, 0x6f, 0x5b, 0xbe, 0xcf, 0x41, 0xb9, 0xbd, 0x0e, 0x2d, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa6, 0x39, 0x58, 0x0b, 0xb0, 0x8f, 0x6b, 0xc6, 0x68, 0x2d, 0x3f, 0x4e, 0x6a, 0xf3, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamKeySize_t29 148u
+#define TYPE_MAP_CDR_CdrStreamKeySize_t29 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x84, 0x60, 0x3e, 0x69, 0xa5, 0x94, \
+  0x28, 0xf0, 0xcb, 0xf8, 0xd1, 0x38, 0x9a, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xe2, 0x1b, 0xd0, 0x3a, 0xeb, 0x0d, 0x7d, 0x3f, 0x5b, 0x05, 0x70, \
+  0xf8, 0x86, 0xf0, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xe2, 0x1b, 0xd0, 0x3a, \
+  0xeb, 0x0d, 0x7d, 0x3f, 0x5b, 0x05, 0x70, 0xf8, 0x86, 0xf0, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x8c, \
+  0xe4, 0xb1, 0x6b, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xcd, 0xd1, 0xbf, \
+  0x51, 0xb7, 0x6f, 0x5b, 0xbe, 0xcf, 0x41, 0xb9, 0xbd, 0x0e, 0x2d, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf2, 0xa6, 0x39, 0x58, 0x0b, 0xb0, 0x8f, 0x6b, \
+  0xc6, 0x68, 0x2d, 0x3f, 0x4e, 0x6a, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, \
+  0x3a, 0x3a, 0x74, 0x32, 0x39, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0xa6, 0x39, 0x58, 0x0b, 0xb0, 0x8f, 0x6b, 0xc6, 0x68, 0x2d, 0x3f, \
+  0x4e, 0x6a, 0xf3, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4b, 0x65, 0x79, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x62, 0x61, 0x73, 0x65, 0x32, 0x39, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xcd, 0xd1, 0xbf, 0x51, 0xb7, 0x6f, 0x5b, \
+  0xbe, 0xcf, 0x41, 0xb9, 0xbd, 0x0e, 0x2d, 0xf1, 0x01, 0x84, 0x60, 0x3e, 0x69, 0xa5, 0x94, 0x28, \
+  0xf0, 0xcb, 0xf8, 0xd1, 0x38, 0x9a, 0xf2, 0xa6, 0x39, 0x58, 0x0b, 0xb0, 0x8f, 0x6b, 0xc6, 0x68, \
+  0x2d, 0x3f, 0x4e, 0x6a, 0xf3, 0xf1, 0xe2, 0x1b, 0xd0, 0x3a, 0xeb, 0x0d, 0x7d, 0x3f, 0x5b, 0x05, \
+  0x70, 0xf8, 0x86, 0xf0\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamKeySize_t29 404u
+const dds_topic_descriptor_t CdrStreamKeySize_t29_desc =
+{
+  .m_size = sizeof (CdrStreamKeySize_t29),
+  .m_align = dds_alignof (CdrStreamKeySize_t29),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamKeySize::t29",
+  .m_keys = CdrStreamKeySize_t29_keys,
+  .m_nops = 8,
+  .m_ops = CdrStreamKeySize_t29_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamKeySize_t29, .sz = TYPE_INFO_CDR_SZ_CdrStreamKeySize_t29 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamKeySize_t29, .sz = TYPE_MAP_CDR_SZ_CdrStreamKeySize_t29 }
+};
+
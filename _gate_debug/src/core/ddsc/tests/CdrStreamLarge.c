@@ -0,0 +1,85 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamLarge.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamLarge.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamLarge.h"
+
+static const uint32_t CdrStreamLarge_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamLarge_t1, k),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamLarge_t1, s),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BLN, offsetof (CdrStreamLarge_t1, b),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamLarge_t1, l),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (CdrStreamLarge_t1, o),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t CdrStreamLarge_t1_keys[1] =
+{
+  { "k", 12, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 221bb05c94038ca0dfa1fc3da773] (#deps: 0)
+  [COMPLETE 1aeae2d8900efbc2c5a729389ddf] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamLarge_t1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x1b, 0xb0, 0x5c, 0x94, 0x03, 0x8c, 0xa0, 0xdf, 0xa1, 0xfc, \
+  0x3d, 0xa7, 0x73, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0xea, 0xe2, 0xd8, 0x90, 0x0e, 0xfb, 0xc2, 0xc5, 0xa7, 0x29, \
+  0x38, 0x9d, 0xdf, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamLarge_t1 100u
+#define TYPE_MAP_CDR_CdrStreamLarge_t1 (const unsigned char []){ \
+  0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x1b, 0xb0, 0x5c, 0x94, 0x03, 0x8c, \
+  0xa0, 0xdf, 0xa1, 0xfc, 0x3d, 0xa7, 0x73, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x01, \
+  0x92, 0xeb, 0x5f, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0xb4, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0xea, 0xe2, 0xd8, 0x90, 0x0e, 0xfb, 0xc2, 0xc5, 0xa7, 0x29, \
+  0x38, 0x9d, 0xdf, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, \
+  0x6f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0xea, 0xe2, \
+  0xd8, 0x90, 0x0e, 0xfb, 0xc2, 0xc5, 0xa7, 0x29, 0x38, 0x9d, 0xdf, 0xf1, 0x22, 0x1b, 0xb0, 0x5c, \
+  0x94, 0x03, 0x8c, 0xa0, 0xdf, 0xa1, 0xfc, 0x3d, 0xa7, 0x73\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamLarge_t1 362u
+const dds_topic_descriptor_t CdrStreamLarge_t1_desc =
+{
+  .m_size = sizeof (CdrStreamLarge_t1),
+  .m_align = dds_alignof (CdrStreamLarge_t1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "CdrStreamLarge::t1",
+  .m_keys = CdrStreamLarge_t1_keys,
+  .m_nops = 7,
+  .m_ops = CdrStreamLarge_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamLarge_t1, .sz = TYPE_INFO_CDR_SZ_CdrStreamLarge_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamLarge_t1, .sz = TYPE_MAP_CDR_SZ_CdrStreamLarge_t1 }
+};
+
@@ -0,0 +1,90 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamLarge.h
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamLarge.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMLARGE_H_B71877EAF79D420ACC81FF128AE892DE
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMLARGE_H_B71877EAF79D420ACC81FF128AE892DE
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef DDS_SEQUENCE_BOOL_DEFINED
+#define DDS_SEQUENCE_BOOL_DEFINED
+typedef struct dds_sequence_bool
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  bool *_buffer;
+  bool _release;
+} dds_sequence_bool;
+
+#define dds_sequence_bool__alloc() \
+((dds_sequence_bool*) dds_alloc (sizeof (dds_sequence_bool)));
+
+#define dds_sequence_bool_allocbuf(l) \
+((bool *) dds_alloc ((l) * sizeof (bool)))
+#endif /* DDS_SEQUENCE_BOOL_DEFINED */
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+#ifndef DDS_SEQUENCE_OCTET_DEFINED
+#define DDS_SEQUENCE_OCTET_DEFINED
+typedef struct dds_sequence_octet
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  uint8_t *_buffer;
+  bool _release;
+} dds_sequence_octet;
+
+#define dds_sequence_octet__alloc() \
+((dds_sequence_octet*) dds_alloc (sizeof (dds_sequence_octet)));
+
+#define dds_sequence_octet_allocbuf(l) \
+((uint8_t *) dds_alloc ((l) * sizeof (uint8_t)))
+#endif /* DDS_SEQUENCE_OCTET_DEFINED */
+
+typedef struct CdrStreamLarge_t1
+{
+  int32_t k;
+  char * s;
+  dds_sequence_bool b;
+  dds_sequence_long l;
+  dds_sequence_octet o;
+} CdrStreamLarge_t1;
+
+extern const dds_topic_descriptor_t CdrStreamLarge_t1_desc;
+
+#define CdrStreamLarge_t1__alloc() \
+((CdrStreamLarge_t1*) dds_alloc (sizeof (CdrStreamLarge_t1)));
+
+#define CdrStreamLarge_t1_free(d,o) \
+dds_sample_free ((d), &CdrStreamLarge_t1_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CDRSTREAMLARGE_H_B71877EAF79D420ACC81FF128AE892DE */
@@ -0,0 +1,906 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CdrStreamSkipDefault.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamSkipDefault.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamSkipDefault.h"
+
+static const uint32_t CdrStreamSkipDefault_t1_pub_ops [] =
+{
+  /* t1_pub */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t1_pub, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE f857318370e875905302bcc4103b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t1_pub (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x57, 0x31, 0x83, 0x70, 0xe8, 0x75, 0x90, 0x53, 0x02, 0xbc, \
+  0xc4, 0x10, 0x3b, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t1_pub 100u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t1_pub (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x57, 0x31, 0x83, 0x70, 0xe8, 0x75, \
+  0x90, 0x53, 0x02, 0xbc, 0xc4, 0x10, 0x3b, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, \
+  0x3a, 0x3a, 0x74, 0x31, 0x5f, 0x70, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0x57, 0x31, 0x83, 0x70, 0xe8, 0x75, 0x90, 0x53, 0x02, 0xbc, \
+  0xc4, 0x10, 0x3b, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, \
+  0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t1_pub 210u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t1_pub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t1_pub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t1_pub),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t1_pub",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamSkipDefault_t1_pub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t1_pub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t1_pub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t1_pub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t1_pub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t1_sub_ops [] =
+{
+  /* t1_sub */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t1_sub, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t1_sub, f2), (3u << 16u) + 4u /* t1_append */,
+  DDS_OP_RTS,
+
+  /* t1_append */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t1_append, s1),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamSkipDefault_t1_append, s2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (CdrStreamSkipDefault_t1_append, s3),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d287b1f673e7d40db06afe300a48] (#deps: 1)
+   - [MINIMAL 132206813a9907ebf51796771d00]
+  [COMPLETE aba16ea20f25c31bc85774764c5c] (#deps: 1)
+   - [COMPLETE cc895247907e70bed9ffc9c06c86]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t1_sub (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd2, 0x87, 0xb1, 0xf6, 0x73, 0xe7, 0xd4, 0x0d, 0xb0, 0x6a, 0xfe, \
+  0x30, 0x0a, 0x48, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x13, 0x22, 0x06, 0x81, 0x3a, 0x99, 0x07, \
+  0xeb, 0xf5, 0x17, 0x96, 0x77, 0x1d, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xab, 0xa1, 0x6e, \
+  0xa2, 0x0f, 0x25, 0xc3, 0x1b, 0xc8, 0x57, 0x74, 0x76, 0x4c, 0x5c, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xcc, 0x89, 0x52, 0x47, 0x90, 0x7e, 0x70, 0xbe, 0xd9, 0xff, 0xc9, 0xc0, 0x6c, 0x86, 0x00, \
+  0x89, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t1_sub 148u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t1_sub (const unsigned char []){ \
+  0xb5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd2, 0x87, 0xb1, 0xf6, 0x73, 0xe7, 0xd4, \
+  0x0d, 0xb0, 0x6a, 0xfe, 0x30, 0x0a, 0x48, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x13, 0x22, 0x06, 0x81, 0x3a, \
+  0x99, 0x07, 0xeb, 0xf5, 0x17, 0x96, 0x77, 0x1d, 0x00, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x13, 0x22, \
+  0x06, 0x81, 0x3a, 0x99, 0x07, 0xeb, 0xf5, 0x17, 0x96, 0x77, 0x1d, 0x00, 0x49, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0xfa, 0xc9, 0x89, 0x44, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x70, 0x00, 0xc0, 0x82, 0x8e, 0x03, 0x00, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xab, 0xa1, 0x6e, 0xa2, 0x0f, 0x25, 0xc3, 0x1b, 0xc8, 0x57, 0x74, \
+  0x76, 0x4c, 0x5c, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x31, \
+  0x5f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xcc, 0x89, 0x52, 0x47, 0x90, 0x7e, 0x70, 0xbe, 0xd9, 0xff, 0xc9, 0xc0, 0x6c, \
+  0x86, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0x89, \
+  0x52, 0x47, 0x90, 0x7e, 0x70, 0xbe, 0xd9, 0xff, 0xc9, 0xc0, 0x6c, 0x86, 0x85, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0a, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, \
+  0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x31, 0x5f, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, \
+  0x51, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xab, 0xa1, 0x6e, 0xa2, 0x0f, 0x25, 0xc3, 0x1b, 0xc8, 0x57, 0x74, 0x76, 0x4c, 0x5c, 0xf1, \
+  0xd2, 0x87, 0xb1, 0xf6, 0x73, 0xe7, 0xd4, 0x0d, 0xb0, 0x6a, 0xfe, 0x30, 0x0a, 0x48, 0xf2, 0xcc, \
+  0x89, 0x52, 0x47, 0x90, 0x7e, 0x70, 0xbe, 0xd9, 0xff, 0xc9, 0xc0, 0x6c, 0x86, 0xf1, 0x13, 0x22, \
+  0x06, 0x81, 0x3a, 0x99, 0x07, 0xeb, 0xf5, 0x17, 0x96, 0x77, 0x1d, 0x00\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t1_sub 556u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t1_sub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t1_sub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t1_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t1_sub",
+  .m_keys = NULL,
+  .m_nops = 9,
+  .m_ops = CdrStreamSkipDefault_t1_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t1_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t1_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t1_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t1_sub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t2_pub_ops [] =
+{
+  /* t2_pub */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t2_pub, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE 6eb1a3d52cf878f75239a9c1239c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t2_pub (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x6e, 0xb1, 0xa3, 0xd5, 0x2c, 0xf8, 0x78, 0xf7, 0x52, 0x39, 0xa9, \
+  0xc1, 0x23, 0x9c, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t2_pub 100u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t2_pub (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x6e, 0xb1, 0xa3, 0xd5, 0x2c, 0xf8, 0x78, \
+  0xf7, 0x52, 0x39, 0xa9, 0xc1, 0x23, 0x9c, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, \
+  0x3a, 0x3a, 0x74, 0x32, 0x5f, 0x70, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x6e, 0xb1, 0xa3, 0xd5, 0x2c, 0xf8, 0x78, 0xf7, 0x52, 0x39, 0xa9, \
+  0xc1, 0x23, 0x9c, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, \
+  0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t2_pub 210u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t2_pub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t2_pub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t2_pub),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t2_pub",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamSkipDefault_t2_pub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t2_pub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t2_pub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t2_pub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t2_pub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t2_sub_ops [] =
+{
+  /* t2_sub */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t2_sub, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t2_sub, f2), (3u << 16u) + 6u /* t2_mutable */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamSkipDefault_t2_sub, f3),
+  DDS_OP_RTS,
+
+  /* t2_mutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 9, 0u,
+  DDS_OP_PLM | 10, 1u,
+  DDS_OP_PLM | 11, 2u,
+  DDS_OP_PLM | 12, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t2_mutable, s1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamSkipDefault_t2_mutable, s2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (CdrStreamSkipDefault_t2_mutable, s3),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t2_mutable, s4),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL ff1bd9aa926fbb7aa8abce7ea182] (#deps: 1)
+   - [MINIMAL d497aabcd0f03af089bb5089236a]
+  [COMPLETE d39510b7a0d7fbbebf7a496445e1] (#deps: 1)
+   - [COMPLETE 471bb628807de5c68f78e7c3f5f7]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t2_sub (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x1b, 0xd9, 0xaa, 0x92, 0x6f, 0xbb, 0x7a, 0xa8, 0xab, 0xce, \
+  0x7e, 0xa1, 0x82, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd4, 0x97, 0xaa, 0xbc, 0xd0, 0xf0, 0x3a, \
+  0xf0, 0x89, 0xbb, 0x50, 0x89, 0x23, 0x6a, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x95, 0x10, \
+  0xb7, 0xa0, 0xd7, 0xfb, 0xbe, 0xbf, 0x7a, 0x49, 0x64, 0x45, 0xe1, 0x00, 0x91, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x47, 0x1b, 0xb6, 0x28, 0x80, 0x7d, 0xe5, 0xc6, 0x8f, 0x78, 0xe7, 0xc3, 0xf5, 0xf7, 0x00, \
+  0x9d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t2_sub 148u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t2_sub (const unsigned char []){ \
+  0xd3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x1b, 0xd9, 0xaa, 0x92, 0x6f, 0xbb, \
+  0x7a, 0xa8, 0xab, 0xce, 0x7e, 0xa1, 0x82, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd4, 0x97, 0xaa, 0xbc, 0xd0, \
+  0xf0, 0x3a, 0xf0, 0x89, 0xbb, 0x50, 0x89, 0x23, 0x6a, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x17, 0x79, 0xcf, 0x3a, 0xf1, \
+  0xd4, 0x97, 0xaa, 0xbc, 0xd0, 0xf0, 0x3a, 0xf0, 0x89, 0xbb, 0x50, 0x89, 0x23, 0x6a, 0x00, 0x00, \
+  0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x43, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x8d, 0xdf, 0x87, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0xfa, 0xc9, 0x89, 0x44, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x08, 0xc0, 0x82, 0x8e, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x7e, 0x7c, 0xb6, 0x81, 0x00, 0x51, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xd3, 0x95, 0x10, 0xb7, 0xa0, 0xd7, 0xfb, 0xbe, 0xbf, 0x7a, 0x49, 0x64, 0x45, 0xe1, 0x00, \
+  0x8d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, \
+  0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x32, 0x5f, 0x73, 0x75, 0x62, \
+  0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x47, \
+  0x1b, 0xb6, 0x28, 0x80, 0x7d, 0xe5, 0xc6, 0x8f, 0x78, 0xe7, 0xc3, 0xf5, 0xf7, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0xf2, 0x47, 0x1b, 0xb6, 0x28, 0x80, 0x7d, 0xe5, 0xc6, 0x8f, 0x78, 0xe7, 0xc3, 0xf5, 0xf7, \
+  0x99, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, \
+  0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x32, 0x5f, 0x6d, 0x75, 0x74, \
+  0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x95, 0x10, 0xb7, 0xa0, 0xd7, 0xfb, \
+  0xbe, 0xbf, 0x7a, 0x49, 0x64, 0x45, 0xe1, 0xf1, 0xff, 0x1b, 0xd9, 0xaa, 0x92, 0x6f, 0xbb, 0x7a, \
+  0xa8, 0xab, 0xce, 0x7e, 0xa1, 0x82, 0xf2, 0x47, 0x1b, 0xb6, 0x28, 0x80, 0x7d, 0xe5, 0xc6, 0x8f, \
+  0x78, 0xe7, 0xc3, 0xf5, 0xf7, 0xf1, 0xd4, 0x97, 0xaa, 0xbc, 0xd0, 0xf0, 0x3a, 0xf0, 0x89, 0xbb, \
+  0x50, 0x89, 0x23, 0x6a\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t2_sub 628u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t2_sub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t2_sub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t2_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t2_sub",
+  .m_keys = NULL,
+  .m_nops = 15,
+  .m_ops = CdrStreamSkipDefault_t2_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t2_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t2_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t2_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t2_sub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t3_pub_ops [] =
+{
+  /* t3_pub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t3_pub, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE e444b5c0d8d486405144140f4afb] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t3_pub (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe4, 0x44, 0xb5, 0xc0, 0xd8, 0xd4, 0x86, 0x40, 0x51, 0x44, 0x14, \
+  0x0f, 0x4a, 0xfb, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t3_pub 100u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t3_pub (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xe4, 0x44, 0xb5, 0xc0, 0xd8, 0xd4, 0x86, \
+  0x40, 0x51, 0x44, 0x14, 0x0f, 0x4a, 0xfb, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, \
+  0x3a, 0x3a, 0x74, 0x33, 0x5f, 0x70, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xe4, 0x44, 0xb5, 0xc0, 0xd8, 0xd4, 0x86, 0x40, 0x51, 0x44, 0x14, \
+  0x0f, 0x4a, 0xfb, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, \
+  0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t3_pub 210u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t3_pub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t3_pub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t3_pub),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t3_pub",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamSkipDefault_t3_pub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t3_pub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t3_pub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t3_pub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t3_pub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t3_sub_ops [] =
+{
+  /* t3_sub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 9, 0u,
+  DDS_OP_PLM | 10, 1u,
+  DDS_OP_PLM | 12, 2u,
+  DDS_OP_PLM | 13, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t3_sub, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t3_sub, f2), (3u << 16u) + 11u /* t3_sub1 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamSkipDefault_t3_sub, f3),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t3_sub, f4), (3u << 16u) + 17u /* t3_sub2 */,
+  DDS_OP_RTS,
+
+  /* t3_sub1 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t3_sub1, s1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t3_sub1, s2), (3u << 16u) + 4u /* t3_sub2 */,
+  DDS_OP_RTS,
+
+  /* t3_sub2 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamSkipDefault_t3_sub2, s1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t3_sub2, s2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL daaf676fe857ec8a83bdb3b2cb20] (#deps: 2)
+   - [MINIMAL 782bce0baac1d91b09f9b7824c35]
+   - [MINIMAL 8a95fcfb65e7e17f1df1d13ce7b3]
+  [COMPLETE c7c42ba574f77bfdec4fe4a03e88] (#deps: 2)
+   - [COMPLETE 00b35367f76c632a3d6e6f42f97b]
+   - [COMPLETE 77a420b30bcba8f801307724da47]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t3_sub (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xda, 0xaf, 0x67, 0x6f, 0xe8, 0x57, 0xec, 0x8a, 0x83, 0xbd, 0xb3, \
+  0xb2, 0xcb, 0x20, 0x00, 0x75, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x78, 0x2b, 0xce, 0x0b, 0xaa, 0xc1, 0xd9, \
+  0x1b, 0x09, 0xf9, 0xb7, 0x82, 0x4c, 0x35, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x8a, 0x95, 0xfc, 0xfb, 0x65, 0xe7, 0xe1, 0x7f, 0x1d, 0xf1, 0xd1, 0x3c, 0xe7, 0xb3, 0x00, \
+  0x3c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0xc4, 0x2b, 0xa5, 0x74, 0xf7, 0x7b, 0xfd, 0xec, 0x4f, 0xe4, \
+  0xa0, 0x3e, 0x88, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x00, 0xb3, 0x53, 0x67, 0xf7, 0x6c, 0x63, \
+  0x2a, 0x3d, 0x6e, 0x6f, 0x42, 0xf9, 0x7b, 0x00, 0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x77, 0xa4, 0x20, 0xb3, 0x0b, 0xcb, 0xa8, 0xf8, 0x01, 0x30, 0x77, 0x24, 0xda, 0x47, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t3_sub 196u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t3_sub (const unsigned char []){ \
+  0x28, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xda, 0xaf, 0x67, 0x6f, 0xe8, 0x57, 0xec, \
+  0x8a, 0x83, 0xbd, 0xb3, 0xb2, 0xcb, 0x20, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x78, 0x2b, 0xce, 0x0b, 0xaa, \
+  0xc1, 0xd9, 0x1b, 0x09, 0xf9, 0xb7, 0x82, 0x4c, 0x35, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x17, 0x79, 0xcf, 0x3a, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8a, 0x95, 0xfc, 0xfb, 0x65, \
+  0xe7, 0xe1, 0x7f, 0x1d, 0xf1, 0xd1, 0x3c, 0xe7, 0xb3, 0x6e, 0x1f, 0xcd, 0x70, 0xf1, 0x78, 0x2b, \
+  0xce, 0x0b, 0xaa, 0xc1, 0xd9, 0x1b, 0x09, 0xf9, 0xb7, 0x82, 0x4c, 0x35, 0x41, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8a, \
+  0x95, 0xfc, 0xfb, 0x65, 0xe7, 0xe1, 0x7f, 0x1d, 0xf1, 0xd1, 0x3c, 0xe7, 0xb3, 0xfa, 0xc9, 0x89, \
+  0x44, 0xf1, 0x8a, 0x95, 0xfc, 0xfb, 0x65, 0xe7, 0xe1, 0x7f, 0x1d, 0xf1, 0xd1, 0x3c, 0xe7, 0xb3, \
+  0x38, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x8d, 0xdf, 0x87, 0x80, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0xfa, 0xc9, 0x89, 0x44, 0xd1, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0xc4, 0x2b, 0xa5, 0x74, 0xf7, 0x7b, 0xfd, 0xec, 0x4f, 0xe4, \
+  0xa0, 0x3e, 0x88, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x33, \
+  0x5f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x00, 0xb3, 0x53, 0x67, 0xf7, 0x6c, 0x63, 0x2a, 0x3d, 0x6e, 0x6f, 0x42, 0xf9, \
+  0x7b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x77, 0xa4, 0x20, 0xb3, 0x0b, 0xcb, 0xa8, 0xf8, 0x01, 0x30, 0x77, 0x24, 0xda, \
+  0x47, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0xf2, 0x00, 0xb3, \
+  0x53, 0x67, 0xf7, 0x6c, 0x63, 0x2a, 0x3d, 0x6e, 0x6f, 0x42, 0xf9, 0x7b, 0x75, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, \
+  0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x33, 0x5f, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x77, 0xa4, 0x20, 0xb3, 0x0b, \
+  0xcb, 0xa8, 0xf8, 0x01, 0x30, 0x77, 0x24, 0xda, 0x47, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x77, 0xa4, 0x20, 0xb3, 0x0b, 0xcb, 0xa8, 0xf8, 0x01, 0x30, \
+  0x77, 0x24, 0xda, 0x47, 0x69, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x33, \
+  0x5f, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0xc4, 0x2b, \
+  0xa5, 0x74, 0xf7, 0x7b, 0xfd, 0xec, 0x4f, 0xe4, 0xa0, 0x3e, 0x88, 0xf1, 0xda, 0xaf, 0x67, 0x6f, \
+  0xe8, 0x57, 0xec, 0x8a, 0x83, 0xbd, 0xb3, 0xb2, 0xcb, 0x20, 0xf2, 0x00, 0xb3, 0x53, 0x67, 0xf7, \
+  0x6c, 0x63, 0x2a, 0x3d, 0x6e, 0x6f, 0x42, 0xf9, 0x7b, 0xf1, 0x78, 0x2b, 0xce, 0x0b, 0xaa, 0xc1, \
+  0xd9, 0x1b, 0x09, 0xf9, 0xb7, 0x82, 0x4c, 0x35, 0xf2, 0x77, 0xa4, 0x20, 0xb3, 0x0b, 0xcb, 0xa8, \
+  0xf8, 0x01, 0x30, 0x77, 0x24, 0xda, 0x47, 0xf1, 0x8a, 0x95, 0xfc, 0xfb, 0x65, 0xe7, 0xe1, 0x7f, \
+  0x1d, 0xf1, 0xd1, 0x3c, 0xe7, 0xb3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t3_sub 870u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t3_sub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t3_sub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t3_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t3_sub",
+  .m_keys = NULL,
+  .m_nops = 22,
+  .m_ops = CdrStreamSkipDefault_t3_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t3_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t3_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t3_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t3_sub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t4_pub_ops [] =
+{
+  /* t4_pub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t4_pub, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE e09f98d135a422bb9b7895bb233d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t4_pub (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe0, 0x9f, 0x98, 0xd1, 0x35, 0xa4, 0x22, 0xbb, 0x9b, 0x78, 0x95, \
+  0xbb, 0x23, 0x3d, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t4_pub 100u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t4_pub (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xe0, 0x9f, 0x98, 0xd1, 0x35, 0xa4, 0x22, \
+  0xbb, 0x9b, 0x78, 0x95, 0xbb, 0x23, 0x3d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, \
+  0x3a, 0x3a, 0x74, 0x34, 0x5f, 0x70, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xe0, 0x9f, 0x98, 0xd1, 0x35, 0xa4, 0x22, 0xbb, 0x9b, 0x78, 0x95, \
+  0xbb, 0x23, 0x3d, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, \
+  0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t4_pub 210u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t4_pub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t4_pub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t4_pub),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t4_pub",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamSkipDefault_t4_pub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t4_pub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t4_pub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t4_pub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t4_pub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t4_sub_ops [] =
+{
+  /* t4_sub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 9, 0u,
+  DDS_OP_PLM | 10, 1u,
+  DDS_OP_PLM | 12, 2u,
+  DDS_OP_PLM | 13, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t4_sub, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t4_sub, f2), (3u << 16u) + 11u /* t4_sub1 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CdrStreamSkipDefault_t4_sub, f3),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t4_sub, f4), (3u << 16u) + 11u /* t4_sub2 */,
+  DDS_OP_RTS,
+
+  /* t4_sub1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t4_sub1, s1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t4_sub1, s2), (3u << 16u) + 4u /* t4_sub2 */,
+  DDS_OP_RTS,
+
+  /* t4_sub2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamSkipDefault_t4_sub2, s1), 1u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t4_sub2, s2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c20438fcd0373642556536c8ac28] (#deps: 3)
+   - [MINIMAL ff915f7500597a69bf630131dc3d]
+   - [MINIMAL 24804014861290a2a1ffae5a7802]
+   - [MINIMAL 927a168e6e2969a33eb2157ccde9]
+  [COMPLETE 1c46d3acccb405eaf0d27aee84bf] (#deps: 3)
+   - [COMPLETE d75091a719a042cbb9b998def4ec]
+   - [COMPLETE 51d146ad37e344f19e5d09b786db]
+   - [COMPLETE 346972dc1f120da821f62b7cc6fe]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t4_sub (const unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc2, 0x04, 0x38, 0xfc, 0xd0, 0x37, 0x36, 0x42, 0x55, 0x65, 0x36, \
+  0xc8, 0xac, 0x28, 0x00, 0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x91, 0x5f, 0x75, 0x00, 0x59, 0x7a, \
+  0x69, 0xbf, 0x63, 0x01, 0x31, 0xdc, 0x3d, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x24, 0x80, 0x40, 0x14, 0x86, 0x12, 0x90, 0xa2, 0xa1, 0xff, 0xae, 0x5a, 0x78, 0x02, 0x00, \
+  0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x92, 0x7a, 0x16, 0x8e, 0x6e, 0x29, 0x69, \
+  0xa3, 0x3e, 0xb2, 0x15, 0x7c, 0xcd, 0xe9, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1c, 0x46, 0xd3, \
+  0xac, 0xcc, 0xb4, 0x05, 0xea, 0xf0, 0xd2, 0x7a, 0xee, 0x84, 0xbf, 0x00, 0xb9, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd7, 0x50, 0x91, 0xa7, 0x19, 0xa0, 0x42, 0xcb, 0xb9, 0xb9, 0x98, 0xde, 0xf4, 0xec, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x51, 0xd1, 0x46, 0xad, 0x37, 0xe3, 0x44, \
+  0xf1, 0x9e, 0x5d, 0x09, 0xb7, 0x86, 0xdb, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x34, 0x69, 0x72, 0xdc, 0x1f, 0x12, 0x0d, 0xa8, 0x21, 0xf6, 0x2b, 0x7c, 0xc6, 0xfe, 0x00, \
+  0x73, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t4_sub 244u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t4_sub (const unsigned char []){ \
+  0x86, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0xc2, 0x04, 0x38, 0xfc, 0xd0, 0x37, 0x36, \
+  0x42, 0x55, 0x65, 0x36, 0xc8, 0xac, 0x28, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xff, 0x91, 0x5f, 0x75, 0x00, \
+  0x59, 0x7a, 0x69, 0xbf, 0x63, 0x01, 0x31, 0xdc, 0x3d, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x17, 0x79, 0xcf, 0x3a, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x24, 0x80, 0x40, 0x14, 0x86, \
+  0x12, 0x90, 0xa2, 0xa1, 0xff, 0xae, 0x5a, 0x78, 0x02, 0x6e, 0x1f, 0xcd, 0x70, 0xf1, 0xff, 0x91, \
+  0x5f, 0x75, 0x00, 0x59, 0x7a, 0x69, 0xbf, 0x63, 0x01, 0x31, 0xdc, 0x3d, 0x41, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x24, \
+  0x80, 0x40, 0x14, 0x86, 0x12, 0x90, 0xa2, 0xa1, 0xff, 0xae, 0x5a, 0x78, 0x02, 0xfa, 0xc9, 0x89, \
+  0x44, 0xf1, 0x24, 0x80, 0x40, 0x14, 0x86, 0x12, 0x90, 0xa2, 0xa1, 0xff, 0xae, 0x5a, 0x78, 0x02, \
+  0x48, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x92, 0x7a, 0x16, 0x8e, 0x6e, 0x29, 0x69, 0xa3, 0x3e, 0xb2, 0x15, 0x7c, 0xcd, \
+  0xe9, 0x8d, 0xdf, 0x87, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0xfa, 0xc9, 0x89, 0x44, 0xf1, 0x92, 0x7a, 0x16, \
+  0x8e, 0x6e, 0x29, 0x69, 0xa3, 0x3e, 0xb2, 0x15, 0x7c, 0xcd, 0xe9, 0x00, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xbd, 0xa4, 0xfe, 0xc8, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xb9, 0x5a, 0xdd, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0xf2, 0x1c, 0x46, 0xd3, 0xac, 0xcc, 0xb4, 0x05, 0xea, 0xf0, 0xd2, 0x7a, \
+  0xee, 0x84, 0xbf, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x34, \
+  0x5f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xd7, 0x50, 0x91, 0xa7, 0x19, 0xa0, 0x42, 0xcb, 0xb9, 0xb9, 0x98, 0xde, 0xf4, \
+  0xec, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x51, 0xd1, 0x46, 0xad, 0x37, 0xe3, 0x44, 0xf1, 0x9e, 0x5d, 0x09, 0xb7, 0x86, \
+  0xdb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0xf2, 0xd7, 0x50, \
+  0x91, 0xa7, 0x19, 0xa0, 0x42, 0xcb, 0xb9, 0xb9, 0x98, 0xde, 0xf4, 0xec, 0x75, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0a, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, \
+  0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x34, 0x5f, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x51, 0xd1, 0x46, 0xad, 0x37, \
+  0xe3, 0x44, 0xf1, 0x9e, 0x5d, 0x09, 0xb7, 0x86, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x51, 0xd1, 0x46, 0xad, 0x37, 0xe3, 0x44, 0xf1, 0x9e, 0x5d, \
+  0x09, 0xb7, 0x86, 0xdb, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x34, \
+  0x5f, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x34, 0x69, 0x72, 0xdc, 0x1f, \
+  0x12, 0x0d, 0xa8, 0x21, 0xf6, 0x2b, 0x7c, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x34, 0x69, 0x72, 0xdc, 0x1f, 0x12, 0x0d, 0xa8, 0x21, 0xf6, 0x2b, 0x7c, 0xc6, 0xfe, \
+  0x6f, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, \
+  0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x34, 0x5f, 0x65, 0x6e, 0x75, \
+  0x6d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x45, 0x34, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x34, 0x5f, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0x1c, 0x46, 0xd3, \
+  0xac, 0xcc, 0xb4, 0x05, 0xea, 0xf0, 0xd2, 0x7a, 0xee, 0x84, 0xbf, 0xf1, 0xc2, 0x04, 0x38, 0xfc, \
+  0xd0, 0x37, 0x36, 0x42, 0x55, 0x65, 0x36, 0xc8, 0xac, 0x28, 0xf2, 0xd7, 0x50, 0x91, 0xa7, 0x19, \
+  0xa0, 0x42, 0xcb, 0xb9, 0xb9, 0x98, 0xde, 0xf4, 0xec, 0xf1, 0xff, 0x91, 0x5f, 0x75, 0x00, 0x59, \
+  0x7a, 0x69, 0xbf, 0x63, 0x01, 0x31, 0xdc, 0x3d, 0xf2, 0x51, 0xd1, 0x46, 0xad, 0x37, 0xe3, 0x44, \
+  0xf1, 0x9e, 0x5d, 0x09, 0xb7, 0x86, 0xdb, 0xf1, 0x24, 0x80, 0x40, 0x14, 0x86, 0x12, 0x90, 0xa2, \
+  0xa1, 0xff, 0xae, 0x5a, 0x78, 0x02, 0xf2, 0x34, 0x69, 0x72, 0xdc, 0x1f, 0x12, 0x0d, 0xa8, 0x21, \
+  0xf6, 0x2b, 0x7c, 0xc6, 0xfe, 0xf1, 0x92, 0x7a, 0x16, 0x8e, 0x6e, 0x29, 0x69, 0xa3, 0x3e, 0xb2, \
+  0x15, 0x7c, 0xcd, 0xe9\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t4_sub 1140u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t4_sub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t4_sub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t4_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t4_sub",
+  .m_keys = NULL,
+  .m_nops = 18,
+  .m_ops = CdrStreamSkipDefault_t4_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t4_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t4_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t4_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t4_sub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t5_pub_ops [] =
+{
+  /* t5_pub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_pub, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t5_pub, f2), (3u << 16u) + 4u /* t5_pub1 */,
+  DDS_OP_RTS,
+
+  /* t5_pub1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_pub1, s1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c3da9019e0e3307d9873efadb07c] (#deps: 1)
+   - [MINIMAL 4c738bde6247bf3e5bfef4b3957b]
+  [COMPLETE 4c70d6f491d5cf5515ab39917060] (#deps: 1)
+   - [COMPLETE fc08c53369f0e000e0108e21c6aa]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t5_pub (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0xda, 0x90, 0x19, 0xe0, 0xe3, 0x30, 0x7d, 0x98, 0x73, 0xef, \
+  0xad, 0xb0, 0x7c, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4c, 0x73, 0x8b, 0xde, 0x62, 0x47, 0xbf, \
+  0x3e, 0x5b, 0xfe, 0xf4, 0xb3, 0x95, 0x7b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x70, 0xd6, \
+  0xf4, 0x91, 0xd5, 0xcf, 0x55, 0x15, 0xab, 0x39, 0x91, 0x70, 0x60, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfc, 0x08, 0xc5, 0x33, 0x69, 0xf0, 0xe0, 0x00, 0xe0, 0x10, 0x8e, 0x21, 0xc6, 0xaa, 0x00, \
+  0x51, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t5_pub 148u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t5_pub (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0xda, 0x90, 0x19, 0xe0, 0xe3, 0x30, \
+  0x7d, 0x98, 0x73, 0xef, 0xad, 0xb0, 0x7c, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x4c, 0x73, 0x8b, 0xde, 0x62, \
+  0x47, 0xbf, 0x3e, 0x5b, 0xfe, 0xf4, 0xb3, 0x95, 0x7b, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x4c, 0x73, \
+  0x8b, 0xde, 0x62, 0x47, 0xbf, 0x3e, 0x5b, 0xfe, 0xf4, 0xb3, 0x95, 0x7b, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0xed, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x70, 0xd6, \
+  0xf4, 0x91, 0xd5, 0xcf, 0x55, 0x15, 0xab, 0x39, 0x91, 0x70, 0x60, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, \
+  0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x35, 0x5f, 0x70, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfc, 0x08, 0xc5, 0x33, 0x69, \
+  0xf0, 0xe0, 0x00, 0xe0, 0x10, 0x8e, 0x21, 0xc6, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0x08, 0xc5, 0x33, 0x69, 0xf0, 0xe0, 0x00, 0xe0, 0x10, \
+  0x8e, 0x21, 0xc6, 0xaa, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x70, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x4c, 0x70, 0xd6, 0xf4, 0x91, 0xd5, 0xcf, 0x55, 0x15, 0xab, 0x39, 0x91, 0x70, 0x60, 0xf1, \
+  0xc3, 0xda, 0x90, 0x19, 0xe0, 0xe3, 0x30, 0x7d, 0x98, 0x73, 0xef, 0xad, 0xb0, 0x7c, 0xf2, 0xfc, \
+  0x08, 0xc5, 0x33, 0x69, 0xf0, 0xe0, 0x00, 0xe0, 0x10, 0x8e, 0x21, 0xc6, 0xaa, 0xf1, 0x4c, 0x73, \
+  0x8b, 0xde, 0x62, 0x47, 0xbf, 0x3e, 0x5b, 0xfe, 0xf4, 0xb3, 0x95, 0x7b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t5_pub 460u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t5_pub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t5_pub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t5_pub),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t5_pub",
+  .m_keys = NULL,
+  .m_nops = 9,
+  .m_ops = CdrStreamSkipDefault_t5_pub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t5_pub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t5_pub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t5_pub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t5_pub }
+};
+
+static const uint32_t CdrStreamSkipDefault_t5_sub_ops [] =
+{
+  /* t5_sub */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_sub, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t5_sub, f2), (3u << 16u) + 4u /* t5_sub1 */,
+  DDS_OP_RTS,
+
+  /* t5_sub1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_sub1, s1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamSkipDefault_t5_sub1, s2), (3u << 16u) + 4u /* t5_sub2 */,
+  DDS_OP_RTS,
+
+  /* t5_sub2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_sub2, s1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamSkipDefault_t5_sub2, s2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 1cd54759458c953adff9d720be51] (#deps: 2)
+   - [MINIMAL 5cec2b4cf463ca047d94b5ab5876]
+   - [MINIMAL 008adc5a970011513440fbb5136f]
+  [COMPLETE d1ea7ef6b0e578ecdced17812e55] (#deps: 2)
+   - [COMPLETE 6ac97bf72e88edf8727ff03edb92]
+   - [COMPLETE 028c69331a9c237a9bfc3890d64c]
+*/
+#define TYPE_INFO_CDR_CdrStreamSkipDefault_t5_sub (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1c, 0xd5, 0x47, 0x59, 0x45, 0x8c, 0x95, 0x3a, 0xdf, 0xf9, 0xd7, \
+  0x20, 0xbe, 0x51, 0x00, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0xec, 0x2b, 0x4c, 0xf4, 0x63, 0xca, \
+  0x04, 0x7d, 0x94, 0xb5, 0xab, 0x58, 0x76, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x8a, 0xdc, 0x5a, 0x97, 0x00, 0x11, 0x51, 0x34, 0x40, 0xfb, 0xb5, 0x13, 0x6f, 0x00, \
+  0x3c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0xea, 0x7e, 0xf6, 0xb0, 0xe5, 0x78, 0xec, 0xdc, 0xed, 0x17, \
+  0x81, 0x2e, 0x55, 0x00, 0x79, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0xc9, 0x7b, 0xf7, 0x2e, 0x88, 0xed, \
+  0xf8, 0x72, 0x7f, 0xf0, 0x3e, 0xdb, 0x92, 0x00, 0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x02, 0x8c, 0x69, 0x33, 0x1a, 0x9c, 0x23, 0x7a, 0x9b, 0xfc, 0x38, 0x90, 0xd6, 0x4c, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t5_sub 196u
+#define TYPE_MAP_CDR_CdrStreamSkipDefault_t5_sub (const unsigned char []){ \
+  0xf8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x1c, 0xd5, 0x47, 0x59, 0x45, 0x8c, 0x95, \
+  0x3a, 0xdf, 0xf9, 0xd7, 0x20, 0xbe, 0x51, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x5c, 0xec, 0x2b, 0x4c, 0xf4, \
+  0x63, 0xca, 0x04, 0x7d, 0x94, 0xb5, 0xab, 0x58, 0x76, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x5c, 0xec, \
+  0x2b, 0x4c, 0xf4, 0x63, 0xca, 0x04, 0x7d, 0x94, 0xb5, 0xab, 0x58, 0x76, 0x41, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x00, \
+  0x8a, 0xdc, 0x5a, 0x97, 0x00, 0x11, 0x51, 0x34, 0x40, 0xfb, 0xb5, 0x13, 0x6f, 0xfa, 0xc9, 0x89, \
+  0x44, 0xf1, 0x00, 0x8a, 0xdc, 0x5a, 0x97, 0x00, 0x11, 0x51, 0x34, 0x40, 0xfb, 0xb5, 0x13, 0x6f, \
+  0x38, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x8d, 0xdf, 0x87, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0xfa, 0xc9, 0x89, 0x44, 0x91, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0xea, 0x7e, 0xf6, 0xb0, 0xe5, 0x78, 0xec, 0xdc, 0xed, 0x17, \
+  0x81, 0x2e, 0x55, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x6a, 0xc9, 0x7b, 0xf7, 0x2e, 0x88, 0xed, 0xf8, 0x72, 0x7f, 0xf0, 0x3e, 0xdb, \
+  0x92, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0xc9, \
+  0x7b, 0xf7, 0x2e, 0x88, 0xed, 0xf8, 0x72, 0x7f, 0xf0, 0x3e, 0xdb, 0x92, 0x75, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0a, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, \
+  0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x35, 0x5f, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x02, 0x8c, 0x69, 0x33, 0x1a, \
+  0x9c, 0x23, 0x7a, 0x9b, 0xfc, 0x38, 0x90, 0xd6, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x8c, 0x69, 0x33, 0x1a, 0x9c, 0x23, 0x7a, 0x9b, 0xfc, \
+  0x38, 0x90, 0xd6, 0x4c, 0x69, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x53, 0x6b, 0x69, 0x70, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0xea, 0x7e, \
+  0xf6, 0xb0, 0xe5, 0x78, 0xec, 0xdc, 0xed, 0x17, 0x81, 0x2e, 0x55, 0xf1, 0x1c, 0xd5, 0x47, 0x59, \
+  0x45, 0x8c, 0x95, 0x3a, 0xdf, 0xf9, 0xd7, 0x20, 0xbe, 0x51, 0xf2, 0x6a, 0xc9, 0x7b, 0xf7, 0x2e, \
+  0x88, 0xed, 0xf8, 0x72, 0x7f, 0xf0, 0x3e, 0xdb, 0x92, 0xf1, 0x5c, 0xec, 0x2b, 0x4c, 0xf4, 0x63, \
+  0xca, 0x04, 0x7d, 0x94, 0xb5, 0xab, 0x58, 0x76, 0xf2, 0x02, 0x8c, 0x69, 0x33, 0x1a, 0x9c, 0x23, \
+  0x7a, 0x9b, 0xfc, 0x38, 0x90, 0xd6, 0x4c, 0xf1, 0x00, 0x8a, 0xdc, 0x5a, 0x97, 0x00, 0x11, 0x51, \
+  0x34, 0x40, 0xfb, 0xb5, 0x13, 0x6f\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t5_sub 758u
+const dds_topic_descriptor_t CdrStreamSkipDefault_t5_sub_desc =
+{
+  .m_size = sizeof (CdrStreamSkipDefault_t5_sub),
+  .m_align = dds_alignof (CdrStreamSkipDefault_t5_sub),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamSkipDefault::t5_sub",
+  .m_keys = NULL,
+  .m_nops = 14,
+  .m_ops = CdrStreamSkipDefault_t5_sub_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamSkipDefault_t5_sub, .sz = TYPE_INFO_CDR_SZ_CdrStreamSkipDefault_t5_sub },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamSkipDefault_t5_sub, .sz = TYPE_MAP_CDR_SZ_CdrStreamSkipDefault_t5_sub }
+};
+
@@ -0,0 +1,77 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CreateWriter.c
+  Source: /root/repo/src/core/ddsc/tests/CreateWriter.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CreateWriter.h"
+
+static const uint32_t DiscStress_CreateWriter_Msg_ops [] =
+{
+  /* Msg */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DiscStress_CreateWriter_Msg, round),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (DiscStress_CreateWriter_Msg, wrseq),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (DiscStress_CreateWriter_Msg, wridx),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (DiscStress_CreateWriter_Msg, histidx),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (DiscStress_CreateWriter_Msg, seq),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4fb1eec6394617c6b603a94d87b9] (#deps: 0)
+  [COMPLETE 15aff5f0bc85a77ef83f20abdfce] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DiscStress_CreateWriter_Msg (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0xb1, 0xee, 0xc6, 0x39, 0x46, 0x17, 0xc6, 0xb6, 0x03, 0xa9, \
+  0x4d, 0x87, 0xb9, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x15, 0xaf, 0xf5, 0xf0, 0xbc, 0x85, 0xa7, 0x7e, 0xf8, 0x3f, 0x20, \
+  0xab, 0xdf, 0xce, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DiscStress_CreateWriter_Msg 100u
+#define TYPE_MAP_CDR_DiscStress_CreateWriter_Msg (const unsigned char []){ \
+  0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0xb1, 0xee, 0xc6, 0x39, 0x46, 0x17, \
+  0xc6, 0xb6, 0x03, 0xa9, 0x4d, 0x87, 0xb9, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x9b, 0xbd, 0x99, 0x3d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xcd, 0x2f, 0x3f, 0x48, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x18, 0x6d, 0x5b, 0x11, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xc9, 0x84, 0x29, 0xc0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0xca, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x15, 0xaf, 0xf5, 0xf0, 0xbc, 0x85, 0xa7, \
+  0x7e, 0xf8, 0x3f, 0x20, 0xab, 0xdf, 0xce, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x44, 0x69, 0x73, 0x63, \
+  0x53, 0x74, 0x72, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x57, 0x72, \
+  0x69, 0x74, 0x65, 0x72, 0x3a, 0x3a, 0x4d, 0x73, 0x67, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x77, 0x72, 0x73, 0x65, \
+  0x71, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x77, 0x72, 0x69, 0x64, 0x78, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x68, 0x69, 0x73, 0x74, \
+  0x69, 0x64, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x15, 0xaf, 0xf5, 0xf0, 0xbc, 0x85, 0xa7, \
+  0x7e, 0xf8, 0x3f, 0x20, 0xab, 0xdf, 0xce, 0xf1, 0x4f, 0xb1, 0xee, 0xc6, 0x39, 0x46, 0x17, 0xc6, \
+  0xb6, 0x03, 0xa9, 0x4d, 0x87, 0xb9\
+}
+#define TYPE_MAP_CDR_SZ_DiscStress_CreateWriter_Msg 374u
+const dds_topic_descriptor_t DiscStress_CreateWriter_Msg_desc =
+{
+  .m_size = sizeof (DiscStress_CreateWriter_Msg),
+  .m_align = dds_alignof (DiscStress_CreateWriter_Msg),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DiscStress::CreateWriter::Msg",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = DiscStress_CreateWriter_Msg_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DiscStress_CreateWriter_Msg, .sz = TYPE_INFO_CDR_SZ_DiscStress_CreateWriter_Msg },
+  .type_mapping = { .data = TYPE_MAP_CDR_DiscStress_CreateWriter_Msg, .sz = TYPE_MAP_CDR_SZ_DiscStress_CreateWriter_Msg }
+};
+
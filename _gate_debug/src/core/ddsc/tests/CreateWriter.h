@@ -0,0 +1,39 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/CreateWriter.h
+  Source: /root/repo/src/core/ddsc/tests/CreateWriter.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CREATEWRITER_H_9B5AA4A977661DB1E5D9D13DDC66DD33
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CREATEWRITER_H_9B5AA4A977661DB1E5D9D13DDC66DD33
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct DiscStress_CreateWriter_Msg
+{
+  int32_t round;
+  uint32_t wrseq;
+  uint32_t wridx;
+  uint32_t histidx;
+  uint32_t seq;
+} DiscStress_CreateWriter_Msg;
+
+extern const dds_topic_descriptor_t DiscStress_CreateWriter_Msg_desc;
+
+#define DiscStress_CreateWriter_Msg__alloc() \
+((DiscStress_CreateWriter_Msg*) dds_alloc (sizeof (DiscStress_CreateWriter_Msg)));
+
+#define DiscStress_CreateWriter_Msg_free(d,o) \
+dds_sample_free ((d), &DiscStress_CreateWriter_Msg_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_CREATEWRITER_H_9B5AA4A977661DB1E5D9D13DDC66DD33 */
@@ -0,0 +1,587 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/DynamicTypeTypes.c
+  Source: /root/repo/src/core/ddsc/tests/DynamicTypeTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "DynamicTypeTypes.h"
+
+static const uint32_t dsub1_ops [] =
+{
+  /* dsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (dsub1, m_int32),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c9213c3c284862c2cf1da7a6f2a9] (#deps: 0)
+  [COMPLETE fd6fd40293021e0f7b7152965fb6] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_dsub1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, \
+  0xa6, 0xf2, 0xa9, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, \
+  0x96, 0x5f, 0xb6, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dsub1 100u
+#define TYPE_MAP_CDR_dsub1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, \
+  0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8b, 0x94, 0x74, 0x6b, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, \
+  0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, \
+  0x31, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x69, 0x6e, \
+  0x74, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0xf1, \
+  0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9\
+}
+#define TYPE_MAP_CDR_SZ_dsub1 190u
+const dds_topic_descriptor_t dsub1_desc =
+{
+  .m_size = sizeof (dsub1),
+  .m_align = dds_alignof (dsub1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dsub1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = dsub1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dsub1, .sz = TYPE_INFO_CDR_SZ_dsub1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_dsub1, .sz = TYPE_MAP_CDR_SZ_dsub1 }
+};
+
+static const uint32_t dsubsub1_ops [] =
+{
+  /* dsubsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub1, m_bool),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 25a67df83545ae942e3852fb4007] (#deps: 0)
+  [COMPLETE c91dde640c49be59dcbbb3d3890e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_dsubsub1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, \
+  0xfb, 0x40, 0x07, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, \
+  0xd3, 0x89, 0x0e, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dsubsub1 100u
+#define TYPE_MAP_CDR_dsubsub1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, \
+  0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0xa9, 0x54, 0xf5, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, \
+  0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, \
+  0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, \
+  0xd3, 0x89, 0x0e, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, \
+  0x40, 0x07\
+}
+#define TYPE_MAP_CDR_SZ_dsubsub1 194u
+const dds_topic_descriptor_t dsubsub1_desc =
+{
+  .m_size = sizeof (dsubsub1),
+  .m_align = dds_alignof (dsubsub1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dsubsub1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = dsubsub1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dsubsub1, .sz = TYPE_INFO_CDR_SZ_dsubsub1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_dsubsub1, .sz = TYPE_MAP_CDR_SZ_dsubsub1 }
+};
+
+static const uint32_t dsubsub2_ops [] =
+{
+  /* dsubsub2 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub2, m_bool),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 25a67df83545ae942e3852fb4007] (#deps: 0)
+  [COMPLETE 601b3c929e775e26491f030d7842] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_dsubsub2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, \
+  0xfb, 0x40, 0x07, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, \
+  0x0d, 0x78, 0x42, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dsubsub2 100u
+#define TYPE_MAP_CDR_dsubsub2 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, \
+  0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0xa9, 0x54, 0xf5, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, \
+  0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, \
+  0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, \
+  0x0d, 0x78, 0x42, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, \
+  0x40, 0x07\
+}
+#define TYPE_MAP_CDR_SZ_dsubsub2 194u
+const dds_topic_descriptor_t dsubsub2_desc =
+{
+  .m_size = sizeof (dsubsub2),
+  .m_align = dds_alignof (dsubsub2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dsubsub2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = dsubsub2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dsubsub2, .sz = TYPE_INFO_CDR_SZ_dsubsub2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_dsubsub2, .sz = TYPE_MAP_CDR_SZ_dsubsub2 }
+};
+
+static const uint32_t dsub2_ops [] =
+{
+  /* dsub2 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dsub2, m_subsub1), (3u << 16u) + 7u /* dsubsub1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dsub2, m_subsub2), (3u << 16u) + 7u /* dsubsub2 */,
+  DDS_OP_RTS,
+
+  /* dsubsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub1, m_bool),
+  DDS_OP_RTS,
+
+  /* dsubsub2 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub2, m_bool),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 05074b0960c0d58d07bd615505dd] (#deps: 1)
+   - [MINIMAL 25a67df83545ae942e3852fb4007]
+  [COMPLETE 036d2aee266482055d2c4f30ba59] (#deps: 2)
+   - [COMPLETE c91dde640c49be59dcbbb3d3890e]
+   - [COMPLETE 601b3c929e775e26491f030d7842]
+*/
+#define TYPE_INFO_CDR_dsub2 (const unsigned char []){ \
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, 0xd5, 0x8d, 0x07, 0xbd, 0x61, \
+  0x55, 0x05, 0xdd, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, \
+  0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x6d, 0x2a, \
+  0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, 0x00, 0x7c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, \
+  0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x41, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dsub2 172u
+#define TYPE_MAP_CDR_dsub2 (const unsigned char []){ \
+  0xd7, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, 0xd5, \
+  0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, \
+  0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x7e, 0xa6, 0xa7, 0xc9, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, \
+  0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x1b, 0x20, 0xd7, 0x3d, 0xf1, 0x25, 0xa6, \
+  0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, \
+  0xa9, 0x54, 0xf5, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, \
+  0x40, 0x07, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0xa9, 0x54, 0xf5, 0x00, 0x31, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, \
+  0x30, 0xba, 0x59, 0x00, 0x78, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, \
+  0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, \
+  0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x60, \
+  0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, \
+  0x3d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, \
+  0x3d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x6d, 0x2a, \
+  0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, 0xf1, 0x05, 0x07, 0x4b, 0x09, \
+  0x60, 0xc0, 0xd5, 0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, \
+  0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, \
+  0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, \
+  0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, \
+  0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07\
+}
+#define TYPE_MAP_CDR_SZ_dsub2 630u
+const dds_topic_descriptor_t dsub2_desc =
+{
+  .m_size = sizeof (dsub2),
+  .m_align = dds_alignof (dsub2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dsub2",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = dsub2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dsub2, .sz = TYPE_INFO_CDR_SZ_dsub2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_dsub2, .sz = TYPE_MAP_CDR_SZ_dsub2 }
+};
+
+static const uint32_t dunion_ops [] =
+{
+  /* dunion */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (dunion, _d), 4u, (20u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_8BY, 9, offsetof (dunion, _u.um_f), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_8BY, 10, offsetof (dunion, _u.um_f), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 9 /* dsub1 */, 15, offsetof (dunion, _u.um_sub1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 5 /* dsub1 */, 16, offsetof (dunion, _u.um_sub1), 0u,
+  DDS_OP_RTS,
+
+  /* dsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (dsub1, m_int32),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 48e7431edc3d25c72c7d1e4fcfaa] (#deps: 1)
+   - [MINIMAL c9213c3c284862c2cf1da7a6f2a9]
+  [COMPLETE a07b8afd1d1c81f8d8e01cd8f1a2] (#deps: 1)
+   - [COMPLETE fd6fd40293021e0f7b7152965fb6]
+*/
+#define TYPE_INFO_CDR_dunion (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, 0xc7, 0x2c, 0x7d, 0x1e, \
+  0x4f, 0xcf, 0xaa, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, \
+  0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0x7b, 0x8a, \
+  0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0x00, 0x8a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, \
+  0x3e, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dunion 148u
+#define TYPE_MAP_CDR_dunion (const unsigned char []){ \
+  0xaf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, \
+  0xc7, 0x2c, 0x7d, 0x1e, 0x4f, 0xcf, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x3d, 0x80, 0xeb, \
+  0x28, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, \
+  0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x19, 0x1f, 0xaa, 0xc3, 0xf1, 0xc9, 0x21, 0x3c, \
+  0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8b, \
+  0x94, 0x74, 0x6b, 0x00, 0xee, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0x7b, 0x8a, \
+  0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0x00, 0x86, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x64, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x75, 0x6d, 0x5f, 0x66, 0x00, 0x00, 0x00, 0x00, \
+  0x32, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, \
+  0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x75, 0x6d, 0x5f, 0x73, \
+  0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, \
+  0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, \
+  0x31, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x69, 0x6e, \
+  0x74, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xa0, 0x7b, 0x8a, 0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0xf1, \
+  0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, 0xc7, 0x2c, 0x7d, 0x1e, 0x4f, 0xcf, 0xaa, 0xf2, 0xfd, \
+  0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0xf1, 0xc9, 0x21, \
+  0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9\
+}
+#define TYPE_MAP_CDR_SZ_dunion 492u
+const dds_topic_descriptor_t dunion_desc =
+{
+  .m_size = sizeof (dunion),
+  .m_align = dds_alignof (dunion),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dunion",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = dunion_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dunion, .sz = TYPE_INFO_CDR_SZ_dunion },
+  .type_mapping = { .data = TYPE_MAP_CDR_dunion, .sz = TYPE_MAP_CDR_SZ_dunion }
+};
+
+static const uint32_t dstruct_ops [] =
+{
+  /* dstruct */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dstruct, m_bool),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (dstruct, m_seq), sizeof (dsub2), (4u << 16u) + 28u /* dsub2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (dstruct, m_arr), 10u, (5u << 16u) + 24u /* dsub2 */, sizeof (dsub2),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dstruct, m_sub1), (3u << 16u) + 32u /* dsub1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dstruct, m_sub2), (3u << 16u) + 16u /* dsub2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dstruct, m_subsub2), (3u << 16u) + 23u /* dsubsub2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dstruct, m_alias), (3u << 16u) + 17u /* dsubsub1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dstruct, m_union), (3u << 16u) + 23u /* dunion */,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (dstruct, m_enum), 1u,
+  DDS_OP_RTS,
+
+  /* dsub2 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dsub2, m_subsub1), (3u << 16u) + 7u /* dsubsub1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (dsub2, m_subsub2), (3u << 16u) + 7u /* dsubsub2 */,
+  DDS_OP_RTS,
+
+  /* dsubsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub1, m_bool),
+  DDS_OP_RTS,
+
+  /* dsubsub2 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (dsubsub2, m_bool),
+  DDS_OP_RTS,
+
+  /* dsub1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (dsub1, m_int32),
+  DDS_OP_RTS,
+
+  /* dunion */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (dunion, _d), 4u, (20u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_8BY, 9, offsetof (dunion, _u.um_f), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_8BY, 10, offsetof (dunion, _u.um_f), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 65521 /* dsub1 */, 15, offsetof (dunion, _u.um_sub1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 65517 /* dsub1 */, 16, offsetof (dunion, _u.um_sub1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c071b2bd1236ed59cb84bfb37298] (#deps: 6)
+   - [MINIMAL 05074b0960c0d58d07bd615505dd]
+   - [MINIMAL 25a67df83545ae942e3852fb4007]
+   - [MINIMAL c9213c3c284862c2cf1da7a6f2a9]
+   - [MINIMAL 769f8dea9dd7d87052caca8016a6]
+   - [MINIMAL 48e7431edc3d25c72c7d1e4fcfaa]
+   - [MINIMAL 89f34a9e1d617d471d837f04e93c]
+  [COMPLETE 8073178d93369a11f3989969666b] (#deps: 7)
+   - [COMPLETE 036d2aee266482055d2c4f30ba59]
+   - [COMPLETE c91dde640c49be59dcbbb3d3890e]
+   - [COMPLETE 601b3c929e775e26491f030d7842]
+   - [COMPLETE fd6fd40293021e0f7b7152965fb6]
+   - [COMPLETE 653dad9145a39106bde9987091f1]
+   - [COMPLETE a07b8afd1d1c81f8d8e01cd8f1a2]
+   - [COMPLETE 2be09c199d78eb3fa195736b461a]
+*/
+#define TYPE_INFO_CDR_dstruct (const unsigned char []){ \
+  0x98, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xb8, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc0, 0x71, 0xb2, 0xbd, 0x12, 0x36, 0xed, 0x59, 0xcb, 0x84, 0xbf, \
+  0xb3, 0x72, 0x98, 0x00, 0x31, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, 0xd5, \
+  0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, \
+  0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x76, 0x9f, 0x8d, 0xea, 0x9d, 0xd7, 0xd8, 0x70, 0x52, 0xca, 0xca, 0x80, 0x16, 0xa6, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, \
+  0xc7, 0x2c, 0x7d, 0x1e, 0x4f, 0xcf, 0xaa, 0x00, 0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x89, 0xf3, 0x4a, 0x9e, 0x1d, 0x61, 0x7d, 0x47, 0x1d, 0x83, 0x7f, 0x04, 0xe9, 0x3c, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0xd0, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x80, 0x73, 0x17, 0x8d, 0x93, 0x36, 0x9a, 0x11, 0xf3, 0x98, 0x99, \
+  0x69, 0x66, 0x6b, 0x00, 0xa1, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, \
+  0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, \
+  0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x41, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x3d, 0xad, 0x91, 0x45, 0xa3, 0x91, \
+  0x06, 0xbd, 0xe9, 0x98, 0x70, 0x91, 0xf1, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa0, 0x7b, 0x8a, 0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0x00, \
+  0x8a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0xe0, 0x9c, 0x19, 0x9d, 0x78, 0xeb, \
+  0x3f, 0xa1, 0x95, 0x73, 0x6b, 0x46, 0x1a, 0x00, 0x5a, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_dstruct 412u
+#define TYPE_MAP_CDR_dstruct (const unsigned char []){ \
+  0x42, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf1, 0xc0, 0x71, 0xb2, 0xbd, 0x12, 0x36, 0xed, \
+  0x59, 0xcb, 0x84, 0xbf, 0xb3, 0x72, 0x98, 0x00, 0x2d, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0xa9, 0x54, 0xf5, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, 0xd5, 0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0x52, 0x5a, \
+  0x8e, 0x61, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, \
+  0xd5, 0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0x92, 0xed, 0xa5, 0xae, 0x19, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, \
+  0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x9d, 0x26, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, 0xd5, 0x8d, 0x07, \
+  0xbd, 0x61, 0x55, 0x05, 0xdd, 0xe6, 0xb0, 0x59, 0xb0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, \
+  0x38, 0x52, 0xfb, 0x40, 0x07, 0x1b, 0x20, 0xd7, 0x3d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x76, 0x9f, 0x8d, 0xea, 0x9d, 0xd7, 0xd8, 0x70, 0x52, \
+  0xca, 0xca, 0x80, 0x16, 0xa6, 0xf1, 0xa4, 0xb4, 0x5f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, 0xc7, 0x2c, \
+  0x7d, 0x1e, 0x4f, 0xcf, 0xaa, 0xa9, 0xb5, 0x50, 0xc0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x89, 0xf3, 0x4a, 0x9e, 0x1d, 0x61, 0x7d, 0x47, 0x1d, \
+  0x83, 0x7f, 0x04, 0xe9, 0x3c, 0xb8, 0x12, 0xfd, 0x81, 0xf1, 0x05, 0x07, 0x4b, 0x09, 0x60, 0xc0, \
+  0xd5, 0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, \
+  0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x7e, 0xa6, 0xa7, 0xc9, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, \
+  0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x1b, 0x20, 0xd7, 0x3d, 0xf1, 0x25, 0xa6, \
+  0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, \
+  0xa9, 0x54, 0xf5, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, \
+  0x40, 0x07, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0xa9, 0x54, 0xf5, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, \
+  0x28, 0x48, 0x62, 0xc2, 0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8b, \
+  0x94, 0x74, 0x6b, 0xf1, 0x76, 0x9f, 0x8d, 0xea, 0x9d, 0xd7, 0xd8, 0x70, 0x52, 0xca, 0xca, 0x80, \
+  0x16, 0xa6, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, 0xae, 0x94, 0x2e, \
+  0x38, 0x52, 0xfb, 0x40, 0x07, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, 0xc7, 0x2c, 0x7d, \
+  0x1e, 0x4f, 0xcf, 0xaa, 0x60, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x3d, 0x80, 0xeb, 0x28, 0x00, 0x00, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, 0xcf, \
+  0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x19, 0x1f, 0xaa, 0xc3, 0xf1, 0x89, 0xf3, 0x4a, 0x9e, 0x1d, 0x61, 0x7d, \
+  0x47, 0x1d, 0x83, 0x7f, 0x04, 0xe9, 0x3c, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x4b, 0xb3, \
+  0x2b, 0x59, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xd2, 0x1a, 0x31, 0x0c, 0x00, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0xf2, 0x80, 0x73, 0x17, 0x8d, 0x93, 0x36, 0x9a, 0x11, 0xf3, 0x98, 0x99, 0x69, 0x66, 0x6b, 0x00, \
+  0x9d, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x64, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x81, 0x01, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0a, 0xf2, 0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, \
+  0x06, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x61, 0x72, 0x72, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, \
+  0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, \
+  0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, \
+  0x59, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x60, \
+  0x1b, 0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, \
+  0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x65, 0x3d, 0xad, 0x91, 0x45, \
+  0xa3, 0x91, 0x06, 0xbd, 0xe9, 0x98, 0x70, 0x91, 0xf1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x6d, 0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa0, 0x7b, 0x8a, 0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, \
+  0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x75, 0x6e, \
+  0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x2b, 0xe0, 0x9c, 0x19, 0x9d, 0x78, 0xeb, 0x3f, 0xa1, 0x95, 0x73, 0x6b, 0x46, \
+  0x1a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, \
+  0x00, 0xf2, 0x03, 0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, \
+  0x78, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x64, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc9, \
+  0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, \
+  0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x6d, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x1d, 0xde, \
+  0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, 0x3d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x64, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x1b, \
+  0x3c, 0x92, 0x9e, 0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0x3d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x64, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0x6f, \
+  0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x3a, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x64, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x3d, 0xad, 0x91, 0x45, \
+  0xa3, 0x91, 0x06, 0xbd, 0xe9, 0x98, 0x70, 0x91, 0xf1, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x64, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xc9, \
+  0x1d, 0xde, 0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0x00, 0x00, 0xf2, \
+  0xa0, 0x7b, 0x8a, 0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, 0xd8, 0xf1, 0xa2, 0x00, 0x00, \
+  0x86, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x64, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x75, 0x6d, 0x5f, 0x66, \
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfd, \
+  0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, 0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x75, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0xe0, 0x9c, 0x19, 0x9d, \
+  0x78, 0xeb, 0x3f, 0xa1, 0x95, 0x73, 0x6b, 0x46, 0x1a, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x64, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x44, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x44, 0x45, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0xf2, 0x80, 0x73, 0x17, 0x8d, 0x93, 0x36, 0x9a, 0x11, 0xf3, 0x98, 0x99, 0x69, 0x66, 0x6b, 0xf1, \
+  0xc0, 0x71, 0xb2, 0xbd, 0x12, 0x36, 0xed, 0x59, 0xcb, 0x84, 0xbf, 0xb3, 0x72, 0x98, 0xf2, 0x03, \
+  0x6d, 0x2a, 0xee, 0x26, 0x64, 0x82, 0x05, 0x5d, 0x2c, 0x4f, 0x30, 0xba, 0x59, 0xf1, 0x05, 0x07, \
+  0x4b, 0x09, 0x60, 0xc0, 0xd5, 0x8d, 0x07, 0xbd, 0x61, 0x55, 0x05, 0xdd, 0xf2, 0xc9, 0x1d, 0xde, \
+  0x64, 0x0c, 0x49, 0xbe, 0x59, 0xdc, 0xbb, 0xb3, 0xd3, 0x89, 0x0e, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, \
+  0x35, 0x45, 0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0xf2, 0x60, 0x1b, 0x3c, 0x92, 0x9e, \
+  0x77, 0x5e, 0x26, 0x49, 0x1f, 0x03, 0x0d, 0x78, 0x42, 0xf1, 0x25, 0xa6, 0x7d, 0xf8, 0x35, 0x45, \
+  0xae, 0x94, 0x2e, 0x38, 0x52, 0xfb, 0x40, 0x07, 0xf2, 0xfd, 0x6f, 0xd4, 0x02, 0x93, 0x02, 0x1e, \
+  0x0f, 0x7b, 0x71, 0x52, 0x96, 0x5f, 0xb6, 0xf1, 0xc9, 0x21, 0x3c, 0x3c, 0x28, 0x48, 0x62, 0xc2, \
+  0xcf, 0x1d, 0xa7, 0xa6, 0xf2, 0xa9, 0xf2, 0x65, 0x3d, 0xad, 0x91, 0x45, 0xa3, 0x91, 0x06, 0xbd, \
+  0xe9, 0x98, 0x70, 0x91, 0xf1, 0xf1, 0x76, 0x9f, 0x8d, 0xea, 0x9d, 0xd7, 0xd8, 0x70, 0x52, 0xca, \
+  0xca, 0x80, 0x16, 0xa6, 0xf2, 0xa0, 0x7b, 0x8a, 0xfd, 0x1d, 0x1c, 0x81, 0xf8, 0xd8, 0xe0, 0x1c, \
+  0xd8, 0xf1, 0xa2, 0xf1, 0x48, 0xe7, 0x43, 0x1e, 0xdc, 0x3d, 0x25, 0xc7, 0x2c, 0x7d, 0x1e, 0x4f, \
+  0xcf, 0xaa, 0xf2, 0x2b, 0xe0, 0x9c, 0x19, 0x9d, 0x78, 0xeb, 0x3f, 0xa1, 0x95, 0x73, 0x6b, 0x46, \
+  0x1a, 0xf1, 0x89, 0xf3, 0x4a, 0x9e, 0x1d, 0x61, 0x7d, 0x47, 0x1d, 0x83, 0x7f, 0x04, 0xe9, 0x3c\
+}
+#define TYPE_MAP_CDR_SZ_dstruct 2240u
+const dds_topic_descriptor_t dstruct_desc =
+{
+  .m_size = sizeof (dstruct),
+  .m_align = dds_alignof (dstruct),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "dstruct",
+  .m_keys = NULL,
+  .m_nops = 25,
+  .m_ops = dstruct_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_dstruct, .sz = TYPE_INFO_CDR_SZ_dstruct },
+  .type_mapping = { .data = TYPE_MAP_CDR_dstruct, .sz = TYPE_MAP_CDR_SZ_dstruct }
+};
+
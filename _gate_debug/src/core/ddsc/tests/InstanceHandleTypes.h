@@ -0,0 +1,63 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/InstanceHandleTypes.h
+  Source: /root/repo/src/core/ddsc/tests/InstanceHandleTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_INSTANCEHANDLETYPES_H_EDAAE71E3D447FF318EAB5C76235675C
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_INSTANCEHANDLETYPES_H_EDAAE71E3D447FF318EAB5C76235675C
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct InstanceHandleTypes_A
+{
+  uint32_t k;
+  uint32_t v;
+} InstanceHandleTypes_A;
+
+extern const dds_topic_descriptor_t InstanceHandleTypes_A_desc;
+
+#define InstanceHandleTypes_A__alloc() \
+((InstanceHandleTypes_A*) dds_alloc (sizeof (InstanceHandleTypes_A)));
+
+#define InstanceHandleTypes_A_free(d,o) \
+dds_sample_free ((d), &InstanceHandleTypes_A_desc, (o))
+
+typedef struct InstanceHandleTypes_C
+{
+  uint32_t k;
+  uint32_t v;
+} InstanceHandleTypes_C;
+
+extern const dds_topic_descriptor_t InstanceHandleTypes_C_desc;
+
+#define InstanceHandleTypes_C__alloc() \
+((InstanceHandleTypes_C*) dds_alloc (sizeof (InstanceHandleTypes_C)));
+
+#define InstanceHandleTypes_C_free(d,o) \
+dds_sample_free ((d), &InstanceHandleTypes_C_desc, (o))
+
+typedef struct InstanceHandleTypes_MD5
+{
+  uint8_t k[128];
+} InstanceHandleTypes_MD5;
+
+extern const dds_topic_descriptor_t InstanceHandleTypes_MD5_desc;
+
+#define InstanceHandleTypes_MD5__alloc() \
+((InstanceHandleTypes_MD5*) dds_alloc (sizeof (InstanceHandleTypes_MD5)));
+
+#define InstanceHandleTypes_MD5_free(d,o) \
+dds_sample_free ((d), &InstanceHandleTypes_MD5_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_DDSC_TESTS_INSTANCEHANDLETYPES_H_EDAAE71E3D447FF318EAB5C76235675C */
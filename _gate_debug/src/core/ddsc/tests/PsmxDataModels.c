@@ -0,0 +1,538 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/PsmxDataModels.c
+  Source: /root/repo/src/core/ddsc/tests/PsmxDataModels.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "PsmxDataModels.h"
+
+static const uint32_t SC_Model_ops [] =
+{
+  /* SC_Model */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SC_Model, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SC_Model, b),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SC_Model, c),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL aa327eaaa1d1b0892235e8f2cf5c] (#deps: 0)
+  [COMPLETE ec0748c7d3e3d87293e4aa610fec] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SC_Model (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xaa, 0x32, 0x7e, 0xaa, 0xa1, 0xd1, 0xb0, 0x89, 0x22, 0x35, 0xe8, \
+  0xf2, 0xcf, 0x5c, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x07, 0x48, 0xc7, 0xd3, 0xe3, 0xd8, 0x72, 0x93, 0xe4, 0xaa, \
+  0x61, 0x0f, 0xec, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SC_Model 100u
+#define TYPE_MAP_CDR_SC_Model (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xaa, 0x32, 0x7e, 0xaa, 0xa1, 0xd1, 0xb0, \
+  0x89, 0x22, 0x35, 0xe8, 0xf2, 0xcf, 0x5c, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x07, 0x48, 0xc7, 0xd3, 0xe3, 0xd8, \
+  0x72, 0x93, 0xe4, 0xaa, 0x61, 0x0f, 0xec, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x53, 0x43, 0x5f, 0x4d, \
+  0x6f, 0x64, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x07, 0x48, 0xc7, 0xd3, 0xe3, 0xd8, 0x72, 0x93, 0xe4, 0xaa, \
+  0x61, 0x0f, 0xec, 0xf1, 0xaa, 0x32, 0x7e, 0xaa, 0xa1, 0xd1, 0xb0, 0x89, 0x22, 0x35, 0xe8, 0xf2, \
+  0xcf, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_SC_Model 258u
+const dds_topic_descriptor_t SC_Model_desc =
+{
+  .m_size = sizeof (SC_Model),
+  .m_align = dds_alignof (SC_Model),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "SC_Model",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = SC_Model_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SC_Model, .sz = TYPE_INFO_CDR_SZ_SC_Model },
+  .type_mapping = { .data = TYPE_MAP_CDR_SC_Model, .sz = TYPE_MAP_CDR_SZ_SC_Model }
+};
+
+static const uint32_t NSC_Model_ops [] =
+{
+  /* NSC_Model */
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (NSC_Model, a),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (NSC_Model, b),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (NSC_Model, c),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d63c644e7cdfe5a80a8cc613dff4] (#deps: 0)
+  [COMPLETE 90c7e3515d4890a09150e931eb96] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_NSC_Model (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd6, 0x3c, 0x64, 0x4e, 0x7c, 0xdf, 0xe5, 0xa8, 0x0a, 0x8c, 0xc6, \
+  0x13, 0xdf, 0xf4, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x90, 0xc7, 0xe3, 0x51, 0x5d, 0x48, 0x90, 0xa0, 0x91, 0x50, 0xe9, \
+  0x31, 0xeb, 0x96, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_NSC_Model 100u
+#define TYPE_MAP_CDR_NSC_Model (const unsigned char []){ \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xd6, 0x3c, 0x64, 0x4e, 0x7c, 0xdf, 0xe5, \
+  0xa8, 0x0a, 0x8c, 0xc6, 0x13, 0xdf, 0xf4, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x0c, 0xc1, 0x75, 0xb9, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x4a, 0x8a, 0x08, 0xf0, \
+  0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x90, 0xc7, 0xe3, 0x51, 0x5d, 0x48, 0x90, \
+  0xa0, 0x91, 0x50, 0xe9, 0x31, 0xeb, 0x96, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x43, 0x5f, \
+  0x4d, 0x6f, 0x64, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x90, 0xc7, 0xe3, 0x51, 0x5d, 0x48, 0x90, 0xa0, 0x91, 0x50, 0xe9, \
+  0x31, 0xeb, 0x96, 0xf1, 0xd6, 0x3c, 0x64, 0x4e, 0x7c, 0xdf, 0xe5, 0xa8, 0x0a, 0x8c, 0xc6, 0x13, \
+  0xdf, 0xf4\
+}
+#define TYPE_MAP_CDR_SZ_NSC_Model 258u
+const dds_topic_descriptor_t NSC_Model_desc =
+{
+  .m_size = sizeof (NSC_Model),
+  .m_align = dds_alignof (NSC_Model),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "NSC_Model",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = NSC_Model_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_NSC_Model, .sz = TYPE_INFO_CDR_SZ_NSC_Model },
+  .type_mapping = { .data = TYPE_MAP_CDR_NSC_Model, .sz = TYPE_MAP_CDR_SZ_NSC_Model }
+};
+
+static const uint32_t PsmxType1_ops [] =
+{
+  /* PsmxType1 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (PsmxType1, xy), (3u << 16u) + 6u /* PsmxType1xy */,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (PsmxType1, z),
+  DDS_OP_RTS,
+
+  /* PsmxType1xy */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (PsmxType1xy, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (PsmxType1xy, y),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 704d42bda1c5e6d40cf3ec3861dc] (#deps: 1)
+   - [MINIMAL 332b9d3fb9a45a253377902bc20e]
+  [COMPLETE bb440d1c0506bd8ca75514d8d7e2] (#deps: 1)
+   - [COMPLETE fe46f9c13f81378f84f4798f8ab2]
+*/
+#define TYPE_INFO_CDR_PsmxType1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x70, 0x4d, 0x42, 0xbd, 0xa1, 0xc5, 0xe6, 0xd4, 0x0c, 0xf3, 0xec, \
+  0x38, 0x61, 0xdc, 0x00, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, \
+  0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0x44, 0x0d, \
+  0x1c, 0x05, 0x06, 0xbd, 0x8c, 0xa7, 0x55, 0x14, 0xd8, 0xd7, 0xe2, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, \
+  0x50, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_PsmxType1 148u
+#define TYPE_MAP_CDR_PsmxType1 (const unsigned char []){ \
+  0xa3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x70, 0x4d, 0x42, 0xbd, 0xa1, 0xc5, 0xe6, \
+  0xd4, 0x0c, 0xf3, 0xec, 0x38, 0x61, 0xdc, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, \
+  0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x3e, 0x44, 0x10, 0x71, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, \
+  0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x41, 0x52, 0x90, 0x76, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xbb, 0x44, 0x0d, 0x1c, 0x05, 0x06, 0xbd, 0x8c, 0xa7, 0x55, 0x14, 0xd8, 0xd7, 0xe2, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x54, 0x79, 0x70, 0x65, 0x31, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, \
+  0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, \
+  0x8f, 0x8a, 0xb2, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x54, 0x79, 0x70, 0x65, \
+  0x31, 0x78, 0x79, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbb, 0x44, 0x0d, \
+  0x1c, 0x05, 0x06, 0xbd, 0x8c, 0xa7, 0x55, 0x14, 0xd8, 0xd7, 0xe2, 0xf1, 0x70, 0x4d, 0x42, 0xbd, \
+  0xa1, 0xc5, 0xe6, 0xd4, 0x0c, 0xf3, 0xec, 0x38, 0x61, 0xdc, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, \
+  0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, \
+  0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_PsmxType1 456u
+const dds_topic_descriptor_t PsmxType1_desc =
+{
+  .m_size = sizeof (PsmxType1),
+  .m_align = dds_alignof (PsmxType1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "PsmxType1",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = PsmxType1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_PsmxType1, .sz = TYPE_INFO_CDR_SZ_PsmxType1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_PsmxType1, .sz = TYPE_MAP_CDR_SZ_PsmxType1 }
+};
+
+static const uint32_t PsmxKeySupportCheck_ops [] =
+{
+  /* PsmxKeySupportCheck */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (PsmxKeySupportCheck, k),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t PsmxKeySupportCheck_keys[1] =
+{
+  { "k", 3, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 7bd3514b967b22299af7acff4344] (#deps: 0)
+  [COMPLETE 24773bd6ceac877668a8e4691c54] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_PsmxKeySupportCheck (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xd3, 0x51, 0x4b, 0x96, 0x7b, 0x22, 0x29, 0x9a, 0xf7, 0xac, \
+  0xff, 0x43, 0x44, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x77, 0x3b, 0xd6, 0xce, 0xac, 0x87, 0x76, 0x68, 0xa8, 0xe4, \
+  0x69, 0x1c, 0x54, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_PsmxKeySupportCheck 100u
+#define TYPE_MAP_CDR_PsmxKeySupportCheck (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xd3, 0x51, 0x4b, 0x96, 0x7b, 0x22, \
+  0x29, 0x9a, 0xf7, 0xac, 0xff, 0x43, 0x44, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x77, 0x3b, 0xd6, 0xce, 0xac, 0x87, \
+  0x76, 0x68, 0xa8, 0xe4, 0x69, 0x1c, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, \
+  0x4b, 0x65, 0x79, 0x53, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x77, 0x3b, 0xd6, 0xce, 0xac, 0x87, 0x76, 0x68, 0xa8, 0xe4, \
+  0x69, 0x1c, 0x54, 0xf1, 0x7b, 0xd3, 0x51, 0x4b, 0x96, 0x7b, 0x22, 0x29, 0x9a, 0xf7, 0xac, 0xff, \
+  0x43, 0x44\
+}
+#define TYPE_MAP_CDR_SZ_PsmxKeySupportCheck 194u
+const dds_topic_descriptor_t PsmxKeySupportCheck_desc =
+{
+  .m_size = sizeof (PsmxKeySupportCheck),
+  .m_align = dds_alignof (PsmxKeySupportCheck),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "PsmxKeySupportCheck",
+  .m_keys = PsmxKeySupportCheck_keys,
+  .m_nops = 2,
+  .m_ops = PsmxKeySupportCheck_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_PsmxKeySupportCheck, .sz = TYPE_INFO_CDR_SZ_PsmxKeySupportCheck },
+  .type_mapping = { .data = TYPE_MAP_CDR_PsmxKeySupportCheck, .sz = TYPE_MAP_CDR_SZ_PsmxKeySupportCheck }
+};
+
+static const uint32_t PsmxLoanTest0_ops [] =
+{
+  /* PsmxLoanTest0 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (PsmxLoanTest0, xy), (3u << 16u) + 6u /* PsmxType1xy */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (PsmxLoanTest0, z),
+  DDS_OP_RTS,
+
+  /* PsmxType1xy */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (PsmxType1xy, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (PsmxType1xy, y),
+  DDS_OP_RTS,
+  
+  /* key: z */
+  DDS_OP_KOF | 1, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t PsmxLoanTest0_keys[1] =
+{
+  { "z", 11, 0 }
+};
+
+/* Type Information:
+  [MINIMAL c7b3522e0a9bf0f86f7da259dcb1] (#deps: 1)
+   - [MINIMAL 332b9d3fb9a45a253377902bc20e]
+  [COMPLETE 4391d868021ecedeb164712efa75] (#deps: 1)
+   - [COMPLETE fe46f9c13f81378f84f4798f8ab2]
+*/
+#define TYPE_INFO_CDR_PsmxLoanTest0 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc7, 0xb3, 0x52, 0x2e, 0x0a, 0x9b, 0xf0, 0xf8, 0x6f, 0x7d, 0xa2, \
+  0x59, 0xdc, 0xb1, 0x00, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, \
+  0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x43, 0x91, 0xd8, \
+  0x68, 0x02, 0x1e, 0xce, 0xde, 0xb1, 0x64, 0x71, 0x2e, 0xfa, 0x75, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, \
+  0x50, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_PsmxLoanTest0 148u
+#define TYPE_MAP_CDR_PsmxLoanTest0 (const unsigned char []){ \
+  0xa3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xc7, 0xb3, 0x52, 0x2e, 0x0a, 0x9b, 0xf0, \
+  0xf8, 0x6f, 0x7d, 0xa2, 0x59, 0xdc, 0xb1, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, \
+  0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x3e, 0x44, 0x10, 0x71, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, \
+  0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x41, 0x52, 0x90, 0x76, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x43, 0x91, 0xd8, 0x68, 0x02, 0x1e, 0xce, 0xde, 0xb1, 0x64, 0x71, 0x2e, 0xfa, 0x75, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x4c, 0x6f, 0x61, 0x6e, 0x54, 0x65, 0x73, 0x74, \
+  0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, \
+  0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x79, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, \
+  0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, \
+  0x54, 0x79, 0x70, 0x65, 0x31, 0x78, 0x79, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x43, 0x91, 0xd8, 0x68, 0x02, 0x1e, 0xce, 0xde, 0xb1, 0x64, 0x71, 0x2e, 0xfa, 0x75, 0xf1, \
+  0xc7, 0xb3, 0x52, 0x2e, 0x0a, 0x9b, 0xf0, 0xf8, 0x6f, 0x7d, 0xa2, 0x59, 0xdc, 0xb1, 0xf2, 0xfe, \
+  0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0xf1, 0x33, 0x2b, \
+  0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_PsmxLoanTest0 460u
+const dds_topic_descriptor_t PsmxLoanTest0_desc =
+{
+  .m_size = sizeof (PsmxLoanTest0),
+  .m_align = dds_alignof (PsmxLoanTest0),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "PsmxLoanTest0",
+  .m_keys = PsmxLoanTest0_keys,
+  .m_nops = 6,
+  .m_ops = PsmxLoanTest0_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_PsmxLoanTest0, .sz = TYPE_INFO_CDR_SZ_PsmxLoanTest0 },
+  .type_mapping = { .data = TYPE_MAP_CDR_PsmxLoanTest0, .sz = TYPE_MAP_CDR_SZ_PsmxLoanTest0 }
+};
+
+static const uint32_t PsmxLoanTest1_ops [] =
+{
+  /* PsmxLoanTest1 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (PsmxLoanTest1, xy), (3u << 16u) + 8u /* PsmxType1xy */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (PsmxLoanTest1, z),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (PsmxLoanTest1, str),
+  DDS_OP_RTS,
+
+  /* PsmxType1xy */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (PsmxType1xy, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (PsmxType1xy, y),
+  DDS_OP_RTS,
+  
+  /* key: z */
+  DDS_OP_KOF | 1, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t PsmxLoanTest1_keys[1] =
+{
+  { "z", 13, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 5b3a260142e73301186265a62855] (#deps: 1)
+   - [MINIMAL 332b9d3fb9a45a253377902bc20e]
+  [COMPLETE 522514217cc93b971f998b309e1b] (#deps: 1)
+   - [COMPLETE fe46f9c13f81378f84f4798f8ab2]
+*/
+#define TYPE_INFO_CDR_PsmxLoanTest1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x3a, 0x26, 0x01, 0x42, 0xe7, 0x33, 0x01, 0x18, 0x62, 0x65, \
+  0xa6, 0x28, 0x55, 0x00, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, \
+  0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x25, 0x14, \
+  0x21, 0x7c, 0xc9, 0x3b, 0x97, 0x1f, 0x99, 0x8b, 0x30, 0x9e, 0x1b, 0x00, 0x7e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, \
+  0x50, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_PsmxLoanTest1 148u
+#define TYPE_MAP_CDR_PsmxLoanTest1 (const unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x3a, 0x26, 0x01, 0x42, 0xe7, 0x33, \
+  0x01, 0x18, 0x62, 0x65, 0xa6, 0x28, 0x55, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, \
+  0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x3e, 0x44, 0x10, 0x71, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0xfb, 0xad, 0xe9, 0xe3, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x34, 0x1b, 0xe9, 0x7d, \
+  0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x41, 0x52, 0x90, 0x76, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x25, 0x14, 0x21, 0x7c, 0xc9, 0x3b, 0x97, 0x1f, 0x99, 0x8b, 0x30, 0x9e, 0x1b, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x4c, 0x6f, 0x61, 0x6e, 0x54, 0x65, 0x73, 0x74, \
+  0x31, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, \
+  0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x79, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0xf2, 0xfe, \
+  0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x00, 0x00, \
+  0x4c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x54, 0x79, 0x70, 0x65, 0x31, 0x78, 0x79, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x25, 0x14, 0x21, 0x7c, 0xc9, 0x3b, \
+  0x97, 0x1f, 0x99, 0x8b, 0x30, 0x9e, 0x1b, 0xf1, 0x5b, 0x3a, 0x26, 0x01, 0x42, 0xe7, 0x33, 0x01, \
+  0x18, 0x62, 0x65, 0xa6, 0x28, 0x55, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, \
+  0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, \
+  0x90, 0x2b, 0xc2, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_PsmxLoanTest1 500u
+const dds_topic_descriptor_t PsmxLoanTest1_desc =
+{
+  .m_size = sizeof (PsmxLoanTest1),
+  .m_align = dds_alignof (PsmxLoanTest1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "PsmxLoanTest1",
+  .m_keys = PsmxLoanTest1_keys,
+  .m_nops = 7,
+  .m_ops = PsmxLoanTest1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_PsmxLoanTest1, .sz = TYPE_INFO_CDR_SZ_PsmxLoanTest1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_PsmxLoanTest1, .sz = TYPE_MAP_CDR_SZ_PsmxLoanTest1 }
+};
+
+static const uint32_t PsmxLoanTest2_ops [] =
+{
+  /* PsmxLoanTest2 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (PsmxLoanTest2, xy), (3u << 16u) + 8u /* PsmxType1xy */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (PsmxLoanTest2, z),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (PsmxLoanTest2, str),
+  DDS_OP_RTS,
+
+  /* PsmxType1xy */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (PsmxType1xy, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (PsmxType1xy, y),
+  DDS_OP_RTS,
+  
+  /* key: z */
+  DDS_OP_KOF | 1, 3u /* order: 1 */,
+  
+  /* key: str */
+  DDS_OP_KOF | 1, 5u /* order: 2 */
+};
+
+static const dds_key_descriptor_t PsmxLoanTest2_keys[2] =
+{
+  { "z", 13, 0 },
+  { "str", 15, 1 }
+};
+
+/* Type Information:
+  [MINIMAL d3a78b1a42dd084c6e85a1e2b1bc] (#deps: 1)
+   - [MINIMAL 332b9d3fb9a45a253377902bc20e]
+  [COMPLETE 7d553698c0a13c12ce9e0aa292e1] (#deps: 1)
+   - [COMPLETE fe46f9c13f81378f84f4798f8ab2]
+*/
+#define TYPE_INFO_CDR_PsmxLoanTest2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0xa7, 0x8b, 0x1a, 0x42, 0xdd, 0x08, 0x4c, 0x6e, 0x85, 0xa1, \
+  0xe2, 0xb1, 0xbc, 0x00, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, \
+  0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0x55, 0x36, \
+  0x98, 0xc0, 0xa1, 0x3c, 0x12, 0xce, 0x9e, 0x0a, 0xa2, 0x92, 0xe1, 0x00, 0x7e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, \
+  0x50, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_PsmxLoanTest2 148u
+#define TYPE_MAP_CDR_PsmxLoanTest2 (const unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0xa7, 0x8b, 0x1a, 0x42, 0xdd, 0x08, \
+  0x4c, 0x6e, 0x85, 0xa1, 0xe2, 0xb1, 0xbc, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, \
+  0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x3e, 0x44, 0x10, 0x71, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0xfb, 0xad, 0xe9, 0xe3, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x34, 0x1b, 0xe9, 0x7d, \
+  0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, 0x90, 0x2b, 0xc2, 0x0e, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x41, 0x52, 0x90, 0x76, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x7d, 0x55, 0x36, 0x98, 0xc0, 0xa1, 0x3c, 0x12, 0xce, 0x9e, 0x0a, 0xa2, 0x92, 0xe1, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x4c, 0x6f, 0x61, 0x6e, 0x54, 0x65, 0x73, 0x74, \
+  0x32, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, \
+  0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x79, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0xf2, 0xfe, \
+  0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, 0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0x00, 0x00, 0x00, \
+  0x4c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x50, 0x73, 0x6d, 0x78, 0x54, 0x79, 0x70, 0x65, 0x31, 0x78, 0x79, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0x55, 0x36, 0x98, 0xc0, 0xa1, 0x3c, \
+  0x12, 0xce, 0x9e, 0x0a, 0xa2, 0x92, 0xe1, 0xf1, 0xd3, 0xa7, 0x8b, 0x1a, 0x42, 0xdd, 0x08, 0x4c, \
+  0x6e, 0x85, 0xa1, 0xe2, 0xb1, 0xbc, 0xf2, 0xfe, 0x46, 0xf9, 0xc1, 0x3f, 0x81, 0x37, 0x8f, 0x84, \
+  0xf4, 0x79, 0x8f, 0x8a, 0xb2, 0xf1, 0x33, 0x2b, 0x9d, 0x3f, 0xb9, 0xa4, 0x5a, 0x25, 0x33, 0x77, \
+  0x90, 0x2b, 0xc2, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_PsmxLoanTest2 500u
+const dds_topic_descriptor_t PsmxLoanTest2_desc =
+{
+  .m_size = sizeof (PsmxLoanTest2),
+  .m_align = dds_alignof (PsmxLoanTest2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "PsmxLoanTest2",
+  .m_keys = PsmxLoanTest2_keys,
+  .m_nops = 7,
+  .m_ops = PsmxLoanTest2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_PsmxLoanTest2, .sz = TYPE_INFO_CDR_SZ_PsmxLoanTest2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_PsmxLoanTest2, .sz = TYPE_MAP_CDR_SZ_PsmxLoanTest2 }
+};
+
@@ -0,0 +1,1863 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/SerdataData.c
+  Source: /root/repo/src/core/ddsc/tests/SerdataData.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "SerdataData.h"
+
+static const uint32_t SerdataKeyOrder_ops [] =
+{
+  /* SerdataKeyOrder */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrder, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrder_keys[2] =
+{
+  { "a", 7, 0 },
+  { "c", 9, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 6a6640081ba9f8b20761b69699a0] (#deps: 0)
+  [COMPLETE 642613ebaa9f16c7c17b927edd5f] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrder (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, \
+  0x96, 0x99, 0xa0, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, \
+  0x7e, 0xdd, 0x5f, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrder 100u
+#define TYPE_MAP_CDR_SerdataKeyOrder (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, \
+  0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x7c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, \
+  0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, \
+  0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, \
+  0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrder 262u
+const dds_topic_descriptor_t SerdataKeyOrder_desc =
+{
+  .m_size = sizeof (SerdataKeyOrder),
+  .m_align = dds_alignof (SerdataKeyOrder),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyOrder",
+  .m_keys = SerdataKeyOrder_keys,
+  .m_nops = 4,
+  .m_ops = SerdataKeyOrder_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrder, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrder },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrder, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrder }
+};
+
+static const uint32_t SerdataKeyOrderId_ops [] =
+{
+  /* SerdataKeyOrderId */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderId, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderId, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderId, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 2 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderId_keys[2] =
+{
+  { "c", 9, 1 },
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 9330a5eb7de9f7aaff2439526777] (#deps: 0)
+  [COMPLETE df8fbdc0c7add49d64e240506c72] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderId (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x30, 0xa5, 0xeb, 0x7d, 0xe9, 0xf7, 0xaa, 0xff, 0x24, 0x39, \
+  0x52, 0x67, 0x77, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x8f, 0xbd, 0xc0, 0xc7, 0xad, 0xd4, 0x9d, 0x64, 0xe2, 0x40, \
+  0x50, 0x6c, 0x72, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderId 100u
+#define TYPE_MAP_CDR_SerdataKeyOrderId (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x30, 0xa5, 0xeb, 0x7d, 0xe9, 0xf7, \
+  0xaa, 0xff, 0x24, 0x39, 0x52, 0x67, 0x77, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x8f, 0xbd, 0xc0, 0xc7, 0xad, 0xd4, \
+  0x9d, 0x64, 0xe2, 0x40, 0x50, 0x6c, 0x72, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x49, 0x64, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x8f, 0xbd, \
+  0xc0, 0xc7, 0xad, 0xd4, 0x9d, 0x64, 0xe2, 0x40, 0x50, 0x6c, 0x72, 0xf1, 0x93, 0x30, 0xa5, 0xeb, \
+  0x7d, 0xe9, 0xf7, 0xaa, 0xff, 0x24, 0x39, 0x52, 0x67, 0x77\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderId 266u
+const dds_topic_descriptor_t SerdataKeyOrderId_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderId),
+  .m_align = dds_alignof (SerdataKeyOrderId),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyOrderId",
+  .m_keys = SerdataKeyOrderId_keys,
+  .m_nops = 4,
+  .m_ops = SerdataKeyOrderId_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderId, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderId },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderId, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderId }
+};
+
+static const uint32_t SerdataKeyOrderHashId_ops [] =
+{
+  /* SerdataKeyOrderHashId */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderHashId, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderHashId, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderHashId, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 158712076 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 4u /* order: 559690 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderHashId_keys[2] =
+{
+  { "c", 9, 1 },
+  { "a", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 067c4938ad6072f5c4efa087c541] (#deps: 0)
+  [COMPLETE 94326ea0a46797bd4a9f66785804] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderHashId (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x06, 0x7c, 0x49, 0x38, 0xad, 0x60, 0x72, 0xf5, 0xc4, 0xef, 0xa0, \
+  0x87, 0xc5, 0x41, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x32, 0x6e, 0xa0, 0xa4, 0x67, 0x97, 0xbd, 0x4a, 0x9f, 0x66, \
+  0x78, 0x58, 0x04, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderHashId 100u
+#define TYPE_MAP_CDR_SerdataKeyOrderHashId (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x06, 0x7c, 0x49, 0x38, 0xad, 0x60, 0x72, \
+  0xf5, 0xc4, 0xef, 0xa0, 0x87, 0xc5, 0x41, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x11, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0c, 0xc1, 0x75, 0x09, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x92, 0xeb, 0x5f, 0x0e, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x4a, 0x8a, 0x08, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x32, 0x6e, 0xa0, 0xa4, 0x67, 0x97, \
+  0xbd, 0x4a, 0x9f, 0x66, 0x78, 0x58, 0x04, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x11, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x48, 0x61, 0x73, 0x68, 0x49, \
+  0x64, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x0c, 0xc1, 0x75, 0x09, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x92, 0xeb, 0x5f, 0x0e, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0x8a, 0x08, 0x00, 0x31, 0x00, 0x08, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x94, 0x32, 0x6e, 0xa0, 0xa4, 0x67, 0x97, 0xbd, 0x4a, 0x9f, 0x66, 0x78, 0x58, 0x04, 0xf1, \
+  0x06, 0x7c, 0x49, 0x38, 0xad, 0x60, 0x72, 0xf5, 0xc4, 0xef, 0xa0, 0x87, 0xc5, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderHashId 270u
+const dds_topic_descriptor_t SerdataKeyOrderHashId_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderHashId),
+  .m_align = dds_alignof (SerdataKeyOrderHashId),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyOrderHashId",
+  .m_keys = SerdataKeyOrderHashId_keys,
+  .m_nops = 4,
+  .m_ops = SerdataKeyOrderHashId_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderHashId, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderHashId },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderHashId, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderHashId }
+};
+
+static const uint32_t SerdataKeyOrderAppendable_ops [] =
+{
+  /* SerdataKeyOrderAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendable, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendable, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderAppendable, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 3 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 5u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderAppendable_keys[2] =
+{
+  { "c", 10, 1 },
+  { "a", 8, 0 }
+};
+
+/* Type Information:
+  [MINIMAL a242c3e5f72e2c0eca8967cbe1e4] (#deps: 0)
+  [COMPLETE fc1b2da2fbf5e9e0f097ea035881] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderAppendable (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, 0x2e, 0x2c, 0x0e, 0xca, 0x89, 0x67, \
+  0xcb, 0xe1, 0xe4, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, 0x97, 0xea, \
+  0x03, 0x58, 0x81, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderAppendable 100u
+#define TYPE_MAP_CDR_SerdataKeyOrderAppendable (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, 0x2e, 0x2c, \
+  0x0e, 0xca, 0x89, 0x67, 0xcb, 0xe1, 0xe4, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, \
+  0xe0, 0xf0, 0x97, 0xea, 0x03, 0x58, 0x81, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x41, 0x70, 0x70, 0x65, 0x6e, \
+  0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, 0x97, 0xea, \
+  0x03, 0x58, 0x81, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, 0x2e, 0x2c, 0x0e, 0xca, 0x89, 0x67, 0xcb, \
+  0xe1, 0xe4\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderAppendable 274u
+const dds_topic_descriptor_t SerdataKeyOrderAppendable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderAppendable),
+  .m_align = dds_alignof (SerdataKeyOrderAppendable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyOrderAppendable",
+  .m_keys = SerdataKeyOrderAppendable_keys,
+  .m_nops = 5,
+  .m_ops = SerdataKeyOrderAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderAppendable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderAppendable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderAppendable }
+};
+
+static const uint32_t SerdataKeyOrderMutable_ops [] =
+{
+  /* SerdataKeyOrderMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, a),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, b),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderMutable, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 8u /* order: 3 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 14u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderMutable_keys[2] =
+{
+  { "c", 19, 1 },
+  { "a", 17, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 754daa47d585b8bcea5444495ec5] (#deps: 0)
+  [COMPLETE 7cab391f30550f8dc617090f8892] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderMutable (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, \
+  0x49, 0x5e, 0xc5, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, \
+  0x0f, 0x88, 0x92, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderMutable 100u
+#define TYPE_MAP_CDR_SerdataKeyOrderMutable (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, \
+  0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, \
+  0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, 0x75, 0x74, 0x61, 0x62, \
+  0x6c, 0x65, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0xf1, \
+  0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderMutable 270u
+const dds_topic_descriptor_t SerdataKeyOrderMutable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderMutable),
+  .m_align = dds_alignof (SerdataKeyOrderMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyOrderMutable",
+  .m_keys = SerdataKeyOrderMutable_keys,
+  .m_nops = 8,
+  .m_ops = SerdataKeyOrderMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderMutable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderMutable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderMutable }
+};
+
+static const uint32_t SerdataKeyString_ops [] =
+{
+  /* SerdataKeyString */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyString, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (SerdataKeyString, b),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyString_keys[2] =
+{
+  { "a", 5, 0 },
+  { "b", 7, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 9606f6f40508bfc272ae46e5d379] (#deps: 0)
+  [COMPLETE 4c87979342158bebb4607e4730bb] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyString (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x96, 0x06, 0xf6, 0xf4, 0x05, 0x08, 0xbf, 0xc2, 0x72, 0xae, 0x46, \
+  0xe5, 0xd3, 0x79, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x87, 0x97, 0x93, 0x42, 0x15, 0x8b, 0xeb, 0xb4, 0x60, 0x7e, \
+  0x47, 0x30, 0xbb, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyString 100u
+#define TYPE_MAP_CDR_SerdataKeyString (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x96, 0x06, 0xf6, 0xf4, 0x05, 0x08, 0xbf, \
+  0xc2, 0x72, 0xae, 0x46, 0xe5, 0xd3, 0x79, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x87, 0x97, 0x93, 0x42, 0x15, 0x8b, \
+  0xeb, 0xb4, 0x60, 0x7e, 0x47, 0x30, 0xbb, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x87, 0x97, 0x93, 0x42, 0x15, 0x8b, \
+  0xeb, 0xb4, 0x60, 0x7e, 0x47, 0x30, 0xbb, 0xf1, 0x96, 0x06, 0xf6, 0xf4, 0x05, 0x08, 0xbf, 0xc2, \
+  0x72, 0xae, 0x46, 0xe5, 0xd3, 0x79\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyString 230u
+const dds_topic_descriptor_t SerdataKeyString_desc =
+{
+  .m_size = sizeof (SerdataKeyString),
+  .m_align = dds_alignof (SerdataKeyString),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyString",
+  .m_keys = SerdataKeyString_keys,
+  .m_nops = 3,
+  .m_ops = SerdataKeyString_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyString, .sz = TYPE_INFO_CDR_SZ_SerdataKeyString },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyString, .sz = TYPE_MAP_CDR_SZ_SerdataKeyString }
+};
+
+static const uint32_t SerdataKeyStringBounded_ops [] =
+{
+  /* SerdataKeyStringBounded */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyStringBounded, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (SerdataKeyStringBounded, b), 4u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyStringBounded_keys[2] =
+{
+  { "a", 6, 0 },
+  { "b", 8, 1 }
+};
+
+/* Type Information:
+  [MINIMAL ec841c00636572b6b575b26733e4] (#deps: 0)
+  [COMPLETE f6aefb25db557f3bfde495f09cda] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyStringBounded (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xec, 0x84, 0x1c, 0x00, 0x63, 0x65, 0x72, 0xb6, 0xb5, 0x75, 0xb2, \
+  0x67, 0x33, 0xe4, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xae, 0xfb, 0x25, 0xdb, 0x55, 0x7f, 0x3b, 0xfd, 0xe4, 0x95, \
+  0xf0, 0x9c, 0xda, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyStringBounded 100u
+#define TYPE_MAP_CDR_SerdataKeyStringBounded (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xec, 0x84, 0x1c, 0x00, 0x63, 0x65, 0x72, \
+  0xb6, 0xb5, 0x75, 0xb2, 0x67, 0x33, 0xe4, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xae, 0xfb, 0x25, 0xdb, 0x55, 0x7f, \
+  0x3b, 0xfd, 0xe4, 0x95, 0xf0, 0x9c, 0xda, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x6f, 0x75, 0x6e, \
+  0x64, 0x65, 0x64, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xae, 0xfb, \
+  0x25, 0xdb, 0x55, 0x7f, 0x3b, 0xfd, 0xe4, 0x95, 0xf0, 0x9c, 0xda, 0xf1, 0xec, 0x84, 0x1c, 0x00, \
+  0x63, 0x65, 0x72, 0xb6, 0xb5, 0x75, 0xb2, 0x67, 0x33, 0xe4\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyStringBounded 234u
+const dds_topic_descriptor_t SerdataKeyStringBounded_desc =
+{
+  .m_size = sizeof (SerdataKeyStringBounded),
+  .m_align = dds_alignof (SerdataKeyStringBounded),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyStringBounded",
+  .m_keys = SerdataKeyStringBounded_keys,
+  .m_nops = 3,
+  .m_ops = SerdataKeyStringBounded_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyStringBounded, .sz = TYPE_INFO_CDR_SZ_SerdataKeyStringBounded },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyStringBounded, .sz = TYPE_MAP_CDR_SZ_SerdataKeyStringBounded }
+};
+
+static const uint32_t SerdataKeyStringAppendable_ops [] =
+{
+  /* SerdataKeyStringAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyStringAppendable, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (SerdataKeyStringAppendable, b),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyStringAppendable_keys[2] =
+{
+  { "a", 6, 0 },
+  { "b", 8, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 1da91cd3823c1adf7d5ea34e752a] (#deps: 0)
+  [COMPLETE 1ef1c8e0327401b0c92a6b8621cd] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyStringAppendable (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0xa9, 0x1c, 0xd3, 0x82, 0x3c, 0x1a, 0xdf, 0x7d, 0x5e, 0xa3, \
+  0x4e, 0x75, 0x2a, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0xf1, 0xc8, 0xe0, 0x32, 0x74, 0x01, 0xb0, 0xc9, 0x2a, 0x6b, \
+  0x86, 0x21, 0xcd, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyStringAppendable 100u
+#define TYPE_MAP_CDR_SerdataKeyStringAppendable (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0xa9, 0x1c, 0xd3, 0x82, 0x3c, 0x1a, \
+  0xdf, 0x7d, 0x5e, 0xa3, 0x4e, 0x75, 0x2a, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1e, 0xf1, 0xc8, 0xe0, 0x32, 0x74, 0x01, \
+  0xb0, 0xc9, 0x2a, 0x6b, 0x86, 0x21, 0xcd, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x41, 0x70, 0x70, 0x65, \
+  0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x1e, 0xf1, 0xc8, 0xe0, 0x32, 0x74, 0x01, 0xb0, 0xc9, 0x2a, 0x6b, 0x86, 0x21, 0xcd, 0xf1, \
+  0x1d, 0xa9, 0x1c, 0xd3, 0x82, 0x3c, 0x1a, 0xdf, 0x7d, 0x5e, 0xa3, 0x4e, 0x75, 0x2a\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyStringAppendable 238u
+const dds_topic_descriptor_t SerdataKeyStringAppendable_desc =
+{
+  .m_size = sizeof (SerdataKeyStringAppendable),
+  .m_align = dds_alignof (SerdataKeyStringAppendable),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyStringAppendable",
+  .m_keys = SerdataKeyStringAppendable_keys,
+  .m_nops = 4,
+  .m_ops = SerdataKeyStringAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyStringAppendable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyStringAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyStringAppendable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyStringAppendable }
+};
+
+static const uint32_t SerdataKeyStringBoundedAppendable_ops [] =
+{
+  /* SerdataKeyStringBoundedAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyStringBoundedAppendable, a),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (SerdataKeyStringBoundedAppendable, b), 4u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 1u /* order: 0 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 3u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyStringBoundedAppendable_keys[2] =
+{
+  { "a", 7, 0 },
+  { "b", 9, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 203b42f2f685d4eb41034617c269] (#deps: 0)
+  [COMPLETE 53e4b874318147edadceb8531f1c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyStringBoundedAppendable (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x20, 0x3b, 0x42, 0xf2, 0xf6, 0x85, 0xd4, 0xeb, 0x41, 0x03, 0x46, \
+  0x17, 0xc2, 0x69, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x53, 0xe4, 0xb8, 0x74, 0x31, 0x81, 0x47, 0xed, 0xad, 0xce, 0xb8, \
+  0x53, 0x1f, 0x1c, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyStringBoundedAppendable 100u
+#define TYPE_MAP_CDR_SerdataKeyStringBoundedAppendable (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x20, 0x3b, 0x42, 0xf2, 0xf6, 0x85, 0xd4, \
+  0xeb, 0x41, 0x03, 0x46, 0x17, 0xc2, 0x69, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x7c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x53, 0xe4, 0xb8, 0x74, 0x31, 0x81, 0x47, \
+  0xed, 0xad, 0xce, 0xb8, 0x53, 0x1f, 0x1c, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x6f, 0x75, 0x6e, \
+  0x64, 0x65, 0x64, 0x41, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x53, 0xe4, 0xb8, 0x74, 0x31, 0x81, 0x47, \
+  0xed, 0xad, 0xce, 0xb8, 0x53, 0x1f, 0x1c, 0xf1, 0x20, 0x3b, 0x42, 0xf2, 0xf6, 0x85, 0xd4, 0xeb, \
+  0x41, 0x03, 0x46, 0x17, 0xc2, 0x69\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyStringBoundedAppendable 246u
+const dds_topic_descriptor_t SerdataKeyStringBoundedAppendable_desc =
+{
+  .m_size = sizeof (SerdataKeyStringBoundedAppendable),
+  .m_align = dds_alignof (SerdataKeyStringBoundedAppendable),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "SerdataKeyStringBoundedAppendable",
+  .m_keys = SerdataKeyStringBoundedAppendable_keys,
+  .m_nops = 4,
+  .m_ops = SerdataKeyStringBoundedAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyStringBoundedAppendable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyStringBoundedAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyStringBoundedAppendable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyStringBoundedAppendable }
+};
+
+static const uint32_t SerdataKeyArr_ops [] =
+{
+  /* SerdataKeyArr */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (SerdataKeyArr, a), 12u,
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t SerdataKeyArr_keys[1] =
+{
+  { "a", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 328aabfc395be691ddc4c367ad1f] (#deps: 0)
+  [COMPLETE 0597198dcb075e981f72a8a32e8a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_SerdataKeyArr (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x32, 0x8a, 0xab, 0xfc, 0x39, 0x5b, 0xe6, 0x91, 0xdd, 0xc4, 0xc3, \
+  0x67, 0xad, 0x1f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x97, 0x19, 0x8d, 0xcb, 0x07, 0x5e, 0x98, 0x1f, 0x72, 0xa8, \
+  0xa3, 0x2e, 0x8a, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyArr 100u
+#define TYPE_MAP_CDR_SerdataKeyArr (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x32, 0x8a, 0xab, 0xfc, 0x39, 0x5b, 0xe6, \
+  0x91, 0xdd, 0xc4, 0xc3, 0x67, 0xad, 0x1f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x97, 0x19, 0x8d, 0xcb, 0x07, 0x5e, 0x98, 0x1f, 0x72, 0xa8, \
+  0xa3, 0x2e, 0x8a, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x41, 0x72, 0x72, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x97, 0x19, 0x8d, 0xcb, 0x07, 0x5e, \
+  0x98, 0x1f, 0x72, 0xa8, 0xa3, 0x2e, 0x8a, 0xf1, 0x32, 0x8a, 0xab, 0xfc, 0x39, 0x5b, 0xe6, 0x91, \
+  0xdd, 0xc4, 0xc3, 0x67, 0xad, 0x1f\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyArr 214u
+const dds_topic_descriptor_t SerdataKeyArr_desc =
+{
+  .m_size = sizeof (SerdataKeyArr),
+  .m_align = dds_alignof (SerdataKeyArr),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "SerdataKeyArr",
+  .m_keys = SerdataKeyArr_keys,
+  .m_nops = 2,
+  .m_ops = SerdataKeyArr_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyArr, .sz = TYPE_INFO_CDR_SZ_SerdataKeyArr },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyArr, .sz = TYPE_MAP_CDR_SZ_SerdataKeyArr }
+};
+
+static const uint32_t SerdataKeyOrderFinalNestedMutable_ops [] =
+{
+  /* SerdataKeyOrderFinalNestedMutable */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderFinalNestedMutable, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderFinalNestedMutable, y),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyOrderFinalNestedMutable, z), (3u << 16u) + 4u /* SerdataKeyOrderMutable */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrderMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, a),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, b),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderMutable, c),
+  DDS_OP_RTS,
+  
+  /* key: x */
+  DDS_OP_KOF | 1, 0u /* order: 3 */,
+  
+  /* key: z.a */
+  DDS_OP_KOF | 2, 4u /* order: 1 */, 8u /* order: 3 */,
+  
+  /* key: z.c */
+  DDS_OP_KOF | 2, 4u /* order: 1 */, 14u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderFinalNestedMutable_keys[3] =
+{
+  { "z.c", 30, 2 },
+  { "z.a", 27, 1 },
+  { "x", 25, 0 }
+};
+
+/* Type Information:
+  [MINIMAL f249ce89b2ed300fe3fae134e86d] (#deps: 1)
+   - [MINIMAL 754daa47d585b8bcea5444495ec5]
+  [COMPLETE dc8a7d07680e2b0873be1ae60f43] (#deps: 1)
+   - [COMPLETE 7cab391f30550f8dc617090f8892]
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderFinalNestedMutable (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf2, 0x49, 0xce, 0x89, 0xb2, 0xed, 0x30, 0x0f, 0xe3, 0xfa, 0xe1, \
+  0x34, 0xe8, 0x6d, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, \
+  0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xdc, 0x8a, 0x7d, \
+  0x07, 0x68, 0x0e, 0x2b, 0x08, 0x73, 0xbe, 0x1a, 0xe6, 0x0f, 0x43, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, \
+  0x70, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderFinalNestedMutable 148u
+#define TYPE_MAP_CDR_SerdataKeyOrderFinalNestedMutable (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xf2, 0x49, 0xce, 0x89, 0xb2, 0xed, 0x30, \
+  0x0f, 0xe3, 0xfa, 0xe1, 0x34, 0xe8, 0x6d, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, \
+  0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x75, 0x4d, \
+  0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0x20, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xdc, 0x8a, 0x7d, \
+  0x07, 0x68, 0x0e, 0x2b, 0x08, 0x73, 0xbe, 0x1a, 0xe6, 0x0f, 0x43, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x46, \
+  0x69, 0x6e, 0x61, 0x6c, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, \
+  0x65, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x7c, \
+  0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, \
+  0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, 0x75, 0x74, 0x61, 0x62, \
+  0x6c, 0x65, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xdc, 0x8a, 0x7d, 0x07, 0x68, 0x0e, 0x2b, 0x08, 0x73, 0xbe, 0x1a, 0xe6, 0x0f, 0x43, 0xf1, \
+  0xf2, 0x49, 0xce, 0x89, 0xb2, 0xed, 0x30, 0x0f, 0xe3, 0xfa, 0xe1, 0x34, 0xe8, 0x6d, 0xf2, 0x7c, \
+  0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0xf1, 0x75, 0x4d, \
+  0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderFinalNestedMutable 556u
+const dds_topic_descriptor_t SerdataKeyOrderFinalNestedMutable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderFinalNestedMutable),
+  .m_align = dds_alignof (SerdataKeyOrderFinalNestedMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyOrderFinalNestedMutable",
+  .m_keys = SerdataKeyOrderFinalNestedMutable_keys,
+  .m_nops = 12,
+  .m_ops = SerdataKeyOrderFinalNestedMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderFinalNestedMutable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderFinalNestedMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderFinalNestedMutable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderFinalNestedMutable }
+};
+
+static const uint32_t SerdataKeyOrderAppendableNestedMutable_ops [] =
+{
+  /* SerdataKeyOrderAppendableNestedMutable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendableNestedMutable, x),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendableNestedMutable, y),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyOrderAppendableNestedMutable, z), (3u << 16u) + 4u /* SerdataKeyOrderMutable */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrderMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, a),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, b),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderMutable, c),
+  DDS_OP_RTS,
+  
+  /* key: x */
+  DDS_OP_KOF | 1, 1u /* order: 3 */,
+  
+  /* key: z.a */
+  DDS_OP_KOF | 2, 5u /* order: 1 */, 8u /* order: 3 */,
+  
+  /* key: z.c */
+  DDS_OP_KOF | 2, 5u /* order: 1 */, 14u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderAppendableNestedMutable_keys[3] =
+{
+  { "z.c", 31, 2 },
+  { "z.a", 28, 1 },
+  { "x", 26, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 3c261b294527f2d228b84a2dad2e] (#deps: 1)
+   - [MINIMAL 754daa47d585b8bcea5444495ec5]
+  [COMPLETE 8f5ac803c95e2807d003a5821950] (#deps: 1)
+   - [COMPLETE 7cab391f30550f8dc617090f8892]
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderAppendableNestedMutable (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3c, 0x26, 0x1b, 0x29, 0x45, 0x27, 0xf2, 0xd2, 0x28, 0xb8, 0x4a, \
+  0x2d, 0xad, 0x2e, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, \
+  0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5a, 0xc8, \
+  0x03, 0xc9, 0x5e, 0x28, 0x07, 0xd0, 0x03, 0xa5, 0x82, 0x19, 0x50, 0x00, 0x90, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, \
+  0x70, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderAppendableNestedMutable 148u
+#define TYPE_MAP_CDR_SerdataKeyOrderAppendableNestedMutable (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x3c, 0x26, 0x1b, 0x29, 0x45, 0x27, 0xf2, \
+  0xd2, 0x28, 0xb8, 0x4a, 0x2d, 0xad, 0x2e, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, \
+  0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x75, 0x4d, \
+  0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0x24, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5a, 0xc8, \
+  0x03, 0xc9, 0x5e, 0x28, 0x07, 0xd0, 0x03, 0xa5, 0x82, 0x19, 0x50, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x41, \
+  0x70, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, \
+  0x92, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0xab, 0x39, \
+  0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0x5a, 0xc8, 0x03, 0xc9, 0x5e, 0x28, 0x07, 0xd0, 0x03, 0xa5, \
+  0x82, 0x19, 0x50, 0xf1, 0x3c, 0x26, 0x1b, 0x29, 0x45, 0x27, 0xf2, 0xd2, 0x28, 0xb8, 0x4a, 0x2d, \
+  0xad, 0x2e, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, \
+  0x92, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderAppendableNestedMutable 560u
+const dds_topic_descriptor_t SerdataKeyOrderAppendableNestedMutable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderAppendableNestedMutable),
+  .m_align = dds_alignof (SerdataKeyOrderAppendableNestedMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyOrderAppendableNestedMutable",
+  .m_keys = SerdataKeyOrderAppendableNestedMutable_keys,
+  .m_nops = 13,
+  .m_ops = SerdataKeyOrderAppendableNestedMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderAppendableNestedMutable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderAppendableNestedMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderAppendableNestedMutable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderAppendableNestedMutable }
+};
+
+static const uint32_t SerdataKeyOrderMutableNestedMutable_ops [] =
+{
+  /* SerdataKeyOrderMutableNestedMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedMutable, x),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedMutable, y),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyOrderMutableNestedMutable, z), (3u << 16u) + 4u /* SerdataKeyOrderMutable */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrderMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, a),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutable, b),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderMutable, c),
+  DDS_OP_RTS,
+  
+  /* key: x */
+  DDS_OP_KOF | 1, 8u /* order: 3 */,
+  
+  /* key: z.a */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 8u /* order: 3 */,
+  
+  /* key: z.c */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 14u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderMutableNestedMutable_keys[3] =
+{
+  { "z.c", 40, 2 },
+  { "z.a", 37, 1 },
+  { "x", 35, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 17ecfcdd354e2e2d9da83004672e] (#deps: 1)
+   - [MINIMAL 754daa47d585b8bcea5444495ec5]
+  [COMPLETE d228780e1628f6c38fa841de4344] (#deps: 1)
+   - [COMPLETE 7cab391f30550f8dc617090f8892]
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderMutableNestedMutable (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x17, 0xec, 0xfc, 0xdd, 0x35, 0x4e, 0x2e, 0x2d, 0x9d, 0xa8, 0x30, \
+  0x04, 0x67, 0x2e, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, 0x85, 0xb8, \
+  0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0x28, 0x78, \
+  0x0e, 0x16, 0x28, 0xf6, 0xc3, 0x8f, 0xa8, 0x41, 0xde, 0x43, 0x44, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, \
+  0x70, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedMutable 148u
+#define TYPE_MAP_CDR_SerdataKeyOrderMutableNestedMutable (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x17, 0xec, 0xfc, 0xdd, 0x35, 0x4e, 0x2e, \
+  0x2d, 0x9d, 0xa8, 0x30, 0x04, 0x67, 0x2e, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x75, 0x4d, 0xaa, 0x47, 0xd5, \
+  0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x75, 0x4d, \
+  0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0x20, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0x28, 0x78, \
+  0x0e, 0x16, 0x28, 0xf6, 0xc3, 0x8f, 0xa8, 0x41, 0xde, 0x43, 0x44, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, \
+  0x62, 0x6c, 0x65, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x7c, \
+  0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, \
+  0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, 0x75, 0x74, 0x61, 0x62, \
+  0x6c, 0x65, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xd2, 0x28, 0x78, 0x0e, 0x16, 0x28, 0xf6, 0xc3, 0x8f, 0xa8, 0x41, 0xde, 0x43, 0x44, 0xf1, \
+  0x17, 0xec, 0xfc, 0xdd, 0x35, 0x4e, 0x2e, 0x2d, 0x9d, 0xa8, 0x30, 0x04, 0x67, 0x2e, 0xf2, 0x7c, \
+  0xab, 0x39, 0x1f, 0x30, 0x55, 0x0f, 0x8d, 0xc6, 0x17, 0x09, 0x0f, 0x88, 0x92, 0xf1, 0x75, 0x4d, \
+  0xaa, 0x47, 0xd5, 0x85, 0xb8, 0xbc, 0xea, 0x54, 0x44, 0x49, 0x5e, 0xc5\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedMutable 556u
+const dds_topic_descriptor_t SerdataKeyOrderMutableNestedMutable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderMutableNestedMutable),
+  .m_align = dds_alignof (SerdataKeyOrderMutableNestedMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyOrderMutableNestedMutable",
+  .m_keys = SerdataKeyOrderMutableNestedMutable_keys,
+  .m_nops = 16,
+  .m_ops = SerdataKeyOrderMutableNestedMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderMutableNestedMutable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderMutableNestedMutable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedMutable }
+};
+
+static const uint32_t SerdataKeyOrderMutableNestedAppendable_ops [] =
+{
+  /* SerdataKeyOrderMutableNestedAppendable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedAppendable, x),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedAppendable, y),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyOrderMutableNestedAppendable, z), (3u << 16u) + 4u /* SerdataKeyOrderAppendable */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrderAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendable, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderAppendable, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrderAppendable, c),
+  DDS_OP_RTS,
+  
+  /* key: x */
+  DDS_OP_KOF | 1, 8u /* order: 3 */,
+  
+  /* key: z.a */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 1u /* order: 3 */,
+  
+  /* key: z.c */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 5u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderMutableNestedAppendable_keys[3] =
+{
+  { "z.c", 31, 2 },
+  { "z.a", 28, 1 },
+  { "x", 26, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 68c21281ecd4e3e8d054ddbeb536] (#deps: 1)
+   - [MINIMAL a242c3e5f72e2c0eca8967cbe1e4]
+  [COMPLETE ff0c23b57c82ba95567df6554f79] (#deps: 1)
+   - [COMPLETE fc1b2da2fbf5e9e0f097ea035881]
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderMutableNestedAppendable (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x68, 0xc2, 0x12, 0x81, 0xec, 0xd4, 0xe3, 0xe8, 0xd0, 0x54, 0xdd, \
+  0xbe, 0xb5, 0x36, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, 0x2e, 0x2c, \
+  0x0e, 0xca, 0x89, 0x67, 0xcb, 0xe1, 0xe4, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x0c, 0x23, \
+  0xb5, 0x7c, 0x82, 0xba, 0x95, 0x56, 0x7d, 0xf6, 0x55, 0x4f, 0x79, 0x00, 0x90, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, 0x97, 0xea, 0x03, 0x58, 0x81, 0x00, \
+  0x74, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedAppendable 148u
+#define TYPE_MAP_CDR_SerdataKeyOrderMutableNestedAppendable (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x68, 0xc2, 0x12, 0x81, 0xec, 0xd4, 0xe3, \
+  0xe8, 0xd0, 0x54, 0xdd, 0xbe, 0xb5, 0x36, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, \
+  0x2e, 0x2c, 0x0e, 0xca, 0x89, 0x67, 0xcb, 0xe1, 0xe4, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0xa2, 0x42, \
+  0xc3, 0xe5, 0xf7, 0x2e, 0x2c, 0x0e, 0xca, 0x89, 0x67, 0xcb, 0xe1, 0xe4, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0x28, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x0c, 0x23, \
+  0xb5, 0x7c, 0x82, 0xba, 0x95, 0x56, 0x7d, 0xf6, 0x55, 0x4f, 0x79, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x41, 0x70, 0x70, 0x65, \
+  0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, 0x97, 0xea, 0x03, 0x58, \
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0x1b, 0x2d, \
+  0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, 0x97, 0xea, 0x03, 0x58, 0x81, 0x00, 0x70, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x41, \
+  0x70, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x0c, 0x23, 0xb5, 0x7c, 0x82, 0xba, \
+  0x95, 0x56, 0x7d, 0xf6, 0x55, 0x4f, 0x79, 0xf1, 0x68, 0xc2, 0x12, 0x81, 0xec, 0xd4, 0xe3, 0xe8, \
+  0xd0, 0x54, 0xdd, 0xbe, 0xb5, 0x36, 0xf2, 0xfc, 0x1b, 0x2d, 0xa2, 0xfb, 0xf5, 0xe9, 0xe0, 0xf0, \
+  0x97, 0xea, 0x03, 0x58, 0x81, 0xf1, 0xa2, 0x42, 0xc3, 0xe5, 0xf7, 0x2e, 0x2c, 0x0e, 0xca, 0x89, \
+  0x67, 0xcb, 0xe1, 0xe4\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedAppendable 564u
+const dds_topic_descriptor_t SerdataKeyOrderMutableNestedAppendable_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderMutableNestedAppendable),
+  .m_align = dds_alignof (SerdataKeyOrderMutableNestedAppendable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyOrderMutableNestedAppendable",
+  .m_keys = SerdataKeyOrderMutableNestedAppendable_keys,
+  .m_nops = 13,
+  .m_ops = SerdataKeyOrderMutableNestedAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderMutableNestedAppendable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderMutableNestedAppendable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedAppendable }
+};
+
+static const uint32_t SerdataKeyOrderMutableNestedFinal_ops [] =
+{
+  /* SerdataKeyOrderMutableNestedFinal */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedFinal, x),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrderMutableNestedFinal, y),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyOrderMutableNestedFinal, z), (3u << 16u) + 4u /* SerdataKeyOrder */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrder */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrder, c),
+  DDS_OP_RTS,
+  
+  /* key: x */
+  DDS_OP_KOF | 1, 8u /* order: 3 */,
+  
+  /* key: z.a */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 0u /* order: 0 */,
+  
+  /* key: z.c */
+  DDS_OP_KOF | 2, 14u /* order: 1 */, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t SerdataKeyOrderMutableNestedFinal_keys[3] =
+{
+  { "z.a", 27, 1 },
+  { "z.c", 30, 2 },
+  { "x", 25, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 4102659b73f3527f9f66c796b440] (#deps: 1)
+   - [MINIMAL 6a6640081ba9f8b20761b69699a0]
+  [COMPLETE 02b2e8519b3c2d79dcf23ed1bb29] (#deps: 1)
+   - [COMPLETE 642613ebaa9f16c7c17b927edd5f]
+*/
+#define TYPE_INFO_CDR_SerdataKeyOrderMutableNestedFinal (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x02, 0x65, 0x9b, 0x73, 0xf3, 0x52, 0x7f, 0x9f, 0x66, 0xc7, \
+  0x96, 0xb4, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, \
+  0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x02, 0xb2, 0xe8, \
+  0x51, 0x9b, 0x3c, 0x2d, 0x79, 0xdc, 0xf2, 0x3e, 0xd1, 0xbb, 0x29, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, \
+  0x68, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedFinal 148u
+#define TYPE_MAP_CDR_SerdataKeyOrderMutableNestedFinal (const unsigned char []){ \
+  0xbf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x02, 0x65, 0x9b, 0x73, 0xf3, 0x52, \
+  0x7f, 0x9f, 0x66, 0xc7, 0x96, 0xb4, 0x40, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, \
+  0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x6a, 0x66, \
+  0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0x43, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, \
+  0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, \
+  0x8a, 0x08, 0xf0, 0x00, 0x18, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x02, 0xb2, 0xe8, \
+  0x51, 0x9b, 0x3c, 0x2d, 0x79, 0xdc, 0xf2, 0x3e, 0xd1, 0xbb, 0x29, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, \
+  0x6c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x64, \
+  0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, \
+  0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x02, 0xb2, 0xe8, 0x51, 0x9b, 0x3c, 0x2d, \
+  0x79, 0xdc, 0xf2, 0x3e, 0xd1, 0xbb, 0x29, 0xf1, 0x41, 0x02, 0x65, 0x9b, 0x73, 0xf3, 0x52, 0x7f, \
+  0x9f, 0x66, 0xc7, 0x96, 0xb4, 0x40, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, \
+  0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, \
+  0xb6, 0x96, 0x99, 0xa0\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedFinal 548u
+const dds_topic_descriptor_t SerdataKeyOrderMutableNestedFinal_desc =
+{
+  .m_size = sizeof (SerdataKeyOrderMutableNestedFinal),
+  .m_align = dds_alignof (SerdataKeyOrderMutableNestedFinal),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyOrderMutableNestedFinal",
+  .m_keys = SerdataKeyOrderMutableNestedFinal_keys,
+  .m_nops = 12,
+  .m_ops = SerdataKeyOrderMutableNestedFinal_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyOrderMutableNestedFinal, .sz = TYPE_INFO_CDR_SZ_SerdataKeyOrderMutableNestedFinal },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyOrderMutableNestedFinal, .sz = TYPE_MAP_CDR_SZ_SerdataKeyOrderMutableNestedFinal }
+};
+
+static const uint32_t SerdataKeyNestedFinalImplicit_ops [] =
+{
+  /* SerdataKeyNestedFinalImplicit */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit, d), (3u << 16u) + 9u /* SerdataKeyNestedFinalImplicitSubtype */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit, e), (3u << 16u) + 6u /* SerdataKeyNestedFinalImplicitSubtype */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (SerdataKeyNestedFinalImplicit, f),
+  DDS_OP_RTS,
+
+  /* SerdataKeyNestedFinalImplicitSubtype */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedFinalImplicitSubtype, x),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedFinalImplicitSubtype, y),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicitSubtype, z), (3u << 16u) + 4u /* SerdataKeyOrder */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrder */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrder, c),
+  DDS_OP_RTS,
+  
+  /* key: d.x */
+  DDS_OP_KOF | 2, 0u /* order: 3 */, 0u /* order: 3 */,
+  
+  /* key: d.y */
+  DDS_OP_KOF | 2, 0u /* order: 3 */, 2u /* order: 2 */,
+  
+  /* key: d.z.a */
+  DDS_OP_KOF | 3, 0u /* order: 3 */, 4u /* order: 1 */, 0u /* order: 0 */,
+  
+  /* key: d.z.c */
+  DDS_OP_KOF | 3, 0u /* order: 3 */, 4u /* order: 1 */, 4u /* order: 2 */,
+  
+  /* key: f */
+  DDS_OP_KOF | 1, 6u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyNestedFinalImplicit_keys[5] =
+{
+  { "f", 38, 4 },
+  { "d.z.a", 30, 2 },
+  { "d.z.c", 34, 3 },
+  { "d.y", 27, 1 },
+  { "d.x", 24, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 675718c0eade004dce5a1d36e5d3] (#deps: 2)
+   - [MINIMAL 33d2ceb4e040fa4640108427f766]
+   - [MINIMAL 6a6640081ba9f8b20761b69699a0]
+  [COMPLETE b84b622a5520f089c0b227b8025c] (#deps: 2)
+   - [COMPLETE 4db60fe4204434c17657dafddf9f]
+   - [COMPLETE 642613ebaa9f16c7c17b927edd5f]
+*/
+#define TYPE_INFO_CDR_SerdataKeyNestedFinalImplicit (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x67, 0x57, 0x18, 0xc0, 0xea, 0xde, 0x00, 0x4d, 0xce, 0x5a, 0x1d, \
+  0x36, 0xe5, 0xd3, 0x00, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0xd2, 0xce, 0xb4, 0xe0, 0x40, 0xfa, \
+  0x46, 0x40, 0x10, 0x84, 0x27, 0xf7, 0x66, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0x00, \
+  0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb8, 0x4b, 0x62, 0x2a, 0x55, 0x20, 0xf0, 0x89, 0xc0, 0xb2, 0x27, \
+  0xb8, 0x02, 0x5c, 0x00, 0x98, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x4d, 0xb6, 0x0f, 0xe4, 0x20, 0x44, 0x34, \
+  0xc1, 0x76, 0x57, 0xda, 0xfd, 0xdf, 0x9f, 0x00, 0x90, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, \
+  0x68, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyNestedFinalImplicit 196u
+#define TYPE_MAP_CDR_SerdataKeyNestedFinalImplicit (const unsigned char []){ \
+  0x37, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x67, 0x57, 0x18, 0xc0, 0xea, 0xde, 0x00, \
+  0x4d, 0xce, 0x5a, 0x1d, 0x36, 0xe5, 0xd3, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x33, 0xd2, 0xce, 0xb4, 0xe0, \
+  0x40, 0xfa, 0x46, 0x40, 0x10, 0x84, 0x27, 0xf7, 0x66, 0x82, 0x77, 0xe0, 0x91, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x33, 0xd2, 0xce, 0xb4, 0xe0, \
+  0x40, 0xfa, 0x46, 0x40, 0x10, 0x84, 0x27, 0xf7, 0x66, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x8f, 0xa1, 0x4c, 0xdd, 0xf1, \
+  0x33, 0xd2, 0xce, 0xb4, 0xe0, 0x40, 0xfa, 0x46, 0x40, 0x10, 0x84, 0x27, 0xf7, 0x66, 0x00, 0x00, \
+  0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, \
+  0xa0, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, \
+  0xb6, 0x96, 0x99, 0xa0, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0xc4, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xb8, 0x4b, 0x62, 0x2a, 0x55, 0x20, 0xf0, 0x89, 0xc0, 0xb2, 0x27, \
+  0xb8, 0x02, 0x5c, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x49, 0x6d, 0x70, \
+  0x6c, 0x69, 0x63, 0x69, 0x74, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x4d, 0xb6, 0x0f, 0xe4, 0x20, \
+  0x44, 0x34, 0xc1, 0x76, 0x57, 0xda, 0xfd, 0xdf, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x4d, \
+  0xb6, 0x0f, 0xe4, 0x20, 0x44, 0x34, 0xc1, 0x76, 0x57, 0xda, 0xfd, 0xdf, 0x9f, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0xf2, 0x4d, 0xb6, 0x0f, \
+  0xe4, 0x20, 0x44, 0x34, 0xc1, 0x76, 0x57, 0xda, 0xfd, 0xdf, 0x9f, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x46, 0x69, 0x6e, 0x61, 0x6c, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x53, 0x75, 0x62, \
+  0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, \
+  0x5f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, \
+  0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xb8, 0x4b, 0x62, \
+  0x2a, 0x55, 0x20, 0xf0, 0x89, 0xc0, 0xb2, 0x27, 0xb8, 0x02, 0x5c, 0xf1, 0x67, 0x57, 0x18, 0xc0, \
+  0xea, 0xde, 0x00, 0x4d, 0xce, 0x5a, 0x1d, 0x36, 0xe5, 0xd3, 0xf2, 0x4d, 0xb6, 0x0f, 0xe4, 0x20, \
+  0x44, 0x34, 0xc1, 0x76, 0x57, 0xda, 0xfd, 0xdf, 0x9f, 0xf1, 0x33, 0xd2, 0xce, 0xb4, 0xe0, 0x40, \
+  0xfa, 0x46, 0x40, 0x10, 0x84, 0x27, 0xf7, 0x66, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, \
+  0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, \
+  0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyNestedFinalImplicit 870u
+const dds_topic_descriptor_t SerdataKeyNestedFinalImplicit_desc =
+{
+  .m_size = sizeof (SerdataKeyNestedFinalImplicit),
+  .m_align = dds_alignof (SerdataKeyNestedFinalImplicit),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 5u,
+  .m_typename = "SerdataKeyNestedFinalImplicit",
+  .m_keys = SerdataKeyNestedFinalImplicit_keys,
+  .m_nops = 12,
+  .m_ops = SerdataKeyNestedFinalImplicit_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyNestedFinalImplicit, .sz = TYPE_INFO_CDR_SZ_SerdataKeyNestedFinalImplicit },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyNestedFinalImplicit, .sz = TYPE_MAP_CDR_SZ_SerdataKeyNestedFinalImplicit }
+};
+
+static const uint32_t SerdataKeyNestedFinalImplicit2_ops [] =
+{
+  /* SerdataKeyNestedFinalImplicit2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2, a), (3u << 16u) + 7u /* SerdataKeyNestedFinalImplicit2Subtype1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2, b), (3u << 16u) + 4u /* SerdataKeyNestedFinalImplicit2Subtype1 */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyNestedFinalImplicit2Subtype1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2Subtype1, c), (3u << 16u) + 7u /* SerdataKeyNestedFinalImplicit2Subtype2 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2Subtype1, d), (3u << 16u) + 4u /* SerdataKeyNestedFinalImplicit2Subtype2 */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyNestedFinalImplicit2Subtype2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2Subtype2, e), (3u << 16u) + 7u /* SerdataKeyNestedFinalImplicit2Subtype3 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedFinalImplicit2Subtype2, f), (3u << 16u) + 4u /* SerdataKeyNestedFinalImplicit2Subtype3 */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyNestedFinalImplicit2Subtype3 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedFinalImplicit2Subtype3, x),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedFinalImplicit2Subtype3, y),
+  DDS_OP_RTS,
+  
+  /* key: a.c.e.x */
+  DDS_OP_KOF | 4, 0u /* order: 0 */, 0u /* order: 0 */, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: a.c.e.y */
+  DDS_OP_KOF | 4, 0u /* order: 0 */, 0u /* order: 0 */, 0u /* order: 0 */, 2u /* order: 1 */,
+  
+  /* key: a.d.e.x */
+  DDS_OP_KOF | 4, 0u /* order: 0 */, 3u /* order: 1 */, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: a.d.e.y */
+  DDS_OP_KOF | 4, 0u /* order: 0 */, 3u /* order: 1 */, 0u /* order: 0 */, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyNestedFinalImplicit2_keys[4] =
+{
+  { "a.c.e.x", 26, 0 },
+  { "a.c.e.y", 31, 1 },
+  { "a.d.e.x", 36, 2 },
+  { "a.d.e.y", 41, 3 }
+};
+
+/* Type Information:
+  [MINIMAL ddde7f965df151bcffd5249495be] (#deps: 3)
+   - [MINIMAL 1fa9f0948440a192ff28dcd45388]
+   - [MINIMAL e8687008949a9ebd68cb1022c868]
+   - [MINIMAL 5f32d255abe28982b75349396a86]
+  [COMPLETE a2e67839e531d78cbfddbc99dba1] (#deps: 3)
+   - [COMPLETE c28c552861ecc7946a9104c4f3c1]
+   - [COMPLETE 6be7284f32392ef311ba944665c8]
+   - [COMPLETE 6f04fbe27761e4a9b2615c4a57a0]
+*/
+#define TYPE_INFO_CDR_SerdataKeyNestedFinalImplicit2 (const unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0xde, 0x7f, 0x96, 0x5d, 0xf1, 0x51, 0xbc, 0xff, 0xd5, 0x24, \
+  0x94, 0x95, 0xbe, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1f, 0xa9, 0xf0, 0x94, 0x84, 0x40, 0xa1, \
+  0x92, 0xff, 0x28, 0xdc, 0xd4, 0x53, 0x88, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xe8, 0x68, 0x70, 0x08, 0x94, 0x9a, 0x9e, 0xbd, 0x68, 0xcb, 0x10, 0x22, 0xc8, 0x68, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x5f, 0x32, 0xd2, 0x55, 0xab, 0xe2, 0x89, \
+  0x82, 0xb7, 0x53, 0x49, 0x39, 0x6a, 0x86, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xa2, 0xe6, 0x78, \
+  0x39, 0xe5, 0x31, 0xd7, 0x8c, 0xbf, 0xdd, 0xbc, 0x99, 0xdb, 0xa1, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc2, 0x8c, 0x55, 0x28, 0x61, 0xec, 0xc7, 0x94, 0x6a, 0x91, 0x04, 0xc4, 0xf3, 0xc1, 0x00, \
+  0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0xe7, 0x28, 0x4f, 0x32, 0x39, 0x2e, \
+  0xf3, 0x11, 0xba, 0x94, 0x46, 0x65, 0xc8, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x6f, 0x04, 0xfb, 0xe2, 0x77, 0x61, 0xe4, 0xa9, 0xb2, 0x61, 0x5c, 0x4a, 0x57, 0xa0, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyNestedFinalImplicit2 244u
+#define TYPE_MAP_CDR_SerdataKeyNestedFinalImplicit2 (const unsigned char []){ \
+  0x77, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0xde, 0x7f, 0x96, 0x5d, 0xf1, 0x51, \
+  0xbc, 0xff, 0xd5, 0x24, 0x94, 0x95, 0xbe, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x1f, 0xa9, 0xf0, 0x94, 0x84, \
+  0x40, 0xa1, 0x92, 0xff, 0x28, 0xdc, 0xd4, 0x53, 0x88, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x1f, 0xa9, 0xf0, 0x94, 0x84, \
+  0x40, 0xa1, 0x92, 0xff, 0x28, 0xdc, 0xd4, 0x53, 0x88, 0x92, 0xeb, 0x5f, 0xfe, 0xf1, 0x1f, 0xa9, \
+  0xf0, 0x94, 0x84, 0x40, 0xa1, 0x92, 0xff, 0x28, 0xdc, 0xd4, 0x53, 0x88, 0x51, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, \
+  0x68, 0x70, 0x08, 0x94, 0x9a, 0x9e, 0xbd, 0x68, 0xcb, 0x10, 0x22, 0xc8, 0x68, 0x4a, 0x8a, 0x08, \
+  0xf0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, \
+  0x68, 0x70, 0x08, 0x94, 0x9a, 0x9e, 0xbd, 0x68, 0xcb, 0x10, 0x22, 0xc8, 0x68, 0x82, 0x77, 0xe0, \
+  0x91, 0xf1, 0xe8, 0x68, 0x70, 0x08, 0x94, 0x9a, 0x9e, 0xbd, 0x68, 0xcb, 0x10, 0x22, 0xc8, 0x68, \
+  0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf1, 0x5f, 0x32, 0xd2, 0x55, 0xab, 0xe2, 0x89, 0x82, 0xb7, 0x53, 0x49, 0x39, 0x6a, \
+  0x86, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x5f, 0x32, 0xd2, 0x55, 0xab, 0xe2, 0x89, 0x82, 0xb7, 0x53, 0x49, 0x39, 0x6a, \
+  0x86, 0x8f, 0xa1, 0x4c, 0xdd, 0xf1, 0x5f, 0x32, 0xd2, 0x55, 0xab, 0xe2, 0x89, 0x82, 0xb7, 0x53, \
+  0x49, 0x39, 0x6a, 0x86, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, 0x4c, 0x02, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0xf2, 0xa2, 0xe6, 0x78, 0x39, 0xe5, 0x31, 0xd7, 0x8c, 0xbf, 0xdd, 0xbc, \
+  0x99, 0xdb, 0xa1, 0x00, 0x80, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x49, 0x6d, 0x70, \
+  0x6c, 0x69, 0x63, 0x69, 0x74, 0x32, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xc2, 0x8c, 0x55, 0x28, 0x61, \
+  0xec, 0xc7, 0x94, 0x6a, 0x91, 0x04, 0xc4, 0xf3, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc2, \
+  0x8c, 0x55, 0x28, 0x61, 0xec, 0xc7, 0x94, 0x6a, 0x91, 0x04, 0xc4, 0xf3, 0xc1, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0xc2, 0x8c, 0x55, 0x28, 0x61, 0xec, 0xc7, \
+  0x94, 0x6a, 0x91, 0x04, 0xc4, 0xf3, 0xc1, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, \
+  0x6c, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x32, 0x53, 0x75, 0x62, 0x74, 0x79, 0x70, \
+  0x65, 0x31, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x6b, 0xe7, 0x28, 0x4f, 0x32, 0x39, 0x2e, 0xf3, 0x11, \
+  0xba, 0x94, 0x46, 0x65, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x6b, 0xe7, 0x28, 0x4f, 0x32, \
+  0x39, 0x2e, 0xf3, 0x11, 0xba, 0x94, 0x46, 0x65, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0xe7, 0x28, 0x4f, 0x32, 0x39, 0x2e, 0xf3, 0x11, 0xba, 0x94, \
+  0x46, 0x65, 0xc8, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x49, 0x6d, 0x70, \
+  0x6c, 0x69, 0x63, 0x69, 0x74, 0x32, 0x53, 0x75, 0x62, 0x74, 0x79, 0x70, 0x65, 0x32, 0x00, 0x00, \
+  0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x6f, 0x04, 0xfb, 0xe2, 0x77, 0x61, 0xe4, 0xa9, 0xb2, 0x61, 0x5c, 0x4a, 0x57, \
+  0xa0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x6f, 0x04, 0xfb, 0xe2, 0x77, 0x61, 0xe4, 0xa9, 0xb2, \
+  0x61, 0x5c, 0x4a, 0x57, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, \
+  0xf2, 0x6f, 0x04, 0xfb, 0xe2, 0x77, 0x61, 0xe4, 0xa9, 0xb2, 0x61, 0x5c, 0x4a, 0x57, 0xa0, 0x00, \
+  0x68, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4e, 0x65, \
+  0x73, 0x74, 0x65, 0x64, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, \
+  0x74, 0x32, 0x53, 0x75, 0x62, 0x74, 0x79, 0x70, 0x65, 0x33, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0xf2, 0xa2, 0xe6, 0x78, 0x39, 0xe5, 0x31, 0xd7, 0x8c, 0xbf, 0xdd, 0xbc, \
+  0x99, 0xdb, 0xa1, 0xf1, 0xdd, 0xde, 0x7f, 0x96, 0x5d, 0xf1, 0x51, 0xbc, 0xff, 0xd5, 0x24, 0x94, \
+  0x95, 0xbe, 0xf2, 0xc2, 0x8c, 0x55, 0x28, 0x61, 0xec, 0xc7, 0x94, 0x6a, 0x91, 0x04, 0xc4, 0xf3, \
+  0xc1, 0xf1, 0x1f, 0xa9, 0xf0, 0x94, 0x84, 0x40, 0xa1, 0x92, 0xff, 0x28, 0xdc, 0xd4, 0x53, 0x88, \
+  0xf2, 0x6b, 0xe7, 0x28, 0x4f, 0x32, 0x39, 0x2e, 0xf3, 0x11, 0xba, 0x94, 0x46, 0x65, 0xc8, 0xf1, \
+  0xe8, 0x68, 0x70, 0x08, 0x94, 0x9a, 0x9e, 0xbd, 0x68, 0xcb, 0x10, 0x22, 0xc8, 0x68, 0xf2, 0x6f, \
+  0x04, 0xfb, 0xe2, 0x77, 0x61, 0xe4, 0xa9, 0xb2, 0x61, 0x5c, 0x4a, 0x57, 0xa0, 0xf1, 0x5f, 0x32, \
+  0xd2, 0x55, 0xab, 0xe2, 0x89, 0x82, 0xb7, 0x53, 0x49, 0x39, 0x6a, 0x86\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyNestedFinalImplicit2 1100u
+const dds_topic_descriptor_t SerdataKeyNestedFinalImplicit2_desc =
+{
+  .m_size = sizeof (SerdataKeyNestedFinalImplicit2),
+  .m_align = dds_alignof (SerdataKeyNestedFinalImplicit2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 4u,
+  .m_typename = "SerdataKeyNestedFinalImplicit2",
+  .m_keys = SerdataKeyNestedFinalImplicit2_keys,
+  .m_nops = 12,
+  .m_ops = SerdataKeyNestedFinalImplicit2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyNestedFinalImplicit2, .sz = TYPE_INFO_CDR_SZ_SerdataKeyNestedFinalImplicit2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyNestedFinalImplicit2, .sz = TYPE_MAP_CDR_SZ_SerdataKeyNestedFinalImplicit2 }
+};
+
+static const uint32_t SerdataKeyNestedMutableImplicit_ops [] =
+{
+  /* SerdataKeyNestedMutableImplicit */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedMutableImplicit, d), (3u << 16u) + 9u /* SerdataKeyNestedMutableImplicitSubtype */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedMutableImplicit, e), (3u << 16u) + 6u /* SerdataKeyNestedMutableImplicitSubtype */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (SerdataKeyNestedMutableImplicit, f),
+  DDS_OP_RTS,
+
+  /* SerdataKeyNestedMutableImplicitSubtype */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedMutableImplicitSubtype, x),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (SerdataKeyNestedMutableImplicitSubtype, y),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_EXT, offsetof (SerdataKeyNestedMutableImplicitSubtype, z), (3u << 16u) + 4u /* SerdataKeyOrder */,
+  DDS_OP_RTS,
+
+  /* SerdataKeyOrder */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, a),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (SerdataKeyOrder, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (SerdataKeyOrder, c),
+  DDS_OP_RTS,
+  
+  /* key: d.x */
+  DDS_OP_KOF | 2, 1u /* order: 3 */, 8u /* order: 3 */,
+  
+  /* key: d.y */
+  DDS_OP_KOF | 2, 1u /* order: 3 */, 11u /* order: 2 */,
+  
+  /* key: d.z.a */
+  DDS_OP_KOF | 3, 1u /* order: 3 */, 14u /* order: 1 */, 0u /* order: 0 */,
+  
+  /* key: d.z.c */
+  DDS_OP_KOF | 3, 1u /* order: 3 */, 14u /* order: 1 */, 4u /* order: 2 */,
+  
+  /* key: f */
+  DDS_OP_KOF | 1, 7u /* order: 1 */
+};
+
+static const dds_key_descriptor_t SerdataKeyNestedMutableImplicit_keys[5] =
+{
+  { "f", 49, 4 },
+  { "d.z.a", 41, 2 },
+  { "d.z.c", 45, 3 },
+  { "d.y", 38, 1 },
+  { "d.x", 35, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8fac726598901f2c614ec4c20def] (#deps: 2)
+   - [MINIMAL 68333bfbd3d49a314608cdade368]
+   - [MINIMAL 6a6640081ba9f8b20761b69699a0]
+  [COMPLETE e5625a280e157337e6d6ffa160b2] (#deps: 2)
+   - [COMPLETE 8fb5448299dd60da19274e21ffc1]
+   - [COMPLETE 642613ebaa9f16c7c17b927edd5f]
+*/
+#define TYPE_INFO_CDR_SerdataKeyNestedMutableImplicit (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0xac, 0x72, 0x65, 0x98, 0x90, 0x1f, 0x2c, 0x61, 0x4e, 0xc4, \
+  0xc2, 0x0d, 0xef, 0x00, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x68, 0x33, 0x3b, 0xfb, 0xd3, 0xd4, 0x9a, \
+  0x31, 0x46, 0x08, 0xcd, 0xad, 0xe3, 0x68, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0, 0x00, \
+  0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe5, 0x62, 0x5a, 0x28, 0x0e, 0x15, 0x73, 0x37, 0xe6, 0xd6, 0xff, \
+  0xa1, 0x60, 0xb2, 0x00, 0x98, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0xb5, 0x44, 0x82, 0x99, 0xdd, 0x60, \
+  0xda, 0x19, 0x27, 0x4e, 0x21, 0xff, 0xc1, 0x00, 0x90, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, \
+  0x68, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyNestedMutableImplicit 196u
+#define TYPE_MAP_CDR_SerdataKeyNestedMutableImplicit (const unsigned char []){ \
+  0x37, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0xac, 0x72, 0x65, 0x98, 0x90, 0x1f, \
+  0x2c, 0x61, 0x4e, 0xc4, 0xc2, 0x0d, 0xef, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x68, 0x33, 0x3b, 0xfb, 0xd3, \
+  0xd4, 0x9a, 0x31, 0x46, 0x08, 0xcd, 0xad, 0xe3, 0x68, 0x82, 0x77, 0xe0, 0x91, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x68, 0x33, 0x3b, 0xfb, 0xd3, \
+  0xd4, 0x9a, 0x31, 0x46, 0x08, 0xcd, 0xad, 0xe3, 0x68, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x8f, 0xa1, 0x4c, 0xdd, 0xf1, \
+  0x68, 0x33, 0x3b, 0xfb, 0xd3, 0xd4, 0x9a, 0x31, 0x46, 0x08, 0xcd, 0xad, 0xe3, 0x68, 0x00, 0x00, \
+  0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0d, 0x41, 0x52, 0x90, 0x76, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, 0xb6, 0x96, 0x99, \
+  0xa0, 0xfb, 0xad, 0xe9, 0xe3, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, 0x07, 0x61, \
+  0xb6, 0x96, 0x99, 0xa0, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0d, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0xc4, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xe5, 0x62, 0x5a, 0x28, 0x0e, 0x15, 0x73, 0x37, 0xe6, 0xd6, 0xff, \
+  0xa1, 0x60, 0xb2, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x49, \
+  0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x8f, 0xb5, 0x44, 0x82, 0x99, \
+  0xdd, 0x60, 0xda, 0x19, 0x27, 0x4e, 0x21, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8f, \
+  0xb5, 0x44, 0x82, 0x99, 0xdd, 0x60, 0xda, 0x19, 0x27, 0x4e, 0x21, 0xff, 0xc1, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0xf2, 0x8f, 0xb5, 0x44, \
+  0x82, 0x99, 0xdd, 0x60, 0xda, 0x19, 0x27, 0x4e, 0x21, 0xff, 0xc1, 0x00, 0x8c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0c, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, \
+  0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x49, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x53, \
+  0x75, 0x62, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, \
+  0x5f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x64, 0x26, 0x13, \
+  0xeb, 0xaa, 0x9f, 0x16, 0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xe5, 0x62, 0x5a, \
+  0x28, 0x0e, 0x15, 0x73, 0x37, 0xe6, 0xd6, 0xff, 0xa1, 0x60, 0xb2, 0xf1, 0x8f, 0xac, 0x72, 0x65, \
+  0x98, 0x90, 0x1f, 0x2c, 0x61, 0x4e, 0xc4, 0xc2, 0x0d, 0xef, 0xf2, 0x8f, 0xb5, 0x44, 0x82, 0x99, \
+  0xdd, 0x60, 0xda, 0x19, 0x27, 0x4e, 0x21, 0xff, 0xc1, 0xf1, 0x68, 0x33, 0x3b, 0xfb, 0xd3, 0xd4, \
+  0x9a, 0x31, 0x46, 0x08, 0xcd, 0xad, 0xe3, 0x68, 0xf2, 0x64, 0x26, 0x13, 0xeb, 0xaa, 0x9f, 0x16, \
+  0xc7, 0xc1, 0x7b, 0x92, 0x7e, 0xdd, 0x5f, 0xf1, 0x6a, 0x66, 0x40, 0x08, 0x1b, 0xa9, 0xf8, 0xb2, \
+  0x07, 0x61, 0xb6, 0x96, 0x99, 0xa0\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyNestedMutableImplicit 870u
+const dds_topic_descriptor_t SerdataKeyNestedMutableImplicit_desc =
+{
+  .m_size = sizeof (SerdataKeyNestedMutableImplicit),
+  .m_align = dds_alignof (SerdataKeyNestedMutableImplicit),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 5u,
+  .m_typename = "SerdataKeyNestedMutableImplicit",
+  .m_keys = SerdataKeyNestedMutableImplicit_keys,
+  .m_nops = 17,
+  .m_ops = SerdataKeyNestedMutableImplicit_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyNestedMutableImplicit, .sz = TYPE_INFO_CDR_SZ_SerdataKeyNestedMutableImplicit },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyNestedMutableImplicit, .sz = TYPE_MAP_CDR_SZ_SerdataKeyNestedMutableImplicit }
+};
+
+static const uint32_t SerdataKeyInheritMutable_ops [] =
+{
+  /* SerdataKeyInheritMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | (DDS_OP_FLAG_BASE << 16) | 19 /* SerdataKeyInheritMutableBase */, 0u,
+  DDS_OP_PLM | 7, 3u,
+  DDS_OP_PLM | 9, 2u,
+  DDS_OP_PLM | 10, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (SerdataKeyInheritMutable, a), (3u << 16u) + 28u /* SerdataKeyInheritMutableNested */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutable, b),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutable, c),
+  DDS_OP_RTS,
+
+  /* SerdataKeyInheritMutableBase */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 6u,
+  DDS_OP_PLM | 9, 5u,
+  DDS_OP_PLM | 10, 4u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (SerdataKeyInheritMutableBase, bx), (3u << 16u) + 10u /* SerdataKeyInheritMutableNested */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutableBase, by),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutableBase, bz),
+  DDS_OP_RTS,
+
+  /* SerdataKeyInheritMutableNested */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutableNested, nx),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutableNested, ny),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY, offsetof (SerdataKeyInheritMutableNested, nz),
+  DDS_OP_RTS,
+  
+  /* key: bx.nx */
+  DDS_OP_KOF | 2, 28u /* order: 6 */, 1u /* order: 9 */,
+  
+  /* key: bx.nz */
+  DDS_OP_KOF | 2, 28u /* order: 6 */, 5u /* order: 7 */,
+  
+  /* key: bz */
+  DDS_OP_KOF | 1, 35u /* order: 4 */
+};
+
+static const dds_key_descriptor_t SerdataKeyInheritMutable_keys[3] =
+{
+  { "bz", 52, 2 },
+  { "bx.nz", 49, 1 },
+  { "bx.nx", 46, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 31a0051c512c72d6de1d370ba012] (#deps: 2)
+   - [MINIMAL 09acb20ad8ef616f3e1f1590afc9]
+   - [MINIMAL 5ff21fff293084a938bdc418c976]
+  [COMPLETE a36ae9511dbc4b1eda1d58218666] (#deps: 2)
+   - [COMPLETE 55c678e5c9741d7e11a2b32ddc67]
+   - [COMPLETE 599f0eb2c0c8662ad94358ad471e]
+*/
+#define TYPE_INFO_CDR_SerdataKeyInheritMutable (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x31, 0xa0, 0x05, 0x1c, 0x51, 0x2c, 0x72, 0xd6, 0xde, 0x1d, 0x37, \
+  0x0b, 0xa0, 0x12, 0x00, 0x63, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x09, 0xac, 0xb2, 0x0a, 0xd8, 0xef, 0x61, \
+  0x6f, 0x3e, 0x1f, 0x15, 0x90, 0xaf, 0xc9, 0x00, 0x57, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x5f, 0xf2, 0x1f, 0xff, 0x29, 0x30, 0x84, 0xa9, 0x38, 0xbd, 0xc4, 0x18, 0xc9, 0x76, 0x00, \
+  0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa3, 0x6a, 0xe9, 0x51, 0x1d, 0xbc, 0x4b, 0x1e, 0xda, 0x1d, 0x58, \
+  0x21, 0x86, 0x66, 0x00, 0x94, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x55, 0xc6, 0x78, 0xe5, 0xc9, 0x74, 0x1d, \
+  0x7e, 0x11, 0xa2, 0xb3, 0x2d, 0xdc, 0x67, 0x00, 0x91, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x59, 0x9f, 0x0e, 0xb2, 0xc0, 0xc8, 0x66, 0x2a, 0xd9, 0x43, 0x58, 0xad, 0x47, 0x1e, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_SerdataKeyInheritMutable 196u
+#define TYPE_MAP_CDR_SerdataKeyInheritMutable (const unsigned char []){ \
+  0x37, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x31, 0xa0, 0x05, 0x1c, 0x51, 0x2c, 0x72, \
+  0xd6, 0xde, 0x1d, 0x37, 0x0b, 0xa0, 0x12, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0x09, 0xac, 0xb2, 0x0a, 0xd8, 0xef, 0x61, 0x6f, 0x3e, 0x1f, 0x15, \
+  0x90, 0xaf, 0xc9, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x5f, 0xf2, 0x1f, 0xff, 0x29, 0x30, 0x84, 0xa9, 0x38, \
+  0xbd, 0xc4, 0x18, 0xc9, 0x76, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x92, 0xeb, 0x5f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x4a, 0x8a, 0x08, 0xf0, 0xf1, 0x09, 0xac, 0xb2, 0x0a, \
+  0xd8, 0xef, 0x61, 0x6f, 0x3e, 0x1f, 0x15, 0x90, 0xaf, 0xc9, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x5f, \
+  0xf2, 0x1f, 0xff, 0x29, 0x30, 0x84, 0xa9, 0x38, 0xbd, 0xc4, 0x18, 0xc9, 0x76, 0x6f, 0x57, 0x70, \
+  0xd5, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xdf, \
+  0x3f, 0x07, 0x9d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0xb0, \
+  0x05, 0xad, 0x12, 0xf1, 0x5f, 0xf2, 0x1f, 0xff, 0x29, 0x30, 0x84, 0xa9, 0x38, 0xbd, 0xc4, 0x18, \
+  0xc9, 0x76, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x97, 0x89, 0x3f, 0x46, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x53, 0x1b, 0xeb, 0x50, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0xc9, 0x7b, 0x33, 0x4f, 0x00, 0xd9, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xa3, 0x6a, 0xe9, 0x51, 0x1d, 0xbc, 0x4b, 0x1e, 0xda, 0x1d, 0x58, \
+  0x21, 0x86, 0x66, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0xf2, 0x55, 0xc6, 0x78, 0xe5, 0xc9, 0x74, 0x1d, 0x7e, 0x11, 0xa2, 0xb3, 0x2d, 0xdc, 0x67, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x4b, \
+  0x65, 0x79, 0x49, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x59, 0x9f, 0x0e, 0xb2, 0xc0, 0xc8, 0x66, 0x2a, 0xd9, \
+  0x43, 0x58, 0xad, 0x47, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf2, 0x55, 0xc6, 0x78, 0xe5, 0xc9, 0x74, 0x1d, \
+  0x7e, 0x11, 0xa2, 0xb3, 0x2d, 0xdc, 0x67, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x4d, 0x75, 0x74, \
+  0x61, 0x62, 0x6c, 0x65, 0x42, 0x61, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x59, \
+  0x9f, 0x0e, 0xb2, 0xc0, 0xc8, 0x66, 0x2a, 0xd9, 0x43, 0x58, 0xad, 0x47, 0x1e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x62, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x79, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x62, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x59, 0x9f, 0x0e, 0xb2, 0xc0, 0xc8, \
+  0x66, 0x2a, 0xd9, 0x43, 0x58, 0xad, 0x47, 0x1e, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x64, \
+  0x61, 0x74, 0x61, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x4d, 0x75, 0x74, \
+  0x61, 0x62, 0x6c, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6e, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x79, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6e, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xa3, 0x6a, 0xe9, 0x51, 0x1d, 0xbc, 0x4b, 0x1e, 0xda, 0x1d, 0x58, \
+  0x21, 0x86, 0x66, 0xf1, 0x31, 0xa0, 0x05, 0x1c, 0x51, 0x2c, 0x72, 0xd6, 0xde, 0x1d, 0x37, 0x0b, \
+  0xa0, 0x12, 0xf2, 0x55, 0xc6, 0x78, 0xe5, 0xc9, 0x74, 0x1d, 0x7e, 0x11, 0xa2, 0xb3, 0x2d, 0xdc, \
+  0x67, 0xf1, 0x09, 0xac, 0xb2, 0x0a, 0xd8, 0xef, 0x61, 0x6f, 0x3e, 0x1f, 0x15, 0x90, 0xaf, 0xc9, \
+  0xf2, 0x59, 0x9f, 0x0e, 0xb2, 0xc0, 0xc8, 0x66, 0x2a, 0xd9, 0x43, 0x58, 0xad, 0x47, 0x1e, 0xf1, \
+  0x5f, 0xf2, 0x1f, 0xff, 0x29, 0x30, 0x84, 0xa9, 0x38, 0xbd, 0xc4, 0x18, 0xc9, 0x76\
+}
+#define TYPE_MAP_CDR_SZ_SerdataKeyInheritMutable 894u
+const dds_topic_descriptor_t SerdataKeyInheritMutable_desc =
+{
+  .m_size = sizeof (SerdataKeyInheritMutable),
+  .m_align = dds_alignof (SerdataKeyInheritMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "SerdataKeyInheritMutable",
+  .m_keys = SerdataKeyInheritMutable_keys,
+  .m_nops = 21,
+  .m_ops = SerdataKeyInheritMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_SerdataKeyInheritMutable, .sz = TYPE_INFO_CDR_SZ_SerdataKeyInheritMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_SerdataKeyInheritMutable, .sz = TYPE_MAP_CDR_SZ_SerdataKeyInheritMutable }
+};
+
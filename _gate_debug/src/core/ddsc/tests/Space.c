@@ -0,0 +1,296 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/Space.c
+  Source: /root/repo/src/core/ddsc/tests/Space.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "Space.h"
+
+static const uint32_t Space_Type1_ops [] =
+{
+  /* Type1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type1, long_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type1, long_2),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type1, long_3),
+  DDS_OP_RTS,
+  
+  /* key: long_1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t Space_Type1_keys[1] =
+{
+  { "long_1", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL e634e1fc1c6c31a967eefa7aaf56] (#deps: 0)
+  [COMPLETE be15b9f315ccf9949fc4bc6b4726] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Space_Type1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, 0xa9, 0x67, 0xee, 0xfa, \
+  0x7a, 0xaf, 0x56, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x15, 0xb9, 0xf3, 0x15, 0xcc, 0xf9, 0x94, 0x9f, 0xc4, 0xbc, \
+  0x6b, 0x47, 0x26, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Space_Type1 100u
+#define TYPE_MAP_CDR_Space_Type1 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, \
+  0xa9, 0x67, 0xee, 0xfa, 0x7a, 0xaf, 0x56, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xaf, 0xeb, 0x04, 0xb7, 0x00, \
+  0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x15, 0xb9, 0xf3, 0x15, 0xcc, 0xf9, \
+  0x94, 0x9f, 0xc4, 0xbc, 0x6b, 0x47, 0x26, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x53, 0x70, 0x61, 0x63, \
+  0x65, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x31, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xbe, 0x15, 0xb9, 0xf3, 0x15, 0xcc, 0xf9, 0x94, 0x9f, 0xc4, 0xbc, 0x6b, 0x47, 0x26, 0xf1, \
+  0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, 0xa9, 0x67, 0xee, 0xfa, 0x7a, 0xaf, 0x56\
+}
+#define TYPE_MAP_CDR_SZ_Space_Type1 286u
+const dds_topic_descriptor_t Space_Type1_desc =
+{
+  .m_size = sizeof (Space_Type1),
+  .m_align = dds_alignof (Space_Type1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Space::Type1",
+  .m_keys = Space_Type1_keys,
+  .m_nops = 4,
+  .m_ops = Space_Type1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Space_Type1, .sz = TYPE_INFO_CDR_SZ_Space_Type1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Space_Type1, .sz = TYPE_MAP_CDR_SZ_Space_Type1 }
+};
+
+static const uint32_t Space_Type2_ops [] =
+{
+  /* Type2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type2, long_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type2, long_2),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type2, long_3),
+  DDS_OP_RTS,
+  
+  /* key: long_1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t Space_Type2_keys[1] =
+{
+  { "long_1", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL e634e1fc1c6c31a967eefa7aaf56] (#deps: 0)
+  [COMPLETE 8efc346e616c767630f5be2d90ca] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Space_Type2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, 0xa9, 0x67, 0xee, 0xfa, \
+  0x7a, 0xaf, 0x56, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0xfc, 0x34, 0x6e, 0x61, 0x6c, 0x76, 0x76, 0x30, 0xf5, 0xbe, \
+  0x2d, 0x90, 0xca, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Space_Type2 100u
+#define TYPE_MAP_CDR_Space_Type2 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, \
+  0xa9, 0x67, 0xee, 0xfa, 0x7a, 0xaf, 0x56, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xaf, 0xeb, 0x04, 0xb7, 0x00, \
+  0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0xfc, 0x34, 0x6e, 0x61, 0x6c, 0x76, \
+  0x76, 0x30, 0xf5, 0xbe, 0x2d, 0x90, 0xca, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x53, 0x70, 0x61, 0x63, \
+  0x65, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x32, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0xfc, 0x34, 0x6e, 0x61, 0x6c, 0x76, 0x76, 0x30, 0xf5, 0xbe, 0x2d, 0x90, 0xca, 0xf1, \
+  0xe6, 0x34, 0xe1, 0xfc, 0x1c, 0x6c, 0x31, 0xa9, 0x67, 0xee, 0xfa, 0x7a, 0xaf, 0x56\
+}
+#define TYPE_MAP_CDR_SZ_Space_Type2 286u
+const dds_topic_descriptor_t Space_Type2_desc =
+{
+  .m_size = sizeof (Space_Type2),
+  .m_align = dds_alignof (Space_Type2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Space::Type2",
+  .m_keys = Space_Type2_keys,
+  .m_nops = 4,
+  .m_ops = Space_Type2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Space_Type2, .sz = TYPE_INFO_CDR_SZ_Space_Type2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Space_Type2, .sz = TYPE_MAP_CDR_SZ_Space_Type2 }
+};
+
+static const uint32_t Space_Type3_ops [] =
+{
+  /* Type3 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type3, long_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type3, long_2),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_Type3, long_3),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL ea7e85a114f4d3346a923d460079] (#deps: 0)
+  [COMPLETE 2400db14371e7257746ecb9dd17c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Space_Type3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xea, 0x7e, 0x85, 0xa1, 0x14, 0xf4, 0xd3, 0x34, 0x6a, 0x92, 0x3d, \
+  0x46, 0x00, 0x79, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x00, 0xdb, 0x14, 0x37, 0x1e, 0x72, 0x57, 0x74, 0x6e, 0xcb, \
+  0x9d, 0xd1, 0x7c, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Space_Type3 100u
+#define TYPE_MAP_CDR_Space_Type3 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xea, 0x7e, 0x85, 0xa1, 0x14, 0xf4, 0xd3, \
+  0x34, 0x6a, 0x92, 0x3d, 0x46, 0x00, 0x79, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xaf, 0xeb, 0x04, 0xb7, 0x00, \
+  0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x00, 0xdb, 0x14, 0x37, 0x1e, 0x72, \
+  0x57, 0x74, 0x6e, 0xcb, 0x9d, 0xd1, 0x7c, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x53, 0x70, 0x61, 0x63, \
+  0x65, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x33, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x24, 0x00, 0xdb, 0x14, 0x37, 0x1e, 0x72, 0x57, 0x74, 0x6e, 0xcb, 0x9d, 0xd1, 0x7c, 0xf1, \
+  0xea, 0x7e, 0x85, 0xa1, 0x14, 0xf4, 0xd3, 0x34, 0x6a, 0x92, 0x3d, 0x46, 0x00, 0x79\
+}
+#define TYPE_MAP_CDR_SZ_Space_Type3 286u
+const dds_topic_descriptor_t Space_Type3_desc =
+{
+  .m_size = sizeof (Space_Type3),
+  .m_align = dds_alignof (Space_Type3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Space::Type3",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = Space_Type3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Space_Type3, .sz = TYPE_INFO_CDR_SZ_Space_Type3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Space_Type3, .sz = TYPE_MAP_CDR_SZ_Space_Type3 }
+};
+
+static const uint32_t Space_simpletypes_ops [] =
+{
+  /* simpletypes */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Space_simpletypes, l),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Space_simpletypes, ll),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (Space_simpletypes, us),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Space_simpletypes, ul),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (Space_simpletypes, ull),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (Space_simpletypes, f),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (Space_simpletypes, d),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (Space_simpletypes, c),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (Space_simpletypes, b),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Space_simpletypes, o),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (Space_simpletypes, s),
+  DDS_OP_RTS,
+  
+  /* key: s */
+  DDS_OP_KOF | 1, 20u /* order: 10 */
+};
+
+static const dds_key_descriptor_t Space_simpletypes_keys[1] =
+{
+  { "s", 23, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8cb31f768192f9c78de22c610ebf] (#deps: 0)
+  [COMPLETE 975e772fd6264749182058e5d0ea] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Space_simpletypes (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0xb3, 0x1f, 0x76, 0x81, 0x92, 0xf9, 0xc7, 0x8d, 0xe2, 0x2c, \
+  0x61, 0x0e, 0xbf, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x97, 0x5e, 0x77, 0x2f, 0xd6, 0x26, 0x47, 0x49, 0x18, 0x20, 0x58, \
+  0xe5, 0xd0, 0xea, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Space_simpletypes 100u
+#define TYPE_MAP_CDR_Space_simpletypes (const unsigned char []){ \
+  0xdc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0xb3, 0x1f, 0x76, 0x81, 0x92, 0xf9, \
+  0xc7, 0x8d, 0xe2, 0x2c, 0x61, 0x0e, 0xbf, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x5b, 0x54, 0xc0, 0xa0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x0b, 0x3b, 0x97, 0xfa, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x73, 0x8a, 0x65, 0x6e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0xd9, 0x98, 0x63, 0x94, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x8f, 0xa1, 0x4c, 0xdd, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x82, 0x77, 0xe0, 0x91, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x30, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x97, 0x5e, 0x77, 0x2f, 0xd6, 0x26, 0x47, \
+  0x49, 0x18, 0x20, 0x58, 0xe5, 0xd0, 0xea, 0x00, 0x18, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x53, 0x70, 0x61, 0x63, \
+  0x65, 0x3a, 0x3a, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x79, 0x70, 0x65, 0x73, 0x00, 0x00, \
+  0xf0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x75, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x73, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x97, 0x5e, 0x77, \
+  0x2f, 0xd6, 0x26, 0x47, 0x49, 0x18, 0x20, 0x58, 0xe5, 0xd0, 0xea, 0xf1, 0x8c, 0xb3, 0x1f, 0x76, \
+  0x81, 0x92, 0xf9, 0xc7, 0x8d, 0xe2, 0x2c, 0x61, 0x0e, 0xbf\
+}
+#define TYPE_MAP_CDR_SZ_Space_simpletypes 570u
+const dds_topic_descriptor_t Space_simpletypes_desc =
+{
+  .m_size = sizeof (Space_simpletypes),
+  .m_align = dds_alignof (Space_simpletypes),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Space::simpletypes",
+  .m_keys = Space_simpletypes_keys,
+  .m_nops = 12,
+  .m_ops = Space_simpletypes_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Space_simpletypes, .sz = TYPE_INFO_CDR_SZ_Space_simpletypes },
+  .type_mapping = { .data = TYPE_MAP_CDR_Space_simpletypes, .sz = TYPE_MAP_CDR_SZ_Space_simpletypes }
+};
+
@@ -0,0 +1,6498 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/TypeBuilderTypes.c
+  Source: /root/repo/src/core/ddsc/tests/TypeBuilderTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "TypeBuilderTypes.h"
+
+static const uint32_t TypeBuilderTypes_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 3f46d7caf5bc98adb25b7daf618d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, \
+  0xaf, 0x61, 0x8d, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t1 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, \
+  0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, \
+  0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t1 202u
+const dds_topic_descriptor_t TypeBuilderTypes_t1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t1),
+  .m_align = dds_alignof (TypeBuilderTypes_t1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t1 }
+};
+
+static const uint32_t TypeBuilderTypes_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL befabd11a939fc45e1be314e648f] (#deps: 2)
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+  [COMPLETE d08221fc386c32b53869d4756ef1] (#deps: 2)
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t2 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, \
+  0x4e, 0x64, 0x8f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, \
+  0x75, 0x6e, 0xf1, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, \
+  0x62, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t2 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t2 (const unsigned char []){ \
+  0xb0, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, \
+  0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x01, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x17, 0x79, 0xcf, 0x3a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x6e, 0x1f, 0xcd, 0x70, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x74, 0xce, 0x2e, 0x1a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x64, 0xe4, 0xcd, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x6c, 0x66, 0x4e, 0xee, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x58, 0x1c, 0x30, 0x10, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x65, 0x06, 0xf0, 0x38, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x82, 0xb5, 0xf6, 0x80, \
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0xf3, 0x44, 0xa4, 0x0a, \
+  0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, \
+  0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x80, 0x39, 0xb4, 0xe0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, \
+  0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x89, 0xb4, 0x5f, 0xf3, 0xf1, 0x16, 0xce, \
+  0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, \
+  0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xc5, 0x61, 0xf7, 0x7b, 0x8a, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, \
+  0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x86, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, \
+  0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, \
+  0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, \
+  0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, \
+  0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, \
+  0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t2 1190u
+const dds_topic_descriptor_t TypeBuilderTypes_t2_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t2),
+  .m_align = dds_alignof (TypeBuilderTypes_t2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t2",
+  .m_keys = NULL,
+  .m_nops = 14,
+  .m_ops = TypeBuilderTypes_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t2, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t2, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t2 }
+};
+
+static const uint32_t TypeBuilderTypes_t3a_ops [] =
+{
+  /* t3a */
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t3a, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 9a0cb031fe8514af3342d3fac3d5] (#deps: 0)
+  [COMPLETE 3b1a09046ba4340cd5adf2c2935b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t3a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, 0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, \
+  0xfa, 0xc3, 0xd5, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, 0x0c, 0xd5, 0xad, 0xf2, \
+  0xc2, 0x93, 0x5b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t3a 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t3a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, 0x85, 0x14, \
+  0xaf, 0x33, 0x42, 0xd3, 0xfa, 0xc3, 0xd5, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, \
+  0x0c, 0xd5, 0xad, 0xf2, 0xc2, 0x93, 0x5b, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x33, \
+  0x61, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x1a, 0x09, \
+  0x04, 0x6b, 0xa4, 0x34, 0x0c, 0xd5, 0xad, 0xf2, 0xc2, 0x93, 0x5b, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, \
+  0xfe, 0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, 0xfa, 0xc3, 0xd5\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t3a 202u
+const dds_topic_descriptor_t TypeBuilderTypes_t3a_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t3a),
+  .m_align = dds_alignof (TypeBuilderTypes_t3a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t3a",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t3a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t3a, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t3a },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t3a, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t3a }
+};
+
+static const uint32_t TypeBuilderTypes_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t3, f1), (3u << 16u) + 10u /* t1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t3, f2), (3u << 16u) + 10u /* t3a */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t3, f3), (3u << 16u) + 10u /* t2 */,
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t3a */
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t3a, f1),
+  DDS_OP_RTS,
+
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL cbc02ae7b86f06f22aba7bcb5b5d] (#deps: 5)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL 9a0cb031fe8514af3342d3fac3d5]
+   - [MINIMAL befabd11a939fc45e1be314e648f]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+  [COMPLETE 6cf33157caed3dcc05030b81536c] (#deps: 5)
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE 3b1a09046ba4340cd5adf2c2935b]
+   - [COMPLETE d08221fc386c32b53869d4756ef1]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t3 (const unsigned char []){ \
+  0x50, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xa0, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0xc0, 0x2a, 0xe7, 0xb8, 0x6f, 0x06, 0xf2, 0x2a, 0xba, 0x7b, \
+  0xcb, 0x5b, 0x5d, 0x00, 0x75, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, 0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, 0xfa, 0xc3, 0xd5, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, \
+  0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, \
+  0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0xa0, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6c, 0xf3, 0x31, \
+  0x57, 0xca, 0xed, 0x3d, 0xcc, 0x05, 0x03, 0x0b, 0x81, 0x53, 0x6c, 0x00, 0xa9, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, \
+  0x0c, 0xd5, 0xad, 0xf2, 0xc2, 0x93, 0x5b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, \
+  0x8a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, \
+  0x62, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t3 340u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t3 (const unsigned char []){ \
+  0xa4, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0xc0, 0x2a, 0xe7, 0xb8, 0x6f, 0x06, \
+  0xf2, 0x2a, 0xba, 0x7b, 0xcb, 0x5b, 0x5d, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, \
+  0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, 0xfa, 0xc3, 0xd5, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, \
+  0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x17, 0x79, 0xcf, 0x3a, 0xf1, 0xf5, 0x4b, \
+  0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, 0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, 0xfa, \
+  0xc3, 0xd5, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, \
+  0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x17, \
+  0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x6e, \
+  0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x74, \
+  0xce, 0x2e, 0x1a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x64, \
+  0xe4, 0xcd, 0xa1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x6c, \
+  0x66, 0x4e, 0xee, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x58, \
+  0x1c, 0x30, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x65, \
+  0x06, 0xf0, 0x38, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, \
+  0x82, 0xb5, 0xf6, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, \
+  0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0x16, \
+  0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x80, 0x39, 0xb4, \
+  0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x89, 0xb4, 0x5f, \
+  0xf3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf2, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0xf2, 0x6c, 0xf3, 0x31, 0x57, 0xca, 0xed, 0x3d, 0xcc, 0x05, 0x03, 0x0b, 0x81, 0x53, 0x6c, 0x00, \
+  0xa5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, 0x0c, 0xd5, \
+  0xad, 0xf2, 0xc2, 0x93, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd0, \
+  0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, \
+  0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, 0x0c, 0xd5, 0xad, 0xf2, 0xc2, 0x93, 0x5b, \
+  0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x33, 0x61, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, \
+  0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x86, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, \
+  0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x33, 0x00, \
+  0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, \
+  0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, \
+  0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0xb8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf2, 0x6c, 0xf3, 0x31, 0x57, 0xca, 0xed, 0x3d, \
+  0xcc, 0x05, 0x03, 0x0b, 0x81, 0x53, 0x6c, 0xf1, 0xcb, 0xc0, 0x2a, 0xe7, 0xb8, 0x6f, 0x06, 0xf2, \
+  0x2a, 0xba, 0x7b, 0xcb, 0x5b, 0x5d, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, \
+  0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, \
+  0xb5, 0x68, 0x16, 0xeb, 0xf2, 0x3b, 0x1a, 0x09, 0x04, 0x6b, 0xa4, 0x34, 0x0c, 0xd5, 0xad, 0xf2, \
+  0xc2, 0x93, 0x5b, 0xf1, 0x9a, 0x0c, 0xb0, 0x31, 0xfe, 0x85, 0x14, 0xaf, 0x33, 0x42, 0xd3, 0xfa, \
+  0xc3, 0xd5, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, \
+  0xf1, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, \
+  0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, \
+  0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, \
+  0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t3 1884u
+const dds_topic_descriptor_t TypeBuilderTypes_t3_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t3),
+  .m_align = dds_alignof (TypeBuilderTypes_t3),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t3",
+  .m_keys = NULL,
+  .m_nops = 22,
+  .m_ops = TypeBuilderTypes_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t3, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t3, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t3 }
+};
+
+static const uint32_t TypeBuilderTypes_t4_ops [] =
+{
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t4, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (TypeBuilderTypes_t4, f3), sizeof (TypeBuilderTypes_t1), (4u << 16u) + 5u /* t1 */,
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8e65e5d6272ed068fe6fb7959de7] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE 3f35e2e96c2e7e4a0001ccea52da] (#deps: 1)
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t4 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, \
+  0x95, 0x9d, 0xe7, 0x00, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x35, 0xe2, \
+  0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x99, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t4 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t4 (const unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, \
+  0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x70, 0x00, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x17, 0x79, 0xcf, 0x3a, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x05, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, \
+  0x95, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, \
+  0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x35, 0xe2, \
+  0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, \
+  0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t4 520u
+const dds_topic_descriptor_t TypeBuilderTypes_t4_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t4),
+  .m_align = dds_alignof (TypeBuilderTypes_t4),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t4",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = TypeBuilderTypes_t4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t4, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t4, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t4 }
+};
+
+static const uint32_t TypeBuilderTypes_t5_ops [] =
+{
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t5, _d), 34u, (383u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_1BY, 1, offsetof (TypeBuilderTypes_t5, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 2, offsetof (TypeBuilderTypes_t5, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BST | 128, 3, offsetof (TypeBuilderTypes_t5, _u.u3), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 4, offsetof (TypeBuilderTypes_t5, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 5, offsetof (TypeBuilderTypes_t5, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 360 /* t1 */, 6, offsetof (TypeBuilderTypes_t5, _u.u6), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 356 /* t1 */, 7, offsetof (TypeBuilderTypes_t5, _u.u6), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BMK | 112, 8, offsetof (TypeBuilderTypes_t5, _u.u8), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 113, 9, offsetof (TypeBuilderTypes_t5, _u.u9), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BSQ | 112, 10, offsetof (TypeBuilderTypes_t5, _u.u10), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 11, offsetof (TypeBuilderTypes_t5, _u.u11), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), 12, offsetof (TypeBuilderTypes_t5, _u.u12), 1u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 13, offsetof (TypeBuilderTypes_t5, _u.u13), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 14, offsetof (TypeBuilderTypes_t5, _u.u14), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 324 /* t1 */, 15, offsetof (TypeBuilderTypes_t5, _u.u15), sizeof (TypeBuilderTypes_t1),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 320 /* t1 */, 16, offsetof (TypeBuilderTypes_t5, _u.u15), sizeof (TypeBuilderTypes_t1),
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BLN, 17, offsetof (TypeBuilderTypes_t5, _u.u17), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 18, offsetof (TypeBuilderTypes_t5, _u.u18), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), 19, offsetof (TypeBuilderTypes_t5, _u.u19), 1u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BMK | 76, 21, offsetof (TypeBuilderTypes_t5, _u.u21), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BSQ | 77, 22, offsetof (TypeBuilderTypes_t5, _u.u22), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 77, 23, offsetof (TypeBuilderTypes_t5, _u.u23), sizeof (dds_sequence_long),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 82, 24, offsetof (TypeBuilderTypes_t5, _u.u24), sizeof (dds_sequence_sequence_long),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 92, 25, offsetof (TypeBuilderTypes_t5, _u.u25), sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 104, 26, offsetof (TypeBuilderTypes_t5, _u.u26), sizeof (dds_sequence_TypeBuilderTypes_td1),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 115, 27, offsetof (TypeBuilderTypes_t5, _u.u27), sizeof (dds_sequence_sequence_TypeBuilderTypes_td2),
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 155, 28, offsetof (TypeBuilderTypes_t5, _u.u28), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 169, 29, offsetof (TypeBuilderTypes_t5, _u.u29), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 186, 30, offsetof (TypeBuilderTypes_t5, _u.u30), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 197, 31, offsetof (TypeBuilderTypes_t5, _u.u31), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 208, 32, offsetof (TypeBuilderTypes_t5, _u.u32), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 214, 33, offsetof (TypeBuilderTypes_t5, _u.u33), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 248, 34, offsetof (TypeBuilderTypes_t5, _u.u34), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 251 /* t4 */, 35, offsetof (TypeBuilderTypes_t5, _u.u35), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_BST, 0u, 6u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (8u << 16u) + 5u, sizeof (dds_sequence_long),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (13u << 16u) + 5u, sizeof (dds_sequence_sequence_long),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_SEQ, 0u, sizeof (dds_sequence_long), (7u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 12u, (15u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_SEQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_bm16), (9u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_td1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td1), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 125000u, (43u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_td2),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_TypeBuilderTypes_td2), (37u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td2), (31u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda4), (26u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda4), (20u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 3u, sizeof (TypeBuilderTypes_tda4), (15u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 6u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 12u, (17u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BSQ, 0u, 8u, sizeof (dds_sequence_TypeBuilderTypes_bm16), (11u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 12u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 12u, (20u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda1), (14u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 5u, sizeof (TypeBuilderTypes_tda1), (9u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 1200u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_tda2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_tda2), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 1200u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_tda3), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 1200000u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 500u, (37u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_td2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td2), (31u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda4), (26u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda4), (20u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 3u, sizeof (TypeBuilderTypes_tda4), (15u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 6u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t4, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (TypeBuilderTypes_t4, f3), sizeof (TypeBuilderTypes_t1), (4u << 16u) + 65529u /* t1 */,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d24552ca6618e0dcf99d2c4fbdec] (#deps: 13)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL cac354c84814910b3025f4a96b04]
+   - [MINIMAL 58a531131473632ee3ba38595896]
+   - [MINIMAL 07c219604fef00f88af047c41e85]
+   - [MINIMAL 1aeb32bde3e52b3eae6e585eeb4b]
+   - [MINIMAL e38971595724bfe1171c685c0107]
+   - [MINIMAL 687416ee263919082770c074c0c5]
+   - [MINIMAL 001d5d2707f221b044e322296a6b]
+   - [MINIMAL fa612aeb32e8adfa5bc31650d807]
+   - [MINIMAL 40845480bb017badbbe737be16ce]
+   - [MINIMAL 8e65e5d6272ed068fe6fb7959de7]
+  [COMPLETE 5a5b30534666aca7ddaa5e78540b] (#deps: 13)
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 2dbb7af22b6d7296291530ff9904]
+   - [COMPLETE f61b99f039473cb4a610a1cac9a0]
+   - [COMPLETE 614ec90d8acf305ee44e80c43f2d]
+   - [COMPLETE edf210d28016f8d9e006f91a2b02]
+   - [COMPLETE 4f89b29cc5247899f91a11a8dd85]
+   - [COMPLETE 34ad0f64bbfc208988ea2c2ea272]
+   - [COMPLETE 852f2f51b604d30704ce85540c27]
+   - [COMPLETE 8d32ecf84d3861100ec94ecaefda]
+   - [COMPLETE d40083b8ea88909b22a77a66bdcc]
+   - [COMPLETE 3f35e2e96c2e7e4a0001ccea52da]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t5 (const unsigned char []){ \
+  0xd0, 0x02, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x60, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, 0x18, 0xe0, 0xdc, 0xf9, 0x9d, 0x2c, \
+  0x4f, 0xbd, 0xec, 0x00, 0x14, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, \
+  0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, \
+  0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, 0x00, 0x32, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, \
+  0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, 0xad, \
+  0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, 0x07, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, \
+  0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x60, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x5a, 0x5b, 0x30, \
+  0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, 0x78, 0x54, 0x0b, 0x00, 0x2e, 0x06, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, \
+  0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, \
+  0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, \
+  0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x4f, 0x89, 0xb2, 0x9c, 0xc5, 0x24, 0x78, \
+  0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, \
+  0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, \
+  0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, 0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x00, \
+  0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, \
+  0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, \
+  0x99, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t5 724u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t5 (const unsigned char []){ \
+  0x66, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, 0x18, 0xe0, \
+  0xdc, 0xf9, 0x9d, 0x2c, 0x4f, 0xbd, 0xec, 0x00, 0x10, 0x05, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0xfc, 0x04, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x27, 0x0c, 0x1b, 0x08, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0x18, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x7b, 0x8d, 0x62, 0xfd, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, \
+  0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0xa6, 0xa0, 0x3a, 0x32, 0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x73, 0x93, 0x85, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x54, 0x86, 0x25, 0x9f, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0xcb, 0x82, 0x32, 0xdd, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xa4, 0xcb, 0x5c, 0xf0, 0x24, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, \
+  0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0xe2, 0xdb, 0xa0, 0x64, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xe2, 0x0d, 0x51, 0x5f, 0x14, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x6d, 0x90, 0xe8, 0xba, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0xb4, 0x42, 0x57, \
+  0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x14, 0xcf, 0x27, 0xf1, 0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x32, 0xae, 0x1a, 0x36, \
+  0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, \
+  0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x0d, 0x71, 0x6c, 0x72, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, \
+  0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0xa8, 0xb7, 0x6f, \
+  0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, \
+  0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x4d, 0xab, 0xfc, 0x91, 0x24, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, \
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x45, 0xf1, 0xec, 0x94, \
+  0x2c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf3, 0x00, 0x01, 0x00, \
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x29, 0x5f, 0xe5, 0xc8, \
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf1, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, \
+  0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x5c, 0x0b, 0x30, 0x0c, 0x34, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, \
+  0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x46, 0x2d, 0xf5, 0x81, 0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, \
+  0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x81, 0x8c, 0x47, 0x5e, 0x38, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x80, 0xf1, 0x01, 0x00, 0x08, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x0c, 0xf1, 0x58, 0xa5, \
+  0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x01, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x26, 0x90, 0x3b, 0xbe, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf1, \
+  0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x05, 0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, \
+  0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0xca, 0xb3, 0x4b, 0xec, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, 0xad, 0xfa, 0x5b, 0xc3, \
+  0x16, 0x50, 0xd8, 0x07, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0xe1, 0x41, 0x0e, \
+  0x38, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, \
+  0x00, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x93, 0xa5, 0x34, 0x00, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x90, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, \
+  0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0xa3, 0x11, 0xa8, 0x31, 0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, \
+  0x00, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x72, 0xda, 0x1b, 0x18, 0x24, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, \
+  0xe7, 0x37, 0xbe, 0x16, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x2c, 0x32, 0x9f, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8e, \
+  0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xed, 0xb8, 0x60, 0x2c, 0xf1, 0xf5, 0x4b, 0x39, \
+  0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, \
+  0x6f, 0x53, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x16, 0xce, 0x50, \
+  0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, \
+  0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x1e, 0x83, 0x07, 0x46, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x19, 0x84, 0x77, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, \
+  0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xe7, 0x09, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xff, 0x7f, 0x67, 0xfa, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, \
+  0xc4, 0x1e, 0x85, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x09, 0xf1, 0x1a, 0xeb, 0x32, \
+  0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf1, \
+  0x01, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x03, 0xf1, \
+  0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0xf1, 0xe3, \
+  0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x68, 0x74, \
+  0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, 0xf1, 0x68, 0x74, 0x16, \
+  0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x07, \
+  0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0xf1, 0x00, 0x1d, \
+  0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0x1a, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, \
+  0xe8, 0xad, 0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, \
+  0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0xf1, 0x40, 0x84, \
+  0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, \
+  0x95, 0x9d, 0xe7, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x79, 0x0b, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0xf2, 0x5a, 0x5b, 0x30, 0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, \
+  0x78, 0x54, 0x0b, 0x00, 0x2a, 0x06, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, \
+  0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x04, \
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x33, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x34, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, \
+  0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, \
+  0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, \
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, \
+  0x01, 0x00, 0x00, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, 0x01, 0x00, \
+  0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x35, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, \
+  0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x36, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x91, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x02, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, \
+  0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x37, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x08, 0x80, \
+  0xf2, 0x00, 0x01, 0x00, 0x0c, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, \
+  0xa1, 0xca, 0xc9, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf2, \
+  0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x05, 0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, \
+  0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x2c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x8d, 0x32, \
+  0xec, 0xf8, 0x4d, 0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x01, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, \
+  0x00, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, \
+  0xf2, 0x4f, 0x89, 0xb2, 0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, \
+  0x00, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x33, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd4, \
+  0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x34, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x35, 0x00, \
+  0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, \
+  0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, \
+  0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x38, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x4e, 0x38, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x38, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, \
+  0xca, 0xc9, 0xa0, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x36, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, \
+  0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x61, 0x4e, \
+  0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x36, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, \
+  0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, \
+  0x32, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x02, 0x80, \
+  0xf2, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x03, 0xf2, 0x4f, 0x89, 0xb2, 0x9c, \
+  0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x00, 0xf2, 0x4f, 0x89, 0xb2, \
+  0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x4a, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x61, 0x34, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, \
+  0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, 0x00, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, \
+  0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x61, 0x33, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x61, \
+  0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x00, 0xf2, \
+  0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0x00, 0x00, \
+  0x3c, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, 0x61, 0x31, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, \
+  0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, 0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x00, \
+  0x3f, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, 0x61, 0x32, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, \
+  0x27, 0x00, 0x00, 0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, \
+  0xbd, 0xcc, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf2, 0x3f, \
+  0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x00, 0x00, \
+  0x95, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0xf2, 0x5a, 0x5b, 0x30, 0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, \
+  0x78, 0x54, 0x0b, 0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, 0x18, 0xe0, 0xdc, 0xf9, 0x9d, 0x2c, 0x4f, \
+  0xbd, 0xec, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, \
+  0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, \
+  0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x2d, 0xbb, 0x7a, \
+  0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0xf1, 0xca, 0xc3, 0x54, 0xc8, \
+  0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, \
+  0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, \
+  0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0xf2, 0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, \
+  0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, \
+  0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, \
+  0x06, 0xf9, 0x1a, 0x2b, 0x02, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, \
+  0x58, 0x5e, 0xeb, 0x4b, 0xf2, 0x4f, 0x89, 0xb2, 0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, \
+  0xa8, 0xdd, 0x85, 0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, \
+  0x01, 0x07, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, \
+  0x72, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, \
+  0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0xf1, \
+  0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0xf2, 0x8d, \
+  0x32, 0xec, 0xf8, 0x4d, 0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0xf1, 0xfa, 0x61, \
+  0x2a, 0xeb, 0x32, 0xe8, 0xad, 0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, 0x07, 0xf2, 0xd4, 0x00, 0x83, \
+  0xb8, 0xea, 0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0xf1, 0x40, 0x84, 0x54, 0x80, \
+  0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, \
+  0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, \
+  0xd0, 0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t5 5528u
+const dds_topic_descriptor_t TypeBuilderTypes_t5_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t5),
+  .m_align = dds_alignof (TypeBuilderTypes_t5),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t5",
+  .m_keys = NULL,
+  .m_nops = 138,
+  .m_ops = TypeBuilderTypes_t5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t5, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t5, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t5 }
+};
+
+static const uint32_t TypeBuilderTypes_t6_ops [] =
+{
+  /* t6 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f1), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f2), 1000u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (TypeBuilderTypes_t6, f3), 3u, (5u << 16u) + 201u /* t1 */, sizeof (TypeBuilderTypes_t1),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t6, f4), 15u, 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t6, f5), 1u, 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t6, f6), 10u, 0u, 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t6, f7), 100u, 0u, 3u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f8), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, offsetof (TypeBuilderTypes_t6, f9), 10u, (8u << 16u) + 5u, sizeof (dds_sequence_long),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f10), 300u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f11), 900u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f12), 90000u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t6, f13), 540000u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, offsetof (TypeBuilderTypes_t6, f14), sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, offsetof (TypeBuilderTypes_t6, f15), 5u, (14u << 16u) + 5u, sizeof (TypeBuilderTypes_seq_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, offsetof (TypeBuilderTypes_t6, f16), 2u, (14u << 16u) + 5u, sizeof (struct TypeBuilderTypes_seq_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, offsetof (TypeBuilderTypes_t6, f17), 20u, (14u << 16u) + 5u, sizeof (struct TypeBuilderTypes_seq_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, offsetof (TypeBuilderTypes_t6, f18), sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_SEQ, offsetof (TypeBuilderTypes_t6, f19), sizeof (TypeBuilderTypes_seq_def), (13u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, offsetof (TypeBuilderTypes_t6, f20), 200u, sizeof (TypeBuilderTypes_seq_arr_def), (20u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 2u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, offsetof (TypeBuilderTypes_t6, f21), 3u, (26u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_seq_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 4u, sizeof (TypeBuilderTypes_seq_arr_def), (20u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 2u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, offsetof (TypeBuilderTypes_t6, f22), 12u, (37u << 16u) + 5u, sizeof (dds_sequence_sequence_sequence_TypeBuilderTypes_seq_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_sequence_TypeBuilderTypes_seq_arr_def), (31u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_seq_arr_def), (25u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 4u, sizeof (TypeBuilderTypes_seq_arr_def), (20u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 2u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_arr_def),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_arr_def), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 300u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 711f11f817cc6b349a9caf549f9a] (#deps: 9)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL cac354c84814910b3025f4a96b04]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 58a531131473632ee3ba38595896]
+   - [MINIMAL 7929eabd5ff376de83ee717d0edd]
+   - [MINIMAL 0097c5b0a67fbcbfa2ded598a996]
+   - [MINIMAL 2207f2556bd374e41fbe3ff5f336]
+   - [MINIMAL 65c74e0742d59727da5c41a871c2]
+  [COMPLETE d6e3efcef5ef7ad9def527385605] (#deps: 9)
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 2dbb7af22b6d7296291530ff9904]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE f61b99f039473cb4a610a1cac9a0]
+   - [COMPLETE f9a7f761096f4d30f83372692a12]
+   - [COMPLETE 83c435abdfc74b1e1f5d54b57123]
+   - [COMPLETE 9415a5052f3b3fa6790ae22e80d9]
+   - [COMPLETE d367afd5b213b46c15f48fbe15b9]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t6 (const unsigned char []){ \
+  0x10, 0x02, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x71, 0x1f, 0x11, 0xf8, 0x17, 0xcc, 0x6b, 0x34, 0x9a, 0x9c, 0xaf, \
+  0x54, 0x9f, 0x9a, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, \
+  0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, \
+  0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x97, 0xc5, 0xb0, 0xa6, 0x7f, 0xbc, \
+  0xbf, 0xa2, 0xde, 0xd5, 0x98, 0xa9, 0x96, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x22, 0x07, 0xf2, 0x55, 0x6b, 0xd3, 0x74, 0xe4, 0x1f, 0xbe, 0x3f, 0xf5, 0xf3, 0x36, 0x00, \
+  0x26, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, \
+  0x27, 0xda, 0x5c, 0x41, 0xa8, 0x71, 0xc2, 0x00, 0x32, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x00, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xe3, 0xef, \
+  0xce, 0xf5, 0xef, 0x7a, 0xd9, 0xde, 0xf5, 0x27, 0x38, 0x56, 0x05, 0x00, 0x1a, 0x04, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, 0x4d, \
+  0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x00, 0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x83, 0xc4, 0x35, 0xab, 0xdf, 0xc7, 0x4b, 0x1e, 0x1f, 0x5d, 0x54, 0xb5, 0x71, 0x23, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x15, 0xa5, 0x05, 0x2f, 0x3b, 0x3f, \
+  0xa6, 0x79, 0x0a, 0xe2, 0x2e, 0x80, 0xd9, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, 0x15, 0xb9, 0x00, \
+  0x5c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t6 532u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t6 (const unsigned char []){ \
+  0xb6, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf1, 0x71, 0x1f, 0x11, 0xf8, 0x17, 0xcc, 0x6b, \
+  0x34, 0x9a, 0x9c, 0xaf, 0x54, 0x9f, 0x9a, 0x00, 0x4a, 0x03, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xe8, 0x03, 0x00, 0x00, 0x10, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, \
+  0x17, 0x79, 0xcf, 0x3a, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, \
+  0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x6e, 0x1f, 0xcd, 0x70, 0x24, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, \
+  0x74, 0xce, 0x2e, 0x1a, 0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, \
+  0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x64, 0xe4, 0xcd, 0xa1, 0x24, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x64, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, \
+  0x6c, 0x66, 0x4e, 0xee, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x58, 0x1c, 0x30, 0x10, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x04, 0x65, 0x06, 0xf0, 0x38, \
+  0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, \
+  0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0x82, 0xb5, 0xf6, 0x80, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, \
+  0x71, 0x7d, 0x0e, 0xdd, 0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x00, 0x97, 0xc5, 0xb0, 0xa6, 0x7f, 0xbc, 0xbf, 0xa2, 0xde, 0xd5, 0x98, 0xa9, \
+  0x96, 0x80, 0x39, 0xb4, 0xe0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x97, \
+  0xc5, 0xb0, 0xa6, 0x7f, 0xbc, 0xbf, 0xa2, 0xde, 0xd5, 0x98, 0xa9, 0x96, 0x89, 0xb4, 0x5f, 0xf3, \
+  0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x22, 0x07, 0xf2, 0x55, 0x6b, \
+  0xd3, 0x74, 0xe4, 0x1f, 0xbe, 0x3f, 0xf5, 0xf3, 0x36, 0x13, 0x23, 0xfd, 0x7c, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0xf1, 0x22, 0x07, 0xf2, 0x55, 0x6b, 0xd3, 0x74, 0xe4, 0x1f, 0xbe, \
+  0x3f, 0xf5, 0xf3, 0x36, 0xd3, 0xc8, 0xa0, 0x83, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, 0xda, 0x5c, 0x41, 0xa8, 0x71, \
+  0xc2, 0xa2, 0x44, 0x9b, 0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0x65, 0xc7, \
+  0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, 0xda, 0x5c, 0x41, 0xa8, 0x71, 0xc2, 0xfe, 0x39, 0x7f, 0x3f, \
+  0x1e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0xd6, 0x0e, \
+  0xa3, 0x89, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, \
+  0x01, 0x00, 0x00, 0xf1, 0x22, 0x07, 0xf2, 0x55, 0x6b, 0xd3, 0x74, 0xe4, 0x1f, 0xbe, 0x3f, 0xf5, \
+  0xf3, 0x36, 0x59, 0x9f, 0x12, 0x7b, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0xc8, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, \
+  0xda, 0x5c, 0x41, 0xa8, 0x71, 0xc2, 0x3a, 0xd3, 0x2b, 0x99, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x04, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, \
+  0xda, 0x5c, 0x41, 0xa8, 0x71, 0xc2, 0xfc, 0x69, 0x8b, 0xd6, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x80, 0xf1, 0x01, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, \
+  0x01, 0x00, 0x04, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, 0xda, 0x5c, 0x41, 0xa8, \
+  0x71, 0xc2, 0x18, 0x63, 0x81, 0x29, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, \
+  0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, \
+  0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0xca, \
+  0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1e, 0x83, 0x07, 0x46, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x19, 0x84, 0x77, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, \
+  0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0xe7, 0x09, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x67, 0xfa, \
+  0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, \
+  0x04, 0xf1, 0x00, 0x97, 0xc5, 0xb0, 0xa6, 0x7f, 0xbc, 0xbf, 0xa2, 0xde, 0xd5, 0x98, 0xa9, 0x96, \
+  0x2b, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x91, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, \
+  0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0xf1, \
+  0x22, 0x07, 0xf2, 0x55, 0x6b, 0xd3, 0x74, 0xe4, 0x1f, 0xbe, 0x3f, 0xf5, 0xf3, 0x36, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, \
+  0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, 0xda, \
+  0x5c, 0x41, 0xa8, 0x71, 0xc2, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, 0x79, 0x29, 0xea, 0xbd, \
+  0x5f, 0xf3, 0x76, 0xde, 0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xe3, 0xef, 0xce, 0xf5, 0xef, 0x7a, 0xd9, 0xde, 0xf5, 0x27, \
+  0x38, 0x56, 0x05, 0x00, 0x16, 0x04, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x36, 0x00, 0x00, 0x00, 0x00, \
+  0xea, 0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xe8, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, \
+  0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, \
+  0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, \
+  0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, \
+  0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, \
+  0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x80, 0xf3, 0x00, \
+  0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, 0x09, \
+  0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0xf9, 0xa7, \
+  0xf7, 0x61, 0x09, 0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x83, 0xc4, 0x35, 0xab, 0xdf, 0xc7, 0x4b, 0x1e, 0x1f, 0x5d, 0x54, 0xb5, 0x71, \
+  0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x06, 0xf2, 0x83, 0xc4, 0x35, 0xab, 0xdf, 0xc7, 0x4b, 0x1e, 0x1f, 0x5d, \
+  0x54, 0xb5, 0x71, 0x23, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x94, 0x15, 0xa5, 0x05, 0x2f, \
+  0x3b, 0x3f, 0xa6, 0x79, 0x0a, 0xe2, 0x2e, 0x80, 0xd9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0xf2, 0x94, 0x15, \
+  0xa5, 0x05, 0x2f, 0x3b, 0x3f, 0xa6, 0x79, 0x0a, 0xe2, 0x2e, 0x80, 0xd9, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, 0x15, \
+  0xb9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, \
+  0x8f, 0xbe, 0x15, 0xb9, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x26, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x94, 0x15, 0xa5, 0x05, \
+  0x2f, 0x3b, 0x3f, 0xa6, 0x79, 0x0a, 0xe2, 0x2e, 0x80, 0xd9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0xc8, 0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, \
+  0x15, 0xf4, 0x8f, 0xbe, 0x15, 0xb9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x32, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x04, 0xf2, \
+  0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, 0x15, 0xb9, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x32, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x02, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, \
+  0x01, 0x00, 0x04, 0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, \
+  0x15, 0xb9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x32, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, \
+  0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, \
+  0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x38, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x38, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x38, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, \
+  0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xf6, \
+  0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x00, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, \
+  0x31, 0x36, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, 0x5f, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, \
+  0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x43, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, \
+  0x72, 0x5f, 0x64, 0x65, 0x66, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf2, \
+  0x83, 0xc4, 0x35, 0xab, 0xdf, 0xc7, 0x4b, 0x1e, 0x1f, 0x5d, 0x54, 0xb5, 0x71, 0x23, 0x00, 0x00, \
+  0x51, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, 0x72, 0x5f, 0x64, 0x65, 0x66, 0x32, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x2c, 0x01, 0x00, 0x00, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, \
+  0x69, 0x2a, 0x12, 0x00, 0x00, 0xf2, 0x94, 0x15, 0xa5, 0x05, 0x2f, 0x3b, 0x3f, 0xa6, 0x79, 0x0a, \
+  0xe2, 0x2e, 0x80, 0xd9, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x73, 0x65, 0x71, 0x5f, 0x64, 0x65, \
+  0x66, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x00, 0x00, \
+  0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, 0x15, 0xb9, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x73, 0x65, 0x71, 0x5f, 0x61, 0x72, 0x72, 0x5f, 0x64, 0x65, \
+  0x66, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, \
+  0x09, 0x6f, 0x4d, 0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xe3, 0xef, 0xce, 0xf5, 0xef, 0x7a, 0xd9, 0xde, 0xf5, 0x27, \
+  0x38, 0x56, 0x05, 0xf1, 0x71, 0x1f, 0x11, 0xf8, 0x17, 0xcc, 0x6b, 0x34, 0x9a, 0x9c, 0xaf, 0x54, \
+  0x9f, 0x9a, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, \
+  0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x2d, \
+  0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0xf1, 0xca, 0xc3, \
+  0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0xf2, 0x35, 0xed, 0x87, \
+  0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, \
+  0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, \
+  0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, \
+  0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0xf2, 0xf9, 0xa7, 0xf7, 0x61, 0x09, 0x6f, 0x4d, \
+  0x30, 0xf8, 0x33, 0x72, 0x69, 0x2a, 0x12, 0xf1, 0x79, 0x29, 0xea, 0xbd, 0x5f, 0xf3, 0x76, 0xde, \
+  0x83, 0xee, 0x71, 0x7d, 0x0e, 0xdd, 0xf2, 0x83, 0xc4, 0x35, 0xab, 0xdf, 0xc7, 0x4b, 0x1e, 0x1f, \
+  0x5d, 0x54, 0xb5, 0x71, 0x23, 0xf1, 0x00, 0x97, 0xc5, 0xb0, 0xa6, 0x7f, 0xbc, 0xbf, 0xa2, 0xde, \
+  0xd5, 0x98, 0xa9, 0x96, 0xf2, 0x94, 0x15, 0xa5, 0x05, 0x2f, 0x3b, 0x3f, 0xa6, 0x79, 0x0a, 0xe2, \
+  0x2e, 0x80, 0xd9, 0xf1, 0x22, 0x07, 0xf2, 0x55, 0x6b, 0xd3, 0x74, 0xe4, 0x1f, 0xbe, 0x3f, 0xf5, \
+  0xf3, 0x36, 0xf2, 0xd3, 0x67, 0xaf, 0xd5, 0xb2, 0x13, 0xb4, 0x6c, 0x15, 0xf4, 0x8f, 0xbe, 0x15, \
+  0xb9, 0xf1, 0x65, 0xc7, 0x4e, 0x07, 0x42, 0xd5, 0x97, 0x27, 0xda, 0x5c, 0x41, 0xa8, 0x71, 0xc2\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t6 3808u
+const dds_topic_descriptor_t TypeBuilderTypes_t6_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t6),
+  .m_align = dds_alignof (TypeBuilderTypes_t6),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t6",
+  .m_keys = NULL,
+  .m_nops = 73,
+  .m_ops = TypeBuilderTypes_t6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t6, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t6, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t6 }
+};
+
+static const uint32_t TypeBuilderTypes_t7_ops [] =
+{
+  /* t7 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t7, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f2), (3u << 16u) + 12u /* tk1 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f3), (3u << 16u) + 14u /* tk2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t7, f4),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f5), (3u << 16u) + 14u /* tk3 */,
+  DDS_OP_RTS,
+
+  /* tk1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk1, tk1_1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk1, tk1_2),
+  DDS_OP_RTS,
+
+  /* tk2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk2, tk2_1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk2, tk2_2),
+  DDS_OP_RTS,
+
+  /* tk3 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk3, tk3_1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_tk3, tk3_2), (3u << 16u) + 4u /* tk3n */,
+  DDS_OP_RTS,
+
+  /* tk3n */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk3n, tk3n_1),
+  DDS_OP_RTS,
+  
+  /* key: f1 */
+  DDS_OP_KOF | 1, 0u /* order: 3 */,
+  
+  /* key: f2.tk1_1 */
+  DDS_OP_KOF | 2, 2u /* order: 0 */, 0u /* order: 2 */,
+  
+  /* key: f2.tk1_2 */
+  DDS_OP_KOF | 2, 2u /* order: 0 */, 2u /* order: 1 */,
+  
+  /* key: f3.tk2_2 */
+  DDS_OP_KOF | 2, 5u /* order: 1 */, 2u /* order: 15 */,
+  
+  /* key: f5.tk3_1 */
+  DDS_OP_KOF | 2, 10u /* order: 5 */, 0u /* order: 0 */,
+  
+  /* key: f5.tk3_2.tk3n_1 */
+  DDS_OP_KOF | 3, 10u /* order: 5 */, 2u /* order: 1 */, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t7_keys[6] =
+{
+  { "f2.tk1_2", 38, 2 },
+  { "f2.tk1_1", 35, 1 },
+  { "f3.tk2_2", 41, 3 },
+  { "f1", 33, 0 },
+  { "f5.tk3_1", 44, 4 },
+  { "f5.tk3_2.tk3n_1", 47, 5 }
+};
+
+/* Type Information:
+  [MINIMAL 71eb558d71e5e3617681448ec043] (#deps: 4)
+   - [MINIMAL 221dd8b1944998719ccf5d20d703]
+   - [MINIMAL bfd233f78f93a7c6ef22abaeadca]
+   - [MINIMAL 4f0197b9efc0f549c3cc327effae]
+   - [MINIMAL 7e55bdb9d5cc9ed924994112f558]
+  [COMPLETE dcc37da883ba03fdf5e0716dfdbe] (#deps: 4)
+   - [COMPLETE 88a15e895395e1204d498c70c53e]
+   - [COMPLETE 613673f3041c6d3acaafa0326c2c]
+   - [COMPLETE 23a2ff13853be16b654f711fbbfb]
+   - [COMPLETE de5714f7b2b018622c0a7f485db1]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t7 (const unsigned char []){ \
+  0x20, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, 0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, \
+  0x8e, 0xc0, 0x43, 0x00, 0x95, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, 0x98, \
+  0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0x00, \
+  0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, 0xc0, 0xf5, \
+  0x49, 0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x7e, 0x55, 0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, \
+  0x6d, 0xfd, 0xbe, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, \
+  0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, 0x00, 0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, \
+  0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, 0x74, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xde, 0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0x00, \
+  0x4d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t7 292u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t7 (const unsigned char []){ \
+  0xc3, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, 0xe5, 0xe3, \
+  0x61, 0x76, 0x81, 0x44, 0x8e, 0xc0, 0x43, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, \
+  0x49, 0x98, 0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, \
+  0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x6e, 0x1f, 0xcd, 0x70, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, \
+  0xc0, 0xf5, 0x49, 0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0x74, 0xce, 0x2e, 0x1a, 0xf1, 0x22, 0x1d, \
+  0xd8, 0xb1, 0x94, 0x49, 0x98, 0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x50, \
+  0xbb, 0x3a, 0x8c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x88, \
+  0x8b, 0xfe, 0x04, 0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, \
+  0xad, 0xca, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xf6, 0xd0, 0xc6, 0xac, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xdd, 0x25, 0xd1, 0x68, 0xf1, 0x4f, 0x01, 0x97, 0xb9, \
+  0xef, 0xc0, 0xf5, 0x49, 0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xcc, \
+  0xbd, 0xa9, 0x6b, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x7e, \
+  0x55, 0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, 0x13, 0xda, 0xf7, \
+  0x49, 0xf1, 0x7e, 0x55, 0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, \
+  0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x29, 0x6d, 0x77, 0x0f, 0x00, 0xb5, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, 0x6d, 0xfd, 0xbe, 0x00, \
+  0xd5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, 0x20, 0x4d, \
+  0x49, 0x8c, 0x70, 0xc5, 0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x61, \
+  0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x23, \
+  0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, 0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, \
+  0xe1, 0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, 0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, \
+  0x31, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x31, 0x5f, \
+  0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x31, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x61, 0x36, 0x73, \
+  0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0x00, 0x60, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x6b, 0x32, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x74, 0x6b, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x32, 0x5f, 0x32, 0x00, 0x00, 0x00, \
+  0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, 0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, 0x33, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x33, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xde, 0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, \
+  0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x33, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0xf2, 0xde, 0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, \
+  0x48, 0x5d, 0xb1, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, 0x33, 0x6e, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x33, 0x6e, 0x5f, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0xdc, 0xc3, 0x7d, \
+  0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, 0x6d, 0xfd, 0xbe, 0xf1, 0x71, 0xeb, 0x55, 0x8d, \
+  0x71, 0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, 0x8e, 0xc0, 0x43, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, \
+  0x95, 0xe1, 0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, \
+  0x98, 0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, \
+  0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, \
+  0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, 0x6b, 0x65, \
+  0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, 0xc0, 0xf5, 0x49, 0xc3, 0xcc, \
+  0x32, 0x7e, 0xff, 0xae, 0xf2, 0xde, 0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, \
+  0x48, 0x5d, 0xb1, 0xf1, 0x7e, 0x55, 0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, \
+  0xf5, 0x58\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t7 1314u
+const dds_topic_descriptor_t TypeBuilderTypes_t7_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t7),
+  .m_align = dds_alignof (TypeBuilderTypes_t7),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 6u,
+  .m_typename = "TypeBuilderTypes::t7",
+  .m_keys = TypeBuilderTypes_t7_keys,
+  .m_nops = 17,
+  .m_ops = TypeBuilderTypes_t7_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t7, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t7 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t7, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t7 }
+};
+
+static const uint32_t TypeBuilderTypes_t8_ops [] =
+{
+  /* t8 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f2), 0u, 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f3), 0u, 3u,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f5),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f6), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f7), 1u,
+  DDS_OP_RTS,
+  
+  /* key: f2 */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: f4 */
+  DDS_OP_KOF | 1, 10u /* order: 3 */,
+  
+  /* key: f6 */
+  DDS_OP_KOF | 1, 14u /* order: 5 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t8_keys[3] =
+{
+  { "f2", 21, 0 },
+  { "f4", 23, 1 },
+  { "f6", 25, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 34550f04e3ec9ae5ed1a6b6f181b] (#deps: 2)
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+  [COMPLETE c797f8d8fbe580ae1b6a992803e3] (#deps: 2)
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t8 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x34, 0x55, 0x0f, 0x04, 0xe3, 0xec, 0x9a, 0xe5, 0xed, 0x1a, 0x6b, \
+  0x6f, 0x18, 0x1b, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, \
+  0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x97, 0xf8, 0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, \
+  0x28, 0x03, 0xe3, 0x00, 0x19, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t8 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t8 (const unsigned char []){ \
+  0x6e, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x34, 0x55, 0x0f, 0x04, 0xe3, 0xec, 0x9a, \
+  0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, \
+  0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, \
+  0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x6e, 0x1f, 0xcd, 0x70, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x74, 0xce, 0x2e, 0x1a, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, \
+  0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, \
+  0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x6c, 0x66, 0x4e, 0xee, 0xf1, 0x80, 0x8e, \
+  0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, \
+  0x7b, 0x43, 0x98, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, \
+  0xce, 0x20, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x97, 0xf8, \
+  0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, 0xe3, 0x00, 0x15, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, \
+  0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x37, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, \
+  0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x97, 0xf8, \
+  0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, 0xe3, 0xf1, 0x34, 0x55, 0x0f, 0x04, \
+  0xe3, 0xec, 0x9a, 0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, \
+  0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, \
+  0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t8 1014u
+const dds_topic_descriptor_t TypeBuilderTypes_t8_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t8),
+  .m_align = dds_alignof (TypeBuilderTypes_t8),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "TypeBuilderTypes::t8",
+  .m_keys = TypeBuilderTypes_t8_keys,
+  .m_nops = 8,
+  .m_ops = TypeBuilderTypes_t8_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t8, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t8 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t8, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t8 }
+};
+
+static const uint32_t TypeBuilderTypes_t9_ops [] =
+{
+  /* t9 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t9, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t9, f2), (4u << 16u) + 13u /* t8 */, sizeof (TypeBuilderTypes_t8),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t9, f3), (4u << 16u) + 30u /* t5 */, sizeof (TypeBuilderTypes_t5),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t9, f4), (4u << 16u) + 422u /* t7 */, sizeof (TypeBuilderTypes_t7),
+  DDS_OP_RTS,
+
+  /* t8 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f2), 0u, 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f3), 0u, 3u,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t8, f5),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f6), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t8, f7), 1u,
+  DDS_OP_RTS,
+
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t5, _d), 34u, (383u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_1BY, 1, offsetof (TypeBuilderTypes_t5, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 2, offsetof (TypeBuilderTypes_t5, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BST | 128, 3, offsetof (TypeBuilderTypes_t5, _u.u3), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 4, offsetof (TypeBuilderTypes_t5, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 5, offsetof (TypeBuilderTypes_t5, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 360 /* t1 */, 6, offsetof (TypeBuilderTypes_t5, _u.u6), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 356 /* t1 */, 7, offsetof (TypeBuilderTypes_t5, _u.u6), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BMK | 112, 8, offsetof (TypeBuilderTypes_t5, _u.u8), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 113, 9, offsetof (TypeBuilderTypes_t5, _u.u9), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BSQ | 112, 10, offsetof (TypeBuilderTypes_t5, _u.u10), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 11, offsetof (TypeBuilderTypes_t5, _u.u11), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), 12, offsetof (TypeBuilderTypes_t5, _u.u12), 1u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 13, offsetof (TypeBuilderTypes_t5, _u.u13), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 14, offsetof (TypeBuilderTypes_t5, _u.u14), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 324 /* t1 */, 15, offsetof (TypeBuilderTypes_t5, _u.u15), sizeof (TypeBuilderTypes_t1),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 320 /* t1 */, 16, offsetof (TypeBuilderTypes_t5, _u.u15), sizeof (TypeBuilderTypes_t1),
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BLN, 17, offsetof (TypeBuilderTypes_t5, _u.u17), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 18, offsetof (TypeBuilderTypes_t5, _u.u18), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), 19, offsetof (TypeBuilderTypes_t5, _u.u19), 1u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BMK | 76, 21, offsetof (TypeBuilderTypes_t5, _u.u21), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BSQ | 77, 22, offsetof (TypeBuilderTypes_t5, _u.u22), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 77, 23, offsetof (TypeBuilderTypes_t5, _u.u23), sizeof (dds_sequence_long),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 82, 24, offsetof (TypeBuilderTypes_t5, _u.u24), sizeof (dds_sequence_sequence_long),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 92, 25, offsetof (TypeBuilderTypes_t5, _u.u25), sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 104, 26, offsetof (TypeBuilderTypes_t5, _u.u26), sizeof (dds_sequence_TypeBuilderTypes_td1),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | 115, 27, offsetof (TypeBuilderTypes_t5, _u.u27), sizeof (dds_sequence_sequence_TypeBuilderTypes_td2),
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 155, 28, offsetof (TypeBuilderTypes_t5, _u.u28), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 169, 29, offsetof (TypeBuilderTypes_t5, _u.u29), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 186, 30, offsetof (TypeBuilderTypes_t5, _u.u30), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 197, 31, offsetof (TypeBuilderTypes_t5, _u.u31), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 208, 32, offsetof (TypeBuilderTypes_t5, _u.u32), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 214, 33, offsetof (TypeBuilderTypes_t5, _u.u33), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 248, 34, offsetof (TypeBuilderTypes_t5, _u.u34), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 251 /* t4 */, 35, offsetof (TypeBuilderTypes_t5, _u.u35), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_BST, 0u, 6u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (8u << 16u) + 5u, sizeof (dds_sequence_long),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (13u << 16u) + 5u, sizeof (dds_sequence_sequence_long),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_SEQ, 0u, sizeof (dds_sequence_long), (7u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 12u, (15u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_SEQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_bm16), (9u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 3u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_td1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td1), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 125000u, (43u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_td2),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_TypeBuilderTypes_td2), (37u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td2), (31u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda4), (26u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda4), (20u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 3u, sizeof (TypeBuilderTypes_tda4), (15u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 6u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 12u, (17u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_bm16),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BSQ, 0u, 8u, sizeof (dds_sequence_TypeBuilderTypes_bm16), (11u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), 0u, 12u, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 12u, (20u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda1), (14u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 5u, sizeof (TypeBuilderTypes_tda1), (9u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 1200u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_tda2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ARR, 0u, sizeof (TypeBuilderTypes_tda2), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 1200u, (14u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_tda3), (8u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 1200000u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 500u, (37u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_td2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (TypeBuilderTypes_td2), (31u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_SEQ, 0u, 2u, sizeof (dds_sequence_sequence_TypeBuilderTypes_tda4), (26u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BSQ, 0u, sizeof (dds_sequence_TypeBuilderTypes_tda4), (20u << 16u) + 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_ARR, 0u, 3u, sizeof (TypeBuilderTypes_tda4), (15u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, 0u, 6u, (9u << 16u) + 5u, sizeof (TypeBuilderTypes_tda3),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, 0u, 2u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t4, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (TypeBuilderTypes_t4, f3), sizeof (TypeBuilderTypes_t1), (4u << 16u) + 65529u /* t1 */,
+  DDS_OP_RTS,
+
+  /* t7 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t7, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f2), (3u << 16u) + 12u /* tk1 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f3), (3u << 16u) + 14u /* tk2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t7, f4),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t7, f5), (3u << 16u) + 14u /* tk3 */,
+  DDS_OP_RTS,
+
+  /* tk1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk1, tk1_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk1, tk1_2),
+  DDS_OP_RTS,
+
+  /* tk2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk2, tk2_1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk2, tk2_2),
+  DDS_OP_RTS,
+
+  /* tk3 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk3, tk3_1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_tk3, tk3_2), (3u << 16u) + 4u /* tk3n */,
+  DDS_OP_RTS,
+
+  /* tk3n */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_tk3n, tk3n_1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a9133e340730fb48f7e56e21b8f9] (#deps: 20)
+   - [MINIMAL 34550f04e3ec9ae5ed1a6b6f181b]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL d24552ca6618e0dcf99d2c4fbdec]
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL cac354c84814910b3025f4a96b04]
+   - [MINIMAL 58a531131473632ee3ba38595896]
+   - [MINIMAL 07c219604fef00f88af047c41e85]
+   - [MINIMAL 1aeb32bde3e52b3eae6e585eeb4b]
+   - [MINIMAL e38971595724bfe1171c685c0107]
+   - [MINIMAL 687416ee263919082770c074c0c5]
+   - [MINIMAL 001d5d2707f221b044e322296a6b]
+   - [MINIMAL fa612aeb32e8adfa5bc31650d807]
+   - [MINIMAL 40845480bb017badbbe737be16ce]
+   - [MINIMAL 8e65e5d6272ed068fe6fb7959de7]
+   - [MINIMAL 71eb558d71e5e3617681448ec043]
+   - [MINIMAL 221dd8b1944998719ccf5d20d703]
+   - [MINIMAL bfd233f78f93a7c6ef22abaeadca]
+   - [MINIMAL 4f0197b9efc0f549c3cc327effae]
+   - [MINIMAL 7e55bdb9d5cc9ed924994112f558]
+  [COMPLETE ab08a74161dba2fad3f362901b80] (#deps: 20)
+   - [COMPLETE c797f8d8fbe580ae1b6a992803e3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 5a5b30534666aca7ddaa5e78540b]
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE 2dbb7af22b6d7296291530ff9904]
+   - [COMPLETE f61b99f039473cb4a610a1cac9a0]
+   - [COMPLETE 614ec90d8acf305ee44e80c43f2d]
+   - [COMPLETE edf210d28016f8d9e006f91a2b02]
+   - [COMPLETE 4f89b29cc5247899f91a11a8dd85]
+   - [COMPLETE 34ad0f64bbfc208988ea2c2ea272]
+   - [COMPLETE 852f2f51b604d30704ce85540c27]
+   - [COMPLETE 8d32ecf84d3861100ec94ecaefda]
+   - [COMPLETE d40083b8ea88909b22a77a66bdcc]
+   - [COMPLETE 3f35e2e96c2e7e4a0001ccea52da]
+   - [COMPLETE dcc37da883ba03fdf5e0716dfdbe]
+   - [COMPLETE 88a15e895395e1204d498c70c53e]
+   - [COMPLETE 613673f3041c6d3acaafa0326c2c]
+   - [COMPLETE 23a2ff13853be16b654f711fbbfb]
+   - [COMPLETE de5714f7b2b018622c0a7f485db1]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t9 (const unsigned char []){ \
+  0x20, 0x04, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa9, 0x13, 0x3e, 0x34, 0x07, 0x30, 0xfb, 0x48, 0xf7, 0xe5, 0x6e, \
+  0x21, 0xb8, 0xf9, 0x00, 0x85, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x34, 0x55, 0x0f, 0x04, 0xe3, 0xec, 0x9a, \
+  0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, 0x18, 0xe0, 0xdc, 0xf9, 0x9d, 0x2c, 0x4f, 0xbd, 0xec, 0x00, \
+  0x14, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, \
+  0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, \
+  0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, 0x00, 0x32, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, \
+  0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, 0xad, \
+  0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, 0x07, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, \
+  0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x66, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, 0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, 0x8e, 0xc0, 0x43, 0x00, \
+  0x95, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, 0x98, \
+  0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0x00, \
+  0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, 0xc0, 0xf5, \
+  0x49, 0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x7e, 0x55, 0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xab, 0x08, 0xa7, 0x41, 0x61, 0xdb, 0xa2, 0xfa, 0xd3, 0xf3, 0x62, \
+  0x90, 0x1b, 0x80, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x97, 0xf8, 0xd8, 0xfb, 0xe5, 0x80, \
+  0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, 0xe3, 0x00, 0x19, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5a, 0x5b, 0x30, 0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, 0x78, 0x54, 0x0b, 0x00, \
+  0x2e, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, \
+  0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, \
+  0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, \
+  0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x4f, 0x89, 0xb2, 0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, \
+  0x4e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, 0x20, \
+  0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, 0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, 0x38, 0x61, \
+  0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x00, 0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, \
+  0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, 0x6d, 0xfd, 0xbe, 0x00, \
+  0xd9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, \
+  0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, 0x00, 0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0x00, \
+  0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, \
+  0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, 0x74, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xde, 0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0x00, \
+  0x4d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t9 1060u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t9 (const unsigned char []){ \
+  0x8f, 0x0b, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf1, 0xa9, 0x13, 0x3e, 0x34, 0x07, 0x30, 0xfb, \
+  0x48, 0xf7, 0xe5, 0x6e, 0x21, 0xb8, 0xf9, 0x00, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x34, 0x55, 0x0f, 0x04, 0xe3, \
+  0xec, 0x9a, 0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, \
+  0x18, 0xe0, 0xdc, 0xf9, 0x9d, 0x2c, 0x4f, 0xbd, 0xec, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, \
+  0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, 0x8e, 0xc0, 0x43, 0x6e, 0x1f, 0xcd, 0x70, 0xf1, 0x34, 0x55, \
+  0x0f, 0x04, 0xe3, 0xec, 0x9a, 0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, 0xc1, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x36, 0x67, 0xf6, \
+  0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x17, 0x79, 0xcf, \
+  0x3a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x6e, \
+  0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x74, \
+  0xce, 0x2e, 0x1a, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x16, \
+  0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x64, 0xe4, 0xcd, \
+  0xa1, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x16, \
+  0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x6c, 0x66, 0x4e, \
+  0xee, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, \
+  0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, \
+  0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0xd2, 0x45, 0x52, 0xca, 0x66, 0x18, 0xe0, 0xdc, 0xf9, \
+  0x9d, 0x2c, 0x4f, 0xbd, 0xec, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0xfc, 0x04, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x27, 0x0c, 0x1b, 0x08, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0x18, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x7b, 0x8d, 0x62, 0xfd, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, \
+  0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0xa6, 0xa0, 0x3a, 0x32, 0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x73, 0x93, 0x85, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x54, 0x86, 0x25, 0x9f, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0xcb, 0x82, 0x32, 0xdd, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xa4, 0xcb, 0x5c, 0xf0, 0x24, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, \
+  0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0xe2, 0xdb, 0xa0, 0x64, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xe2, 0x0d, 0x51, 0x5f, 0x14, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x6d, 0x90, 0xe8, 0xba, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0xb4, 0x42, 0x57, \
+  0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x14, 0xcf, 0x27, 0xf1, 0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x32, 0xae, 0x1a, 0x36, \
+  0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, \
+  0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x0d, 0x71, 0x6c, 0x72, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, \
+  0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0xa8, 0xb7, 0x6f, \
+  0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, \
+  0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x4d, 0xab, 0xfc, 0x91, 0x24, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, \
+  0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x45, 0xf1, 0xec, 0x94, \
+  0x2c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf3, 0x00, 0x01, 0x00, \
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x29, 0x5f, 0xe5, 0xc8, \
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf1, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, \
+  0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x5c, 0x0b, 0x30, 0x0c, 0x34, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, \
+  0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x46, 0x2d, 0xf5, 0x81, 0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, \
+  0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x81, 0x8c, 0x47, 0x5e, 0x38, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x80, 0xf1, 0x01, 0x00, 0x08, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x0c, 0xf1, 0x58, 0xa5, \
+  0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x01, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x26, 0x90, 0x3b, 0xbe, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf1, \
+  0x01, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x05, 0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, \
+  0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0xca, 0xb3, 0x4b, 0xec, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, 0xad, 0xfa, 0x5b, 0xc3, \
+  0x16, 0x50, 0xd8, 0x07, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0xe1, 0x41, 0x0e, \
+  0x38, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, \
+  0x00, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x93, 0xa5, 0x34, 0x00, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x90, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, \
+  0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0xa3, 0x11, 0xa8, 0x31, 0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, \
+  0x00, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x72, 0xda, 0x1b, 0x18, 0x24, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, \
+  0xe7, 0x37, 0xbe, 0x16, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x2c, 0x32, 0x9f, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8e, \
+  0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xed, 0xb8, 0x60, 0x2c, 0xf1, 0xf5, 0x4b, 0x39, \
+  0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, 0x30, 0x25, 0xf4, 0xa9, \
+  0x6b, 0x04, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1e, 0x83, 0x07, 0x46, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x19, \
+  0x84, 0x77, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, \
+  0x96, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xe7, 0x09, 0xa5, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x67, 0xfa, 0xf1, 0x07, 0xc2, 0x19, \
+  0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, 0x1e, 0x85, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x02, 0x09, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, \
+  0x5e, 0xeb, 0x4b, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, \
+  0x00, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x03, 0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, \
+  0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0xf1, 0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, \
+  0x1c, 0x68, 0x5c, 0x01, 0x07, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, \
+  0xc0, 0x74, 0xc0, 0xc5, 0xf1, 0x68, 0x74, 0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, \
+  0x74, 0xc0, 0xc5, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, \
+  0xf0, 0x47, 0xc4, 0x1e, 0x85, 0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, \
+  0x22, 0x29, 0x6a, 0x6b, 0x1a, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x04, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, 0xad, 0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, \
+  0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x1d, 0x5d, 0x27, 0x07, 0xf2, 0x21, 0xb0, 0x44, \
+  0xe3, 0x22, 0x29, 0x6a, 0x6b, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, \
+  0x37, 0xbe, 0x16, 0xce, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0xf1, 0x8e, 0x65, 0xe5, \
+  0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, 0xb7, 0x95, 0x9d, 0xe7, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, 0x00, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x17, 0x79, \
+  0xcf, 0x3a, 0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, 0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, 0x8e, 0xc0, \
+  0x43, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, 0x98, 0x71, 0x9c, \
+  0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, \
+  0x22, 0xab, 0xae, 0xad, 0xca, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, 0xc0, 0xf5, 0x49, 0xc3, \
+  0xcc, 0x32, 0x7e, 0xff, 0xae, 0x74, 0xce, 0x2e, 0x1a, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, \
+  0x98, 0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x50, 0xbb, 0x3a, 0x8c, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x88, 0x8b, 0xfe, 0x04, 0xf1, \
+  0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0xf6, 0xd0, 0xc6, 0xac, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0xdd, 0x25, 0xd1, 0x68, 0xf1, 0x4f, 0x01, 0x97, 0xb9, 0xef, 0xc0, 0xf5, 0x49, \
+  0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xcc, 0xbd, 0xa9, 0x6b, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x7e, 0x55, 0xbd, 0xb9, 0xd5, \
+  0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, 0x13, 0xda, 0xf7, 0x49, 0xf1, 0x7e, 0x55, \
+  0xbd, 0xb9, 0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x29, \
+  0x6d, 0x77, 0x0f, 0x00, 0x21, 0x10, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf2, 0xab, 0x08, 0xa7, \
+  0x41, 0x61, 0xdb, 0xa2, 0xfa, 0xd3, 0xf3, 0x62, 0x90, 0x1b, 0x80, 0x00, 0xbd, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xc7, 0x97, 0xf8, 0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, \
+  0xe3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0x5a, 0x5b, 0x30, 0x53, 0x46, \
+  0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, 0x78, 0x54, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, 0x6d, 0xfd, \
+  0xbe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x97, \
+  0xf8, 0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, 0xe3, 0x15, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, \
+  0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x37, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, \
+  0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x5a, 0x5b, 0x30, 0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, 0x78, 0x54, 0x0b, \
+  0x2a, 0x06, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x35, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x37, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x38, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2d, \
+  0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x31, 0x39, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xf6, \
+  0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x61, \
+  0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x04, \
+  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x33, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x80, \
+  0xf3, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, 0xf6, 0x1b, \
+  0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, 0x61, 0x4e, 0xc9, 0x0d, \
+  0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x4a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x80, 0xf2, 0x01, 0x00, 0x02, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, 0xed, 0xf2, 0x10, 0xd2, \
+  0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x08, 0x80, 0xf2, 0x00, 0x01, 0x00, \
+  0x0c, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x32, 0x38, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x80, 0xf2, 0x01, 0x00, 0x00, 0x80, \
+  0xf2, 0x00, 0x01, 0x00, 0x05, 0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, \
+  0x85, 0x54, 0x0c, 0x27, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, 0x38, \
+  0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x34, 0xad, \
+  0x0f, 0x64, 0xbb, 0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x01, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf2, 0x4f, 0x89, 0xb2, \
+  0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0xed, 0xf2, \
+  0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, \
+  0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, \
+  0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x33, 0x35, 0x00, 0x00, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, \
+  0x72, 0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x38, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x4e, 0x38, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x38, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, \
+  0xca, 0xc9, 0xa0, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x36, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, \
+  0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x61, 0x4e, \
+  0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x36, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, \
+  0x06, 0xf9, 0x1a, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, \
+  0x32, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x02, 0x80, \
+  0xf2, 0x00, 0x01, 0x00, 0x00, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x03, 0xf2, 0x4f, 0x89, 0xb2, 0x9c, \
+  0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x00, 0xf2, 0x4f, 0x89, 0xb2, \
+  0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0x00, 0x4a, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x61, 0x34, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, 0xfc, \
+  0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, 0x00, 0xf2, 0x34, 0xad, 0x0f, 0x64, 0xbb, \
+  0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x64, 0x61, 0x33, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x61, \
+  0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, 0xc4, 0x3f, 0x2d, 0x00, 0x00, 0xf2, \
+  0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0x00, 0x00, \
+  0x3c, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, 0x61, 0x31, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, \
+  0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, 0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0x00, \
+  0x3f, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x64, 0x61, 0x32, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xf2, 0x85, 0x2f, 0x2f, 0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, \
+  0x27, 0x00, 0x00, 0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, 0x9b, 0x22, 0xa7, 0x7a, 0x66, \
+  0xbd, 0xcc, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf2, 0x3f, \
+  0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, 0x01, 0xcc, 0xea, 0x52, 0xda, 0x00, 0x00, 0x00, \
+  0x95, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, \
+  0x03, 0xfd, 0xf5, 0xe0, 0x71, 0x6d, 0xfd, 0xbe, 0xd5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x37, \
+  0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x88, \
+  0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, 0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, \
+  0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, 0x6b, 0x65, \
+  0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, \
+  0x00, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, 0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, 0x3e, \
+  0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, 0x31, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x31, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, \
+  0x32, 0x6c, 0x2c, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, 0x32, 0x00, 0x00, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x74, 0x6b, 0x32, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x23, 0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, \
+  0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x6b, \
+  0x33, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x33, 0x5f, \
+  0x31, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xde, \
+  0x57, 0x14, 0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x6b, 0x33, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xde, 0x57, 0x14, \
+  0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0x00, 0x49, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x6b, 0x33, 0x6e, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x74, 0x6b, 0x33, 0x6e, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x02, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0xf2, 0xab, 0x08, 0xa7, 0x41, 0x61, 0xdb, 0xa2, 0xfa, 0xd3, 0xf3, 0x62, \
+  0x90, 0x1b, 0x80, 0xf1, 0xa9, 0x13, 0x3e, 0x34, 0x07, 0x30, 0xfb, 0x48, 0xf7, 0xe5, 0x6e, 0x21, \
+  0xb8, 0xf9, 0xf2, 0xc7, 0x97, 0xf8, 0xd8, 0xfb, 0xe5, 0x80, 0xae, 0x1b, 0x6a, 0x99, 0x28, 0x03, \
+  0xe3, 0xf1, 0x34, 0x55, 0x0f, 0x04, 0xe3, 0xec, 0x9a, 0xe5, 0xed, 0x1a, 0x6b, 0x6f, 0x18, 0x1b, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, \
+  0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, \
+  0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x5a, 0x5b, 0x30, \
+  0x53, 0x46, 0x66, 0xac, 0xa7, 0xdd, 0xaa, 0x5e, 0x78, 0x54, 0x0b, 0xf1, 0xd2, 0x45, 0x52, 0xca, \
+  0x66, 0x18, 0xe0, 0xdc, 0xf9, 0x9d, 0x2c, 0x4f, 0xbd, 0xec, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xf2, 0x2d, 0xbb, 0x7a, 0xf2, 0x2b, 0x6d, 0x72, \
+  0x96, 0x29, 0x15, 0x30, 0xff, 0x99, 0x04, 0xf1, 0xca, 0xc3, 0x54, 0xc8, 0x48, 0x14, 0x91, 0x0b, \
+  0x30, 0x25, 0xf4, 0xa9, 0x6b, 0x04, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, \
+  0x10, 0xa1, 0xca, 0xc9, 0xa0, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, \
+  0x38, 0x59, 0x58, 0x96, 0xf2, 0x61, 0x4e, 0xc9, 0x0d, 0x8a, 0xcf, 0x30, 0x5e, 0xe4, 0x4e, 0x80, \
+  0xc4, 0x3f, 0x2d, 0xf1, 0x07, 0xc2, 0x19, 0x60, 0x4f, 0xef, 0x00, 0xf8, 0x8a, 0xf0, 0x47, 0xc4, \
+  0x1e, 0x85, 0xf2, 0xed, 0xf2, 0x10, 0xd2, 0x80, 0x16, 0xf8, 0xd9, 0xe0, 0x06, 0xf9, 0x1a, 0x2b, \
+  0x02, 0xf1, 0x1a, 0xeb, 0x32, 0xbd, 0xe3, 0xe5, 0x2b, 0x3e, 0xae, 0x6e, 0x58, 0x5e, 0xeb, 0x4b, \
+  0xf2, 0x4f, 0x89, 0xb2, 0x9c, 0xc5, 0x24, 0x78, 0x99, 0xf9, 0x1a, 0x11, 0xa8, 0xdd, 0x85, 0xf1, \
+  0xe3, 0x89, 0x71, 0x59, 0x57, 0x24, 0xbf, 0xe1, 0x17, 0x1c, 0x68, 0x5c, 0x01, 0x07, 0xf2, 0x34, \
+  0xad, 0x0f, 0x64, 0xbb, 0xfc, 0x20, 0x89, 0x88, 0xea, 0x2c, 0x2e, 0xa2, 0x72, 0xf1, 0x68, 0x74, \
+  0x16, 0xee, 0x26, 0x39, 0x19, 0x08, 0x27, 0x70, 0xc0, 0x74, 0xc0, 0xc5, 0xf2, 0x85, 0x2f, 0x2f, \
+  0x51, 0xb6, 0x04, 0xd3, 0x07, 0x04, 0xce, 0x85, 0x54, 0x0c, 0x27, 0xf1, 0x00, 0x1d, 0x5d, 0x27, \
+  0x07, 0xf2, 0x21, 0xb0, 0x44, 0xe3, 0x22, 0x29, 0x6a, 0x6b, 0xf2, 0x8d, 0x32, 0xec, 0xf8, 0x4d, \
+  0x38, 0x61, 0x10, 0x0e, 0xc9, 0x4e, 0xca, 0xef, 0xda, 0xf1, 0xfa, 0x61, 0x2a, 0xeb, 0x32, 0xe8, \
+  0xad, 0xfa, 0x5b, 0xc3, 0x16, 0x50, 0xd8, 0x07, 0xf2, 0xd4, 0x00, 0x83, 0xb8, 0xea, 0x88, 0x90, \
+  0x9b, 0x22, 0xa7, 0x7a, 0x66, 0xbd, 0xcc, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, \
+  0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0xf2, 0x3f, 0x35, 0xe2, 0xe9, 0x6c, 0x2e, 0x7e, 0x4a, 0x00, \
+  0x01, 0xcc, 0xea, 0x52, 0xda, 0xf1, 0x8e, 0x65, 0xe5, 0xd6, 0x27, 0x2e, 0xd0, 0x68, 0xfe, 0x6f, \
+  0xb7, 0x95, 0x9d, 0xe7, 0xf2, 0xdc, 0xc3, 0x7d, 0xa8, 0x83, 0xba, 0x03, 0xfd, 0xf5, 0xe0, 0x71, \
+  0x6d, 0xfd, 0xbe, 0xf1, 0x71, 0xeb, 0x55, 0x8d, 0x71, 0xe5, 0xe3, 0x61, 0x76, 0x81, 0x44, 0x8e, \
+  0xc0, 0x43, 0xf2, 0x88, 0xa1, 0x5e, 0x89, 0x53, 0x95, 0xe1, 0x20, 0x4d, 0x49, 0x8c, 0x70, 0xc5, \
+  0x3e, 0xf1, 0x22, 0x1d, 0xd8, 0xb1, 0x94, 0x49, 0x98, 0x71, 0x9c, 0xcf, 0x5d, 0x20, 0xd7, 0x03, \
+  0xf2, 0x61, 0x36, 0x73, 0xf3, 0x04, 0x1c, 0x6d, 0x3a, 0xca, 0xaf, 0xa0, 0x32, 0x6c, 0x2c, 0xf1, \
+  0xbf, 0xd2, 0x33, 0xf7, 0x8f, 0x93, 0xa7, 0xc6, 0xef, 0x22, 0xab, 0xae, 0xad, 0xca, 0xf2, 0x23, \
+  0xa2, 0xff, 0x13, 0x85, 0x3b, 0xe1, 0x6b, 0x65, 0x4f, 0x71, 0x1f, 0xbb, 0xfb, 0xf1, 0x4f, 0x01, \
+  0x97, 0xb9, 0xef, 0xc0, 0xf5, 0x49, 0xc3, 0xcc, 0x32, 0x7e, 0xff, 0xae, 0xf2, 0xde, 0x57, 0x14, \
+  0xf7, 0xb2, 0xb0, 0x18, 0x62, 0x2c, 0x0a, 0x7f, 0x48, 0x5d, 0xb1, 0xf1, 0x7e, 0x55, 0xbd, 0xb9, \
+  0xd5, 0xcc, 0x9e, 0xd9, 0x24, 0x99, 0x41, 0x12, 0xf5, 0x58\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t9 7738u
+const dds_topic_descriptor_t TypeBuilderTypes_t9_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t9),
+  .m_align = dds_alignof (TypeBuilderTypes_t9),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t9",
+  .m_keys = NULL,
+  .m_nops = 169,
+  .m_ops = TypeBuilderTypes_t9_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t9, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t9 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t9, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t9 }
+};
+
+static const uint32_t TypeBuilderTypes_t10_2_ops [] =
+{
+  /* t10_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10_2, f10_2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 9c49981a0d93ff5a7cabbe122099] (#deps: 0)
+  [COMPLETE 1a9e3f1d9234a09bfcf8434cc04a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t10_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, \
+  0x12, 0x20, 0x99, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, \
+  0x4c, 0xc0, 0x4a, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10_2 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t10_2 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, \
+  0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x45, 0x58, 0xb0, 0xb8, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x30, 0x5f, 0x32, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, \
+  0x1d, 0x92, 0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0xf1, 0x9c, 0x49, 0x98, 0x1a, \
+  0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10_2 202u
+const dds_topic_descriptor_t TypeBuilderTypes_t10_2_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t10_2),
+  .m_align = dds_alignof (TypeBuilderTypes_t10_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t10_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t10_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t10_2, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t10_2, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10_2 }
+};
+
+static const uint32_t TypeBuilderTypes_t10_1_ops [] =
+{
+  /* t10_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t10_1, parent), (3u << 16u) + 6u /* t10_2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10_1, f10_1),
+  DDS_OP_RTS,
+
+  /* t10_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10_2, f10_2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 1656bbd9df5f4b6f643643455ec2] (#deps: 1)
+   - [MINIMAL 9c49981a0d93ff5a7cabbe122099]
+  [COMPLETE d36b30c2851ea010fa9cf608250b] (#deps: 1)
+   - [COMPLETE 1a9e3f1d9234a09bfcf8434cc04a]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t10_1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, 0x4b, 0x6f, 0x64, 0x36, 0x43, \
+  0x45, 0x5e, 0xc2, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, \
+  0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, 0x30, \
+  0xc2, 0x85, 0x1e, 0xa0, 0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0x00, 0x5c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10_1 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t10_1 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, 0x4b, \
+  0x6f, 0x64, 0x36, 0x43, 0x45, 0x5e, 0xc2, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, \
+  0x12, 0x20, 0x99, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x6a, 0xf0, 0xaf, 0x06, 0xf1, 0x9c, 0x49, 0x98, 0x1a, \
+  0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x45, \
+  0x58, 0xb0, 0xb8, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, 0x30, \
+  0xc2, 0x85, 0x1e, 0xa0, 0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x30, 0x5f, 0x31, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x30, 0x5f, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x30, 0x5f, 0x32, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, 0x30, \
+  0xc2, 0x85, 0x1e, 0xa0, 0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0xf1, 0x16, 0x56, 0xbb, 0xd9, \
+  0xdf, 0x5f, 0x4b, 0x6f, 0x64, 0x36, 0x43, 0x45, 0x5e, 0xc2, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, \
+  0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, \
+  0xff, 0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10_1 408u
+const dds_topic_descriptor_t TypeBuilderTypes_t10_1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t10_1),
+  .m_align = dds_alignof (TypeBuilderTypes_t10_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t10_1",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = TypeBuilderTypes_t10_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t10_1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t10_1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10_1 }
+};
+
+static const uint32_t TypeBuilderTypes_t10_ops [] =
+{
+  /* t10 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t10, parent), (3u << 16u) + 9u /* t10_1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t10, f2), (3u << 16u) + 10u /* t10_2 */,
+  DDS_OP_RTS,
+
+  /* t10_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t10_1, parent), (3u << 16u) + 6u /* t10_2 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10_1, f10_1),
+  DDS_OP_RTS,
+
+  /* t10_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t10_2, f10_2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 3f38d502aa4ee8c29d1b3ee96ef8] (#deps: 2)
+   - [MINIMAL 1656bbd9df5f4b6f643643455ec2]
+   - [MINIMAL 9c49981a0d93ff5a7cabbe122099]
+  [COMPLETE bdef66fc81984374d44e0d33aa25] (#deps: 2)
+   - [COMPLETE d36b30c2851ea010fa9cf608250b]
+   - [COMPLETE 1a9e3f1d9234a09bfcf8434cc04a]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t10 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0x38, 0xd5, 0x02, 0xaa, 0x4e, 0xe8, 0xc2, 0x9d, 0x1b, 0x3e, \
+  0xe9, 0x6e, 0xf8, 0x00, 0x51, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, 0x4b, \
+  0x6f, 0x64, 0x36, 0x43, 0x45, 0x5e, 0xc2, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0xef, 0x66, 0xfc, 0x81, 0x98, 0x43, 0x74, 0xd4, 0x4e, 0x0d, \
+  0x33, 0xaa, 0x25, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, 0x30, 0xc2, 0x85, 0x1e, 0xa0, \
+  0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, \
+  0x4c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t10 (const unsigned char []){ \
+  0xdf, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0x38, 0xd5, 0x02, 0xaa, 0x4e, 0xe8, \
+  0xc2, 0x9d, 0x1b, 0x3e, 0xe9, 0x6e, 0xf8, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, 0x4b, 0x6f, 0x64, 0x36, 0x43, \
+  0x45, 0x5e, 0xc2, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, 0x7c, \
+  0xab, 0xbe, 0x12, 0x20, 0x99, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, \
+  0x4b, 0x6f, 0x64, 0x36, 0x43, 0x45, 0x5e, 0xc2, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, \
+  0x12, 0x20, 0x99, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x6a, 0xf0, 0xaf, 0x06, 0xf1, 0x9c, 0x49, 0x98, 0x1a, \
+  0x0d, 0x93, 0xff, 0x5a, 0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x45, \
+  0x58, 0xb0, 0xb8, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0xef, 0x66, \
+  0xfc, 0x81, 0x98, 0x43, 0x74, 0xd4, 0x4e, 0x0d, 0x33, 0xaa, 0x25, 0x00, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, 0x30, 0xc2, 0x85, 0x1e, 0xa0, \
+  0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, 0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, \
+  0x4a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x6b, \
+  0x30, 0xc2, 0x85, 0x1e, 0xa0, 0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0x58, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x30, 0x5f, 0x31, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x30, 0x5f, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x30, 0x5f, 0x32, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0xef, 0x66, \
+  0xfc, 0x81, 0x98, 0x43, 0x74, 0xd4, 0x4e, 0x0d, 0x33, 0xaa, 0x25, 0xf1, 0x3f, 0x38, 0xd5, 0x02, \
+  0xaa, 0x4e, 0xe8, 0xc2, 0x9d, 0x1b, 0x3e, 0xe9, 0x6e, 0xf8, 0xf2, 0xd3, 0x6b, 0x30, 0xc2, 0x85, \
+  0x1e, 0xa0, 0x10, 0xfa, 0x9c, 0xf6, 0x08, 0x25, 0x0b, 0xf1, 0x16, 0x56, 0xbb, 0xd9, 0xdf, 0x5f, \
+  0x4b, 0x6f, 0x64, 0x36, 0x43, 0x45, 0x5e, 0xc2, 0xf2, 0x1a, 0x9e, 0x3f, 0x1d, 0x92, 0x34, 0xa0, \
+  0x9b, 0xfc, 0xf8, 0x43, 0x4c, 0xc0, 0x4a, 0xf1, 0x9c, 0x49, 0x98, 0x1a, 0x0d, 0x93, 0xff, 0x5a, \
+  0x7c, 0xab, 0xbe, 0x12, 0x20, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10 678u
+const dds_topic_descriptor_t TypeBuilderTypes_t10_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t10),
+  .m_align = dds_alignof (TypeBuilderTypes_t10),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t10",
+  .m_keys = NULL,
+  .m_nops = 9,
+  .m_ops = TypeBuilderTypes_t10_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t10, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t10 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t10, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t10 }
+};
+
+static const uint32_t TypeBuilderTypes_t11_ops [] =
+{
+  /* t11 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11, u1), (3u << 16u) + 7u /* t11a */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11, u2), (3u << 16u) + 7u /* t11b */,
+  DDS_OP_RTS,
+
+  /* t11a */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t11a, f1),
+  DDS_OP_RTS,
+
+  /* t11b */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11b, f1), (3u << 16u) + 65532u /* t11a */,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c38eaea5aa1dd3983876dfaa2c18] (#deps: 2)
+   - [MINIMAL e888b59a0645dd608e4145a61d9a]
+   - [MINIMAL 92584c8dc006fa4fd3e0ce20d053]
+  [COMPLETE 16e651f93b0d42e516f0414f0d0a] (#deps: 2)
+   - [COMPLETE 10be10a3e2c6441eb53dcc032e5b]
+   - [COMPLETE 2ee215a857f64dc4308e7740b52f]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t11 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, 0x98, 0x38, 0x76, 0xdf, \
+  0xaa, 0x2c, 0x18, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, 0x45, 0xdd, \
+  0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, \
+  0x4f, 0x0d, 0x0a, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, \
+  0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2e, 0xe2, 0x15, 0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t11 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t11 (const unsigned char []){ \
+  0xe5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, \
+  0x98, 0x38, 0x76, 0xdf, 0xaa, 0x2c, 0x18, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, \
+  0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xe4, 0x77, 0x4c, 0xdd, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, \
+  0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53, 0x27, 0x0c, 0x1b, 0x08, 0xf1, 0xe8, 0x88, \
+  0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, \
+  0xd0, 0x53, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, \
+  0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, \
+  0x4f, 0x0d, 0x0a, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, \
+  0x51, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, \
+  0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2e, 0xe2, 0x15, 0xa8, 0x57, \
+  0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, \
+  0xcc, 0x03, 0x2e, 0x5b, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x31, 0x61, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0xe2, \
+  0x15, 0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0a, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x31, 0x62, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, \
+  0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, 0x4f, 0x0d, 0x0a, 0xf1, \
+  0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, 0x98, 0x38, 0x76, 0xdf, 0xaa, 0x2c, 0x18, 0xf2, 0x10, \
+  0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0xf1, 0xe8, 0x88, \
+  0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xf2, 0x2e, 0xe2, 0x15, \
+  0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0xf1, 0x92, 0x58, 0x4c, 0x8d, \
+  0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t11 682u
+const dds_topic_descriptor_t TypeBuilderTypes_t11_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t11),
+  .m_align = dds_alignof (TypeBuilderTypes_t11),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t11",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = TypeBuilderTypes_t11_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t11, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t11 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t11, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t11 }
+};
+
+static const uint32_t TypeBuilderTypes_t12_ops [] =
+{
+  /* t12 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 19, 0u,
+  DDS_OP_PLM | 20, 1u,
+  DDS_OP_PLM | 21, 2u,
+  DDS_OP_PLM | 23, 3u,
+  DDS_OP_PLM | 25, 4u,
+  DDS_OP_PLM | 27, 5u,
+  DDS_OP_PLM | 29, 6u,
+  DDS_OP_PLM | 45, 7u,
+  DDS_OP_PLM | 47, 8u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12, f2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f3), (3u << 16u) + 42u /* t12a */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f4), (3u << 16u) + 41u /* t12b */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t12, f5), 6u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f6), (3u << 16u) + 30u /* t12a */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, offsetof (TypeBuilderTypes_t12, f7), 3u, (17u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_t12b),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BSQ, 0u, 4u, sizeof (dds_sequence_TypeBuilderTypes_t12b), (11u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STU, 0u, 5u, sizeof (TypeBuilderTypes_t12b), (5u << 16u) + 19u /* t12b */,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, offsetof (TypeBuilderTypes_t12, f8), 12u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t12, f9), 5u,
+  DDS_OP_RTS,
+
+  /* t12a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12a, fa1),
+  DDS_OP_RTS,
+
+  /* t12b */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12b, fb1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12b, fb2), (3u << 16u) + 65531u /* t12a */,
+  DDS_OP_RTS,
+  
+  /* key: f2 */
+  DDS_OP_KOF | 1, 23u /* order: 1 */,
+  
+  /* key: f6.fa1 */
+  DDS_OP_KOF | 2, 38u /* order: 5 */, 0u /* order: 0 */,
+  
+  /* key: f8 */
+  DDS_OP_KOF | 1, 60u /* order: 7 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t12_keys[3] =
+{
+  { "f2", 77, 0 },
+  { "f6.fa1", 79, 1 },
+  { "f8", 82, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 1f4541d3147081d131a1833c38bb] (#deps: 2)
+   - [MINIMAL dde4223956958095bd90c73e0d48]
+   - [MINIMAL dba11c7fccd72305a2f120e3115b]
+  [COMPLETE 42cd6259e6e2410703c67537fe0a] (#deps: 2)
+   - [COMPLETE ff05eef48b402b1783baeed83937]
+   - [COMPLETE be5bf219dff29b882866073426e2]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t12 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, 0xd1, 0x31, 0xa1, 0x83, \
+  0x3c, 0x38, 0xbb, 0x00, 0x13, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, 0x95, 0x80, \
+  0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, 0x00, \
+  0x45, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, 0xe2, 0x41, 0x07, 0x03, 0xc6, 0x75, \
+  0x37, 0xfe, 0x0a, 0x00, 0x75, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, \
+  0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0x00, \
+  0x72, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t12 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t12 (const unsigned char []){ \
+  0xb5, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, \
+  0xd1, 0x31, 0xa1, 0x83, 0x3c, 0x38, 0xbb, 0x00, 0x0f, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, \
+  0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, \
+  0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x05, 0x74, 0xce, 0x2e, 0x1a, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, \
+  0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x00, 0x00, \
+  0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x04, 0x80, 0xf1, 0x00, 0x01, 0x00, \
+  0x05, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, \
+  0x6c, 0x66, 0x4e, 0xee, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x09, 0x58, 0x1c, 0x30, 0x10, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x65, 0x06, 0xf0, 0x38, 0xf1, 0xdd, 0xe4, 0x22, 0x39, \
+  0x56, 0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x27, \
+  0x7b, 0x3b, 0x5a, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, \
+  0x11, 0x5b, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x53, 0xcc, 0x63, 0x8c, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, 0x95, 0x80, 0x95, 0xbd, \
+  0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x05, 0xc0, 0x47, 0x2b, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, 0xe2, 0x41, 0x07, 0x03, 0xc6, 0x75, \
+  0x37, 0xfe, 0x0a, 0x00, 0x71, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x32, 0x00, 0x00, 0x00, \
+  0x45, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, \
+  0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, \
+  0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x05, 0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, \
+  0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf2, 0x00, \
+  0x01, 0x00, 0x04, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x05, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, \
+  0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, \
+  0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x46, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x32, 0x61, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x61, 0x31, 0x00, \
+  0x00, 0x00, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, \
+  0xe2, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x32, 0x62, 0x00, 0x00, \
+  0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, \
+  0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, 0xe2, 0x41, 0x07, 0x03, 0xc6, 0x75, 0x37, 0xfe, 0x0a, 0xf1, \
+  0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, 0xd1, 0x31, 0xa1, 0x83, 0x3c, 0x38, 0xbb, 0xf2, 0xff, \
+  0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0xf1, 0xdd, 0xe4, \
+  0x22, 0x39, 0x56, 0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0xf2, 0xbe, 0x5b, 0xf2, \
+  0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, \
+  0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t12 1162u
+const dds_topic_descriptor_t TypeBuilderTypes_t12_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t12),
+  .m_align = dds_alignof (TypeBuilderTypes_t12),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "TypeBuilderTypes::t12",
+  .m_keys = TypeBuilderTypes_t12_keys,
+  .m_nops = 29,
+  .m_ops = TypeBuilderTypes_t12_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t12, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t12 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t12, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t12 }
+};
+
+static const uint32_t TypeBuilderTypes_t13_ops [] =
+{
+  /* t13 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | (DDS_OP_FLAG_BASE << 16) | 31 /* t13a */, 0u,
+  DDS_OP_PLM | 11, 3u,
+  DDS_OP_PLM | 12, 4u,
+  DDS_OP_PLM | 13, 5u,
+  DDS_OP_PLM | 15, 6u,
+  DDS_OP_PLM | 17, 7u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t13, f0),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t13, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t13, f2), (3u << 16u) + 30u /* t1 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t13, f3), (3u << 16u) + 29u /* t12 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t13, f4), (3u << 16u) + 102u /* t11 */,
+  DDS_OP_RTS,
+
+  /* t13a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 0u,
+  DDS_OP_PLM | 8, 1u,
+  DDS_OP_PLM | 10, 2u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t13a, b1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t13a, b2), (3u << 16u) + 7u /* t1 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t13a, b3),
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t12 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 19, 0u,
+  DDS_OP_PLM | 20, 1u,
+  DDS_OP_PLM | 21, 2u,
+  DDS_OP_PLM | 23, 3u,
+  DDS_OP_PLM | 25, 4u,
+  DDS_OP_PLM | 27, 5u,
+  DDS_OP_PLM | 29, 6u,
+  DDS_OP_PLM | 45, 7u,
+  DDS_OP_PLM | 47, 8u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12, f2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f3), (3u << 16u) + 42u /* t12a */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f4), (3u << 16u) + 41u /* t12b */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t12, f5), 6u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12, f6), (3u << 16u) + 30u /* t12a */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BSQ, offsetof (TypeBuilderTypes_t12, f7), 3u, (17u << 16u) + 5u, sizeof (dds_sequence_sequence_TypeBuilderTypes_t12b),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BSQ, 0u, 4u, sizeof (dds_sequence_TypeBuilderTypes_t12b), (11u << 16u) + 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STU, 0u, 5u, sizeof (TypeBuilderTypes_t12b), (5u << 16u) + 19u /* t12b */,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, offsetof (TypeBuilderTypes_t12, f8), 12u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t12, f9), 5u,
+  DDS_OP_RTS,
+
+  /* t12a */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12a, fa1),
+  DDS_OP_RTS,
+
+  /* t12b */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t12b, fb1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t12b, fb2), (3u << 16u) + 65531u /* t12a */,
+  DDS_OP_RTS,
+
+  /* t11 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11, u1), (3u << 16u) + 7u /* t11a */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11, u2), (3u << 16u) + 7u /* t11b */,
+  DDS_OP_RTS,
+
+  /* t11a */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t11a, f1),
+  DDS_OP_RTS,
+
+  /* t11b */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t11b, f1), (3u << 16u) + 65532u /* t11a */,
+  DDS_OP_RTS,
+  
+  /* key: b2.f1 */
+  DDS_OP_KOF | 2, 43u /* order: 1 */, 0u /* order: 0 */,
+  
+  /* key: b3 */
+  DDS_OP_KOF | 1, 47u /* order: 2 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t13_keys[2] =
+{
+  { "b2.f1", 145, 0 },
+  { "b3", 148, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 5f843f23e8aa180472504bba095e] (#deps: 8)
+   - [MINIMAL fa93d62d4d050ece4a0a16e13852]
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL 1f4541d3147081d131a1833c38bb]
+   - [MINIMAL dde4223956958095bd90c73e0d48]
+   - [MINIMAL dba11c7fccd72305a2f120e3115b]
+   - [MINIMAL c38eaea5aa1dd3983876dfaa2c18]
+   - [MINIMAL e888b59a0645dd608e4145a61d9a]
+   - [MINIMAL 92584c8dc006fa4fd3e0ce20d053]
+  [COMPLETE b9d01c01595c2a5e9ab709900c1c] (#deps: 8)
+   - [COMPLETE 050ea27135cfa7f4ac7f20b4d55c]
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE 42cd6259e6e2410703c67537fe0a]
+   - [COMPLETE ff05eef48b402b1783baeed83937]
+   - [COMPLETE be5bf219dff29b882866073426e2]
+   - [COMPLETE 16e651f93b0d42e516f0414f0d0a]
+   - [COMPLETE 10be10a3e2c6441eb53dcc032e5b]
+   - [COMPLETE 2ee215a857f64dc4308e7740b52f]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t13 (const unsigned char []){ \
+  0xe0, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xe8, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5f, 0x84, 0x3f, 0x23, 0xe8, 0xaa, 0x18, 0x04, 0x72, 0x50, 0x4b, \
+  0xba, 0x09, 0x5e, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x93, 0xd6, 0x2d, 0x4d, 0x05, 0x0e, \
+  0xce, 0x4a, 0x0a, 0x16, 0xe1, 0x38, 0x52, 0x00, 0x57, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, \
+  0xd1, 0x31, 0xa1, 0x83, 0x3c, 0x38, 0xbb, 0x00, 0x13, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, 0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, \
+  0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, 0x98, 0x38, 0x76, 0xdf, 0xaa, 0x2c, 0x18, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, 0x45, 0xdd, \
+  0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0xe8, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xd0, 0x1c, 0x01, 0x59, 0x5c, 0x2a, 0x5e, 0x9a, 0xb7, 0x09, \
+  0x90, 0x0c, 0x1c, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x0e, 0xa2, 0x71, 0x35, 0xcf, 0xa7, \
+  0xf4, 0xac, 0x7f, 0x20, 0xb4, 0xd5, 0x5c, 0x00, 0x89, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, 0xe2, 0x41, \
+  0x07, 0x03, 0xc6, 0x75, 0x37, 0xfe, 0x0a, 0x00, 0x75, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x00, \
+  0x4a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, \
+  0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0x00, 0x72, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, 0x4f, 0x0d, 0x0a, 0x00, \
+  0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, \
+  0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2e, 0xe2, 0x15, 0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t13 484u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t13 (const unsigned char []){ \
+  0xe5, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf1, 0x5f, 0x84, 0x3f, 0x23, 0xe8, 0xaa, 0x18, \
+  0x04, 0x72, 0x50, 0x4b, 0xba, 0x09, 0x5e, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x93, 0xd6, 0x2d, 0x4d, 0x05, 0x0e, 0xce, 0x4a, 0x0a, 0x16, \
+  0xe1, 0x38, 0x52, 0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0xca, 0xe8, 0xa6, 0x23, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, \
+  0x87, 0xb5, 0x68, 0x16, 0xeb, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, 0xd1, 0x31, \
+  0xa1, 0x83, 0x3c, 0x38, 0xbb, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, 0x98, 0x38, \
+  0x76, 0xdf, 0xaa, 0x2c, 0x18, 0x6e, 0x1f, 0xcd, 0x70, 0xf1, 0xfa, 0x93, 0xd6, 0x2d, 0x4d, 0x05, \
+  0x0e, 0xce, 0x4a, 0x0a, 0x16, 0xe1, 0x38, 0x52, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0c, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0xed, 0xba, 0xb4, 0x55, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xfb, 0xfb, 0xa2, 0xe4, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x01, 0x7a, 0x6f, 0x15, 0x0b, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, 0xd1, \
+  0x31, 0xa1, 0x83, 0x3c, 0x38, 0xbb, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, \
+  0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, \
+  0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x05, 0x74, 0xce, 0x2e, 0x1a, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, \
+  0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x00, 0x00, \
+  0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x04, 0x80, 0xf1, 0x00, 0x01, 0x00, \
+  0x05, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, \
+  0x6c, 0x66, 0x4e, 0xee, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x09, 0x58, 0x1c, 0x30, 0x10, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x65, 0x06, 0xf0, 0x38, 0xf1, 0xdd, 0xe4, 0x22, 0x39, \
+  0x56, 0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x27, \
+  0x7b, 0x3b, 0x5a, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, \
+  0x11, 0x5b, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x53, 0xcc, 0x63, 0x8c, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, 0x95, 0x80, 0x95, 0xbd, \
+  0x90, 0xc7, 0x3e, 0x0d, 0x48, 0x05, 0xc0, 0x47, 0x2b, 0xf1, 0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, \
+  0xd3, 0x98, 0x38, 0x76, 0xdf, 0xaa, 0x2c, 0x18, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, \
+  0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xe4, 0x77, 0x4c, 0xdd, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, \
+  0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53, 0x27, 0x0c, 0x1b, 0x08, 0xf1, 0xe8, 0x88, \
+  0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0xf1, 0x92, 0x58, 0x4c, 0x8d, 0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, \
+  0xd0, 0x53, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe8, 0x88, 0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, \
+  0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0xa1, 0x05, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xd0, 0x1c, 0x01, 0x59, 0x5c, 0x2a, 0x5e, 0x9a, 0xb7, 0x09, \
+  0x90, 0x0c, 0x1c, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0xf2, 0x05, 0x0e, 0xa2, 0x71, 0x35, 0xcf, 0xa7, 0xf4, 0xac, 0x7f, 0x20, 0xb4, 0xd5, 0x5c, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x33, 0x00, 0x00, 0x00, \
+  0xa9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, \
+  0xe2, 0x41, 0x07, 0x03, 0xc6, 0x75, 0x37, 0xfe, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, 0x4f, 0x0d, \
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x0e, \
+  0xa2, 0x71, 0x35, 0xcf, 0xa7, 0xf4, 0xac, 0x7f, 0x20, 0xb4, 0xd5, 0x5c, 0x85, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0c, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x33, 0x61, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, \
+  0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x62, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, \
+  0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x42, 0xcd, \
+  0x62, 0x59, 0xe6, 0xe2, 0x41, 0x07, 0x03, 0xc6, 0x75, 0x37, 0xfe, 0x0a, 0x71, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x32, 0x00, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, \
+  0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, \
+  0xe2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x05, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, \
+  0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x04, 0x80, 0xf2, 0x00, 0x01, 0x00, \
+  0x05, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x04, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, \
+  0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, 0x37, \
+  0x46, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x32, 0x61, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x61, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, \
+  0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, 0xe2, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x32, 0x62, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, 0xd8, 0x39, \
+  0x37, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x62, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x16, \
+  0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, 0x4f, 0x0d, 0x0a, 0x00, 0x00, 0x00, \
+  0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x10, \
+  0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2e, 0xe2, 0x15, 0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, \
+  0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, \
+  0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x31, 0x61, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0xe2, 0x15, 0xa8, 0x57, 0xf6, \
+  0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x31, 0x62, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x10, 0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, \
+  0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0xd0, 0x1c, \
+  0x01, 0x59, 0x5c, 0x2a, 0x5e, 0x9a, 0xb7, 0x09, 0x90, 0x0c, 0x1c, 0xf1, 0x5f, 0x84, 0x3f, 0x23, \
+  0xe8, 0xaa, 0x18, 0x04, 0x72, 0x50, 0x4b, 0xba, 0x09, 0x5e, 0xf2, 0x05, 0x0e, 0xa2, 0x71, 0x35, \
+  0xcf, 0xa7, 0xf4, 0xac, 0x7f, 0x20, 0xb4, 0xd5, 0x5c, 0xf1, 0xfa, 0x93, 0xd6, 0x2d, 0x4d, 0x05, \
+  0x0e, 0xce, 0x4a, 0x0a, 0x16, 0xe1, 0x38, 0x52, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, \
+  0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xf2, 0x42, 0xcd, 0x62, 0x59, 0xe6, 0xe2, 0x41, 0x07, 0x03, \
+  0xc6, 0x75, 0x37, 0xfe, 0x0a, 0xf1, 0x1f, 0x45, 0x41, 0xd3, 0x14, 0x70, 0x81, 0xd1, 0x31, 0xa1, \
+  0x83, 0x3c, 0x38, 0xbb, 0xf2, 0xff, 0x05, 0xee, 0xf4, 0x8b, 0x40, 0x2b, 0x17, 0x83, 0xba, 0xee, \
+  0xd8, 0x39, 0x37, 0xf1, 0xdd, 0xe4, 0x22, 0x39, 0x56, 0x95, 0x80, 0x95, 0xbd, 0x90, 0xc7, 0x3e, \
+  0x0d, 0x48, 0xf2, 0xbe, 0x5b, 0xf2, 0x19, 0xdf, 0xf2, 0x9b, 0x88, 0x28, 0x66, 0x07, 0x34, 0x26, \
+  0xe2, 0xf1, 0xdb, 0xa1, 0x1c, 0x7f, 0xcc, 0xd7, 0x23, 0x05, 0xa2, 0xf1, 0x20, 0xe3, 0x11, 0x5b, \
+  0xf2, 0x16, 0xe6, 0x51, 0xf9, 0x3b, 0x0d, 0x42, 0xe5, 0x16, 0xf0, 0x41, 0x4f, 0x0d, 0x0a, 0xf1, \
+  0xc3, 0x8e, 0xae, 0xa5, 0xaa, 0x1d, 0xd3, 0x98, 0x38, 0x76, 0xdf, 0xaa, 0x2c, 0x18, 0xf2, 0x10, \
+  0xbe, 0x10, 0xa3, 0xe2, 0xc6, 0x44, 0x1e, 0xb5, 0x3d, 0xcc, 0x03, 0x2e, 0x5b, 0xf1, 0xe8, 0x88, \
+  0xb5, 0x9a, 0x06, 0x45, 0xdd, 0x60, 0x8e, 0x41, 0x45, 0xa6, 0x1d, 0x9a, 0xf2, 0x2e, 0xe2, 0x15, \
+  0xa8, 0x57, 0xf6, 0x4d, 0xc4, 0x30, 0x8e, 0x77, 0x40, 0xb5, 0x2f, 0xf1, 0x92, 0x58, 0x4c, 0x8d, \
+  0xc0, 0x06, 0xfa, 0x4f, 0xd3, 0xe0, 0xce, 0x20, 0xd0, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t13 2730u
+const dds_topic_descriptor_t TypeBuilderTypes_t13_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t13),
+  .m_align = dds_alignof (TypeBuilderTypes_t13),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "TypeBuilderTypes::t13",
+  .m_keys = TypeBuilderTypes_t13_keys,
+  .m_nops = 59,
+  .m_ops = TypeBuilderTypes_t13_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t13, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t13 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t13, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t13 }
+};
+
+static const uint32_t TypeBuilderTypes_t14_ops [] =
+{
+  /* t14 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14, f1), (3u << 16u) + 4u /* t14c */,
+  DDS_OP_RTS,
+
+  /* t14c */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14c, c1), (3u << 16u) + 4u /* t14b */,
+  DDS_OP_RTS,
+
+  /* t14b */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14b, b1), (3u << 16u) + 4u /* t14a */,
+  DDS_OP_RTS,
+
+  /* t14a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t14a, a1),
+  DDS_OP_RTS,
+  
+  /* key: f1.c1.b1.a1 */
+  DDS_OP_KOF | 4, 0u /* order: 0 */, 0u /* order: 0 */, 0u /* order: 0 */, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t14_keys[1] =
+{
+  { "f1.c1.b1.a1", 15, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8f1630b0c791b1f3e2cd50cea5a8] (#deps: 3)
+   - [MINIMAL ab0d4b89f43744841ba53cc8567c]
+   - [MINIMAL 6a1d9e9b79c72eaae695f02725c3]
+   - [MINIMAL a8fc080ca2efbdbc371df3fe2e9b]
+  [COMPLETE 772b50669ef2f2fd48450a088e42] (#deps: 3)
+   - [COMPLETE 7a8e37ac27426aa3f8fcc11099b4]
+   - [COMPLETE cb919c1c8e2182d41f924428f5b3]
+   - [COMPLETE 3b6e57a372259a0c98a6a2e75875]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t14 (const unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, \
+  0xce, 0xa5, 0xa8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xab, 0x0d, 0x4b, 0x89, 0xf4, 0x37, 0x44, \
+  0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6a, 0x1d, 0x9e, 0x9b, 0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, \
+  0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x2b, 0x50, \
+  0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, 0x08, 0x8e, 0x42, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7a, 0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, 0x21, 0x82, \
+  0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0x00, 0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, 0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t14 244u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t14 (const unsigned char []){ \
+  0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, \
+  0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, 0xa8, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xab, 0x0d, 0x4b, 0x89, 0xf4, \
+  0x37, 0x44, 0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xab, 0x0d, \
+  0x4b, 0x89, 0xf4, 0x37, 0x44, 0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0x31, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x6a, \
+  0x1d, 0x9e, 0x9b, 0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0xa9, 0xf7, 0xe9, \
+  0x79, 0xf1, 0x6a, 0x1d, 0x9e, 0x9b, 0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, \
+  0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, 0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, \
+  0x9b, 0xed, 0xba, 0xb4, 0x55, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, 0xbc, 0x37, 0x1d, \
+  0xf3, 0xfe, 0x2e, 0x9b, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8a, 0x8b, 0xb7, 0xcd, 0x00, 0x95, 0x01, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, \
+  0x08, 0x8e, 0x42, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x34, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x7a, 0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, \
+  0xb4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x8e, \
+  0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x34, 0x63, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, \
+  0x21, 0x82, 0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x63, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, 0x21, 0x82, 0xd4, 0x1f, 0x92, \
+  0x44, 0x28, 0xf5, 0xb3, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x34, 0x62, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, 0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, \
+  0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x6e, \
+  0x57, 0xa3, 0x72, 0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x34, 0x61, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, 0x08, 0x8e, 0x42, 0xf1, \
+  0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, 0xa8, 0xf2, 0x7a, \
+  0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0xf1, 0xab, 0x0d, \
+  0x4b, 0x89, 0xf4, 0x37, 0x44, 0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0xf2, 0xcb, 0x91, 0x9c, \
+  0x1c, 0x8e, 0x21, 0x82, 0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0xf1, 0x6a, 0x1d, 0x9e, 0x9b, \
+  0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, \
+  0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, \
+  0xbd, 0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t14 808u
+const dds_topic_descriptor_t TypeBuilderTypes_t14_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t14),
+  .m_align = dds_alignof (TypeBuilderTypes_t14),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypeBuilderTypes::t14",
+  .m_keys = TypeBuilderTypes_t14_keys,
+  .m_nops = 8,
+  .m_ops = TypeBuilderTypes_t14_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t14, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t14 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t14, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t14 }
+};
+
+static const uint32_t TypeBuilderTypes_t15a_ops [] =
+{
+  /* t15a */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15a, _d), 3u, (16u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 'a', offsetof (TypeBuilderTypes_t15a, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 'z', offsetof (TypeBuilderTypes_t15a, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t15a, _u.u3), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c98988b8eee3877b3c2223bb4b3d] (#deps: 0)
+  [COMPLETE 8e54c3999ef248b4cc07cd95b8fe] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t15a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, \
+  0xbb, 0x4b, 0x3d, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, \
+  0x95, 0xb8, 0xfe, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15a 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t15a (const unsigned char []){ \
+  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, \
+  0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x48, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, \
+  0x27, 0x0c, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x09, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xad, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, \
+  0x95, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x61, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, \
+  0x95, 0xb8, 0xfe, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, \
+  0x4b, 0x3d\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15a 338u
+const dds_topic_descriptor_t TypeBuilderTypes_t15a_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t15a),
+  .m_align = dds_alignof (TypeBuilderTypes_t15a),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t15a",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = TypeBuilderTypes_t15a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t15a, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15a },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t15a, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15a }
+};
+
+static const uint32_t TypeBuilderTypes_t15b_ops [] =
+{
+  /* t15b */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15b, _d), 6u, (28u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t15b, _u.u1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 21 /* t1 */, 2, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 17 /* t1 */, 5, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 16 /* t2 */, 10, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 12 /* t2 */, 11, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 8 /* t2 */, 0, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 931b577d0897ea746eae2df15304] (#deps: 4)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL befabd11a939fc45e1be314e648f]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+  [COMPLETE bc07685137c034d34079a656353d] (#deps: 4)
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE d08221fc386c32b53869d4756ef1]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t15b (const unsigned char []){ \
+  0x20, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, \
+  0xf1, 0x53, 0x04, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, \
+  0x05, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, \
+  0x56, 0x35, 0x3d, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, \
+  0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, \
+  0x8a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, \
+  0x62, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15b 292u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t15b (const unsigned char []){ \
+  0x84, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, \
+  0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x74, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x28, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, \
+  0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x45, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, \
+  0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x17, \
+  0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x6e, \
+  0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x74, \
+  0xce, 0x2e, 0x1a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x64, \
+  0xe4, 0xcd, 0xa1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x6c, \
+  0x66, 0x4e, 0xee, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x58, \
+  0x1c, 0x30, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x65, \
+  0x06, 0xf0, 0x38, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, \
+  0x82, 0xb5, 0xf6, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, \
+  0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0x16, \
+  0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x80, 0x39, 0xb4, \
+  0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x89, 0xb4, 0x5f, \
+  0xf3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, 0xce, 0x20, 0xf1, 0x80, \
+  0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x00, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xb6, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0x00, \
+  0xc1, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x62, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0xf2, 0xd0, \
+  0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, \
+  0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, \
+  0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x86, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, \
+  0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, \
+  0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0xf1, 0x93, 0x1b, 0x57, 0x7d, \
+  0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, \
+  0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, \
+  0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, \
+  0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, \
+  0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, \
+  0x6f, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15b 1762u
+const dds_topic_descriptor_t TypeBuilderTypes_t15b_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t15b),
+  .m_align = dds_alignof (TypeBuilderTypes_t15b),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t15b",
+  .m_keys = NULL,
+  .m_nops = 24,
+  .m_ops = TypeBuilderTypes_t15b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t15b, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15b },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t15b, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15b }
+};
+
+static const uint32_t TypeBuilderTypes_t15c_ops [] =
+{
+  /* t15c */
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t15c, a1),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a2),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a3),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a4), (4u << 16u) + 9u /* t15a */, sizeof (TypeBuilderTypes_t15a),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a5), (4u << 16u) + 22u /* t15b */, sizeof (TypeBuilderTypes_t15b),
+  DDS_OP_RTS,
+
+  /* t15a */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15a, _d), 3u, (16u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 'a', offsetof (TypeBuilderTypes_t15a, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 'z', offsetof (TypeBuilderTypes_t15a, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t15a, _u.u3), 0u,
+  DDS_OP_RTS,
+
+  /* t15b */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15b, _d), 6u, (28u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t15b, _u.u1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 21 /* t1 */, 2, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 17 /* t1 */, 5, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 16 /* t2 */, 10, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 12 /* t2 */, 11, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 8 /* t2 */, 0, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f498f9505677140a39582d50563a] (#deps: 6)
+   - [MINIMAL c98988b8eee3877b3c2223bb4b3d]
+   - [MINIMAL 931b577d0897ea746eae2df15304]
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL befabd11a939fc45e1be314e648f]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+  [COMPLETE c689ff16f07626154f7859fc6cd1] (#deps: 6)
+   - [COMPLETE 8e54c3999ef248b4cc07cd95b8fe]
+   - [COMPLETE bc07685137c034d34079a656353d]
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE d08221fc386c32b53869d4756ef1]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t15c (const unsigned char []){ \
+  0x80, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xb8, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, 0x58, 0x2d, \
+  0x50, 0x56, 0x3a, 0x00, 0x85, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, \
+  0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x00, 0x60, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, \
+  0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, \
+  0x05, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, \
+  0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0xb8, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, \
+  0xfc, 0x6c, 0xd1, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, \
+  0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, 0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0x00, \
+  0xc5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, \
+  0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, \
+  0x8a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, \
+  0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, \
+  0x62, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15c 388u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t15c (const unsigned char []){ \
+  0x88, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, \
+  0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0x00, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x70, 0x00, 0x8a, 0x8b, 0xb7, 0xcd, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x69, 0x3a, 0x9f, 0xdd, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x9d, 0x60, 0x7a, 0x66, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, \
+  0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x89, 0x4f, 0x78, 0x2a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, \
+  0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x32, 0xcf, 0xe6, 0xc1, 0xf1, 0xc9, 0x89, \
+  0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x5c, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, \
+  0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0x93, 0x1b, 0x57, \
+  0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, \
+  0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x28, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, \
+  0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, \
+  0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, \
+  0x01, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x06, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x03, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x74, 0xce, 0x2e, 0x1a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x08, 0x6c, 0x66, 0x4e, 0xee, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x58, 0x1c, 0x30, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x65, 0x06, 0xf0, 0x38, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x00, 0x82, 0xb5, 0xf6, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x0a, 0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, \
+  0x98, 0x80, 0x39, 0xb4, 0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x89, 0xb4, 0x5f, 0xf3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, \
+  0xe1, 0x7b, 0x43, 0x98, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, \
+  0xce, 0x20, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0x36, 0x05, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, \
+  0xfc, 0x6c, 0xd1, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x63, 0x00, 0x00, \
+  0x99, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, \
+  0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, \
+  0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x35, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, \
+  0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x95, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x35, 0x61, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, \
+  0xa6, 0x56, 0x35, 0x3d, 0xc1, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x62, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x45, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, \
+  0xf1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, \
+  0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, \
+  0x86, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, \
+  0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, \
+  0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0xf1, \
+  0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0xf2, 0x8e, \
+  0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0xf1, 0xc9, 0x89, \
+  0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0xf2, 0xbc, 0x07, 0x68, \
+  0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0xf1, 0x93, 0x1b, 0x57, 0x7d, \
+  0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, \
+  0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, \
+  0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, \
+  0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, \
+  0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, \
+  0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, \
+  0x6f, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15c 2466u
+const dds_topic_descriptor_t TypeBuilderTypes_t15c_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t15c),
+  .m_align = dds_alignof (TypeBuilderTypes_t15c),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t15c",
+  .m_keys = NULL,
+  .m_nops = 35,
+  .m_ops = TypeBuilderTypes_t15c_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t15c, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15c },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t15c, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15c }
+};
+
+static const uint32_t TypeBuilderTypes_t15_ops [] =
+{
+  /* t15 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15, parent), (3u << 16u) + 15u /* t15c */,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15, f1), (4u << 16u) + 12u /* t15c */, sizeof (TypeBuilderTypes_t15c),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t15, f2), 1u,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t15, f3), 0u, 3u,
+  DDS_OP_RTS,
+
+  /* t15c */
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t15c, a1),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a2),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a3),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a4), (4u << 16u) + 9u /* t15a */, sizeof (TypeBuilderTypes_t15a),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a5), (4u << 16u) + 22u /* t15b */, sizeof (TypeBuilderTypes_t15b),
+  DDS_OP_RTS,
+
+  /* t15a */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15a, _d), 3u, (16u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 'a', offsetof (TypeBuilderTypes_t15a, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 'z', offsetof (TypeBuilderTypes_t15a, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t15a, _u.u3), 0u,
+  DDS_OP_RTS,
+
+  /* t15b */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15b, _d), 6u, (28u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t15b, _u.u1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 21 /* t1 */, 2, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 17 /* t1 */, 5, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 16 /* t2 */, 10, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 12 /* t2 */, 11, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 8 /* t2 */, 0, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 740a129359d40e7b73c58aabe6c3] (#deps: 8)
+   - [MINIMAL f498f9505677140a39582d50563a]
+   - [MINIMAL c98988b8eee3877b3c2223bb4b3d]
+   - [MINIMAL 931b577d0897ea746eae2df15304]
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL befabd11a939fc45e1be314e648f]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 58a531131473632ee3ba38595896]
+  [COMPLETE 095420ac462999ce8c249500f359] (#deps: 8)
+   - [COMPLETE c689ff16f07626154f7859fc6cd1]
+   - [COMPLETE 8e54c3999ef248b4cc07cd95b8fe]
+   - [COMPLETE bc07685137c034d34079a656353d]
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE d08221fc386c32b53869d4756ef1]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE f61b99f039473cb4a610a1cac9a0]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t15 (const unsigned char []){ \
+  0xe0, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xe8, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, 0x7b, 0x73, 0xc5, 0x8a, \
+  0xab, 0xe6, 0xc3, 0x00, 0x81, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, \
+  0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0x00, 0x85, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, \
+  0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, \
+  0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, \
+  0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0xe8, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x54, 0x20, 0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, 0x95, \
+  0x00, 0xf3, 0x59, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, \
+  0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, \
+  0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, \
+  0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, \
+  0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15 484u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t15 (const unsigned char []){ \
+  0x60, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, \
+  0x7b, 0x73, 0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, 0x58, 0x2d, \
+  0x50, 0x56, 0x3a, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, \
+  0x58, 0x2d, 0x50, 0x56, 0x3a, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, \
+  0x28, 0xe1, 0x7b, 0x43, 0x98, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, \
+  0xba, 0x38, 0x59, 0x58, 0x96, 0x17, 0x79, 0xcf, 0x3a, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, \
+  0x14, 0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x70, 0x00, 0x8a, 0x8b, 0xb7, 0xcd, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x69, 0x3a, 0x9f, 0xdd, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x9d, 0x60, 0x7a, 0x66, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, \
+  0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x89, 0x4f, 0x78, 0x2a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, \
+  0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x32, 0xcf, 0xe6, 0xc1, 0xf1, 0xc9, 0x89, \
+  0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x5c, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, \
+  0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0x93, 0x1b, 0x57, \
+  0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, \
+  0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x28, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, \
+  0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, \
+  0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, \
+  0x01, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x06, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x03, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x74, 0xce, 0x2e, 0x1a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x08, 0x6c, 0x66, 0x4e, 0xee, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x58, 0x1c, 0x30, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x65, 0x06, 0xf0, 0x38, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x00, 0x82, 0xb5, 0xf6, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x0a, 0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, \
+  0x98, 0x80, 0x39, 0xb4, 0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x89, 0xb4, 0x5f, 0xf3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, \
+  0xe1, 0x7b, 0x43, 0x98, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, \
+  0xce, 0x20, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x58, 0xa5, 0x31, \
+  0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xe7, 0x09, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xff, 0x7f, 0x67, 0xfa, 0x79, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x54, 0x20, \
+  0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, 0x95, 0x00, 0xf3, 0x59, 0x00, 0xb5, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, \
+  0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x35, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, \
+  0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, \
+  0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, \
+  0x59, 0xfc, 0x6c, 0xd1, 0xc5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x63, 0x00, 0x00, \
+  0x99, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, \
+  0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, \
+  0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x35, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, \
+  0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x95, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x35, 0x61, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, \
+  0xa6, 0x56, 0x35, 0x3d, 0xc1, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x62, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x45, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, \
+  0xf1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, \
+  0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, \
+  0x86, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, \
+  0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, \
+  0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, \
+  0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, \
+  0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x36, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x31, 0x36, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x54, 0x20, \
+  0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, 0x95, 0x00, 0xf3, 0x59, 0xf1, 0x74, 0x0a, 0x12, 0x93, \
+  0x59, 0xd4, 0x0e, 0x7b, 0x73, 0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, \
+  0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, \
+  0x14, 0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, \
+  0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, \
+  0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, \
+  0x79, 0xa6, 0x56, 0x35, 0x3d, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, \
+  0x2d, 0xf1, 0x53, 0x04, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, \
+  0xaf, 0x61, 0x8d, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, \
+  0x16, 0xeb, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, \
+  0xf1, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, \
+  0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, \
+  0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, \
+  0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0xf6, 0x1b, 0x99, \
+  0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0xf1, 0x58, 0xa5, 0x31, 0x13, \
+  0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15 3066u
+const dds_topic_descriptor_t TypeBuilderTypes_t15_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t15),
+  .m_align = dds_alignof (TypeBuilderTypes_t15),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t15",
+  .m_keys = NULL,
+  .m_nops = 40,
+  .m_ops = TypeBuilderTypes_t15_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t15, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t15 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t15, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t15 }
+};
+
+static const uint32_t TypeBuilderTypes_t16_ops [] =
+{
+  /* t16 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t16, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t16, f2),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t16, f3),
+  DDS_OP_RTS,
+  
+  /* key: f1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: f2 */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: f3 */
+  DDS_OP_KOF | 1, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t16_keys[3] =
+{
+  { "f1", 7, 0 },
+  { "f2", 9, 1 },
+  { "f3", 11, 2 }
+};
+
+/* Type Information:
+  [MINIMAL 84627f1b2676ad0897c720967517] (#deps: 0)
+  [COMPLETE bae484f323e035fbea32912e2757] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t16 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x62, 0x7f, 0x1b, 0x26, 0x76, 0xad, 0x08, 0x97, 0xc7, 0x20, \
+  0x96, 0x75, 0x17, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xba, 0xe4, 0x84, 0xf3, 0x23, 0xe0, 0x35, 0xfb, 0xea, 0x32, 0x91, \
+  0x2e, 0x27, 0x57, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t16 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t16 (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x62, 0x7f, 0x1b, 0x26, 0x76, 0xad, \
+  0x08, 0x97, 0xc7, 0x20, 0x96, 0x75, 0x17, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x17, 0x79, 0xcf, 0x3a, 0x00, \
+  0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xba, 0xe4, 0x84, 0xf3, 0x23, 0xe0, 0x35, \
+  0xfb, 0xea, 0x32, 0x91, 0x2e, 0x27, 0x57, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x36, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xba, 0xe4, 0x84, \
+  0xf3, 0x23, 0xe0, 0x35, 0xfb, 0xea, 0x32, 0x91, 0x2e, 0x27, 0x57, 0xf1, 0x84, 0x62, 0x7f, 0x1b, \
+  0x26, 0x76, 0xad, 0x08, 0x97, 0xc7, 0x20, 0x96, 0x75, 0x17\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t16 282u
+const dds_topic_descriptor_t TypeBuilderTypes_t16_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t16),
+  .m_align = dds_alignof (TypeBuilderTypes_t16),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "TypeBuilderTypes::t16",
+  .m_keys = TypeBuilderTypes_t16_keys,
+  .m_nops = 4,
+  .m_ops = TypeBuilderTypes_t16_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t16, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t16 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t16, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t16 }
+};
+
+static const uint32_t TypeBuilderTypes_t17_ops [] =
+{
+  /* t17 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_ENU | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t17, _d), 2u, (13u << 16u) + 5u, 1u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 9 /* t14 */, TypeBuilderTypes_EN16_1, offsetof (TypeBuilderTypes_t17, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 20 /* t15 */, TypeBuilderTypes_EN16_2, offsetof (TypeBuilderTypes_t17, _u.u2), 0u,
+  DDS_OP_RTS,
+
+  /* t14 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14, f1), (3u << 16u) + 4u /* t14c */,
+  DDS_OP_RTS,
+
+  /* t14c */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14c, c1), (3u << 16u) + 4u /* t14b */,
+  DDS_OP_RTS,
+
+  /* t14b */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t14b, b1), (3u << 16u) + 4u /* t14a */,
+  DDS_OP_RTS,
+
+  /* t14a */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t14a, a1),
+  DDS_OP_RTS,
+
+  /* t15 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15, parent), (3u << 16u) + 15u /* t15c */,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15, f1), (4u << 16u) + 12u /* t15c */, sizeof (TypeBuilderTypes_t15c),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t15, f2), 1u,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t15, f3), 0u, 3u,
+  DDS_OP_RTS,
+
+  /* t15c */
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t15c, a1),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a2),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15c, a3),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a4), (4u << 16u) + 9u /* t15a */, sizeof (TypeBuilderTypes_t15a),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t15c, a5), (4u << 16u) + 22u /* t15b */, sizeof (TypeBuilderTypes_t15b),
+  DDS_OP_RTS,
+
+  /* t15a */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15a, _d), 3u, (16u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 'a', offsetof (TypeBuilderTypes_t15a, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STR, 'z', offsetof (TypeBuilderTypes_t15a, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t15a, _u.u3), 0u,
+  DDS_OP_RTS,
+
+  /* t15b */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t15b, _d), 6u, (28u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t15b, _u.u1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 21 /* t1 */, 2, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 17 /* t1 */, 5, offsetof (TypeBuilderTypes_t15b, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 16 /* t2 */, 10, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 12 /* t2 */, 11, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_JEQ4 | DDS_OP_FLAG_EXT | DDS_OP_TYPE_STU | 8 /* t2 */, 0, offsetof (TypeBuilderTypes_t15b, _u.u3), sizeof (TypeBuilderTypes_t2),
+  DDS_OP_RTS,
+
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t1, f1),
+  DDS_OP_RTS,
+
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (TypeBuilderTypes_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (TypeBuilderTypes_t2, f3),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (TypeBuilderTypes_t2, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f6),
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY, offsetof (TypeBuilderTypes_t2, f7),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t2, f8),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (TypeBuilderTypes_t2, f9),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t2, f10),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t2, f11), 11u,
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f12), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (TypeBuilderTypes_t2, f13), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8ddfac705a6fcea82ddb9925c22c] (#deps: 14)
+   - [MINIMAL 57859b216a730d17a104e66d3b97]
+   - [MINIMAL 8f1630b0c791b1f3e2cd50cea5a8]
+   - [MINIMAL ab0d4b89f43744841ba53cc8567c]
+   - [MINIMAL 6a1d9e9b79c72eaae695f02725c3]
+   - [MINIMAL a8fc080ca2efbdbc371df3fe2e9b]
+   - [MINIMAL 740a129359d40e7b73c58aabe6c3]
+   - [MINIMAL f498f9505677140a39582d50563a]
+   - [MINIMAL c98988b8eee3877b3c2223bb4b3d]
+   - [MINIMAL 931b577d0897ea746eae2df15304]
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL befabd11a939fc45e1be314e648f]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+   - [MINIMAL 58a531131473632ee3ba38595896]
+  [COMPLETE 3b9fe934a1059b130369055c051d] (#deps: 14)
+   - [COMPLETE 25800af4a5d5861293b069873759]
+   - [COMPLETE 772b50669ef2f2fd48450a088e42]
+   - [COMPLETE 7a8e37ac27426aa3f8fcc11099b4]
+   - [COMPLETE cb919c1c8e2182d41f924428f5b3]
+   - [COMPLETE 3b6e57a372259a0c98a6a2e75875]
+   - [COMPLETE 095420ac462999ce8c249500f359]
+   - [COMPLETE c689ff16f07626154f7859fc6cd1]
+   - [COMPLETE 8e54c3999ef248b4cc07cd95b8fe]
+   - [COMPLETE bc07685137c034d34079a656353d]
+   - [COMPLETE 3f46d7caf5bc98adb25b7daf618d]
+   - [COMPLETE d08221fc386c32b53869d4756ef1]
+   - [COMPLETE 564a080fe0329a0727d6f26ab1c3]
+   - [COMPLETE 35ed87f903dd63dca10b0277945b]
+   - [COMPLETE f61b99f039473cb4a610a1cac9a0]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t17 (const unsigned char []){ \
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x78, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xdf, 0xac, 0x70, 0x5a, 0x6f, 0xce, 0xa8, 0x2d, 0xdb, 0x99, \
+  0x25, 0xc2, 0x2c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x57, 0x85, 0x9b, 0x21, 0x6a, 0x73, 0x0d, \
+  0x17, 0xa1, 0x04, 0xe6, 0x6d, 0x3b, 0x97, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, 0xa8, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xab, 0x0d, 0x4b, 0x89, 0xf4, 0x37, 0x44, \
+  0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6a, 0x1d, 0x9e, 0x9b, 0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0x00, \
+  0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, \
+  0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, 0x7b, 0x73, 0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0x00, \
+  0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, \
+  0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0x00, 0x85, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, \
+  0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, \
+  0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, \
+  0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x78, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x9f, 0xe9, 0x34, 0xa1, 0x05, 0x9b, 0x13, 0x03, 0x69, 0x05, \
+  0x5c, 0x05, 0x1d, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x25, 0x80, 0x0a, 0xf4, 0xa5, 0xd5, 0x86, \
+  0x12, 0x93, 0xb0, 0x69, 0x87, 0x37, 0x59, 0x00, 0x71, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, 0x08, 0x8e, 0x42, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, \
+  0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0x00, 0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, 0x21, 0x82, 0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, 0x25, 0x9a, \
+  0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x09, 0x54, 0x20, 0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, 0x95, 0x00, 0xf3, 0x59, 0x00, \
+  0xb9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, \
+  0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, 0xfe, 0x00, \
+  0x99, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, \
+  0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, \
+  0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, \
+  0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, \
+  0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t17 772u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t17 (const unsigned char []){ \
+  0x40, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xdf, 0xac, 0x70, 0x5a, 0x6f, 0xce, \
+  0xa8, 0x2d, 0xdb, 0x99, 0x25, 0xc2, 0x2c, 0x00, 0x78, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0xf1, 0x57, 0x85, 0x9b, 0x21, 0x6a, \
+  0x73, 0x0d, 0x17, 0xa1, 0x04, 0xe6, 0x6d, 0x3b, 0x97, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8f, \
+  0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, 0xa8, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x24, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, 0x7b, 0x73, \
+  0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x27, 0x0c, 0x1b, 0x08, 0xf1, 0x57, 0x85, 0x9b, 0x21, 0x6a, 0x73, 0x0d, 0x17, 0xa1, 0x04, 0xe6, \
+  0x6d, 0x3b, 0x97, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xf6, 0xb4, 0x04, 0xaa, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x84, \
+  0x51, 0x8b, 0xf1, 0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, \
+  0xa8, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xab, 0x0d, 0x4b, 0x89, 0xf4, 0x37, 0x44, 0x84, 0x1b, \
+  0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xab, 0x0d, 0x4b, 0x89, 0xf4, 0x37, \
+  0x44, 0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x6a, 0x1d, 0x9e, 0x9b, 0x79, \
+  0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0xa9, 0xf7, 0xe9, 0x79, 0xf1, 0x6a, 0x1d, \
+  0x9e, 0x9b, 0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0x31, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xa8, \
+  0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, 0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b, 0xed, 0xba, 0xb4, \
+  0x55, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, 0xbd, 0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b, \
+  0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x8a, 0x8b, 0xb7, 0xcd, 0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, 0x7b, \
+  0x73, 0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, 0x58, 0x2d, \
+  0x50, 0x56, 0x3a, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, \
+  0x58, 0x2d, 0x50, 0x56, 0x3a, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, \
+  0x28, 0xe1, 0x7b, 0x43, 0x98, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, \
+  0xba, 0x38, 0x59, 0x58, 0x96, 0x17, 0x79, 0xcf, 0x3a, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, \
+  0x14, 0x0a, 0x39, 0x58, 0x2d, 0x50, 0x56, 0x3a, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x70, 0x00, 0x8a, 0x8b, 0xb7, 0xcd, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x69, 0x3a, 0x9f, 0xdd, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x9d, 0x60, 0x7a, 0x66, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, \
+  0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x89, 0x4f, 0x78, 0x2a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, \
+  0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x32, 0xcf, 0xe6, 0xc1, 0xf1, 0xc9, 0x89, \
+  0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, 0x4b, 0x3d, 0x5c, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, \
+  0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x7a, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0x93, 0x1b, 0x57, \
+  0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, \
+  0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0x28, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0xf1, 0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, \
+  0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, \
+  0xbe, 0xfa, 0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0x00, 0x00, \
+  0x01, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0xf1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x06, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x03, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x74, 0xce, 0x2e, 0x1a, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x64, 0xe4, 0xcd, 0xa1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x08, 0x6c, 0x66, 0x4e, 0xee, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x58, 0x1c, 0x30, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x65, 0x06, 0xf0, 0x38, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x70, 0x00, 0x82, 0xb5, 0xf6, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x0a, 0xf3, 0x44, 0xa4, 0x0a, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, \
+  0x98, 0x80, 0x39, 0xb4, 0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x89, 0xb4, 0x5f, 0xf3, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, \
+  0xe1, 0x7b, 0x43, 0x98, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, \
+  0xce, 0x20, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xf1, 0x58, 0xa5, 0x31, \
+  0x13, 0x14, 0x73, 0x63, 0x2e, 0xe3, 0xba, 0x38, 0x59, 0x58, 0x96, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xe7, 0x09, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xff, 0x7f, 0x67, 0xfa, 0x41, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x9f, 0xe9, \
+  0x34, 0xa1, 0x05, 0x9b, 0x13, 0x03, 0x69, 0x05, 0x5c, 0x05, 0x1d, 0x00, 0xa5, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x37, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x11, 0x00, 0xf2, 0x25, \
+  0x80, 0x0a, 0xf4, 0xa5, 0xd5, 0x86, 0x12, 0x93, 0xb0, 0x69, 0x87, 0x37, 0x59, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, 0x08, 0x8e, \
+  0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x09, 0x54, 0x20, 0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, 0x95, 0x00, 0xf3, \
+  0x59, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x25, 0x80, 0x0a, 0xf4, 0xa5, 0xd5, 0x86, 0x12, 0x93, 0xb0, \
+  0x69, 0x87, 0x37, 0x59, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x31, 0x36, 0x00, 0x00, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x31, 0x36, \
+  0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x45, 0x4e, 0x31, 0x36, \
+  0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, \
+  0x0a, 0x08, 0x8e, 0x42, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x34, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x7a, 0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, \
+  0xb4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x8e, \
+  0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x34, 0x63, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, \
+  0x21, 0x82, 0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x63, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x91, 0x9c, 0x1c, 0x8e, 0x21, 0x82, 0xd4, 0x1f, 0x92, \
+  0x44, 0x28, 0xf5, 0xb3, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x34, 0x62, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, 0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, \
+  0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x6e, \
+  0x57, 0xa3, 0x72, 0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x34, 0x61, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x54, 0x20, 0xac, 0x46, 0x29, 0x99, 0xce, 0x8c, 0x24, \
+  0x95, 0x00, 0xf3, 0x59, 0xb5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, \
+  0xd1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, \
+  0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, \
+  0xa0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0x89, \
+  0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, 0x78, 0x59, 0xfc, 0x6c, 0xd1, 0xc5, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x35, 0x63, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, 0x95, 0xb8, \
+  0xfe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, \
+  0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x61, 0x35, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, \
+  0xcd, 0x95, 0xb8, 0xfe, 0x95, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x61, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x09, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x07, \
+  0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, 0x3d, 0xc1, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x31, 0x35, 0x62, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, \
+  0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, \
+  0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, \
+  0x00, 0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, \
+  0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x82, 0x21, 0xfc, 0x38, 0x6c, \
+  0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0x86, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x37, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x39, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x56, \
+  0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, \
+  0x0b, 0x02, 0x77, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x33, 0x00, \
+  0x00, 0x00, 0xf2, 0x56, 0x4a, 0x08, 0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, \
+  0xc3, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, \
+  0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xed, \
+  0x87, 0xf9, 0x03, 0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0x5e, 0x00, 0x00, 0x00, \
+  0xf2, 0x41, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xf6, \
+  0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, 0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0x00, 0x00, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x62, 0x6d, \
+  0x31, 0x36, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x36, 0x5f, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x42, 0x4d, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x9f, 0xe9, 0x34, 0xa1, 0x05, 0x9b, 0x13, 0x03, 0x69, 0x05, \
+  0x5c, 0x05, 0x1d, 0xf1, 0x8d, 0xdf, 0xac, 0x70, 0x5a, 0x6f, 0xce, 0xa8, 0x2d, 0xdb, 0x99, 0x25, \
+  0xc2, 0x2c, 0xf2, 0x25, 0x80, 0x0a, 0xf4, 0xa5, 0xd5, 0x86, 0x12, 0x93, 0xb0, 0x69, 0x87, 0x37, \
+  0x59, 0xf1, 0x57, 0x85, 0x9b, 0x21, 0x6a, 0x73, 0x0d, 0x17, 0xa1, 0x04, 0xe6, 0x6d, 0x3b, 0x97, \
+  0xf2, 0x77, 0x2b, 0x50, 0x66, 0x9e, 0xf2, 0xf2, 0xfd, 0x48, 0x45, 0x0a, 0x08, 0x8e, 0x42, 0xf1, \
+  0x8f, 0x16, 0x30, 0xb0, 0xc7, 0x91, 0xb1, 0xf3, 0xe2, 0xcd, 0x50, 0xce, 0xa5, 0xa8, 0xf2, 0x7a, \
+  0x8e, 0x37, 0xac, 0x27, 0x42, 0x6a, 0xa3, 0xf8, 0xfc, 0xc1, 0x10, 0x99, 0xb4, 0xf1, 0xab, 0x0d, \
+  0x4b, 0x89, 0xf4, 0x37, 0x44, 0x84, 0x1b, 0xa5, 0x3c, 0xc8, 0x56, 0x7c, 0xf2, 0xcb, 0x91, 0x9c, \
+  0x1c, 0x8e, 0x21, 0x82, 0xd4, 0x1f, 0x92, 0x44, 0x28, 0xf5, 0xb3, 0xf1, 0x6a, 0x1d, 0x9e, 0x9b, \
+  0x79, 0xc7, 0x2e, 0xaa, 0xe6, 0x95, 0xf0, 0x27, 0x25, 0xc3, 0xf2, 0x3b, 0x6e, 0x57, 0xa3, 0x72, \
+  0x25, 0x9a, 0x0c, 0x98, 0xa6, 0xa2, 0xe7, 0x58, 0x75, 0xf1, 0xa8, 0xfc, 0x08, 0x0c, 0xa2, 0xef, \
+  0xbd, 0xbc, 0x37, 0x1d, 0xf3, 0xfe, 0x2e, 0x9b, 0xf2, 0x09, 0x54, 0x20, 0xac, 0x46, 0x29, 0x99, \
+  0xce, 0x8c, 0x24, 0x95, 0x00, 0xf3, 0x59, 0xf1, 0x74, 0x0a, 0x12, 0x93, 0x59, 0xd4, 0x0e, 0x7b, \
+  0x73, 0xc5, 0x8a, 0xab, 0xe6, 0xc3, 0xf2, 0xc6, 0x89, 0xff, 0x16, 0xf0, 0x76, 0x26, 0x15, 0x4f, \
+  0x78, 0x59, 0xfc, 0x6c, 0xd1, 0xf1, 0xf4, 0x98, 0xf9, 0x50, 0x56, 0x77, 0x14, 0x0a, 0x39, 0x58, \
+  0x2d, 0x50, 0x56, 0x3a, 0xf2, 0x8e, 0x54, 0xc3, 0x99, 0x9e, 0xf2, 0x48, 0xb4, 0xcc, 0x07, 0xcd, \
+  0x95, 0xb8, 0xfe, 0xf1, 0xc9, 0x89, 0x88, 0xb8, 0xee, 0xe3, 0x87, 0x7b, 0x3c, 0x22, 0x23, 0xbb, \
+  0x4b, 0x3d, 0xf2, 0xbc, 0x07, 0x68, 0x51, 0x37, 0xc0, 0x34, 0xd3, 0x40, 0x79, 0xa6, 0x56, 0x35, \
+  0x3d, 0xf1, 0x93, 0x1b, 0x57, 0x7d, 0x08, 0x97, 0xea, 0x74, 0x6e, 0xae, 0x2d, 0xf1, 0x53, 0x04, \
+  0xf2, 0x3f, 0x46, 0xd7, 0xca, 0xf5, 0xbc, 0x98, 0xad, 0xb2, 0x5b, 0x7d, 0xaf, 0x61, 0x8d, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xf2, 0xd0, \
+  0x82, 0x21, 0xfc, 0x38, 0x6c, 0x32, 0xb5, 0x38, 0x69, 0xd4, 0x75, 0x6e, 0xf1, 0xf1, 0xbe, 0xfa, \
+  0xbd, 0x11, 0xa9, 0x39, 0xfc, 0x45, 0xe1, 0xbe, 0x31, 0x4e, 0x64, 0x8f, 0xf2, 0x56, 0x4a, 0x08, \
+  0x0f, 0xe0, 0x32, 0x9a, 0x07, 0x27, 0xd6, 0xf2, 0x6a, 0xb1, 0xc3, 0xf1, 0x16, 0xce, 0x50, 0xb0, \
+  0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0xf2, 0x35, 0xed, 0x87, 0xf9, 0x03, \
+  0xdd, 0x63, 0xdc, 0xa1, 0x0b, 0x02, 0x77, 0x94, 0x5b, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, \
+  0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0xf2, 0xf6, 0x1b, 0x99, 0xf0, 0x39, 0x47, 0x3c, \
+  0xb4, 0xa6, 0x10, 0xa1, 0xca, 0xc9, 0xa0, 0xf1, 0x58, 0xa5, 0x31, 0x13, 0x14, 0x73, 0x63, 0x2e, \
+  0xe3, 0xba, 0x38, 0x59, 0x58, 0x96\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t17 4438u
+const dds_topic_descriptor_t TypeBuilderTypes_t17_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t17),
+  .m_align = dds_alignof (TypeBuilderTypes_t17),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t17",
+  .m_keys = NULL,
+  .m_nops = 52,
+  .m_ops = TypeBuilderTypes_t17_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t17, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t17 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t17, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t17 }
+};
+
+static const uint32_t TypeBuilderTypes_t18_ops [] =
+{
+  /* t18 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t18, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 957825f8d0cd3310e3b4ec7f1c93] (#deps: 0)
+  [COMPLETE 396121993f96fe817be52e37e7d8] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t18 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x95, 0x78, 0x25, 0xf8, 0xd0, 0xcd, 0x33, 0x10, 0xe3, 0xb4, 0xec, \
+  0x7f, 0x1c, 0x93, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x39, 0x61, 0x21, 0x99, 0x3f, 0x96, 0xfe, 0x81, 0x7b, 0xe5, 0x2e, \
+  0x37, 0xe7, 0xd8, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t18 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t18 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x95, 0x78, 0x25, 0xf8, 0xd0, 0xcd, 0x33, \
+  0x10, 0xe3, 0xb4, 0xec, 0x7f, 0x1c, 0x93, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x8f, 0x6b, 0x0d, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x39, 0x61, 0x21, 0x99, 0x3f, 0x96, 0xfe, \
+  0x81, 0x7b, 0xe5, 0x2e, 0x37, 0xe7, 0xd8, 0x00, 0x56, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x38, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x09, 0x8f, 0x6b, 0x0d, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x01, \
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x74, 0x65, 0x73, 0x74, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x39, 0x61, 0x21, \
+  0x99, 0x3f, 0x96, 0xfe, 0x81, 0x7b, 0xe5, 0x2e, 0x37, 0xe7, 0xd8, 0xf1, 0x95, 0x78, 0x25, 0xf8, \
+  0xd0, 0xcd, 0x33, 0x10, 0xe3, 0xb4, 0xec, 0x7f, 0x1c, 0x93\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t18 218u
+const dds_topic_descriptor_t TypeBuilderTypes_t18_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t18),
+  .m_align = dds_alignof (TypeBuilderTypes_t18),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t18",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t18_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t18, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t18 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t18, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t18 }
+};
+
+static const uint32_t TypeBuilderTypes_t19_ops [] =
+{
+  /* t19 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t19, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t19, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 6cff043f3a60cfaf1962c60d778f] (#deps: 1)
+   - [MINIMAL 9e452fc9043135123e625170db39]
+  [COMPLETE 5f484559bbcb4a79e1f3a54f9341] (#deps: 2)
+   - [COMPLETE d7fa9f244b000b4df3f01b798fc8]
+   - [COMPLETE 0d750bbddaaa7e5d68eb2379ec97]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t19 (const unsigned char []){ \
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0xff, 0x04, 0x3f, 0x3a, 0x60, 0xcf, 0xaf, 0x19, 0x62, 0xc6, \
+  0x0d, 0x77, 0x8f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, 0x31, 0x35, \
+  0x12, 0x3e, 0x62, 0x51, 0x70, 0xdb, 0x39, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x48, 0x45, \
+  0x59, 0xbb, 0xcb, 0x4a, 0x79, 0xe1, 0xf3, 0xa5, 0x4f, 0x93, 0x41, 0x00, 0x81, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd7, 0xfa, 0x9f, 0x24, 0x4b, 0x00, 0x0b, 0x4d, 0xf3, 0xf0, 0x1b, 0x79, 0x8f, 0xc8, 0x00, \
+  0x3b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0x75, 0x0b, 0xbd, 0xda, 0xaa, 0x7e, \
+  0x5d, 0x68, 0xeb, 0x23, 0x79, 0xec, 0x97, 0x00, 0x3b, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t19 172u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t19 (const unsigned char []){ \
+  0xb9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0xff, 0x04, 0x3f, 0x3a, 0x60, 0xcf, \
+  0xaf, 0x19, 0x62, 0xc6, 0x0d, 0x77, 0x8f, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, \
+  0x31, 0x35, 0x12, 0x3e, 0x62, 0x51, 0x70, 0xdb, 0x39, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, \
+  0x31, 0x35, 0x12, 0x3e, 0x62, 0x51, 0x70, 0xdb, 0x39, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x9e, 0x45, \
+  0x2f, 0xc9, 0x04, 0x31, 0x35, 0x12, 0x3e, 0x62, 0x51, 0x70, 0xdb, 0x39, 0x15, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x70, 0x00, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, 0x31, 0x35, 0x12, 0x3e, 0x62, \
+  0x51, 0x70, 0xdb, 0x39, 0x15, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, \
+  0x2b, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x48, 0x45, 0x59, 0xbb, 0xcb, 0x4a, \
+  0x79, 0xe1, 0xf3, 0xa5, 0x4f, 0x93, 0x41, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x39, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd7, 0xfa, 0x9f, 0x24, 0x4b, 0x00, 0x0b, 0x4d, 0xf3, \
+  0xf0, 0x1b, 0x79, 0x8f, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x0d, \
+  0x75, 0x0b, 0xbd, 0xda, 0xaa, 0x7e, 0x5d, 0x68, 0xeb, 0x23, 0x79, 0xec, 0x97, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xd7, 0xfa, 0x9f, 0x24, 0x4b, 0x00, \
+  0x0b, 0x4d, 0xf3, 0xf0, 0x1b, 0x79, 0x8f, 0xc8, 0x37, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, \
+  0x39, 0x5f, 0x32, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0x00, 0x00, 0xf2, 0x0d, 0x75, 0x0b, 0xbd, 0xda, 0xaa, 0x7e, 0x5d, 0x68, 0xeb, 0x23, 0x79, \
+  0xec, 0x97, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x31, 0x39, 0x5f, 0x31, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, \
+  0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x48, 0x45, 0x59, 0xbb, 0xcb, 0x4a, \
+  0x79, 0xe1, 0xf3, 0xa5, 0x4f, 0x93, 0x41, 0xf1, 0x6c, 0xff, 0x04, 0x3f, 0x3a, 0x60, 0xcf, 0xaf, \
+  0x19, 0x62, 0xc6, 0x0d, 0x77, 0x8f, 0xf2, 0xd7, 0xfa, 0x9f, 0x24, 0x4b, 0x00, 0x0b, 0x4d, 0xf3, \
+  0xf0, 0x1b, 0x79, 0x8f, 0xc8, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, 0x31, 0x35, 0x12, 0x3e, 0x62, \
+  0x51, 0x70, 0xdb, 0x39, 0xf2, 0x0d, 0x75, 0x0b, 0xbd, 0xda, 0xaa, 0x7e, 0x5d, 0x68, 0xeb, 0x23, \
+  0x79, 0xec, 0x97, 0xf1, 0x9e, 0x45, 0x2f, 0xc9, 0x04, 0x31, 0x35, 0x12, 0x3e, 0x62, 0x51, 0x70, \
+  0xdb, 0x39\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t19 594u
+const dds_topic_descriptor_t TypeBuilderTypes_t19_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t19),
+  .m_align = dds_alignof (TypeBuilderTypes_t19),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t19",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = TypeBuilderTypes_t19_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t19, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t19 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t19, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t19 }
+};
+
+static const uint32_t TypeBuilderTypes_t20_1_ops [] =
+{
+  /* t20_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t20_1, _d), 4u, (27u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 16, 1, offsetof (TypeBuilderTypes_t20_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 12, 2, offsetof (TypeBuilderTypes_t20_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 11, 3, offsetof (TypeBuilderTypes_t20_1, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 7, 0, offsetof (TypeBuilderTypes_t20_1, _u.u2), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 6de334f56567e4b91e2589f3b5d3] (#deps: 0)
+  [COMPLETE c79ef36f7ba33650f2ff68f56750] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t20_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, 0x65, 0x67, 0xe4, 0xb9, 0x1e, 0x25, 0x89, \
+  0xf3, 0xb5, 0xd3, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, 0xff, 0x68, \
+  0xf5, 0x67, 0x50, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t20_1 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t20_1 (const unsigned char []){ \
+  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, 0x65, 0x67, 0xe4, \
+  0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xe4, 0x77, 0x4c, 0xdd, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, 0xff, 0x68, 0xf5, 0x67, 0x50, 0x00, \
+  0x8d, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x30, 0x5f, 0x31, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x9e, 0xf3, \
+  0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, 0xff, 0x68, 0xf5, 0x67, 0x50, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, \
+  0x65, 0x67, 0xe4, 0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t20_1 330u
+const dds_topic_descriptor_t TypeBuilderTypes_t20_1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t20_1),
+  .m_align = dds_alignof (TypeBuilderTypes_t20_1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t20_1",
+  .m_keys = NULL,
+  .m_nops = 10,
+  .m_ops = TypeBuilderTypes_t20_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t20_1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t20_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t20_1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t20_1 }
+};
+
+static const uint32_t TypeBuilderTypes_t20_ops [] =
+{
+  /* t20 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t20, f1), (3u << 16u) + 6u /* t20_1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t20, f2),
+  DDS_OP_RTS,
+
+  /* t20_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t20_1, _d), 4u, (27u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 16, 1, offsetof (TypeBuilderTypes_t20_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 12, 2, offsetof (TypeBuilderTypes_t20_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 11, 3, offsetof (TypeBuilderTypes_t20_1, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 7, 0, offsetof (TypeBuilderTypes_t20_1, _u.u2), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, 0u, 3u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL da2e3149c71db7f20f8fb24315cf] (#deps: 1)
+   - [MINIMAL 6de334f56567e4b91e2589f3b5d3]
+  [COMPLETE 55c36e389dedcb0f485a6b00d4e6] (#deps: 1)
+   - [COMPLETE c79ef36f7ba33650f2ff68f56750]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t20 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xda, 0x2e, 0x31, 0x49, 0xc7, 0x1d, 0xb7, 0xf2, 0x0f, 0x8f, 0xb2, \
+  0x43, 0x15, 0xcf, 0x00, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, 0x65, 0x67, 0xe4, \
+  0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x55, 0xc3, 0x6e, \
+  0x38, 0x9d, 0xed, 0xcb, 0x0f, 0x48, 0x5a, 0x6b, 0x00, 0xd4, 0xe6, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, 0xff, 0x68, 0xf5, 0x67, 0x50, 0x00, \
+  0x91, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t20 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t20 (const unsigned char []){ \
+  0xcc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xda, 0x2e, 0x31, 0x49, 0xc7, 0x1d, 0xb7, \
+  0xf2, 0x0f, 0x8f, 0xb2, 0x43, 0x15, 0xcf, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, 0x65, \
+  0x67, 0xe4, 0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0xf1, \
+  0x6d, 0xe3, 0x34, 0xf5, 0x65, 0x67, 0xe4, 0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3, 0x00, 0x00, \
+  0x5c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x20, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, \
+  0x25, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x55, 0xc3, 0x6e, 0x38, 0x9d, 0xed, 0xcb, \
+  0x0f, 0x48, 0x5a, 0x6b, 0x00, 0xd4, 0xe6, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, \
+  0xff, 0x68, 0xf5, 0x67, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, \
+  0x36, 0x50, 0xf2, 0xff, 0x68, 0xf5, 0x67, 0x50, 0x8d, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x30, 0x5f, 0x31, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x55, 0xc3, 0x6e, 0x38, 0x9d, 0xed, 0xcb, 0x0f, 0x48, 0x5a, 0x6b, \
+  0x00, 0xd4, 0xe6, 0xf1, 0xda, 0x2e, 0x31, 0x49, 0xc7, 0x1d, 0xb7, 0xf2, 0x0f, 0x8f, 0xb2, 0x43, \
+  0x15, 0xcf, 0xf2, 0xc7, 0x9e, 0xf3, 0x6f, 0x7b, 0xa3, 0x36, 0x50, 0xf2, 0xff, 0x68, 0xf5, 0x67, \
+  0x50, 0xf1, 0x6d, 0xe3, 0x34, 0xf5, 0x65, 0x67, 0xe4, 0xb9, 0x1e, 0x25, 0x89, 0xf3, 0xb5, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t20 576u
+const dds_topic_descriptor_t TypeBuilderTypes_t20_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t20),
+  .m_align = dds_alignof (TypeBuilderTypes_t20),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t20",
+  .m_keys = NULL,
+  .m_nops = 13,
+  .m_ops = TypeBuilderTypes_t20_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t20, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t20 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t20, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t20 }
+};
+
+static const uint32_t TypeBuilderTypes_t21_2_ops [] =
+{
+  /* t21_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t21_2, _d), 1u, (13u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 4, 1, offsetof (TypeBuilderTypes_t21_2, _u.u1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), 0u, 3u, 1u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 89e4c224b9d9da491021638c5924] (#deps: 1)
+   - [MINIMAL 44adc4f2d84e149ca6a27cd090ab]
+  [COMPLETE 5f85878caa5435c7866f4ccf9ffd] (#deps: 1)
+   - [COMPLETE b04a61c3a421c05e561ab5bbecb6]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t21_2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x89, 0xe4, 0xc2, 0x24, 0xb9, 0xd9, 0xda, 0x49, 0x10, 0x21, 0x63, \
+  0x8c, 0x59, 0x24, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, 0x14, \
+  0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x85, 0x87, \
+  0x8c, 0xaa, 0x54, 0x35, 0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, 0x00, \
+  0x72, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t21_2 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t21_2 (const unsigned char []){ \
+  0xae, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x89, 0xe4, 0xc2, 0x24, 0xb9, 0xd9, 0xda, \
+  0x49, 0x10, 0x21, 0x63, 0x8c, 0x59, 0x24, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, \
+  0x14, 0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xe4, 0x77, 0x4c, 0xdd, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, 0x14, 0x9c, 0xa6, 0xa2, 0x7c, \
+  0xd0, 0x90, 0xab, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xb2, 0xd8, 0xda, 0x8e, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xb7, \
+  0x8c, 0x8a, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x85, 0x87, \
+  0x8c, 0xaa, 0x54, 0x35, 0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x31, 0x5f, 0x32, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, \
+  0x6e, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x31, 0x5f, 0x31, 0x00, 0x42, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0x32, 0x31, 0x5f, 0x31, 0x5f, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0x32, 0x31, 0x5f, 0x31, 0x5f, 0x31, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x85, 0x87, \
+  0x8c, 0xaa, 0x54, 0x35, 0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0xf1, 0x89, 0xe4, 0xc2, 0x24, \
+  0xb9, 0xd9, 0xda, 0x49, 0x10, 0x21, 0x63, 0x8c, 0x59, 0x24, 0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, \
+  0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, \
+  0x14, 0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t21_2 520u
+const dds_topic_descriptor_t TypeBuilderTypes_t21_2_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t21_2),
+  .m_align = dds_alignof (TypeBuilderTypes_t21_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t21_2",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = TypeBuilderTypes_t21_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t21_2, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t21_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t21_2, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t21_2 }
+};
+
+static const uint32_t TypeBuilderTypes_t21_ops [] =
+{
+  /* t21 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t21, f1), (3u << 16u) + 4u /* t21_2 */,
+  DDS_OP_RTS,
+
+  /* t21_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t21_2, _d), 1u, (13u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 4, 1, offsetof (TypeBuilderTypes_t21_2, _u.u1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), 0u, 3u, 1u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 345c2440fc57369553f6bf074ca8] (#deps: 2)
+   - [MINIMAL 89e4c224b9d9da491021638c5924]
+   - [MINIMAL 44adc4f2d84e149ca6a27cd090ab]
+  [COMPLETE d5a07a86081f56bd3f603d6b4aec] (#deps: 2)
+   - [COMPLETE 5f85878caa5435c7866f4ccf9ffd]
+   - [COMPLETE b04a61c3a421c05e561ab5bbecb6]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t21 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x34, 0x5c, 0x24, 0x40, 0xfc, 0x57, 0x36, 0x95, 0x53, 0xf6, 0xbf, \
+  0x07, 0x4c, 0xa8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x89, 0xe4, 0xc2, 0x24, 0xb9, 0xd9, 0xda, \
+  0x49, 0x10, 0x21, 0x63, 0x8c, 0x59, 0x24, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, 0x14, 0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd5, 0xa0, 0x7a, 0x86, 0x08, 0x1f, 0x56, 0xbd, 0x3f, 0x60, 0x3d, \
+  0x6b, 0x4a, 0xec, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x85, 0x87, 0x8c, 0xaa, 0x54, 0x35, \
+  0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0x00, 0x75, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, 0x00, \
+  0x72, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t21 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t21 (const unsigned char []){ \
+  0xf2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x34, 0x5c, 0x24, 0x40, 0xfc, 0x57, 0x36, \
+  0x95, 0x53, 0xf6, 0xbf, 0x07, 0x4c, 0xa8, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x89, 0xe4, 0xc2, 0x24, 0xb9, \
+  0xd9, 0xda, 0x49, 0x10, 0x21, 0x63, 0x8c, 0x59, 0x24, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x89, 0xe4, \
+  0xc2, 0x24, 0xb9, 0xd9, 0xda, 0x49, 0x10, 0x21, 0x63, 0x8c, 0x59, 0x24, 0x48, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x44, 0xad, \
+  0xc4, 0xf2, 0xd8, 0x4e, 0x14, 0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, 0x14, \
+  0x9c, 0xa6, 0xa2, 0x7c, 0xd0, 0x90, 0xab, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xb2, 0xd8, \
+  0xda, 0x8e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x52, 0xb7, 0x8c, 0x8a, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0xd5, 0xa0, 0x7a, 0x86, 0x08, 0x1f, 0x56, 0xbd, 0x3f, 0x60, 0x3d, 0x6b, 0x4a, 0xec, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x31, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x5f, \
+  0x85, 0x87, 0x8c, 0xaa, 0x54, 0x35, 0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x5f, 0x85, 0x87, 0x8c, 0xaa, 0x54, \
+  0x35, 0xc7, 0x86, 0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0x71, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x31, 0x5f, 0x32, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0xb0, 0x4a, \
+  0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0x4a, \
+  0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, 0xbb, 0xec, 0xb6, 0x6e, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x31, 0x5f, 0x31, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x54, 0x32, 0x31, 0x5f, 0x31, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x54, 0x32, 0x31, 0x5f, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xd5, 0xa0, 0x7a, 0x86, 0x08, 0x1f, 0x56, \
+  0xbd, 0x3f, 0x60, 0x3d, 0x6b, 0x4a, 0xec, 0xf1, 0x34, 0x5c, 0x24, 0x40, 0xfc, 0x57, 0x36, 0x95, \
+  0x53, 0xf6, 0xbf, 0x07, 0x4c, 0xa8, 0xf2, 0x5f, 0x85, 0x87, 0x8c, 0xaa, 0x54, 0x35, 0xc7, 0x86, \
+  0x6f, 0x4c, 0xcf, 0x9f, 0xfd, 0xf1, 0x89, 0xe4, 0xc2, 0x24, 0xb9, 0xd9, 0xda, 0x49, 0x10, 0x21, \
+  0x63, 0x8c, 0x59, 0x24, 0xf2, 0xb0, 0x4a, 0x61, 0xc3, 0xa4, 0x21, 0xc0, 0x5e, 0x56, 0x1a, 0xb5, \
+  0xbb, 0xec, 0xb6, 0xf1, 0x44, 0xad, 0xc4, 0xf2, 0xd8, 0x4e, 0x14, 0x9c, 0xa6, 0xa2, 0x7c, 0xd0, \
+  0x90, 0xab\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t21 722u
+const dds_topic_descriptor_t TypeBuilderTypes_t21_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t21),
+  .m_align = dds_alignof (TypeBuilderTypes_t21),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t21",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = TypeBuilderTypes_t21_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t21, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t21 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t21, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t21 }
+};
+
+static const uint32_t TypeBuilderTypes_t22_1_ops [] =
+{
+  /* t22_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t22_1, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 9e7628fc826abe08deccee368418] (#deps: 0)
+  [COMPLETE 433dba3e7512c75acc8ca92406b3] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t22_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x9e, 0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, \
+  0x36, 0x84, 0x18, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, \
+  0x24, 0x06, 0xb3, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t22_1 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t22_1 (const unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x9e, 0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, \
+  0x08, 0xde, 0xcc, 0xee, 0x36, 0x84, 0x18, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x10, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, \
+  0x24, 0x06, 0xb3, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x32, 0x5f, 0x31, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, \
+  0x24, 0x06, 0xb3, 0xf1, 0x9e, 0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, 0x36, \
+  0x84, 0x18\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t22_1 226u
+const dds_topic_descriptor_t TypeBuilderTypes_t22_1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t22_1),
+  .m_align = dds_alignof (TypeBuilderTypes_t22_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t22_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t22_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t22_1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t22_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t22_1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t22_1 }
+};
+
+static const uint32_t TypeBuilderTypes_t22_ops [] =
+{
+  /* t22 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t22, f1), 6u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t22, f2), 12u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t22, f3), 24u,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t22, f4), (3u << 16u) + 4u /* t22_1 */,
+  DDS_OP_RTS,
+
+  /* t22_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t22_1, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c17afc256705b64d17cf78c5f35f] (#deps: 4)
+   - [MINIMAL f280dbc15b3ad199db7bb168f297]
+   - [MINIMAL 568c7da6e3bb6c12581905912cdd]
+   - [MINIMAL 1bd07200381afa957eec33dd12e4]
+   - [MINIMAL 9e7628fc826abe08deccee368418]
+  [COMPLETE fad55a3de008c33b28de75f9db78] (#deps: 4)
+   - [COMPLETE 84b454cb3c6931e3114b7e7bc50a]
+   - [COMPLETE c9de7522d3ef35e434d61121a47d]
+   - [COMPLETE 861697eb9fb43884fa32badb8536]
+   - [COMPLETE 433dba3e7512c75acc8ca92406b3]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t22 (const unsigned char []){ \
+  0x20, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc1, 0x7a, 0xfc, 0x25, 0x67, 0x05, 0xb6, 0x4d, 0x17, 0xcf, 0x78, \
+  0xc5, 0xf3, 0x5f, 0x00, 0x99, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf2, 0x80, 0xdb, 0xc1, 0x5b, 0x3a, 0xd1, \
+  0x99, 0xdb, 0x7b, 0xb1, 0x68, 0xf2, 0x97, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x56, 0x8c, 0x7d, 0xa6, 0xe3, 0xbb, 0x6c, 0x12, 0x58, 0x19, 0x05, 0x91, 0x2c, 0xdd, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1b, 0xd0, 0x72, 0x00, 0x38, 0x1a, 0xfa, \
+  0x95, 0x7e, 0xec, 0x33, 0xdd, 0x12, 0xe4, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x9e, 0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, 0x36, 0x84, 0x18, 0x00, \
+  0x32, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x88, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0xd5, 0x5a, 0x3d, 0xe0, 0x08, 0xc3, 0x3b, 0x28, 0xde, 0x75, \
+  0xf9, 0xdb, 0x78, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x84, 0xb4, 0x54, 0xcb, 0x3c, 0x69, 0x31, \
+  0xe3, 0x11, 0x4b, 0x7e, 0x7b, 0xc5, 0x0a, 0x00, 0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0xde, 0x75, 0x22, 0xd3, 0xef, 0x35, 0xe4, 0x34, 0xd6, 0x11, 0x21, 0xa4, 0x7d, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x86, 0x16, 0x97, 0xeb, 0x9f, 0xb4, 0x38, \
+  0x84, 0xfa, 0x32, 0xba, 0xdb, 0x85, 0x36, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, 0x24, 0x06, 0xb3, 0x00, \
+  0x55, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t22 292u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t22 (const unsigned char []){ \
+  0x8a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf1, 0xc1, 0x7a, 0xfc, 0x25, 0x67, 0x05, 0xb6, \
+  0x4d, 0x17, 0xcf, 0x78, 0xc5, 0xf3, 0x5f, 0x00, 0x95, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf2, 0x80, 0xdb, 0xc1, 0x5b, 0x3a, 0xd1, 0x99, 0xdb, \
+  0x7b, 0xb1, 0x68, 0xf2, 0x97, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0xf1, 0xf2, 0x80, 0xdb, 0xc1, 0x5b, 0x3a, 0xd1, 0x99, 0xdb, 0x7b, 0xb1, 0x68, 0xf2, 0x97, \
+  0x17, 0x79, 0xcf, 0x3a, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x9e, \
+  0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, 0x36, 0x84, 0x18, 0x6e, 0x1f, 0xcd, \
+  0x70, 0xf1, 0xf2, 0x80, 0xdb, 0xc1, 0x5b, 0x3a, 0xd1, 0x99, 0xdb, 0x7b, 0xb1, 0x68, 0xf2, 0x97, \
+  0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xf1, 0x56, 0x8c, 0x7d, 0xa6, 0xe3, 0xbb, 0x6c, 0x12, 0x58, 0x19, 0x05, 0x91, 0x2c, \
+  0xdd, 0xf1, 0x56, 0x8c, 0x7d, 0xa6, 0xe3, 0xbb, 0x6c, 0x12, 0x58, 0x19, 0x05, 0x91, 0x2c, 0xdd, \
+  0x28, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x1b, 0xd0, \
+  0x72, 0x00, 0x38, 0x1a, 0xfa, 0x95, 0x7e, 0xec, 0x33, 0xdd, 0x12, 0xe4, 0xf1, 0x1b, 0xd0, 0x72, \
+  0x00, 0x38, 0x1a, 0xfa, 0x95, 0x7e, 0xec, 0x33, 0xdd, 0x12, 0xe4, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0xf1, 0x9e, 0x76, 0x28, 0xfc, 0x82, \
+  0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, 0x36, 0x84, 0x18, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x10, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, \
+  0x59, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0xd5, 0x5a, 0x3d, 0xe0, 0x08, 0xc3, \
+  0x3b, 0x28, 0xde, 0x75, 0xf9, 0xdb, 0x78, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x32, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x02, 0x03, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x84, 0xb4, 0x54, 0xcb, 0x3c, \
+  0x69, 0x31, 0xe3, 0x11, 0x4b, 0x7e, 0x7b, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x84, 0xb4, \
+  0x54, 0xcb, 0x3c, 0x69, 0x31, 0xe3, 0x11, 0x4b, 0x7e, 0x7b, 0xc5, 0x0a, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, 0x24, 0x06, \
+  0xb3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, 0x00, 0xf2, 0x84, 0xb4, \
+  0x54, 0xcb, 0x3c, 0x69, 0x31, 0xe3, 0x11, 0x4b, 0x7e, 0x7b, 0xc5, 0x0a, 0x43, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x61, 0x72, 0x72, 0x5f, 0x6c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xf2, 0xc9, 0xde, 0x75, 0x22, 0xd3, 0xef, 0x35, 0xe4, 0x34, 0xd6, 0x11, 0x21, 0xa4, \
+  0x7d, 0x00, 0x00, 0xf2, 0xc9, 0xde, 0x75, 0x22, 0xd3, 0xef, 0x35, 0xe4, 0x34, 0xd6, 0x11, 0x21, \
+  0xa4, 0x7d, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, 0x72, 0x5f, 0x6c, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x86, 0x16, 0x97, 0xeb, 0x9f, 0xb4, 0x38, 0x84, 0xfa, 0x32, \
+  0xba, 0xdb, 0x85, 0x36, 0x00, 0x00, 0xf2, 0x86, 0x16, 0x97, 0xeb, 0x9f, 0xb4, 0x38, 0x84, 0xfa, \
+  0x32, 0xba, 0xdb, 0x85, 0x36, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, \
+  0x72, 0x5f, 0x6c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, \
+  0x5a, 0xcc, 0x8c, 0xa9, 0x24, 0x06, 0xb3, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x32, 0x5f, 0x31, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x9a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0xd5, 0x5a, 0x3d, 0xe0, 0x08, 0xc3, \
+  0x3b, 0x28, 0xde, 0x75, 0xf9, 0xdb, 0x78, 0xf1, 0xc1, 0x7a, 0xfc, 0x25, 0x67, 0x05, 0xb6, 0x4d, \
+  0x17, 0xcf, 0x78, 0xc5, 0xf3, 0x5f, 0xf2, 0x84, 0xb4, 0x54, 0xcb, 0x3c, 0x69, 0x31, 0xe3, 0x11, \
+  0x4b, 0x7e, 0x7b, 0xc5, 0x0a, 0xf1, 0xf2, 0x80, 0xdb, 0xc1, 0x5b, 0x3a, 0xd1, 0x99, 0xdb, 0x7b, \
+  0xb1, 0x68, 0xf2, 0x97, 0xf2, 0xc9, 0xde, 0x75, 0x22, 0xd3, 0xef, 0x35, 0xe4, 0x34, 0xd6, 0x11, \
+  0x21, 0xa4, 0x7d, 0xf1, 0x56, 0x8c, 0x7d, 0xa6, 0xe3, 0xbb, 0x6c, 0x12, 0x58, 0x19, 0x05, 0x91, \
+  0x2c, 0xdd, 0xf2, 0x86, 0x16, 0x97, 0xeb, 0x9f, 0xb4, 0x38, 0x84, 0xfa, 0x32, 0xba, 0xdb, 0x85, \
+  0x36, 0xf1, 0x1b, 0xd0, 0x72, 0x00, 0x38, 0x1a, 0xfa, 0x95, 0x7e, 0xec, 0x33, 0xdd, 0x12, 0xe4, \
+  0xf2, 0x43, 0x3d, 0xba, 0x3e, 0x75, 0x12, 0xc7, 0x5a, 0xcc, 0x8c, 0xa9, 0x24, 0x06, 0xb3, 0xf1, \
+  0x9e, 0x76, 0x28, 0xfc, 0x82, 0x6a, 0xbe, 0x08, 0xde, 0xcc, 0xee, 0x36, 0x84, 0x18\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t22 1166u
+const dds_topic_descriptor_t TypeBuilderTypes_t22_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t22),
+  .m_align = dds_alignof (TypeBuilderTypes_t22),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t22",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = TypeBuilderTypes_t22_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t22, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t22 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t22, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t22 }
+};
+
+static const uint32_t TypeBuilderTypes_t23_ops [] =
+{
+  /* t23 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STR, offsetof (TypeBuilderTypes_t23, f1), 4u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a1a69c44cacdd151f6f8dd3561ac] (#deps: 2)
+   - [MINIMAL 1e94705b3258f90b16254f095feb]
+   - [MINIMAL 402e16d8112710cdfd3c089bc0f5]
+  [COMPLETE 86bfd8d91b410ce6e3eaf7bf645b] (#deps: 2)
+   - [COMPLETE e110c0443533452bbdc37d406c56]
+   - [COMPLETE 895a829216971b3c83c7790e1c8e]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t23 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0xa6, 0x9c, 0x44, 0xca, 0xcd, 0xd1, 0x51, 0xf6, 0xf8, 0xdd, \
+  0x35, 0x61, 0xac, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x1e, 0x94, 0x70, 0x5b, 0x32, 0x58, 0xf9, \
+  0x0b, 0x16, 0x25, 0x4f, 0x09, 0x5f, 0xeb, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x2e, 0x16, 0xd8, 0x11, 0x27, 0x10, 0xcd, 0xfd, 0x3c, 0x08, 0x9b, 0xc0, 0xf5, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x86, 0xbf, 0xd8, 0xd9, 0x1b, 0x41, 0x0c, 0xe6, 0xe3, 0xea, 0xf7, \
+  0xbf, 0x64, 0x5b, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe1, 0x10, 0xc0, 0x44, 0x35, 0x33, 0x45, \
+  0x2b, 0xbd, 0xc3, 0x7d, 0x40, 0x6c, 0x56, 0x00, 0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x89, 0x5a, 0x82, 0x92, 0x16, 0x97, 0x1b, 0x3c, 0x83, 0xc7, 0x79, 0x0e, 0x1c, 0x8e, 0x00, \
+  0x41, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t23 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t23 (const unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0xa6, 0x9c, 0x44, 0xca, 0xcd, 0xd1, \
+  0x51, 0xf6, 0xf8, 0xdd, 0x35, 0x61, 0xac, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x1e, 0x94, 0x70, 0x5b, 0x32, 0x58, 0xf9, 0x0b, 0x16, 0x25, \
+  0x4f, 0x09, 0x5f, 0xeb, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x1e, 0x94, 0x70, 0x5b, 0x32, 0x58, 0xf9, \
+  0x0b, 0x16, 0x25, 0x4f, 0x09, 0x5f, 0xeb, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x2e, 0x16, 0xd8, 0x11, \
+  0x27, 0x10, 0xcd, 0xfd, 0x3c, 0x08, 0x9b, 0xc0, 0xf5, 0xf1, 0x40, 0x2e, 0x16, 0xd8, 0x11, 0x27, \
+  0x10, 0xcd, 0xfd, 0x3c, 0x08, 0x9b, 0xc0, 0xf5, 0x1b, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x86, 0xbf, 0xd8, 0xd9, 0x1b, 0x41, 0x0c, 0xe6, 0xe3, 0xea, 0xf7, 0xbf, 0x64, 0x5b, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf2, 0xe1, 0x10, 0xc0, 0x44, 0x35, 0x33, \
+  0x45, 0x2b, 0xbd, 0xc3, 0x7d, 0x40, 0x6c, 0x56, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xe1, 0x10, 0xc0, 0x44, 0x35, 0x33, 0x45, 0x2b, 0xbd, 0xc3, 0x7d, 0x40, 0x6c, 0x56, \
+  0x43, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, 0x72, 0x5f, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x89, 0x5a, 0x82, 0x92, 0x16, 0x97, 0x1b, 0x3c, 0x83, \
+  0xc7, 0x79, 0x0e, 0x1c, 0x8e, 0x00, 0x00, 0xf2, 0x89, 0x5a, 0x82, 0x92, 0x16, 0x97, 0x1b, 0x3c, \
+  0x83, 0xc7, 0x79, 0x0e, 0x1c, 0x8e, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x61, 0x72, \
+  0x72, 0x5f, 0x73, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x86, 0xbf, 0xd8, 0xd9, 0x1b, 0x41, 0x0c, 0xe6, 0xe3, 0xea, 0xf7, \
+  0xbf, 0x64, 0x5b, 0xf1, 0xa1, 0xa6, 0x9c, 0x44, 0xca, 0xcd, 0xd1, 0x51, 0xf6, 0xf8, 0xdd, 0x35, \
+  0x61, 0xac, 0xf2, 0xe1, 0x10, 0xc0, 0x44, 0x35, 0x33, 0x45, 0x2b, 0xbd, 0xc3, 0x7d, 0x40, 0x6c, \
+  0x56, 0xf1, 0x1e, 0x94, 0x70, 0x5b, 0x32, 0x58, 0xf9, 0x0b, 0x16, 0x25, 0x4f, 0x09, 0x5f, 0xeb, \
+  0xf2, 0x89, 0x5a, 0x82, 0x92, 0x16, 0x97, 0x1b, 0x3c, 0x83, 0xc7, 0x79, 0x0e, 0x1c, 0x8e, 0xf1, \
+  0x40, 0x2e, 0x16, 0xd8, 0x11, 0x27, 0x10, 0xcd, 0xfd, 0x3c, 0x08, 0x9b, 0xc0, 0xf5\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t23 574u
+const dds_topic_descriptor_t TypeBuilderTypes_t23_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t23),
+  .m_align = dds_alignof (TypeBuilderTypes_t23),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t23",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t23_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t23, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t23 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t23, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t23 }
+};
+
+static const uint32_t TypeBuilderTypes_t24_1_ops [] =
+{
+  /* t24_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t24_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 2649a998b4e7459440ddc6ef2741] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t24_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, \
+  0xef, 0x27, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24_1 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t24_1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, \
+  0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x34, 0x5f, 0x31, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, \
+  0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24_1 202u
+const dds_topic_descriptor_t TypeBuilderTypes_t24_1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t24_1),
+  .m_align = dds_alignof (TypeBuilderTypes_t24_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t24_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = TypeBuilderTypes_t24_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t24_1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t24_1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24_1 }
+};
+
+static const uint32_t TypeBuilderTypes_t24_2_ops [] =
+{
+  /* t24_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY, offsetof (TypeBuilderTypes_t24_2, _d), 5u, (29u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t24_2, _u.a), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 22 /* t24_1 */, 2, offsetof (TypeBuilderTypes_t24_2, _u.b), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 18 /* t24_1 */, 3, offsetof (TypeBuilderTypes_t24_2, _u.b), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 8, 4, offsetof (TypeBuilderTypes_t24_2, _u.c), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 4, 5, offsetof (TypeBuilderTypes_t24_2, _u.c), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, 0u, sizeof (TypeBuilderTypes_t24_1), (4u << 16u) + 6u /* t24_1 */,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+
+  /* t24_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t24_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a8d9b262090b6c60a01f08c8ff8a] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE 64f2739b6550311dcad9945c66fd] (#deps: 1)
+   - [COMPLETE 2649a998b4e7459440ddc6ef2741]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t24_2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, \
+  0xc8, 0xff, 0x8a, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x64, 0xf2, 0x73, \
+  0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0x00, 0xc0, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24_2 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t24_2 (const unsigned char []){ \
+  0xdb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, \
+  0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0xc1, 0x75, 0xb9, 0x28, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, \
+  0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x92, 0xeb, 0x5f, 0xfe, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x4a, 0x8a, 0x08, 0xf0, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x2d, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x64, 0xf2, 0x73, 0x9b, 0x65, 0x50, 0x31, \
+  0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x34, 0x5f, 0x32, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x26, \
+  0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, \
+  0x01, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, \
+  0x27, 0x41, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, \
+  0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x34, 0x5f, 0x31, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x64, 0xf2, 0x73, \
+  0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0xf1, 0xa8, 0xd9, 0xb2, 0x62, \
+  0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, \
+  0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, \
+  0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24_2 600u
+const dds_topic_descriptor_t TypeBuilderTypes_t24_2_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t24_2),
+  .m_align = dds_alignof (TypeBuilderTypes_t24_2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t24_2",
+  .m_keys = NULL,
+  .m_nops = 11,
+  .m_ops = TypeBuilderTypes_t24_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t24_2, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t24_2, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24_2 }
+};
+
+static const uint32_t TypeBuilderTypes_t24_ops [] =
+{
+  /* t24 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF, offsetof (TypeBuilderTypes_t24, _d), 14u, (92u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 56, 1, offsetof (TypeBuilderTypes_t24, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 52, 2, offsetof (TypeBuilderTypes_t24, _u.u1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 81 /* t24_1 */, 3, offsetof (TypeBuilderTypes_t24, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 77 /* t24_1 */, 4, offsetof (TypeBuilderTypes_t24, _u.u2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 45, 5, offsetof (TypeBuilderTypes_t24, _u.u3), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 41, 6, offsetof (TypeBuilderTypes_t24, _u.u3), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 43, 7, offsetof (TypeBuilderTypes_t24, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_ARR | 39, 8, offsetof (TypeBuilderTypes_t24, _u.u4), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 46, 10, offsetof (TypeBuilderTypes_t24, _u.s1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 42, 11, offsetof (TypeBuilderTypes_t24, _u.s1), 0u, DDS_OP_JEQ4 | DDS_OP_TYPE_UNI | 52 /* t24_2 */, 12, offsetof (TypeBuilderTypes_t24, _u.s2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_UNI | 48 /* t24_2 */, 13, offsetof (TypeBuilderTypes_t24, _u.s2), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 35, 99, offsetof (TypeBuilderTypes_t24, _u.u99), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 31, 0, offsetof (TypeBuilderTypes_t24, _u.u99), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, 0u, sizeof (TypeBuilderTypes_t24_1), (4u << 16u) + 33u /* t24_1 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, 0u, 2u, (5u << 16u) + 28u /* t24_1 */, sizeof (TypeBuilderTypes_t24_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_SEQ, 0u, 2u, (10u << 16u) + 5u, sizeof (dds_sequence_TypeBuilderTypes_t24_1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, 0u, sizeof (TypeBuilderTypes_t24_1), (4u << 16u) + 17u /* t24_1 */,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_UNI, 0u, sizeof (TypeBuilderTypes_t24_2), (4u << 16u) + 14u /* t24_2 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, 0u, sizeof (TypeBuilderTypes_t24_1), (4u << 16u) + 6u /* t24_1 */,
+  DDS_OP_RTS,
+  DDS_OP_RTS,
+
+  /* t24_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t24_1, f1),
+  DDS_OP_RTS,
+
+  /* t24_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY, offsetof (TypeBuilderTypes_t24_2, _d), 5u, (29u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (TypeBuilderTypes_t24_2, _u.a), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 65525 /* t24_1 */, 2, offsetof (TypeBuilderTypes_t24_2, _u.b), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 65521 /* t24_1 */, 3, offsetof (TypeBuilderTypes_t24_2, _u.b), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 8, 4, offsetof (TypeBuilderTypes_t24_2, _u.c), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_SEQ | 4, 5, offsetof (TypeBuilderTypes_t24_2, _u.c), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, 0u, sizeof (TypeBuilderTypes_t24_1), (4u << 16u) + 65509u /* t24_1 */,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c58c1e3e8cc7e7c40ab97c2d7c79] (#deps: 2)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+   - [MINIMAL a8d9b262090b6c60a01f08c8ff8a]
+  [COMPLETE bfbe10db484773af81f9b8a20e64] (#deps: 2)
+   - [COMPLETE 2649a998b4e7459440ddc6ef2741]
+   - [COMPLETE 64f2739b6550311dcad9945c66fd]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t24 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc5, 0x8c, 0x1e, 0x3e, 0x8c, 0xc7, 0xe7, 0xc4, 0x0a, 0xb9, 0x7c, \
+  0x2d, 0x7c, 0x79, 0x00, 0x70, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0x00, \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0xbe, 0x10, 0xdb, 0x48, 0x47, 0x73, 0xaf, 0x81, 0xf9, 0xb8, \
+  0xa2, 0x0e, 0x64, 0x00, 0xca, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, \
+  0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x64, 0xf2, 0x73, 0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0x00, \
+  0xc0, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t24 (const unsigned char []){ \
+  0x5c, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xc5, 0x8c, 0x1e, 0x3e, 0x8c, 0xc7, 0xe7, \
+  0xc4, 0x0a, 0xb9, 0x7c, 0x2d, 0x7c, 0x79, 0x00, 0x6c, 0x01, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x58, 0x01, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, \
+  0x01, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, \
+  0x16, 0xeb, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xe4, 0x77, 0x4c, 0xdd, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, \
+  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, \
+  0xb5, 0x68, 0x16, 0xeb, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x53, 0x2a, 0x7b, 0x8e, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0xf1, 0x00, 0x01, 0x00, 0x00, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7b, 0x8d, 0x62, 0xfd, \
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x8d, 0xdf, 0x87, 0x80, \
+  0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa8, 0xd9, 0xb2, 0x62, 0x09, \
+  0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xfa, 0xc9, 0x89, 0x44, 0x28, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x41, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0xa5, 0x37, 0xc2, 0xc9, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0xf1, \
+  0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a, 0x00, 0x00, \
+  0x8c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0xc1, 0x75, 0xb9, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, \
+  0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x4a, 0x8a, 0x08, 0xf0, \
+  0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0xbe, 0x10, 0xdb, 0x48, 0x47, 0x73, \
+  0xaf, 0x81, 0xf9, 0xb8, 0xa2, 0x0e, 0x64, 0x00, 0xc6, 0x01, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x34, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x8e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, \
+  0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, \
+  0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, \
+  0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0xf2, 0x00, 0x01, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, \
+  0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, \
+  0x01, 0x00, 0x00, 0xf2, 0x64, 0xf2, 0x73, 0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, \
+  0x66, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x64, 0xf2, 0x73, 0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, \
+  0xd9, 0x94, 0x5c, 0x66, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x41, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x39, 0x39, 0x00, \
+  0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, \
+  0x41, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x34, 0x5f, 0x31, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x64, 0xf2, \
+  0x73, 0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0xbc, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x34, 0x5f, 0x32, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, \
+  0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, \
+  0x40, 0xdd, 0xc6, 0xef, 0x27, 0x41, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0xbe, 0x10, 0xdb, 0x48, 0x47, 0x73, 0xaf, 0x81, 0xf9, 0xb8, \
+  0xa2, 0x0e, 0x64, 0xf1, 0xc5, 0x8c, 0x1e, 0x3e, 0x8c, 0xc7, 0xe7, 0xc4, 0x0a, 0xb9, 0x7c, 0x2d, \
+  0x7c, 0x79, 0xf2, 0x26, 0x49, 0xa9, 0x98, 0xb4, 0xe7, 0x45, 0x94, 0x40, 0xdd, 0xc6, 0xef, 0x27, \
+  0x41, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, \
+  0xf2, 0x64, 0xf2, 0x73, 0x9b, 0x65, 0x50, 0x31, 0x1d, 0xca, 0xd9, 0x94, 0x5c, 0x66, 0xfd, 0xf1, \
+  0xa8, 0xd9, 0xb2, 0x62, 0x09, 0x0b, 0x6c, 0x60, 0xa0, 0x1f, 0x08, 0xc8, 0xff, 0x8a\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24 1486u
+const dds_topic_descriptor_t TypeBuilderTypes_t24_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t24),
+  .m_align = dds_alignof (TypeBuilderTypes_t24),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t24",
+  .m_keys = NULL,
+  .m_nops = 39,
+  .m_ops = TypeBuilderTypes_t24_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t24, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t24 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t24, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t24 }
+};
+
+static const uint32_t TypeBuilderTypes_t25_1_ops [] =
+{
+  /* t25_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t25_1, _d), 1u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BST | 4, 0, offsetof (TypeBuilderTypes_t25_1, _u.u1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_BST, 0u, 10u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e074fa3f828875313d72baa6125a] (#deps: 0)
+  [COMPLETE b7355536e9b691c56f21700ac8a4] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t25_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe0, 0x74, 0xfa, 0x3f, 0x82, 0x88, 0x75, 0x31, 0x3d, 0x72, 0xba, \
+  0xa6, 0x12, 0x5a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb7, 0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, \
+  0x0a, 0xc8, 0xa4, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t25_1 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t25_1 (const unsigned char []){ \
+  0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe0, 0x74, 0xfa, 0x3f, 0x82, 0x88, 0x75, \
+  0x31, 0x3d, 0x72, 0xba, 0xa6, 0x12, 0x5a, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x09, \
+  0x00, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xb7, 0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, 0x0a, 0xc8, 0xa4, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x35, 0x5f, 0x31, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x09, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xb7, 0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, \
+  0x0a, 0xc8, 0xa4, 0xf1, 0xe0, 0x74, 0xfa, 0x3f, 0x82, 0x88, 0x75, 0x31, 0x3d, 0x72, 0xba, 0xa6, \
+  0x12, 0x5a\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t25_1 226u
+const dds_topic_descriptor_t TypeBuilderTypes_t25_1_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t25_1),
+  .m_align = dds_alignof (TypeBuilderTypes_t25_1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t25_1",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = TypeBuilderTypes_t25_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t25_1, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t25_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t25_1, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t25_1 }
+};
+
+static const uint32_t TypeBuilderTypes_t25_ops [] =
+{
+  /* t25 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t25, f1), (3u << 16u) + 4u /* t25_1 */,
+  DDS_OP_RTS,
+
+  /* t25_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (TypeBuilderTypes_t25_1, _d), 1u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_BST | 4, 0, offsetof (TypeBuilderTypes_t25_1, _u.u1), 0u,
+  DDS_OP_ADR | DDS_OP_TYPE_BST, 0u, 10u,
+  DDS_OP_RTS,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7a395e4744c1ce91ed58098fd7cf] (#deps: 1)
+   - [MINIMAL e074fa3f828875313d72baa6125a]
+  [COMPLETE 580a8263a837d5f66ce55b0b5e78] (#deps: 1)
+   - [COMPLETE b7355536e9b691c56f21700ac8a4]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t25 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7a, 0x39, 0x5e, 0x47, 0x44, 0xc1, 0xce, 0x91, 0xed, 0x58, 0x09, \
+  0x8f, 0xd7, 0xcf, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe0, 0x74, 0xfa, 0x3f, 0x82, 0x88, 0x75, \
+  0x31, 0x3d, 0x72, 0xba, 0xa6, 0x12, 0x5a, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x0a, 0x82, \
+  0x63, 0xa8, 0x37, 0xd5, 0xf6, 0x6c, 0xe5, 0x5b, 0x0b, 0x5e, 0x78, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xb7, 0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, 0x0a, 0xc8, 0xa4, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t25 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t25 (const unsigned char []){ \
+  0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x7a, 0x39, 0x5e, 0x47, 0x44, 0xc1, 0xce, \
+  0x91, 0xed, 0x58, 0x09, 0x8f, 0xd7, 0xcf, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe0, 0x74, 0xfa, 0x3f, 0x82, \
+  0x88, 0x75, 0x31, 0x3d, 0x72, 0xba, 0xa6, 0x12, 0x5a, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xe0, 0x74, \
+  0xfa, 0x3f, 0x82, 0x88, 0x75, 0x31, 0x3d, 0x72, 0xba, 0xa6, 0x12, 0x5a, 0x2c, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x70, 0x09, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0xd5, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x0a, 0x82, 0x63, 0xa8, 0x37, 0xd5, 0xf6, 0x6c, 0xe5, 0x5b, \
+  0x0b, 0x5e, 0x78, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x35, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xb7, 0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, 0x0a, 0xc8, \
+  0xa4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xb7, 0x35, \
+  0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, 0x0a, 0xc8, 0xa4, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x35, 0x5f, 0x31, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x0a, 0x82, 0x63, 0xa8, 0x37, 0xd5, 0xf6, 0x6c, 0xe5, 0x5b, 0x0b, 0x5e, 0x78, 0xf1, \
+  0x7a, 0x39, 0x5e, 0x47, 0x44, 0xc1, 0xce, 0x91, 0xed, 0x58, 0x09, 0x8f, 0xd7, 0xcf, 0xf2, 0xb7, \
+  0x35, 0x55, 0x36, 0xe9, 0xb6, 0x91, 0xc5, 0x6f, 0x21, 0x70, 0x0a, 0xc8, 0xa4, 0xf1, 0xe0, 0x74, \
+  0xfa, 0x3f, 0x82, 0x88, 0x75, 0x31, 0x3d, 0x72, 0xba, 0xa6, 0x12, 0x5a\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t25 428u
+const dds_topic_descriptor_t TypeBuilderTypes_t25_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t25),
+  .m_align = dds_alignof (TypeBuilderTypes_t25),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t25",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = TypeBuilderTypes_t25_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t25, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t25 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t25, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t25 }
+};
+
+static const uint32_t TypeBuilderTypes_t26_ops [] =
+{
+  /* t26 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t26, f1), (3u << 16u) + 4u /* t26_1 */,
+  DDS_OP_RTS,
+
+  /* t26_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_DEF, offsetof (TypeBuilderTypes_t26_1, _d), 2u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t26_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t26_1, _u.u2), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b7780637719be9f030ab28176756] (#deps: 1)
+   - [MINIMAL bd0828ef47628de5bd100cf98d87]
+  [COMPLETE 8729d2a7a08c109576356df2531c] (#deps: 1)
+   - [COMPLETE a55db9226ef5d5923408415b4f7e]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t26 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb7, 0x78, 0x06, 0x37, 0x71, 0x9b, 0xe9, 0xf0, 0x30, 0xab, 0x28, \
+  0x17, 0x67, 0x56, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0x08, 0x28, 0xef, 0x47, 0x62, 0x8d, \
+  0xe5, 0xbd, 0x10, 0x0c, 0xf9, 0x8d, 0x87, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x29, 0xd2, \
+  0xa7, 0xa0, 0x8c, 0x10, 0x95, 0x76, 0x35, 0x6d, 0xf2, 0x53, 0x1c, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa5, 0x5d, 0xb9, 0x22, 0x6e, 0xf5, 0xd5, 0x92, 0x34, 0x08, 0x41, 0x5b, 0x4f, 0x7e, 0x00, \
+  0x79, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t26 148u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t26 (const unsigned char []){ \
+  0xa0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xb7, 0x78, 0x06, 0x37, 0x71, 0x9b, 0xe9, \
+  0xf0, 0x30, 0xab, 0x28, 0x17, 0x67, 0x56, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xbd, 0x08, 0x28, 0xef, 0x47, \
+  0x62, 0x8d, 0xe5, 0xbd, 0x10, 0x0c, 0xf9, 0x8d, 0x87, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xbd, 0x08, \
+  0x28, 0xef, 0x47, 0x62, 0x8d, 0xe5, 0xbd, 0x10, 0x0c, 0xf9, 0x8d, 0x87, 0x44, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, \
+  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x27, 0x0c, 0x1b, 0x08, 0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x29, 0xd2, \
+  0xa7, 0xa0, 0x8c, 0x10, 0x95, 0x76, 0x35, 0x6d, 0xf2, 0x53, 0x1c, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x74, 0x32, 0x36, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa5, 0x5d, 0xb9, 0x22, 0x6e, \
+  0xf5, 0xd5, 0x92, 0x34, 0x08, 0x41, 0x5b, 0x4f, 0x7e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x5d, 0xb9, 0x22, 0x6e, 0xf5, 0xd5, 0x92, 0x34, 0x08, \
+  0x41, 0x5b, 0x4f, 0x7e, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x36, 0x5f, 0x31, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x29, 0xd2, 0xa7, 0xa0, 0x8c, 0x10, \
+  0x95, 0x76, 0x35, 0x6d, 0xf2, 0x53, 0x1c, 0xf1, 0xb7, 0x78, 0x06, 0x37, 0x71, 0x9b, 0xe9, 0xf0, \
+  0x30, 0xab, 0x28, 0x17, 0x67, 0x56, 0xf2, 0xa5, 0x5d, 0xb9, 0x22, 0x6e, 0xf5, 0xd5, 0x92, 0x34, \
+  0x08, 0x41, 0x5b, 0x4f, 0x7e, 0xf1, 0xbd, 0x08, 0x28, 0xef, 0x47, 0x62, 0x8d, 0xe5, 0xbd, 0x10, \
+  0x0c, 0xf9, 0x8d, 0x87\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t26 484u
+const dds_topic_descriptor_t TypeBuilderTypes_t26_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t26),
+  .m_align = dds_alignof (TypeBuilderTypes_t26),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t26",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = TypeBuilderTypes_t26_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t26, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t26 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t26, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t26 }
+};
+
+static const uint32_t TypeBuilderTypes_t27_ops [] =
+{
+  /* t27 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (TypeBuilderTypes_t27, f1), (3u << 16u) + 4u /* t27_1 */,
+  DDS_OP_RTS,
+
+  /* t27_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT) | DDS_OP_FLAG_DEF, offsetof (TypeBuilderTypes_t27_1, _d), 3u, (17u << 16u) + 5u, 5u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, TypeBuilderTypes_E27_1, offsetof (TypeBuilderTypes_t27_1, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, TypeBuilderTypes_E27_3, offsetof (TypeBuilderTypes_t27_1, _u.u3), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (TypeBuilderTypes_t27_1, _u.ud), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4aa343cd6395a0e072e9c5a35869] (#deps: 2)
+   - [MINIMAL 5544750c159e36564a59840ccda4]
+   - [MINIMAL 6c5b35081f0ec04bb840deba87e5]
+  [COMPLETE f54a529a3dfb71e8e32753940644] (#deps: 2)
+   - [COMPLETE 7e67ffb2184a1a9e3dea668ffd23]
+   - [COMPLETE 51e39f48fa947a705a88b0bbc523]
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t27 (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4a, 0xa3, 0x43, 0xcd, 0x63, 0x95, 0xa0, 0xe0, 0x72, 0xe9, 0xc5, \
+  0xa3, 0x58, 0x69, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x55, 0x44, 0x75, 0x0c, 0x15, 0x9e, 0x36, \
+  0x56, 0x4a, 0x59, 0x84, 0x0c, 0xcd, 0xa4, 0x00, 0x70, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6c, 0x5b, 0x35, 0x08, 0x1f, 0x0e, 0xc0, 0x4b, 0xb8, 0x40, 0xde, 0xba, 0x87, 0xe5, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x4a, 0x52, 0x9a, 0x3d, 0xfb, 0x71, 0xe8, 0xe3, 0x27, 0x53, \
+  0x94, 0x06, 0x44, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0x67, 0xff, 0xb2, 0x18, 0x4a, 0x1a, \
+  0x9e, 0x3d, 0xea, 0x66, 0x8f, 0xfd, 0x23, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0xe3, 0x9f, 0x48, 0xfa, 0x94, 0x7a, 0x70, 0x5a, 0x88, 0xb0, 0xbb, 0xc5, 0x23, 0x00, \
+  0x88, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t27 196u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t27 (const unsigned char []){ \
+  0x2a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x4a, 0xa3, 0x43, 0xcd, 0x63, 0x95, 0xa0, \
+  0xe0, 0x72, 0xe9, 0xc5, 0xa3, 0x58, 0x69, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x55, 0x44, 0x75, 0x0c, 0x15, \
+  0x9e, 0x36, 0x56, 0x4a, 0x59, 0x84, 0x0c, 0xcd, 0xa4, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x55, 0x44, \
+  0x75, 0x0c, 0x15, 0x9e, 0x36, 0x56, 0x4a, 0x59, 0x84, 0x0c, 0xcd, 0xa4, 0x6c, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0xf1, 0x6c, \
+  0x5b, 0x35, 0x08, 0x1f, 0x0e, 0xc0, 0x4b, 0xb8, 0x40, 0xde, 0xba, 0x87, 0xe5, 0x00, 0x00, 0x00, \
+  0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x7b, 0x8e, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xfe, 0x3d, 0x7a, 0xf1, 0x6c, 0x5b, 0x35, \
+  0x08, 0x1f, 0x0e, 0xc0, 0x4b, 0xb8, 0x40, 0xde, 0xba, 0x87, 0xe5, 0x00, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x8a, 0xf2, 0x3e, 0x9a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0xbe, 0xcc, 0x24, 0xbc, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x0c, 0xa6, 0x45, 0x00, 0x00, \
+  0xb8, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x4a, 0x52, 0x9a, 0x3d, 0xfb, 0x71, \
+  0xe8, 0xe3, 0x27, 0x53, 0x94, 0x06, 0x44, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x37, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x7e, 0x67, 0xff, 0xb2, 0x18, 0x4a, 0x1a, 0x9e, 0x3d, \
+  0xea, 0x66, 0x8f, 0xfd, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x7e, 0x67, 0xff, 0xb2, 0x18, 0x4a, 0x1a, 0x9e, 0x3d, 0xea, 0x66, 0x8f, 0xfd, 0x23, \
+  0xa1, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x37, 0x5f, 0x31, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0xf2, 0x51, 0xe3, 0x9f, 0x48, 0xfa, 0x94, 0x7a, 0x70, 0x5a, 0x88, 0xb0, 0xbb, 0xc5, \
+  0x23, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x51, 0xe3, 0x9f, 0x48, 0xfa, 0x94, 0x7a, 0x70, 0x5a, 0x88, \
+  0xb0, 0xbb, 0xc5, 0x23, 0x84, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x42, 0x75, 0x69, 0x6c, \
+  0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x32, 0x37, 0x00, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x37, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x37, 0x5f, 0x33, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x37, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x4a, 0x52, 0x9a, 0x3d, 0xfb, 0x71, 0xe8, 0xe3, 0x27, 0x53, \
+  0x94, 0x06, 0x44, 0xf1, 0x4a, 0xa3, 0x43, 0xcd, 0x63, 0x95, 0xa0, 0xe0, 0x72, 0xe9, 0xc5, 0xa3, \
+  0x58, 0x69, 0xf2, 0x7e, 0x67, 0xff, 0xb2, 0x18, 0x4a, 0x1a, 0x9e, 0x3d, 0xea, 0x66, 0x8f, 0xfd, \
+  0x23, 0xf1, 0x55, 0x44, 0x75, 0x0c, 0x15, 0x9e, 0x36, 0x56, 0x4a, 0x59, 0x84, 0x0c, 0xcd, 0xa4, \
+  0xf2, 0x51, 0xe3, 0x9f, 0x48, 0xfa, 0x94, 0x7a, 0x70, 0x5a, 0x88, 0xb0, 0xbb, 0xc5, 0x23, 0xf1, \
+  0x6c, 0x5b, 0x35, 0x08, 0x1f, 0x0e, 0xc0, 0x4b, 0xb8, 0x40, 0xde, 0xba, 0x87, 0xe5\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t27 846u
+const dds_topic_descriptor_t TypeBuilderTypes_t27_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t27),
+  .m_align = dds_alignof (TypeBuilderTypes_t27),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "TypeBuilderTypes::t27",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = TypeBuilderTypes_t27_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t27, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t27 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t27, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t27 }
+};
+
+static const uint32_t TypeBuilderTypes_t28_ops [] =
+{
+  /* t28 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (TypeBuilderTypes_t28, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (TypeBuilderTypes_t28, f2), 4u,
+  DDS_OP_RTS,
+  
+  /* key: f1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: f2 */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t TypeBuilderTypes_t28_keys[2] =
+{
+  { "f1", 6, 0 },
+  { "f2", 8, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 6a15c114a94e0cd45518b12b1367] (#deps: 0)
+  [COMPLETE fa7d3e147c869477aead4e7013d7] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypeBuilderTypes_t28 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x15, 0xc1, 0x14, 0xa9, 0x4e, 0x0c, 0xd4, 0x55, 0x18, 0xb1, \
+  0x2b, 0x13, 0x67, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0x7d, 0x3e, 0x14, 0x7c, 0x86, 0x94, 0x77, 0xae, 0xad, 0x4e, \
+  0x70, 0x13, 0xd7, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypeBuilderTypes_t28 100u
+#define TYPE_MAP_CDR_TypeBuilderTypes_t28 (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x15, 0xc1, 0x14, 0xa9, 0x4e, 0x0c, \
+  0xd4, 0x55, 0x18, 0xb1, 0x2b, 0x13, 0x67, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0xbd, 0x19, 0x83, 0x6d, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, 0x36, 0x67, 0xf6, 0xa0, \
+  0x75, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0x7d, 0x3e, 0x14, 0x7c, 0x86, 0x94, \
+  0x77, 0xae, 0xad, 0x4e, 0x70, 0x13, 0xd7, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x74, 0x32, \
+  0x38, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x03, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0x7d, 0x3e, 0x14, 0x7c, 0x86, 0x94, 0x77, 0xae, 0xad, 0x4e, \
+  0x70, 0x13, 0xd7, 0xf1, 0x6a, 0x15, 0xc1, 0x14, 0xa9, 0x4e, 0x0c, 0xd4, 0x55, 0x18, 0xb1, 0x2b, \
+  0x13, 0x67\
+}
+#define TYPE_MAP_CDR_SZ_TypeBuilderTypes_t28 242u
+const dds_topic_descriptor_t TypeBuilderTypes_t28_desc =
+{
+  .m_size = sizeof (TypeBuilderTypes_t28),
+  .m_align = dds_alignof (TypeBuilderTypes_t28),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "TypeBuilderTypes::t28",
+  .m_keys = TypeBuilderTypes_t28_keys,
+  .m_nops = 3,
+  .m_ops = TypeBuilderTypes_t28_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypeBuilderTypes_t28, .sz = TYPE_INFO_CDR_SZ_TypeBuilderTypes_t28 },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypeBuilderTypes_t28, .sz = TYPE_MAP_CDR_SZ_TypeBuilderTypes_t28 }
+};
+
@@ -0,0 +1,1322 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/XSpace.c
+  Source: /root/repo/src/core/ddsc/tests/XSpace.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpace.h"
+
+static const uint32_t XSpace_XType1_ops [] =
+{
+  /* XType1 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 1u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType1, long_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType1, long_2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpace_XType1, bm_3), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 44c4bdb7d0efd080dfff93368c3b] (#deps: 1)
+   - [MINIMAL 2fab5126ef5700ea20cfd623b7cc]
+  [COMPLETE c8853407d3780d7643a5496933aa] (#deps: 1)
+   - [COMPLETE 0596829f0d844e7ab90c9c96abe3]
+*/
+#define TYPE_INFO_CDR_XSpace_XType1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x44, 0xc4, 0xbd, 0xb7, 0xd0, 0xef, 0xd0, 0x80, 0xdf, 0xff, 0x93, \
+  0x36, 0x8c, 0x3b, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xab, 0x51, 0x26, 0xef, 0x57, 0x00, \
+  0xea, 0x20, 0xcf, 0xd6, 0x23, 0xb7, 0xcc, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0x85, 0x34, \
+  0x07, 0xd3, 0x78, 0x0d, 0x76, 0x43, 0xa5, 0x49, 0x69, 0x33, 0xaa, 0x00, 0x8b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x05, 0x96, 0x82, 0x9f, 0x0d, 0x84, 0x4e, 0x7a, 0xb9, 0x0c, 0x9c, 0x96, 0xab, 0xe3, 0x00, \
+  0x60, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType1 148u
+#define TYPE_MAP_CDR_XSpace_XType1 (const unsigned char []){ \
+  0xb0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x44, 0xc4, 0xbd, 0xb7, 0xd0, 0xef, 0xd0, \
+  0x80, 0xdf, 0xff, 0x93, 0x36, 0x8c, 0x3b, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x2f, 0xab, 0x51, 0x26, 0xef, \
+  0x57, 0x00, 0xea, 0x20, 0xcf, 0xd6, 0x23, 0xb7, 0xcc, 0x15, 0x97, 0x46, 0xd2, 0xf1, 0x2f, 0xab, \
+  0x51, 0x26, 0xef, 0x57, 0x00, 0xea, 0x20, 0xcf, 0xd6, 0x23, 0xb7, 0xcc, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xa4, 0xfd, 0xb8, 0xce, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xab, 0x0b, 0xfd, 0x73, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0x85, 0x34, \
+  0x07, 0xd3, 0x78, 0x0d, 0x76, 0x43, 0xa5, 0x49, 0x69, 0x33, 0xaa, 0x00, 0x87, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x31, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x05, 0x96, 0x82, 0x9f, 0x0d, \
+  0x84, 0x4e, 0x7a, 0xb9, 0x0c, 0x9c, 0x96, 0xab, 0xe3, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x62, 0x6d, 0x5f, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x96, 0x82, 0x9f, 0x0d, 0x84, 0x4e, 0x7a, \
+  0xb9, 0x0c, 0x9c, 0x96, 0xab, 0xe3, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, \
+  0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x6d, 0x79, 0x5f, 0x62, \
+  0x69, 0x74, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x61, 0x67, \
+  0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x66, 0x6c, 0x61, 0x67, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xc8, 0x85, 0x34, 0x07, 0xd3, 0x78, 0x0d, 0x76, 0x43, 0xa5, 0x49, 0x69, 0x33, 0xaa, 0xf1, \
+  0x44, 0xc4, 0xbd, 0xb7, 0xd0, 0xef, 0xd0, 0x80, 0xdf, 0xff, 0x93, 0x36, 0x8c, 0x3b, 0xf2, 0x05, \
+  0x96, 0x82, 0x9f, 0x0d, 0x84, 0x4e, 0x7a, 0xb9, 0x0c, 0x9c, 0x96, 0xab, 0xe3, 0xf1, 0x2f, 0xab, \
+  0x51, 0x26, 0xef, 0x57, 0x00, 0xea, 0x20, 0xcf, 0xd6, 0x23, 0xb7, 0xcc\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType1 524u
+const dds_topic_descriptor_t XSpace_XType1_desc =
+{
+  .m_size = sizeof (XSpace_XType1),
+  .m_align = dds_alignof (XSpace_XType1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType1",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = XSpace_XType1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType1, .sz = TYPE_INFO_CDR_SZ_XSpace_XType1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType1, .sz = TYPE_MAP_CDR_SZ_XSpace_XType1 }
+};
+
+static const uint32_t XSpace_XType1a_ops [] =
+{
+  /* XType1a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 1u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType1a, long_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType1a, long_2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (XSpace_XType1a, bm_3),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 9c1ed0cd7fe46cd588b7994ef1c0] (#deps: 0)
+  [COMPLETE d66dad43cd1c6655949c771a7ee4] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType1a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x1e, 0xd0, 0xcd, 0x7f, 0xe4, 0x6c, 0xd5, 0x88, 0xb7, 0x99, \
+  0x4e, 0xf1, 0xc0, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0x6d, 0xad, 0x43, 0xcd, 0x1c, 0x66, 0x55, 0x94, 0x9c, 0x77, \
+  0x1a, 0x7e, 0xe4, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType1a 100u
+#define TYPE_MAP_CDR_XSpace_XType1a (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x9c, 0x1e, 0xd0, 0xcd, 0x7f, 0xe4, 0x6c, \
+  0xd5, 0x88, 0xb7, 0x99, 0x4e, 0xf1, 0xc0, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x15, 0x97, 0x46, 0xd2, 0x00, \
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0x6d, 0xad, 0x43, 0xcd, 0x1c, 0x66, \
+  0x55, 0x94, 0x9c, 0x77, 0x1a, 0x7e, 0xe4, 0x00, 0x77, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x31, 0x61, 0x00, 0x53, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x62, 0x6d, 0x5f, 0x33, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0x6d, 0xad, \
+  0x43, 0xcd, 0x1c, 0x66, 0x55, 0x94, 0x9c, 0x77, 0x1a, 0x7e, 0xe4, 0xf1, 0x9c, 0x1e, 0xd0, 0xcd, \
+  0x7f, 0xe4, 0x6c, 0xd5, 0x88, 0xb7, 0x99, 0x4e, 0xf1, 0xc0\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType1a 282u
+const dds_topic_descriptor_t XSpace_XType1a_desc =
+{
+  .m_size = sizeof (XSpace_XType1a),
+  .m_align = dds_alignof (XSpace_XType1a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType1a",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = XSpace_XType1a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType1a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType1a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType1a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType1a }
+};
+
+static const uint32_t XSpace_XType2_ops [] =
+{
+  /* XType2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType2, long_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType2, long_2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c4ba71d9ff61cc30883733e72d20] (#deps: 0)
+  [COMPLETE 3d3dc7657e23247b41e3672d6670] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0xba, 0x71, 0xd9, 0xff, 0x61, 0xcc, 0x30, 0x88, 0x37, 0x33, \
+  0xe7, 0x2d, 0x20, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x3d, 0xc7, 0x65, 0x7e, 0x23, 0x24, 0x7b, 0x41, 0xe3, 0x67, \
+  0x2d, 0x66, 0x70, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType2 100u
+#define TYPE_MAP_CDR_XSpace_XType2 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0xba, 0x71, 0xd9, 0xff, 0x61, 0xcc, \
+  0x30, 0x88, 0x37, 0x33, 0xe7, 0x2d, 0x20, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x75, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x3d, 0xc7, 0x65, 0x7e, 0x23, 0x24, \
+  0x7b, 0x41, 0xe3, 0x67, 0x2d, 0x66, 0x70, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x32, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x3d, 0xc7, 0x65, 0x7e, 0x23, 0x24, 0x7b, 0x41, 0xe3, 0x67, \
+  0x2d, 0x66, 0x70, 0xf1, 0xc4, 0xba, 0x71, 0xd9, 0xff, 0x61, 0xcc, 0x30, 0x88, 0x37, 0x33, 0xe7, \
+  0x2d, 0x20\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType2 242u
+const dds_topic_descriptor_t XSpace_XType2_desc =
+{
+  .m_size = sizeof (XSpace_XType2),
+  .m_align = dds_alignof (XSpace_XType2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType2",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpace_XType2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType2, .sz = TYPE_INFO_CDR_SZ_XSpace_XType2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType2, .sz = TYPE_MAP_CDR_SZ_XSpace_XType2 }
+};
+
+static const uint32_t XSpace_XType2a_ops [] =
+{
+  /* XType2a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType2a, long_1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType2a, long_2),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType2a, long_3),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4698d2129d4bca583b5cc976bb0e] (#deps: 0)
+  [COMPLETE ee341cfc57dff4f0b2065eec1b0e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType2a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x98, 0xd2, 0x12, 0x9d, 0x4b, 0xca, 0x58, 0x3b, 0x5c, 0xc9, \
+  0x76, 0xbb, 0x0e, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xee, 0x34, 0x1c, 0xfc, 0x57, 0xdf, 0xf4, 0xf0, 0xb2, 0x06, 0x5e, \
+  0xec, 0x1b, 0x0e, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType2a 100u
+#define TYPE_MAP_CDR_XSpace_XType2a (const unsigned char []){ \
+  0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x98, 0xd2, 0x12, 0x9d, 0x4b, 0xca, \
+  0x58, 0x3b, 0x5c, 0xc9, 0x76, 0xbb, 0x0e, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xaf, 0xeb, 0x04, 0xb7, 0x00, \
+  0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xee, 0x34, 0x1c, 0xfc, 0x57, 0xdf, 0xf4, \
+  0xf0, 0xb2, 0x06, 0x5e, 0xec, 0x1b, 0x0e, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x32, 0x61, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xee, 0x34, 0x1c, 0xfc, 0x57, 0xdf, 0xf4, 0xf0, 0xb2, 0x06, 0x5e, 0xec, 0x1b, 0x0e, 0xf1, \
+  0x46, 0x98, 0xd2, 0x12, 0x9d, 0x4b, 0xca, 0x58, 0x3b, 0x5c, 0xc9, 0x76, 0xbb, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType2a 286u
+const dds_topic_descriptor_t XSpace_XType2a_desc =
+{
+  .m_size = sizeof (XSpace_XType2a),
+  .m_align = dds_alignof (XSpace_XType2a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType2a",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = XSpace_XType2a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType2a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType2a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType2a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType2a }
+};
+
+static const uint32_t XSpace_XType3_1_ops [] =
+{
+  /* XType3_1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1, long_4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1, long_5),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4c7132e3bccbf91606152f1e947d] (#deps: 0)
+  [COMPLETE 724be904a1d88f01edb0bfbad973] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType3_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4c, 0x71, 0x32, 0xe3, 0xbc, 0xcb, 0xf9, 0x16, 0x06, 0x15, 0x2f, \
+  0x1e, 0x94, 0x7d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x72, 0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, 0x01, 0xed, 0xb0, 0xbf, \
+  0xba, 0xd9, 0x73, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType3_1 100u
+#define TYPE_MAP_CDR_XSpace_XType3_1 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x4c, 0x71, 0x32, 0xe3, 0xbc, 0xcb, 0xf9, \
+  0x16, 0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x5c, 0xf2, 0x44, 0xf2, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x96, 0xbf, 0x4a, 0xf8, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x72, 0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, \
+  0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x33, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x72, 0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, \
+  0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0xf1, 0x4c, 0x71, 0x32, 0xe3, 0xbc, 0xcb, 0xf9, 0x16, \
+  0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType3_1 246u
+const dds_topic_descriptor_t XSpace_XType3_1_desc =
+{
+  .m_size = sizeof (XSpace_XType3_1),
+  .m_align = dds_alignof (XSpace_XType3_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType3_1",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpace_XType3_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType3_1, .sz = TYPE_INFO_CDR_SZ_XSpace_XType3_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType3_1, .sz = TYPE_MAP_CDR_SZ_XSpace_XType3_1 }
+};
+
+static const uint32_t XSpace_XType3_1a_ops [] =
+{
+  /* XType3_1a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1a, long_4),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2ff3fd72aa97f3fa3e0f49c47ff0] (#deps: 0)
+  [COMPLETE a72ad58167e6e1b9d10644941ed9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType3_1a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xf3, 0xfd, 0x72, 0xaa, 0x97, 0xf3, 0xfa, 0x3e, 0x0f, 0x49, \
+  0xc4, 0x7f, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa7, 0x2a, 0xd5, 0x81, 0x67, 0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, \
+  0x94, 0x1e, 0xd9, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType3_1a 100u
+#define TYPE_MAP_CDR_XSpace_XType3_1a (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xf3, 0xfd, 0x72, 0xaa, 0x97, 0xf3, \
+  0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x5c, 0xf2, 0x44, 0xf2, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa7, 0x2a, 0xd5, 0x81, 0x67, 0xe6, 0xe1, \
+  0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x33, 0x5f, 0x31, 0x61, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa7, 0x2a, 0xd5, \
+  0x81, 0x67, 0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0xf1, 0x2f, 0xf3, 0xfd, 0x72, \
+  0xaa, 0x97, 0xf3, 0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType3_1a 202u
+const dds_topic_descriptor_t XSpace_XType3_1a_desc =
+{
+  .m_size = sizeof (XSpace_XType3_1a),
+  .m_align = dds_alignof (XSpace_XType3_1a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType3_1a",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = XSpace_XType3_1a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType3_1a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType3_1a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType3_1a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType3_1a }
+};
+
+static const uint32_t XSpace_XType3_ops [] =
+{
+  /* XType3 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 2u,
+  DDS_OP_PLM | 6, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3, long_2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpace_XType3, struct_3), (3u << 16u) + 4u /* XType3_1 */,
+  DDS_OP_RTS,
+
+  /* XType3_1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1, long_4),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1, long_5),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2ff0582007279af636a46d6b5bdc] (#deps: 1)
+   - [MINIMAL 4c7132e3bccbf91606152f1e947d]
+  [COMPLETE 9223e07615ea4ad319eecafd1a8e] (#deps: 1)
+   - [COMPLETE 724be904a1d88f01edb0bfbad973]
+*/
+#define TYPE_INFO_CDR_XSpace_XType3 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xf0, 0x58, 0x20, 0x07, 0x27, 0x9a, 0xf6, 0x36, 0xa4, 0x6d, \
+  0x6b, 0x5b, 0xdc, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4c, 0x71, 0x32, 0xe3, 0xbc, 0xcb, 0xf9, \
+  0x16, 0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x92, 0x23, 0xe0, \
+  0x76, 0x15, 0xea, 0x4a, 0xd3, 0x19, 0xee, 0xca, 0xfd, 0x1a, 0x8e, 0x00, 0x73, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x72, 0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, 0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0x00, \
+  0x65, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType3 148u
+#define TYPE_MAP_CDR_XSpace_XType3 (const unsigned char []){ \
+  0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xf0, 0x58, 0x20, 0x07, 0x27, 0x9a, \
+  0xf6, 0x36, 0xa4, 0x6d, 0x6b, 0x5b, 0xdc, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x4c, 0x71, 0x32, 0xe3, 0xbc, \
+  0xcb, 0xf9, 0x16, 0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d, 0x12, 0x3b, 0xd5, 0xf0, 0xf1, 0x4c, 0x71, \
+  0x32, 0xe3, 0xbc, 0xcb, 0xf9, 0x16, 0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x5c, \
+  0xf2, 0x44, 0xf2, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x96, \
+  0xbf, 0x4a, 0xf8, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x92, 0x23, 0xe0, \
+  0x76, 0x15, 0xea, 0x4a, 0xd3, 0x19, 0xee, 0xca, 0xfd, 0x1a, 0x8e, 0x00, 0x6f, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x33, 0x00, 0x00, \
+  0x4b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x72, \
+  0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, 0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x33, 0x00, 0x00, 0x00, 0xf2, \
+  0x72, 0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, 0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, \
+  0x65, 0x33, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x92, 0x23, 0xe0, 0x76, 0x15, 0xea, 0x4a, 0xd3, 0x19, 0xee, 0xca, 0xfd, 0x1a, 0x8e, 0xf1, \
+  0x2f, 0xf0, 0x58, 0x20, 0x07, 0x27, 0x9a, 0xf6, 0x36, 0xa4, 0x6d, 0x6b, 0x5b, 0xdc, 0xf2, 0x72, \
+  0x4b, 0xe9, 0x04, 0xa1, 0xd8, 0x8f, 0x01, 0xed, 0xb0, 0xbf, 0xba, 0xd9, 0x73, 0xf1, 0x4c, 0x71, \
+  0x32, 0xe3, 0xbc, 0xcb, 0xf9, 0x16, 0x06, 0x15, 0x2f, 0x1e, 0x94, 0x7d\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType3 492u
+const dds_topic_descriptor_t XSpace_XType3_desc =
+{
+  .m_size = sizeof (XSpace_XType3),
+  .m_align = dds_alignof (XSpace_XType3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType3",
+  .m_keys = NULL,
+  .m_nops = 10,
+  .m_ops = XSpace_XType3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType3, .sz = TYPE_INFO_CDR_SZ_XSpace_XType3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType3, .sz = TYPE_MAP_CDR_SZ_XSpace_XType3 }
+};
+
+static const uint32_t XSpace_XType3a_ops [] =
+{
+  /* XType3a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 7, 1u,
+  DDS_OP_PLM | 8, 2u,
+  DDS_OP_PLM | 9, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3a, long_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3a, long_2),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpace_XType3a, struct_3), (3u << 16u) + 4u /* XType3_1a */,
+  DDS_OP_RTS,
+
+  /* XType3_1a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_XType3_1a, long_4),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 173fc41be4ce1f88dbaa89ed0b0b] (#deps: 1)
+   - [MINIMAL 2ff3fd72aa97f3fa3e0f49c47ff0]
+  [COMPLETE 85cfdbb5aef3d60b7c1bb2337b6e] (#deps: 1)
+   - [COMPLETE a72ad58167e6e1b9d10644941ed9]
+*/
+#define TYPE_INFO_CDR_XSpace_XType3a (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x17, 0x3f, 0xc4, 0x1b, 0xe4, 0xce, 0x1f, 0x88, 0xdb, 0xaa, 0x89, \
+  0xed, 0x0b, 0x0b, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x2f, 0xf3, 0xfd, 0x72, 0xaa, 0x97, 0xf3, \
+  0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x85, 0xcf, 0xdb, \
+  0xb5, 0xae, 0xf3, 0xd6, 0x0b, 0x7c, 0x1b, 0xb2, 0x33, 0x7b, 0x6e, 0x00, 0x8f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa7, 0x2a, 0xd5, 0x81, 0x67, 0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType3a 148u
+#define TYPE_MAP_CDR_XSpace_XType3a (const unsigned char []){ \
+  0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x17, 0x3f, 0xc4, 0x1b, 0xe4, 0xce, 0x1f, \
+  0x88, 0xdb, 0xaa, 0x89, 0xed, 0x0b, 0x0b, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xb7, 0xb3, 0x54, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x65, 0x67, 0x72, 0x84, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x2f, 0xf3, 0xfd, 0x72, 0xaa, \
+  0x97, 0xf3, 0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0, 0x12, 0x3b, 0xd5, 0xf0, 0xf1, 0x2f, 0xf3, \
+  0xfd, 0x72, 0xaa, 0x97, 0xf3, 0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x5c, \
+  0xf2, 0x44, 0xf2, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x85, 0xcf, 0xdb, \
+  0xb5, 0xae, 0xf3, 0xd6, 0x0b, 0x7c, 0x1b, 0xb2, 0x33, 0x7b, 0x6e, 0x00, 0x8b, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x33, 0x61, 0x00, \
+  0x67, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa7, 0x2a, 0xd5, 0x81, 0x67, \
+  0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x33, 0x00, 0x00, 0x00, 0xf2, 0xa7, 0x2a, 0xd5, 0x81, \
+  0x67, 0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x33, 0x5f, 0x31, \
+  0x61, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, \
+  0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x85, 0xcf, 0xdb, 0xb5, 0xae, 0xf3, 0xd6, 0x0b, 0x7c, 0x1b, 0xb2, 0x33, 0x7b, 0x6e, 0xf1, \
+  0x17, 0x3f, 0xc4, 0x1b, 0xe4, 0xce, 0x1f, 0x88, 0xdb, 0xaa, 0x89, 0xed, 0x0b, 0x0b, 0xf2, 0xa7, \
+  0x2a, 0xd5, 0x81, 0x67, 0xe6, 0xe1, 0xb9, 0xd1, 0x06, 0x44, 0x94, 0x1e, 0xd9, 0xf1, 0x2f, 0xf3, \
+  0xfd, 0x72, 0xaa, 0x97, 0xf3, 0xfa, 0x3e, 0x0f, 0x49, 0xc4, 0x7f, 0xf0\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType3a 492u
+const dds_topic_descriptor_t XSpace_XType3a_desc =
+{
+  .m_size = sizeof (XSpace_XType3a),
+  .m_align = dds_alignof (XSpace_XType3a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType3a",
+  .m_keys = NULL,
+  .m_nops = 11,
+  .m_ops = XSpace_XType3a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType3a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType3a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType3a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType3a }
+};
+
+static const uint32_t XSpace_XType4_ops [] =
+{
+  /* XType4 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY, offsetof (XSpace_XType4, seq_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY, offsetof (XSpace_XType4, seq_2), 10u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c3e61b7ab18348af49bf843df1c7] (#deps: 0)
+  [COMPLETE 3d833e1f67df2fabb353428b5fb9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType4 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0xe6, 0x1b, 0x7a, 0xb1, 0x83, 0x48, 0xaf, 0x49, 0xbf, 0x84, \
+  0x3d, 0xf1, 0xc7, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x83, 0x3e, 0x1f, 0x67, 0xdf, 0x2f, 0xab, 0xb3, 0x53, 0x42, \
+  0x8b, 0x5f, 0xb9, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType4 100u
+#define TYPE_MAP_CDR_XSpace_XType4 (const unsigned char []){ \
+  0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc3, 0xe6, 0x1b, 0x7a, 0xb1, 0x83, 0x48, \
+  0xaf, 0x49, 0xbf, 0x84, 0x3d, 0xf1, 0xc7, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x07, \
+  0xd4, 0x69, 0x0a, 0xf0, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x0a, 0x07, 0x43, 0xfd, 0x18, 0x7c, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x3d, 0x83, 0x3e, 0x1f, 0x67, 0xdf, 0x2f, 0xab, 0xb3, 0x53, 0x42, 0x8b, 0x5f, 0xb9, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, \
+  0x65, 0x34, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x0a, 0x07, 0x06, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x83, 0x3e, \
+  0x1f, 0x67, 0xdf, 0x2f, 0xab, 0xb3, 0x53, 0x42, 0x8b, 0x5f, 0xb9, 0xf1, 0xc3, 0xe6, 0x1b, 0x7a, \
+  0xb1, 0x83, 0x48, 0xaf, 0x49, 0xbf, 0x84, 0x3d, 0xf1, 0xc7\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType4 250u
+const dds_topic_descriptor_t XSpace_XType4_desc =
+{
+  .m_size = sizeof (XSpace_XType4),
+  .m_align = dds_alignof (XSpace_XType4),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType4",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpace_XType4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType4, .sz = TYPE_INFO_CDR_SZ_XSpace_XType4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType4, .sz = TYPE_MAP_CDR_SZ_XSpace_XType4 }
+};
+
+static const uint32_t XSpace_XType4a_ops [] =
+{
+  /* XType4a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 7, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY, offsetof (XSpace_XType4a, seq_1), 999u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY, offsetof (XSpace_XType4a, seq_2), 5u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 21aa3c73efdc68a8411d379bf2e2] (#deps: 0)
+  [COMPLETE 253af2a4e3e1397ebb8dffe381b5] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType4a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x21, 0xaa, 0x3c, 0x73, 0xef, 0xdc, 0x68, 0xa8, 0x41, 0x1d, 0x37, \
+  0x9b, 0xf2, 0xe2, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x25, 0x3a, 0xf2, 0xa4, 0xe3, 0xe1, 0x39, 0x7e, 0xbb, 0x8d, 0xff, \
+  0xe3, 0x81, 0xb5, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType4a 100u
+#define TYPE_MAP_CDR_XSpace_XType4a (const unsigned char []){ \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x21, 0xaa, 0x3c, 0x73, 0xef, 0xdc, 0x68, \
+  0xa8, 0x41, 0x1d, 0x37, 0x9b, 0xf2, 0xe2, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0xe7, 0x03, 0x00, 0x00, 0x07, 0xd4, 0x69, 0x0a, 0xf0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x07, 0x43, 0xfd, 0x18, 0x7c, \
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x25, 0x3a, 0xf2, 0xa4, 0xe3, 0xe1, 0x39, \
+  0x7e, 0xbb, 0x8d, 0xff, 0xe3, 0x81, 0xb5, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x34, 0x61, 0x00, 0x44, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x07, 0x06, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x25, 0x3a, 0xf2, \
+  0xa4, 0xe3, 0xe1, 0x39, 0x7e, 0xbb, 0x8d, 0xff, 0xe3, 0x81, 0xb5, 0xf1, 0x21, 0xaa, 0x3c, 0x73, \
+  0xef, 0xdc, 0x68, 0xa8, 0x41, 0x1d, 0x37, 0x9b, 0xf2, 0xe2\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType4a 266u
+const dds_topic_descriptor_t XSpace_XType4a_desc =
+{
+  .m_size = sizeof (XSpace_XType4a),
+  .m_align = dds_alignof (XSpace_XType4a),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::XType4a",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpace_XType4a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType4a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType4a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType4a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType4a }
+};
+
+static const uint32_t XSpace_XType5_ops [] =
+{
+  /* XType5 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (XSpace_XType5, str_1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (XSpace_XType5, str_2), 11u,
+  DDS_OP_RTS,
+  
+  /* key: str_1 */
+  DDS_OP_KOF | 1, 6u /* order: 0 */,
+  
+  /* key: str_2 */
+  DDS_OP_KOF | 1, 9u /* order: 1 */
+};
+
+static const dds_key_descriptor_t XSpace_XType5_keys[2] =
+{
+  { "str_1", 13, 0 },
+  { "str_2", 15, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 53e63621d1c6678ea43b84bdaa37] (#deps: 0)
+  [COMPLETE ac4b34d992c14e2817569dd3e6f9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType5 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x53, 0xe6, 0x36, 0x21, 0xd1, 0xc6, 0x67, 0x8e, 0xa4, 0x3b, 0x84, \
+  0xbd, 0xaa, 0x37, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x4b, 0x34, 0xd9, 0x92, 0xc1, 0x4e, 0x28, 0x17, 0x56, 0x9d, \
+  0xd3, 0xe6, 0xf9, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType5 100u
+#define TYPE_MAP_CDR_XSpace_XType5 (const unsigned char []){ \
+  0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x53, 0xe6, 0x36, 0x21, 0xd1, 0xc6, 0x67, \
+  0x8e, 0xa4, 0x3b, 0x84, 0xbd, 0xaa, 0x37, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x87, 0x43, 0x47, 0xa6, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x0a, 0xfd, 0x3d, 0x06, 0x94, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x4b, 0x34, 0xd9, 0x92, 0xc1, 0x4e, \
+  0x28, 0x17, 0x56, 0x9d, 0xd3, 0xe6, 0xf9, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x35, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x4b, 0x34, \
+  0xd9, 0x92, 0xc1, 0x4e, 0x28, 0x17, 0x56, 0x9d, 0xd3, 0xe6, 0xf9, 0xf1, 0x53, 0xe6, 0x36, 0x21, \
+  0xd1, 0xc6, 0x67, 0x8e, 0xa4, 0x3b, 0x84, 0xbd, 0xaa, 0x37\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType5 234u
+const dds_topic_descriptor_t XSpace_XType5_desc =
+{
+  .m_size = sizeof (XSpace_XType5),
+  .m_align = dds_alignof (XSpace_XType5),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "XSpace::XType5",
+  .m_keys = XSpace_XType5_keys,
+  .m_nops = 6,
+  .m_ops = XSpace_XType5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType5, .sz = TYPE_INFO_CDR_SZ_XSpace_XType5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType5, .sz = TYPE_MAP_CDR_SZ_XSpace_XType5 }
+};
+
+static const uint32_t XSpace_XType5a_ops [] =
+{
+  /* XType5a */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 7, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (XSpace_XType5a, str_1), 1000u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (XSpace_XType5a, str_2), 6u,
+  DDS_OP_RTS,
+  
+  /* key: str_1 */
+  DDS_OP_KOF | 1, 6u /* order: 0 */,
+  
+  /* key: str_2 */
+  DDS_OP_KOF | 1, 10u /* order: 1 */
+};
+
+static const dds_key_descriptor_t XSpace_XType5a_keys[2] =
+{
+  { "str_1", 14, 0 },
+  { "str_2", 16, 1 }
+};
+
+/* Type Information:
+  [MINIMAL a9464d961000ff7c7693f72b95d8] (#deps: 0)
+  [COMPLETE c34aed9227d1bff428dd7388f26e] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_XType5a (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa9, 0x46, 0x4d, 0x96, 0x10, 0x00, 0xff, 0x7c, 0x76, 0x93, 0xf7, \
+  0x2b, 0x95, 0xd8, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc3, 0x4a, 0xed, 0x92, 0x27, 0xd1, 0xbf, 0xf4, 0x28, 0xdd, 0x73, \
+  0x88, 0xf2, 0x6e, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_XType5a 100u
+#define TYPE_MAP_CDR_XSpace_XType5a (const unsigned char []){ \
+  0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa9, 0x46, 0x4d, 0x96, 0x10, 0x00, 0xff, \
+  0x7c, 0x76, 0x93, 0xf7, 0x2b, 0x95, 0xd8, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x71, 0x00, 0xe7, 0x03, 0x00, 0x00, \
+  0x87, 0x43, 0x47, 0xa6, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x05, \
+  0xfd, 0x3d, 0x06, 0x94, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc3, 0x4a, 0xed, \
+  0x92, 0x27, 0xd1, 0xbf, 0xf4, 0x28, 0xdd, 0x73, 0x88, 0xf2, 0x6e, 0x00, 0x5c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x58, 0x54, 0x79, 0x70, 0x65, 0x35, 0x61, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x71, 0x00, 0xe7, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x5f, \
+  0x31, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x05, \
+  0x06, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xc3, 0x4a, 0xed, 0x92, 0x27, 0xd1, 0xbf, 0xf4, 0x28, 0xdd, 0x73, \
+  0x88, 0xf2, 0x6e, 0xf1, 0xa9, 0x46, 0x4d, 0x96, 0x10, 0x00, 0xff, 0x7c, 0x76, 0x93, 0xf7, 0x2b, \
+  0x95, 0xd8\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_XType5a 242u
+const dds_topic_descriptor_t XSpace_XType5a_desc =
+{
+  .m_size = sizeof (XSpace_XType5a),
+  .m_align = dds_alignof (XSpace_XType5a),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "XSpace::XType5a",
+  .m_keys = XSpace_XType5a_keys,
+  .m_nops = 6,
+  .m_ops = XSpace_XType5a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_XType5a, .sz = TYPE_INFO_CDR_SZ_XSpace_XType5a },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_XType5a, .sz = TYPE_MAP_CDR_SZ_XSpace_XType5a }
+};
+
+static const uint32_t XSpace_to_toplevel_ops [] =
+{
+  /* to_toplevel */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_to_toplevel, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpace_to_toplevel, f2), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpace_to_toplevel, f3), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7931538d0ba4b282a6a52c50fd98] (#deps: 3)
+   - [MINIMAL 40845480bb017badbbe737be16ce]
+   - [MINIMAL 16ce50b0626045eb5228e17b4398]
+   - [MINIMAL 808e75678c59840455f0d2396f53]
+  [COMPLETE 7b35eaea4150b9551c4e07115bab] (#deps: 3)
+   - [COMPLETE 3283d8be04bc11b5e606373e1c98]
+   - [COMPLETE c9bc11c0e71cea92da9431a65b91]
+   - [COMPLETE 9d8551da1443647740c931907f6a]
+*/
+#define TYPE_INFO_CDR_XSpace_to_toplevel (const unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x79, 0x31, 0x53, 0x8d, 0x0b, 0xa4, 0xb2, 0x82, 0xa6, 0xa5, 0x2c, \
+  0x50, 0xfd, 0x98, 0x00, 0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, \
+  0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, \
+  0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7b, 0x35, 0xea, \
+  0xea, 0x41, 0x50, 0xb9, 0x55, 0x1c, 0x4e, 0x07, 0x11, 0x5b, 0xab, 0x00, 0xa5, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x32, 0x83, 0xd8, 0xbe, 0x04, 0xbc, 0x11, 0xb5, 0xe6, 0x06, 0x37, 0x3e, 0x1c, 0x98, 0x00, \
+  0x32, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0xbc, 0x11, 0xc0, 0xe7, 0x1c, 0xea, \
+  0x92, 0xda, 0x94, 0x31, 0xa6, 0x5b, 0x91, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x9d, 0x85, 0x51, 0xda, 0x14, 0x43, 0x64, 0x77, 0x40, 0xc9, 0x31, 0x90, 0x7f, 0x6a, 0x00, \
+  0x56, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_to_toplevel 244u
+#define TYPE_MAP_CDR_XSpace_to_toplevel (const unsigned char []){ \
+  0x48, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x79, 0x31, 0x53, 0x8d, 0x0b, 0xa4, 0xb2, \
+  0x82, 0xa6, 0xa5, 0x2c, 0x50, 0xfd, 0x98, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, \
+  0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, \
+  0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, 0x43, 0x98, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, \
+  0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53, 0x17, 0x79, 0xcf, 0x3a, 0xf1, 0x40, 0x84, \
+  0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, 0x37, 0xbe, 0x16, 0xce, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x04, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, \
+  0x7b, 0x43, 0x98, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x48, 0xed, 0x5d, 0x2d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0f, \
+  0xce, 0x20, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, \
+  0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x2f, 0xf9, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xf7, 0x7b, 0xce, 0x01, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0xf2, 0x7b, 0x35, 0xea, 0xea, 0x41, 0x50, 0xb9, 0x55, 0x1c, 0x4e, 0x07, \
+  0x11, 0x5b, 0xab, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, \
+  0x74, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x32, \
+  0x83, 0xd8, 0xbe, 0x04, 0xbc, 0x11, 0xb5, 0xe6, 0x06, 0x37, 0x3e, 0x1c, 0x98, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc9, 0xbc, 0x11, 0xc0, 0xe7, 0x1c, 0xea, 0x92, 0xda, \
+  0x94, 0x31, 0xa6, 0x5b, 0x91, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x9d, \
+  0x85, 0x51, 0xda, 0x14, 0x43, 0x64, 0x77, 0x40, 0xc9, 0x31, 0x90, 0x7f, 0x6a, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x32, 0x83, 0xd8, 0xbe, 0x04, 0xbc, \
+  0x11, 0xb5, 0xe6, 0x06, 0x37, 0x3e, 0x1c, 0x98, 0x2e, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x73, 0x65, 0x71, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf2, 0xc9, 0xbc, 0x11, 0xc0, 0xe7, \
+  0x1c, 0xea, 0x92, 0xda, 0x94, 0x31, 0xa6, 0x5b, 0x91, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x65, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x45, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x45, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x9d, 0x85, 0x51, 0xda, 0x14, 0x43, \
+  0x64, 0x77, 0x40, 0xc9, 0x31, 0x90, 0x7f, 0x6a, 0x52, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, \
+  0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0x7b, 0x35, 0xea, 0xea, 0x41, 0x50, 0xb9, \
+  0x55, 0x1c, 0x4e, 0x07, 0x11, 0x5b, 0xab, 0xf1, 0x79, 0x31, 0x53, 0x8d, 0x0b, 0xa4, 0xb2, 0x82, \
+  0xa6, 0xa5, 0x2c, 0x50, 0xfd, 0x98, 0xf2, 0x32, 0x83, 0xd8, 0xbe, 0x04, 0xbc, 0x11, 0xb5, 0xe6, \
+  0x06, 0x37, 0x3e, 0x1c, 0x98, 0xf1, 0x40, 0x84, 0x54, 0x80, 0xbb, 0x01, 0x7b, 0xad, 0xbb, 0xe7, \
+  0x37, 0xbe, 0x16, 0xce, 0xf2, 0xc9, 0xbc, 0x11, 0xc0, 0xe7, 0x1c, 0xea, 0x92, 0xda, 0x94, 0x31, \
+  0xa6, 0x5b, 0x91, 0xf1, 0x16, 0xce, 0x50, 0xb0, 0x62, 0x60, 0x45, 0xeb, 0x52, 0x28, 0xe1, 0x7b, \
+  0x43, 0x98, 0xf2, 0x9d, 0x85, 0x51, 0xda, 0x14, 0x43, 0x64, 0x77, 0x40, 0xc9, 0x31, 0x90, 0x7f, \
+  0x6a, 0xf1, 0x80, 0x8e, 0x75, 0x67, 0x8c, 0x59, 0x84, 0x04, 0x55, 0xf0, 0xd2, 0x39, 0x6f, 0x53\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_to_toplevel 928u
+const dds_topic_descriptor_t XSpace_to_toplevel_desc =
+{
+  .m_size = sizeof (XSpace_to_toplevel),
+  .m_align = dds_alignof (XSpace_to_toplevel),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::to_toplevel",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpace_to_toplevel_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_to_toplevel, .sz = TYPE_INFO_CDR_SZ_XSpace_to_toplevel },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_to_toplevel, .sz = TYPE_MAP_CDR_SZ_XSpace_to_toplevel }
+};
+
+static const uint32_t XSpace_to_inherit_ops [] =
+{
+  /* to_inherit */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (XSpace_to_inherit, parent), (3u << 16u) + 7u /* to_base */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpace_to_inherit, f1), (3u << 16u) + 7u /* u */,
+  DDS_OP_RTS,
+
+  /* to_base */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_to_base, b1),
+  DDS_OP_RTS,
+
+  /* u */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_u, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpace_u, _u.u1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL dcb0842577f903af5bdf7a87855c] (#deps: 2)
+   - [MINIMAL dd67a6ccf9d17964b77c0efc0d99]
+   - [MINIMAL 764123c11deaa342ebb11bb38b01]
+  [COMPLETE e38540481bb9055ab83b2c4c4c77] (#deps: 2)
+   - [COMPLETE f465ce4964d3a9db7d092fe16122]
+   - [COMPLETE 2b8bd88cd7b1c7d602e5e7b64937]
+*/
+#define TYPE_INFO_CDR_XSpace_to_inherit (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xdc, 0xb0, 0x84, 0x25, 0x77, 0xf9, 0x03, 0xaf, 0x5b, 0xdf, 0x7a, \
+  0x87, 0x85, 0x5c, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, 0x79, \
+  0x64, 0xb7, 0x7c, 0x0e, 0xfc, 0x0d, 0x99, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x76, 0x41, 0x23, 0xc1, 0x1d, 0xea, 0xa3, 0x42, 0xeb, 0xb1, 0x1b, 0xb3, 0x8b, 0x01, 0x00, \
+  0x34, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe3, 0x85, 0x40, 0x48, 0x1b, 0xb9, 0x05, 0x5a, 0xb8, 0x3b, 0x2c, \
+  0x4c, 0x4c, 0x77, 0x00, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf4, 0x65, 0xce, 0x49, 0x64, 0xd3, 0xa9, \
+  0xdb, 0x7d, 0x09, 0x2f, 0xe1, 0x61, 0x22, 0x00, 0x41, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2b, 0x8b, 0xd8, 0x8c, 0xd7, 0xb1, 0xc7, 0xd6, 0x02, 0xe5, 0xe7, 0xb6, 0x49, 0x37, 0x00, \
+  0x51, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_to_inherit 196u
+#define TYPE_MAP_CDR_XSpace_to_inherit (const unsigned char []){ \
+  0xd0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xdc, 0xb0, 0x84, 0x25, 0x77, 0xf9, 0x03, \
+  0xaf, 0x5b, 0xdf, 0x7a, 0x87, 0x85, 0x5c, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, 0x79, 0x64, 0xb7, 0x7c, 0x0e, \
+  0xfc, 0x0d, 0x99, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x76, 0x41, 0x23, 0xc1, 0x1d, 0xea, 0xa3, 0x42, 0xeb, \
+  0xb1, 0x1b, 0xb3, 0x8b, 0x01, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, \
+  0x79, 0x64, 0xb7, 0x7c, 0x0e, 0xfc, 0x0d, 0x99, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xed, 0xba, 0xb4, 0x55, 0xf1, \
+  0x76, 0x41, 0x23, 0xc1, 0x1d, 0xea, 0xa3, 0x42, 0xeb, 0xb1, 0x1b, 0xb3, 0x8b, 0x01, 0x00, 0x00, \
+  0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xe4, 0x77, 0x4c, 0xdd, 0x29, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xe3, 0x85, 0x40, \
+  0x48, 0x1b, 0xb9, 0x05, 0x5a, 0xb8, 0x3b, 0x2c, 0x4c, 0x4c, 0x77, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xf2, 0xf4, 0x65, 0xce, 0x49, 0x64, 0xd3, 0xa9, \
+  0xdb, 0x7d, 0x09, 0x2f, 0xe1, 0x61, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x74, 0x6f, 0x5f, 0x69, 0x6e, 0x68, 0x65, 0x72, \
+  0x69, 0x74, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2b, 0x8b, 0xd8, 0x8c, 0xd7, 0xb1, 0xc7, 0xd6, 0x02, \
+  0xe5, 0xe7, 0xb6, 0x49, 0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xf4, 0x65, 0xce, 0x49, 0x64, 0xd3, 0xa9, 0xdb, 0x7d, 0x09, 0x2f, 0xe1, 0x61, 0x22, \
+  0x3d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x74, 0x6f, 0x5f, 0x62, \
+  0x61, 0x73, 0x65, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x2b, 0x8b, 0xd8, 0x8c, 0xd7, 0xb1, 0xc7, 0xd6, 0x02, 0xe5, 0xe7, 0xb6, 0x49, 0x37, \
+  0x4d, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x75, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xe3, 0x85, 0x40, \
+  0x48, 0x1b, 0xb9, 0x05, 0x5a, 0xb8, 0x3b, 0x2c, 0x4c, 0x4c, 0x77, 0xf1, 0xdc, 0xb0, 0x84, 0x25, \
+  0x77, 0xf9, 0x03, 0xaf, 0x5b, 0xdf, 0x7a, 0x87, 0x85, 0x5c, 0xf2, 0xf4, 0x65, 0xce, 0x49, 0x64, \
+  0xd3, 0xa9, 0xdb, 0x7d, 0x09, 0x2f, 0xe1, 0x61, 0x22, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, \
+  0x79, 0x64, 0xb7, 0x7c, 0x0e, 0xfc, 0x0d, 0x99, 0xf2, 0x2b, 0x8b, 0xd8, 0x8c, 0xd7, 0xb1, 0xc7, \
+  0xd6, 0x02, 0xe5, 0xe7, 0xb6, 0x49, 0x37, 0xf1, 0x76, 0x41, 0x23, 0xc1, 0x1d, 0xea, 0xa3, 0x42, \
+  0xeb, 0xb1, 0x1b, 0xb3, 0x8b, 0x01\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_to_inherit 614u
+const dds_topic_descriptor_t XSpace_to_inherit_desc =
+{
+  .m_size = sizeof (XSpace_to_inherit),
+  .m_align = dds_alignof (XSpace_to_inherit),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::to_inherit",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = XSpace_to_inherit_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_to_inherit, .sz = TYPE_INFO_CDR_SZ_XSpace_to_inherit },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_to_inherit, .sz = TYPE_MAP_CDR_SZ_XSpace_to_inherit }
+};
+
+static const uint32_t XSpace_to_uniondisc_ops [] =
+{
+  /* to_uniondisc */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_to_uniondisc, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpace_to_uniondisc, _u.u1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e6ffbaac17d429874b3f457c1d94] (#deps: 0)
+  [COMPLETE d875fde456eb3646b611243efb07] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_to_uniondisc (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0xff, 0xba, 0xac, 0x17, 0xd4, 0x29, 0x87, 0x4b, 0x3f, 0x45, \
+  0x7c, 0x1d, 0x94, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd8, 0x75, 0xfd, 0xe4, 0x56, 0xeb, 0x36, 0x46, 0xb6, 0x11, 0x24, \
+  0x3e, 0xfb, 0x07, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_to_uniondisc 100u
+#define TYPE_MAP_CDR_XSpace_to_uniondisc (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe6, 0xff, 0xba, 0xac, 0x17, 0xd4, 0x29, \
+  0x87, 0x4b, 0x3f, 0x45, 0x7c, 0x1d, 0x94, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xd8, 0x75, 0xfd, 0xe4, 0x56, 0xeb, 0x36, 0x46, 0xb6, 0x11, 0x24, \
+  0x3e, 0xfb, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, \
+  0x74, 0x6f, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x64, 0x69, 0x73, 0x63, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xd8, 0x75, 0xfd, \
+  0xe4, 0x56, 0xeb, 0x36, 0x46, 0xb6, 0x11, 0x24, 0x3e, 0xfb, 0x07, 0xf1, 0xe6, 0xff, 0xba, 0xac, \
+  0x17, 0xd4, 0x29, 0x87, 0x4b, 0x3f, 0x45, 0x7c, 0x1d, 0x94\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_to_uniondisc 234u
+const dds_topic_descriptor_t XSpace_to_uniondisc_desc =
+{
+  .m_size = sizeof (XSpace_to_uniondisc),
+  .m_align = dds_alignof (XSpace_to_uniondisc),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::to_uniondisc",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = XSpace_to_uniondisc_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_to_uniondisc, .sz = TYPE_INFO_CDR_SZ_XSpace_to_uniondisc },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_to_uniondisc, .sz = TYPE_MAP_CDR_SZ_XSpace_to_uniondisc }
+};
+
+static const uint32_t XSpace_dep_test_ops [] =
+{
+  /* dep_test */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpace_dep_test, f1), (3u << 16u) + 4u /* dep_test_nested */,
+  DDS_OP_RTS,
+
+  /* dep_test_nested */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_dep_test_nested, n1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpace_dep_test_nested, n2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 61b7fae78b48f229cb08ec74ba55] (#deps: 1)
+   - [MINIMAL 3e4fe1d4e4ee38139ea40416a5c8]
+  [COMPLETE 056b745e180fe87fc1d094011313] (#deps: 1)
+   - [COMPLETE dc88a65e02449c61fcbac31dca02]
+*/
+#define TYPE_INFO_CDR_XSpace_dep_test (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x61, 0xb7, 0xfa, 0xe7, 0x8b, 0x48, 0xf2, 0x29, 0xcb, 0x08, 0xec, \
+  0x74, 0xba, 0x55, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x3e, 0x4f, 0xe1, 0xd4, 0xe4, 0xee, 0x38, \
+  0x13, 0x9e, 0xa4, 0x04, 0x16, 0xa5, 0xc8, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x6b, 0x74, \
+  0x5e, 0x18, 0x0f, 0xe8, 0x7f, 0xc1, 0xd0, 0x94, 0x01, 0x13, 0x13, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xdc, 0x88, 0xa6, 0x5e, 0x02, 0x44, 0x9c, 0x61, 0xfc, 0xba, 0xc3, 0x1d, 0xca, 0x02, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_dep_test 148u
+#define TYPE_MAP_CDR_XSpace_dep_test (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x61, 0xb7, 0xfa, 0xe7, 0x8b, 0x48, 0xf2, \
+  0x29, 0xcb, 0x08, 0xec, 0x74, 0xba, 0x55, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x3e, 0x4f, 0xe1, 0xd4, 0xe4, \
+  0xee, 0x38, 0x13, 0x9e, 0xa4, 0x04, 0x16, 0xa5, 0xc8, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x3e, 0x4f, \
+  0xe1, 0xd4, 0xe4, 0xee, 0x38, 0x13, 0x9e, 0xa4, 0x04, 0x16, 0xa5, 0xc8, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xc8, \
+  0x25, 0x61, 0xec, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xa6, \
+  0xbb, 0xc9, 0x1a, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x6b, 0x74, \
+  0x5e, 0x18, 0x0f, 0xe8, 0x7f, 0xc1, 0xd0, 0x94, 0x01, 0x13, 0x13, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x64, 0x65, 0x70, 0x5f, 0x74, 0x65, 0x73, 0x74, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xdc, 0x88, 0xa6, 0x5e, 0x02, 0x44, 0x9c, 0x61, 0xfc, \
+  0xba, 0xc3, 0x1d, 0xca, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xdc, 0x88, 0xa6, 0x5e, 0x02, 0x44, 0x9c, 0x61, 0xfc, 0xba, 0xc3, 0x1d, 0xca, 0x02, \
+  0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0a, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, 0x64, 0x65, 0x70, 0x5f, \
+  0x74, 0x65, 0x73, 0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x6b, 0x74, \
+  0x5e, 0x18, 0x0f, 0xe8, 0x7f, 0xc1, 0xd0, 0x94, 0x01, 0x13, 0x13, 0xf1, 0x61, 0xb7, 0xfa, 0xe7, \
+  0x8b, 0x48, 0xf2, 0x29, 0xcb, 0x08, 0xec, 0x74, 0xba, 0x55, 0xf2, 0xdc, 0x88, 0xa6, 0x5e, 0x02, \
+  0x44, 0x9c, 0x61, 0xfc, 0xba, 0xc3, 0x1d, 0xca, 0x02, 0xf1, 0x3e, 0x4f, 0xe1, 0xd4, 0xe4, 0xee, \
+  0x38, 0x13, 0x9e, 0xa4, 0x04, 0x16, 0xa5, 0xc8\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_dep_test 440u
+const dds_topic_descriptor_t XSpace_dep_test_desc =
+{
+  .m_size = sizeof (XSpace_dep_test),
+  .m_align = dds_alignof (XSpace_dep_test),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::dep_test",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpace_dep_test_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_dep_test, .sz = TYPE_INFO_CDR_SZ_XSpace_dep_test },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_dep_test, .sz = TYPE_MAP_CDR_SZ_XSpace_dep_test }
+};
+
+static const uint32_t XSpace_to_unionmembers_ops [] =
+{
+  /* to_unionmembers */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (XSpace_to_unionmembers, _d), 2u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpace_to_unionmembers, _u.u1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_2BY, 0, offsetof (XSpace_to_unionmembers, _u.u2), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 198c4c03c1c50e59f9d813a25af1] (#deps: 0)
+  [COMPLETE 8696a2ee6518511132e7c2728d8c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpace_to_unionmembers (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x19, 0x8c, 0x4c, 0x03, 0xc1, 0xc5, 0x0e, 0x59, 0xf9, 0xd8, 0x13, \
+  0xa2, 0x5a, 0xf1, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x86, 0x96, 0xa2, 0xee, 0x65, 0x18, 0x51, 0x11, 0x32, 0xe7, 0xc2, \
+  0x72, 0x8d, 0x8c, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_to_unionmembers 100u
+#define TYPE_MAP_CDR_XSpace_to_unionmembers (const unsigned char []){ \
+  0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x19, 0x8c, 0x4c, 0x03, 0xc1, 0xc5, 0x0e, \
+  0x59, 0xf9, 0xd8, 0x13, 0xa2, 0x5a, 0xf1, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x1b, 0x08, \
+  0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x86, 0x96, 0xa2, 0xee, 0x65, 0x18, 0x51, \
+  0x11, 0x32, 0xe7, 0xc2, 0x72, 0x8d, 0x8c, 0x00, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x3a, 0x3a, 0x74, 0x6f, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x6d, 0x65, 0x6d, 0x62, \
+  0x65, 0x72, 0x73, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x3d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x41, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x86, 0x96, 0xa2, \
+  0xee, 0x65, 0x18, 0x51, 0x11, 0x32, 0xe7, 0xc2, 0x72, 0x8d, 0x8c, 0xf1, 0x19, 0x8c, 0x4c, 0x03, \
+  0xc1, 0xc5, 0x0e, 0x59, 0xf9, 0xd8, 0x13, 0xa2, 0x5a, 0xf1\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_to_unionmembers 282u
+const dds_topic_descriptor_t XSpace_to_unionmembers_desc =
+{
+  .m_size = sizeof (XSpace_to_unionmembers),
+  .m_align = dds_alignof (XSpace_to_unionmembers),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::to_unionmembers",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpace_to_unionmembers_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_to_unionmembers, .sz = TYPE_INFO_CDR_SZ_XSpace_to_unionmembers },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_to_unionmembers, .sz = TYPE_MAP_CDR_SZ_XSpace_to_unionmembers }
+};
+
+static const uint32_t XSpace_to_arraybound_ops [] =
+{
+  /* to_arraybound */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (XSpace_to_arraybound, f1), 1000000000u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b20a9dbfcd08b4a7b72c366f5a3f] (#deps: 2)
+   - [MINIMAL df2db8433077f025f012c8060192]
+   - [MINIMAL 7880de5ba9c2bfcf0fd6fe3df70c]
+  [COMPLETE 624df09de208c08823d33dbbc2ea] (#deps: 2)
+   - [COMPLETE a39d7cdb2f4464fe4f1252fb25e9]
+   - [COMPLETE 5a49fb0613050213c6ef635ba5dd]
+*/
+#define TYPE_INFO_CDR_XSpace_to_arraybound (const unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x0a, 0x9d, 0xbf, 0xcd, 0x08, 0xb4, 0xa7, 0xb7, 0x2c, 0x36, \
+  0x6f, 0x5a, 0x3f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdf, 0x2d, 0xb8, 0x43, 0x30, 0x77, 0xf0, \
+  0x25, 0xf0, 0x12, 0xc8, 0x06, 0x01, 0x92, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x78, 0x80, 0xde, 0x5b, 0xa9, 0xc2, 0xbf, 0xcf, 0x0f, 0xd6, 0xfe, 0x3d, 0xf7, 0x0c, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x4d, 0xf0, 0x9d, 0xe2, 0x08, 0xc0, 0x88, 0x23, 0xd3, 0x3d, \
+  0xbb, 0xc2, 0xea, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xa3, 0x9d, 0x7c, 0xdb, 0x2f, 0x44, 0x64, \
+  0xfe, 0x4f, 0x12, 0x52, 0xfb, 0x25, 0xe9, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5a, 0x49, 0xfb, 0x06, 0x13, 0x05, 0x02, 0x13, 0xc6, 0xef, 0x63, 0x5b, 0xa5, 0xdd, 0x00, \
+  0x3b, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpace_to_arraybound 196u
+#define TYPE_MAP_CDR_XSpace_to_arraybound (const unsigned char []){ \
+  0xb5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x0a, 0x9d, 0xbf, 0xcd, 0x08, 0xb4, \
+  0xa7, 0xb7, 0x2c, 0x36, 0x6f, 0x5a, 0x3f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0xf1, 0xdf, 0x2d, 0xb8, 0x43, 0x30, 0x77, 0xf0, 0x25, 0xf0, 0x12, \
+  0xc8, 0x06, 0x01, 0x92, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xdf, 0x2d, 0xb8, 0x43, 0x30, 0x77, 0xf0, \
+  0x25, 0xf0, 0x12, 0xc8, 0x06, 0x01, 0x92, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x78, 0x80, 0xde, 0x5b, 0xa9, \
+  0xc2, 0xbf, 0xcf, 0x0f, 0xd6, 0xfe, 0x3d, 0xf7, 0x0c, 0xf1, 0x78, 0x80, 0xde, 0x5b, 0xa9, 0xc2, \
+  0xbf, 0xcf, 0x0f, 0xd6, 0xfe, 0x3d, 0xf7, 0x0c, 0x1d, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0xca, 0x9a, 0x3b, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x4d, 0xf0, 0x9d, 0xe2, 0x08, 0xc0, 0x88, 0x23, 0xd3, 0x3d, \
+  0xbb, 0xc2, 0xea, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, \
+  0x74, 0x6f, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xf2, 0xa3, 0x9d, \
+  0x7c, 0xdb, 0x2f, 0x44, 0x64, 0xfe, 0x4f, 0x12, 0x52, 0xfb, 0x25, 0xe9, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xa3, 0x9d, 0x7c, 0xdb, 0x2f, 0x44, 0x64, 0xfe, 0x4f, 0x12, \
+  0x52, 0xfb, 0x25, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, \
+  0x74, 0x64, 0x64, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xf2, 0x5a, 0x49, 0xfb, 0x06, 0x13, 0x05, 0x02, 0x13, 0xc6, 0xef, 0x63, 0x5b, 0xa5, \
+  0xdd, 0x00, 0x00, 0xf2, 0x5a, 0x49, 0xfb, 0x06, 0x13, 0x05, 0x02, 0x13, 0xc6, 0xef, 0x63, 0x5b, \
+  0xa5, 0xdd, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x3a, \
+  0x74, 0x64, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xca, 0x9a, 0x3b, 0x02, 0x00, 0x00, 0x00, \
+  0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x4d, 0xf0, 0x9d, 0xe2, 0x08, 0xc0, \
+  0x88, 0x23, 0xd3, 0x3d, 0xbb, 0xc2, 0xea, 0xf1, 0xb2, 0x0a, 0x9d, 0xbf, 0xcd, 0x08, 0xb4, 0xa7, \
+  0xb7, 0x2c, 0x36, 0x6f, 0x5a, 0x3f, 0xf2, 0xa3, 0x9d, 0x7c, 0xdb, 0x2f, 0x44, 0x64, 0xfe, 0x4f, \
+  0x12, 0x52, 0xfb, 0x25, 0xe9, 0xf1, 0xdf, 0x2d, 0xb8, 0x43, 0x30, 0x77, 0xf0, 0x25, 0xf0, 0x12, \
+  0xc8, 0x06, 0x01, 0x92, 0xf2, 0x5a, 0x49, 0xfb, 0x06, 0x13, 0x05, 0x02, 0x13, 0xc6, 0xef, 0x63, \
+  0x5b, 0xa5, 0xdd, 0xf1, 0x78, 0x80, 0xde, 0x5b, 0xa9, 0xc2, 0xbf, 0xcf, 0x0f, 0xd6, 0xfe, 0x3d, \
+  0xf7, 0x0c\
+}
+#define TYPE_MAP_CDR_SZ_XSpace_to_arraybound 562u
+const dds_topic_descriptor_t XSpace_to_arraybound_desc =
+{
+  .m_size = sizeof (XSpace_to_arraybound),
+  .m_align = dds_alignof (XSpace_to_arraybound),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpace::to_arraybound",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpace_to_arraybound_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpace_to_arraybound, .sz = TYPE_INFO_CDR_SZ_XSpace_to_arraybound },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpace_to_arraybound, .sz = TYPE_MAP_CDR_SZ_XSpace_to_arraybound }
+};
+
@@ -0,0 +1,922 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/XSpaceEnum.c
+  Source: /root/repo/src/core/ddsc/tests/XSpaceEnum.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpaceEnum.h"
+
+static const uint32_t XSpaceEnum_rd1_ops [] =
+{
+  /* rd1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_rd1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4f21fcd1747d6d23f8e9a94b0bf5] (#deps: 1)
+   - [MINIMAL 463d92afec9e3c8c71afb8d275b4]
+  [COMPLETE ccb28251de98608868bf8ff80493] (#deps: 1)
+   - [COMPLETE c97cccb6f8788747875499e7061c]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_rd1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, 0xf8, 0xe9, 0xa9, \
+  0x4b, 0x0b, 0xf5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, \
+  0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0xb2, 0x82, \
+  0x51, 0xde, 0x98, 0x60, 0x88, 0x68, 0xbf, 0x8f, 0xf8, 0x04, 0x93, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_rd1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_rd1 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, \
+  0x23, 0xf8, 0xe9, 0xa9, 0x4b, 0x0b, 0xf5, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, \
+  0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x46, 0x3d, \
+  0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0xb2, 0x82, 0x51, 0xde, 0x98, 0x60, \
+  0x88, 0x68, 0xbf, 0x8f, 0xf8, 0x04, 0x93, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x72, 0x64, 0x31, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc9, \
+  0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, \
+  0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x00, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0xb2, 0x82, 0x51, 0xde, 0x98, 0x60, 0x88, 0x68, 0xbf, 0x8f, \
+  0xf8, 0x04, 0x93, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, 0xf8, 0xe9, 0xa9, 0x4b, \
+  0x0b, 0xf5, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, \
+  0x1c, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_rd1 496u
+const dds_topic_descriptor_t XSpaceEnum_rd1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_rd1),
+  .m_align = dds_alignof (XSpaceEnum_rd1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::rd1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_rd1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_rd1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_rd1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_rd1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_rd1 }
+};
+
+static const uint32_t XSpaceEnum_wr1_1_ops [] =
+{
+  /* wr1_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr1_1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4f21fcd1747d6d23f8e9a94b0bf5] (#deps: 1)
+   - [MINIMAL 463d92afec9e3c8c71afb8d275b4]
+  [COMPLETE b92c3024eb0f3a9687116000861e] (#deps: 1)
+   - [COMPLETE c97cccb6f8788747875499e7061c]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr1_1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, 0xf8, 0xe9, 0xa9, \
+  0x4b, 0x0b, 0xf5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, \
+  0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0x2c, 0x30, \
+  0x24, 0xeb, 0x0f, 0x3a, 0x96, 0x87, 0x11, 0x60, 0x00, 0x86, 0x1e, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr1_1 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, \
+  0x23, 0xf8, 0xe9, 0xa9, 0x4b, 0x0b, 0xf5, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, \
+  0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x46, 0x3d, \
+  0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0x2c, 0x30, 0x24, 0xeb, 0x0f, 0x3a, \
+  0x96, 0x87, 0x11, 0x60, 0x00, 0x86, 0x1e, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, \
+  0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x7c, \
+  0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x66, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb9, 0x2c, 0x30, 0x24, 0xeb, 0x0f, 0x3a, \
+  0x96, 0x87, 0x11, 0x60, 0x00, 0x86, 0x1e, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, \
+  0xf8, 0xe9, 0xa9, 0x4b, 0x0b, 0xf5, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, \
+  0x54, 0x99, 0xe7, 0x06, 0x1c, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, \
+  0xb8, 0xd2, 0x75, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_1 500u
+const dds_topic_descriptor_t XSpaceEnum_wr1_1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr1_1),
+  .m_align = dds_alignof (XSpaceEnum_wr1_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr1_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr1_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr1_1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr1_1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_1 }
+};
+
+static const uint32_t XSpaceEnum_wr1_2_ops [] =
+{
+  /* wr1_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr1_2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 83439cf000567a2dd1c590b0796d] (#deps: 1)
+   - [MINIMAL af851eba0b0db64f413408fedff3]
+  [COMPLETE e81afd3c157a360b39bf02ed985f] (#deps: 1)
+   - [COMPLETE acc9b3b382e80fefc6d369994fda]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr1_2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, 0xd1, 0xc5, 0x90, \
+  0xb0, 0x79, 0x6d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, \
+  0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe8, 0x1a, 0xfd, \
+  0x3c, 0x15, 0x7a, 0x36, 0x0b, 0x39, 0xbf, 0x02, 0xed, 0x98, 0x5f, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr1_2 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, \
+  0x2d, 0xd1, 0xc5, 0x90, 0xb0, 0x79, 0x6d, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, \
+  0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xaf, 0x85, \
+  0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe8, 0x1a, 0xfd, 0x3c, 0x15, 0x7a, 0x36, \
+  0x0b, 0x39, 0xbf, 0x02, 0xed, 0x98, 0x5f, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x32, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, \
+  0xda, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xac, 0xc9, \
+  0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x61, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe8, 0x1a, 0xfd, 0x3c, 0x15, 0x7a, 0x36, \
+  0x0b, 0x39, 0xbf, 0x02, 0xed, 0x98, 0x5f, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, \
+  0xd1, 0xc5, 0x90, 0xb0, 0x79, 0x6d, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, \
+  0xd3, 0x69, 0x99, 0x4f, 0xda, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, \
+  0x08, 0xfe, 0xdf, 0xf3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_2 500u
+const dds_topic_descriptor_t XSpaceEnum_wr1_2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr1_2),
+  .m_align = dds_alignof (XSpaceEnum_wr1_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr1_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr1_2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr1_2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_2 }
+};
+
+static const uint32_t XSpaceEnum_rd2_ops [] =
+{
+  /* rd2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_rd2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 83439cf000567a2dd1c590b0796d] (#deps: 1)
+   - [MINIMAL af851eba0b0db64f413408fedff3]
+  [COMPLETE 4e027d5cdc8a41212a2fdd244782] (#deps: 1)
+   - [COMPLETE acc9b3b382e80fefc6d369994fda]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_rd2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, 0xd1, 0xc5, 0x90, \
+  0xb0, 0x79, 0x6d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, \
+  0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x02, 0x7d, \
+  0x5c, 0xdc, 0x8a, 0x41, 0x21, 0x2a, 0x2f, 0xdd, 0x24, 0x47, 0x82, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_rd2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_rd2 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, \
+  0x2d, 0xd1, 0xc5, 0x90, 0xb0, 0x79, 0x6d, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, \
+  0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xaf, 0x85, \
+  0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x02, 0x7d, 0x5c, 0xdc, 0x8a, 0x41, \
+  0x21, 0x2a, 0x2f, 0xdd, 0x24, 0x47, 0x82, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x72, 0x64, 0x32, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xac, \
+  0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, \
+  0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x00, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x02, 0x7d, 0x5c, 0xdc, 0x8a, 0x41, 0x21, 0x2a, 0x2f, 0xdd, \
+  0x24, 0x47, 0x82, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, 0xd1, 0xc5, 0x90, 0xb0, \
+  0x79, 0x6d, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, \
+  0xda, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_rd2 496u
+const dds_topic_descriptor_t XSpaceEnum_rd2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_rd2),
+  .m_align = dds_alignof (XSpaceEnum_rd2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::rd2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_rd2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_rd2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_rd2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_rd2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_rd2 }
+};
+
+static const uint32_t XSpaceEnum_wr2_1_ops [] =
+{
+  /* wr2_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr2_1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 83439cf000567a2dd1c590b0796d] (#deps: 1)
+   - [MINIMAL af851eba0b0db64f413408fedff3]
+  [COMPLETE 752316d44bf2f18d5703cceba51b] (#deps: 1)
+   - [COMPLETE acc9b3b382e80fefc6d369994fda]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr2_1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, 0xd1, 0xc5, 0x90, \
+  0xb0, 0x79, 0x6d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, \
+  0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x75, 0x23, 0x16, \
+  0xd4, 0x4b, 0xf2, 0xf1, 0x8d, 0x57, 0x03, 0xcc, 0xeb, 0xa5, 0x1b, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr2_1 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, \
+  0x2d, 0xd1, 0xc5, 0x90, 0xb0, 0x79, 0x6d, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, \
+  0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xaf, 0x85, \
+  0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, 0x08, 0xfe, 0xdf, 0xf3, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x75, 0x23, 0x16, 0xd4, 0x4b, 0xf2, 0xf1, \
+  0x8d, 0x57, 0x03, 0xcc, 0xeb, 0xa5, 0x1b, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, \
+  0xda, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xac, 0xc9, \
+  0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, 0xd3, 0x69, 0x99, 0x4f, 0xda, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x61, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x75, 0x23, 0x16, 0xd4, 0x4b, 0xf2, 0xf1, \
+  0x8d, 0x57, 0x03, 0xcc, 0xeb, 0xa5, 0x1b, 0xf1, 0x83, 0x43, 0x9c, 0xf0, 0x00, 0x56, 0x7a, 0x2d, \
+  0xd1, 0xc5, 0x90, 0xb0, 0x79, 0x6d, 0xf2, 0xac, 0xc9, 0xb3, 0xb3, 0x82, 0xe8, 0x0f, 0xef, 0xc6, \
+  0xd3, 0x69, 0x99, 0x4f, 0xda, 0xf1, 0xaf, 0x85, 0x1e, 0xba, 0x0b, 0x0d, 0xb6, 0x4f, 0x41, 0x34, \
+  0x08, 0xfe, 0xdf, 0xf3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_1 500u
+const dds_topic_descriptor_t XSpaceEnum_wr2_1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr2_1),
+  .m_align = dds_alignof (XSpaceEnum_wr2_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr2_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr2_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr2_1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr2_1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_1 }
+};
+
+static const uint32_t XSpaceEnum_wr2_2_ops [] =
+{
+  /* wr2_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr2_2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4f21fcd1747d6d23f8e9a94b0bf5] (#deps: 1)
+   - [MINIMAL 463d92afec9e3c8c71afb8d275b4]
+  [COMPLETE 9c3e9f831f4e97aec4ea90013056] (#deps: 1)
+   - [COMPLETE c97cccb6f8788747875499e7061c]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr2_2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, 0xf8, 0xe9, 0xa9, \
+  0x4b, 0x0b, 0xf5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, \
+  0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x3e, 0x9f, \
+  0x83, 0x1f, 0x4e, 0x97, 0xae, 0xc4, 0xea, 0x90, 0x01, 0x30, 0x56, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr2_2 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, \
+  0x23, 0xf8, 0xe9, 0xa9, 0x4b, 0x0b, 0xf5, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, \
+  0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x46, 0x3d, \
+  0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, 0xb8, 0xd2, 0x75, 0xb4, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x3e, 0x9f, 0x83, 0x1f, 0x4e, 0x97, \
+  0xae, 0xc4, 0xea, 0x90, 0x01, 0x30, 0x56, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x32, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, \
+  0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0x7c, \
+  0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, 0x54, 0x99, 0xe7, 0x06, 0x1c, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x66, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x3e, 0x9f, 0x83, 0x1f, 0x4e, 0x97, \
+  0xae, 0xc4, 0xea, 0x90, 0x01, 0x30, 0x56, 0xf1, 0x4f, 0x21, 0xfc, 0xd1, 0x74, 0x7d, 0x6d, 0x23, \
+  0xf8, 0xe9, 0xa9, 0x4b, 0x0b, 0xf5, 0xf2, 0xc9, 0x7c, 0xcc, 0xb6, 0xf8, 0x78, 0x87, 0x47, 0x87, \
+  0x54, 0x99, 0xe7, 0x06, 0x1c, 0xf1, 0x46, 0x3d, 0x92, 0xaf, 0xec, 0x9e, 0x3c, 0x8c, 0x71, 0xaf, \
+  0xb8, 0xd2, 0x75, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_2 500u
+const dds_topic_descriptor_t XSpaceEnum_wr2_2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr2_2),
+  .m_align = dds_alignof (XSpaceEnum_wr2_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr2_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr2_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr2_2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr2_2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_2 }
+};
+
+static const uint32_t XSpaceEnumPlus_wr1_3_ops [] =
+{
+  /* wr1_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumPlus_wr1_3, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2a2fc46989a9ed88d1074168f877] (#deps: 1)
+   - [MINIMAL 3dfa3be4014e279897d70eb01d60]
+  [COMPLETE b50f42f9116f53b45c004c04e7be] (#deps: 1)
+   - [COMPLETE 367f04d66a98db6d699850ba13b7]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumPlus_wr1_3 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x2f, 0xc4, 0x69, 0x89, 0xa9, 0xed, 0x88, 0xd1, 0x07, 0x41, \
+  0x68, 0xf8, 0x77, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x3d, 0xfa, 0x3b, 0xe4, 0x01, 0x4e, 0x27, \
+  0x98, 0x97, 0xd7, 0x0e, 0xb0, 0x1d, 0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x0f, 0x42, \
+  0xf9, 0x11, 0x6f, 0x53, 0xb4, 0x5c, 0x00, 0x4c, 0x04, 0xe7, 0xbe, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x36, 0x7f, 0x04, 0xd6, 0x6a, 0x98, 0xdb, 0x6d, 0x69, 0x98, 0x50, 0xba, 0x13, 0xb7, 0x00, \
+  0xa5, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr1_3 148u
+#define TYPE_MAP_CDR_XSpaceEnumPlus_wr1_3 (const unsigned char []){ \
+  0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x2f, 0xc4, 0x69, 0x89, 0xa9, 0xed, \
+  0x88, 0xd1, 0x07, 0x41, 0x68, 0xf8, 0x77, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x3d, 0xfa, 0x3b, 0xe4, 0x01, \
+  0x4e, 0x27, 0x98, 0x97, 0xd7, 0x0e, 0xb0, 0x1d, 0x60, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x3d, 0xfa, \
+  0x3b, 0xe4, 0x01, 0x4e, 0x27, 0x98, 0x97, 0xd7, 0x0e, 0xb0, 0x1d, 0x60, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe0, \
+  0xe7, 0x24, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x0f, 0x42, \
+  0xf9, 0x11, 0x6f, 0x53, 0xb4, 0x5c, 0x00, 0x4c, 0x04, 0xe7, 0xbe, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, \
+  0x77, 0x72, 0x31, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x36, 0x7f, 0x04, 0xd6, 0x6a, \
+  0x98, 0xdb, 0x6d, 0x69, 0x98, 0x50, 0xba, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x36, 0x7f, 0x04, 0xd6, 0x6a, 0x98, 0xdb, 0x6d, 0x69, 0x98, \
+  0x50, 0xba, 0x13, 0xb7, 0xa1, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x70, \
+  0x6c, 0x75, 0x73, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x0f, 0x42, 0xf9, 0x11, 0x6f, 0x53, 0xb4, 0x5c, 0x00, 0x4c, \
+  0x04, 0xe7, 0xbe, 0xf1, 0x2a, 0x2f, 0xc4, 0x69, 0x89, 0xa9, 0xed, 0x88, 0xd1, 0x07, 0x41, 0x68, \
+  0xf8, 0x77, 0xf2, 0x36, 0x7f, 0x04, 0xd6, 0x6a, 0x98, 0xdb, 0x6d, 0x69, 0x98, 0x50, 0xba, 0x13, \
+  0xb7, 0xf1, 0x3d, 0xfa, 0x3b, 0xe4, 0x01, 0x4e, 0x27, 0x98, 0x97, 0xd7, 0x0e, 0xb0, 0x1d, 0x60\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr1_3 560u
+const dds_topic_descriptor_t XSpaceEnumPlus_wr1_3_desc =
+{
+  .m_size = sizeof (XSpaceEnumPlus_wr1_3),
+  .m_align = dds_alignof (XSpaceEnumPlus_wr1_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumPlus::wr1_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumPlus_wr1_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumPlus_wr1_3, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr1_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumPlus_wr1_3, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr1_3 }
+};
+
+static const uint32_t XSpaceEnumPlus_wr2_3_ops [] =
+{
+  /* wr2_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumPlus_wr2_3, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d399d3400bdcb3de525c48506486] (#deps: 1)
+   - [MINIMAL eaacae5cb4b7226add2dd2ac89a3]
+  [COMPLETE e158ccd96449c65337eabdbe9711] (#deps: 1)
+   - [COMPLETE 2e55be19ef343884e005424971c5]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumPlus_wr2_3 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x99, 0xd3, 0x40, 0x0b, 0xdc, 0xb3, 0xde, 0x52, 0x5c, 0x48, \
+  0x50, 0x64, 0x86, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xea, 0xac, 0xae, 0x5c, 0xb4, 0xb7, 0x22, \
+  0x6a, 0xdd, 0x2d, 0xd2, 0xac, 0x89, 0xa3, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe1, 0x58, 0xcc, \
+  0xd9, 0x64, 0x49, 0xc6, 0x53, 0x37, 0xea, 0xbd, 0xbe, 0x97, 0x11, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2e, 0x55, 0xbe, 0x19, 0xef, 0x34, 0x38, 0x84, 0xe0, 0x05, 0x42, 0x49, 0x71, 0xc5, 0x00, \
+  0xa5, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr2_3 148u
+#define TYPE_MAP_CDR_XSpaceEnumPlus_wr2_3 (const unsigned char []){ \
+  0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x99, 0xd3, 0x40, 0x0b, 0xdc, 0xb3, \
+  0xde, 0x52, 0x5c, 0x48, 0x50, 0x64, 0x86, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xea, 0xac, 0xae, 0x5c, 0xb4, \
+  0xb7, 0x22, 0x6a, 0xdd, 0x2d, 0xd2, 0xac, 0x89, 0xa3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xea, 0xac, \
+  0xae, 0x5c, 0xb4, 0xb7, 0x22, 0x6a, 0xdd, 0x2d, 0xd2, 0xac, 0x89, 0xa3, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2f, \
+  0x3a, 0xdf, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe1, 0x58, 0xcc, \
+  0xd9, 0x64, 0x49, 0xc6, 0x53, 0x37, 0xea, 0xbd, 0xbe, 0x97, 0x11, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, \
+  0x77, 0x72, 0x32, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2e, 0x55, 0xbe, 0x19, 0xef, \
+  0x34, 0x38, 0x84, 0xe0, 0x05, 0x42, 0x49, 0x71, 0xc5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0x55, 0xbe, 0x19, 0xef, 0x34, 0x38, 0x84, 0xe0, 0x05, \
+  0x42, 0x49, 0x71, 0xc5, 0xa1, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x70, \
+  0x6c, 0x75, 0x73, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xe1, 0x58, 0xcc, 0xd9, 0x64, 0x49, 0xc6, 0x53, 0x37, 0xea, 0xbd, \
+  0xbe, 0x97, 0x11, 0xf1, 0xd3, 0x99, 0xd3, 0x40, 0x0b, 0xdc, 0xb3, 0xde, 0x52, 0x5c, 0x48, 0x50, \
+  0x64, 0x86, 0xf2, 0x2e, 0x55, 0xbe, 0x19, 0xef, 0x34, 0x38, 0x84, 0xe0, 0x05, 0x42, 0x49, 0x71, \
+  0xc5, 0xf1, 0xea, 0xac, 0xae, 0x5c, 0xb4, 0xb7, 0x22, 0x6a, 0xdd, 0x2d, 0xd2, 0xac, 0x89, 0xa3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr2_3 560u
+const dds_topic_descriptor_t XSpaceEnumPlus_wr2_3_desc =
+{
+  .m_size = sizeof (XSpaceEnumPlus_wr2_3),
+  .m_align = dds_alignof (XSpaceEnumPlus_wr2_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumPlus::wr2_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumPlus_wr2_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumPlus_wr2_3, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr2_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumPlus_wr2_3, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr2_3 }
+};
+
+static const uint32_t XSpaceEnumMin_wr1_4_ops [] =
+{
+  /* wr1_4 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumMin_wr1_4, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e37ff3fb5a64a710d19237bc8fc1] (#deps: 1)
+   - [MINIMAL 0aeb779781d18629c09c5ee8ae09]
+  [COMPLETE fdd0322601d4e2fd128b1d01d3fd] (#deps: 1)
+   - [COMPLETE 270160453c21de1b17be56a137d3]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumMin_wr1_4 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0x7f, 0xf3, 0xfb, 0x5a, 0x64, 0xa7, 0x10, 0xd1, 0x92, 0x37, \
+  0xbc, 0x8f, 0xc1, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x0a, 0xeb, 0x77, 0x97, 0x81, 0xd1, 0x86, \
+  0x29, 0xc0, 0x9c, 0x5e, 0xe8, 0xae, 0x09, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0xd0, 0x32, \
+  0x26, 0x01, 0xd4, 0xe2, 0xfd, 0x12, 0x8b, 0x1d, 0x01, 0xd3, 0xfd, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x27, 0x01, 0x60, 0x45, 0x3c, 0x21, 0xde, 0x1b, 0x17, 0xbe, 0x56, 0xa1, 0x37, 0xd3, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr1_4 148u
+#define TYPE_MAP_CDR_XSpaceEnumMin_wr1_4 (const unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0x7f, 0xf3, 0xfb, 0x5a, 0x64, 0xa7, \
+  0x10, 0xd1, 0x92, 0x37, 0xbc, 0x8f, 0xc1, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x0a, 0xeb, 0x77, 0x97, 0x81, \
+  0xd1, 0x86, 0x29, 0xc0, 0x9c, 0x5e, 0xe8, 0xae, 0x09, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x0a, 0xeb, \
+  0x77, 0x97, 0x81, 0xd1, 0x86, 0x29, 0xc0, 0x9c, 0x5e, 0xe8, 0xae, 0x09, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0xd0, 0x32, 0x26, 0x01, 0xd4, 0xe2, 0xfd, 0x12, 0x8b, 0x1d, \
+  0x01, 0xd3, 0xfd, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x27, 0x01, 0x60, 0x45, 0x3c, 0x21, 0xde, 0x1b, 0x17, 0xbe, 0x56, 0xa1, 0x37, \
+  0xd3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x01, \
+  0x60, 0x45, 0x3c, 0x21, 0xde, 0x1b, 0x17, 0xbe, 0x56, 0xa1, 0x37, 0xd3, 0x69, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x65, \
+  0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0xd0, 0x32, 0x26, 0x01, 0xd4, 0xe2, 0xfd, 0x12, 0x8b, 0x1d, \
+  0x01, 0xd3, 0xfd, 0xf1, 0xe3, 0x7f, 0xf3, 0xfb, 0x5a, 0x64, 0xa7, 0x10, 0xd1, 0x92, 0x37, 0xbc, \
+  0x8f, 0xc1, 0xf2, 0x27, 0x01, 0x60, 0x45, 0x3c, 0x21, 0xde, 0x1b, 0x17, 0xbe, 0x56, 0xa1, 0x37, \
+  0xd3, 0xf1, 0x0a, 0xeb, 0x77, 0x97, 0x81, 0xd1, 0x86, 0x29, 0xc0, 0x9c, 0x5e, 0xe8, 0xae, 0x09\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr1_4 464u
+const dds_topic_descriptor_t XSpaceEnumMin_wr1_4_desc =
+{
+  .m_size = sizeof (XSpaceEnumMin_wr1_4),
+  .m_align = dds_alignof (XSpaceEnumMin_wr1_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumMin::wr1_4",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumMin_wr1_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumMin_wr1_4, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr1_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumMin_wr1_4, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr1_4 }
+};
+
+static const uint32_t XSpaceEnumMin_wr2_4_ops [] =
+{
+  /* wr2_4 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumMin_wr2_4, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d107d74c63704ef92828a30c5817] (#deps: 1)
+   - [MINIMAL 97b9625d0694fb9a6c8a40ce7bf6]
+  [COMPLETE 49b8eb323a2fc086bfc9296d89e8] (#deps: 1)
+   - [COMPLETE 0b88b2e90fec2f3e986e706f599b]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumMin_wr2_4 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd1, 0x07, 0xd7, 0x4c, 0x63, 0x70, 0x4e, 0xf9, 0x28, 0x28, 0xa3, \
+  0x0c, 0x58, 0x17, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x97, 0xb9, 0x62, 0x5d, 0x06, 0x94, 0xfb, \
+  0x9a, 0x6c, 0x8a, 0x40, 0xce, 0x7b, 0xf6, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xb8, 0xeb, \
+  0x32, 0x3a, 0x2f, 0xc0, 0x86, 0xbf, 0xc9, 0x29, 0x6d, 0x89, 0xe8, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x0b, 0x88, 0xb2, 0xe9, 0x0f, 0xec, 0x2f, 0x3e, 0x98, 0x6e, 0x70, 0x6f, 0x59, 0x9b, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr2_4 148u
+#define TYPE_MAP_CDR_XSpaceEnumMin_wr2_4 (const unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xd1, 0x07, 0xd7, 0x4c, 0x63, 0x70, 0x4e, \
+  0xf9, 0x28, 0x28, 0xa3, 0x0c, 0x58, 0x17, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x97, 0xb9, 0x62, 0x5d, 0x06, \
+  0x94, 0xfb, 0x9a, 0x6c, 0x8a, 0x40, 0xce, 0x7b, 0xf6, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x97, 0xb9, \
+  0x62, 0x5d, 0x06, 0x94, 0xfb, 0x9a, 0x6c, 0x8a, 0x40, 0xce, 0x7b, 0xf6, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xb8, 0xeb, 0x32, 0x3a, 0x2f, 0xc0, 0x86, 0xbf, 0xc9, 0x29, \
+  0x6d, 0x89, 0xe8, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x0b, 0x88, 0xb2, 0xe9, 0x0f, 0xec, 0x2f, 0x3e, 0x98, 0x6e, 0x70, 0x6f, 0x59, \
+  0x9b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x88, \
+  0xb2, 0xe9, 0x0f, 0xec, 0x2f, 0x3e, 0x98, 0x6e, 0x70, 0x6f, 0x59, 0x9b, 0x69, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x65, \
+  0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xb8, 0xeb, 0x32, 0x3a, 0x2f, 0xc0, 0x86, 0xbf, 0xc9, 0x29, \
+  0x6d, 0x89, 0xe8, 0xf1, 0xd1, 0x07, 0xd7, 0x4c, 0x63, 0x70, 0x4e, 0xf9, 0x28, 0x28, 0xa3, 0x0c, \
+  0x58, 0x17, 0xf2, 0x0b, 0x88, 0xb2, 0xe9, 0x0f, 0xec, 0x2f, 0x3e, 0x98, 0x6e, 0x70, 0x6f, 0x59, \
+  0x9b, 0xf1, 0x97, 0xb9, 0x62, 0x5d, 0x06, 0x94, 0xfb, 0x9a, 0x6c, 0x8a, 0x40, 0xce, 0x7b, 0xf6\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr2_4 464u
+const dds_topic_descriptor_t XSpaceEnumMin_wr2_4_desc =
+{
+  .m_size = sizeof (XSpaceEnumMin_wr2_4),
+  .m_align = dds_alignof (XSpaceEnumMin_wr2_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumMin::wr2_4",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumMin_wr2_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumMin_wr2_4, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr2_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumMin_wr2_4, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr2_4 }
+};
+
+static const uint32_t XSpaceEnumLabel_wr1_5_ops [] =
+{
+  /* wr1_5 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumLabel_wr1_5, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bb50fc1f61314dd9b5227e12513a] (#deps: 1)
+   - [MINIMAL d9f7b44fc09206168c0bfb6c1738]
+  [COMPLETE e27c8495df45af09f31bac40b150] (#deps: 1)
+   - [COMPLETE a4be33b90107363d95dec675c548]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumLabel_wr1_5 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x50, 0xfc, 0x1f, 0x61, 0x31, 0x4d, 0xd9, 0xb5, 0x22, 0x7e, \
+  0x12, 0x51, 0x3a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd9, 0xf7, 0xb4, 0x4f, 0xc0, 0x92, 0x06, \
+  0x16, 0x8c, 0x0b, 0xfb, 0x6c, 0x17, 0x38, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x7c, 0x84, \
+  0x95, 0xdf, 0x45, 0xaf, 0x09, 0xf3, 0x1b, 0xac, 0x40, 0xb1, 0x50, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa4, 0xbe, 0x33, 0xb9, 0x01, 0x07, 0x36, 0x3d, 0x95, 0xde, 0xc6, 0x75, 0xc5, 0x48, 0x00, \
+  0x8d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr1_5 148u
+#define TYPE_MAP_CDR_XSpaceEnumLabel_wr1_5 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x50, 0xfc, 0x1f, 0x61, 0x31, 0x4d, \
+  0xd9, 0xb5, 0x22, 0x7e, 0x12, 0x51, 0x3a, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd9, 0xf7, 0xb4, 0x4f, 0xc0, \
+  0x92, 0x06, 0x16, 0x8c, 0x0b, 0xfb, 0x6c, 0x17, 0x38, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xd9, 0xf7, \
+  0xb4, 0x4f, 0xc0, 0x92, 0x06, 0x16, 0x8c, 0x0b, 0xfb, 0x6c, 0x17, 0x38, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x59, 0x8a, 0xb8, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x7c, 0x84, 0x95, 0xdf, 0x45, 0xaf, \
+  0x09, 0xf3, 0x1b, 0xac, 0x40, 0xb1, 0x50, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x77, 0x72, 0x31, \
+  0x5f, 0x35, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa4, 0xbe, 0x33, 0xb9, 0x01, 0x07, 0x36, 0x3d, 0x95, \
+  0xde, 0xc6, 0x75, 0xc5, 0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xa4, 0xbe, 0x33, 0xb9, 0x01, 0x07, 0x36, 0x3d, 0x95, 0xde, 0xc6, 0x75, 0xc5, 0x48, \
+  0x89, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, \
+  0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x6c, 0x61, 0x62, 0x65, \
+  0x6c, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x46, 0x46, 0x46, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x7c, 0x84, 0x95, 0xdf, 0x45, 0xaf, \
+  0x09, 0xf3, 0x1b, 0xac, 0x40, 0xb1, 0x50, 0xf1, 0xbb, 0x50, 0xfc, 0x1f, 0x61, 0x31, 0x4d, 0xd9, \
+  0xb5, 0x22, 0x7e, 0x12, 0x51, 0x3a, 0xf2, 0xa4, 0xbe, 0x33, 0xb9, 0x01, 0x07, 0x36, 0x3d, 0x95, \
+  0xde, 0xc6, 0x75, 0xc5, 0x48, 0xf1, 0xd9, 0xf7, 0xb4, 0x4f, 0xc0, 0x92, 0x06, 0x16, 0x8c, 0x0b, \
+  0xfb, 0x6c, 0x17, 0x38\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr1_5 516u
+const dds_topic_descriptor_t XSpaceEnumLabel_wr1_5_desc =
+{
+  .m_size = sizeof (XSpaceEnumLabel_wr1_5),
+  .m_align = dds_alignof (XSpaceEnumLabel_wr1_5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumLabel::wr1_5",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumLabel_wr1_5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumLabel_wr1_5, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr1_5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumLabel_wr1_5, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr1_5 }
+};
+
+static const uint32_t XSpaceEnumLabel_wr2_5_ops [] =
+{
+  /* wr2_5 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumLabel_wr2_5, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b87f6724514d4da294f54ba6411f] (#deps: 1)
+   - [MINIMAL 40633ea3b3a84231b894f1b9609c]
+  [COMPLETE 71f1aa84d013d02704701acd5cc8] (#deps: 1)
+   - [COMPLETE 3afb5098c0e2a927937bec36c446]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumLabel_wr2_5 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb8, 0x7f, 0x67, 0x24, 0x51, 0x4d, 0x4d, 0xa2, 0x94, 0xf5, 0x4b, \
+  0xa6, 0x41, 0x1f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x63, 0x3e, 0xa3, 0xb3, 0xa8, 0x42, \
+  0x31, 0xb8, 0x94, 0xf1, 0xb9, 0x60, 0x9c, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xf1, 0xaa, \
+  0x84, 0xd0, 0x13, 0xd0, 0x27, 0x04, 0x70, 0x1a, 0xcd, 0x5c, 0xc8, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3a, 0xfb, 0x50, 0x98, 0xc0, 0xe2, 0xa9, 0x27, 0x93, 0x7b, 0xec, 0x36, 0xc4, 0x46, 0x00, \
+  0x8d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr2_5 148u
+#define TYPE_MAP_CDR_XSpaceEnumLabel_wr2_5 (const unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xb8, 0x7f, 0x67, 0x24, 0x51, 0x4d, 0x4d, \
+  0xa2, 0x94, 0xf5, 0x4b, 0xa6, 0x41, 0x1f, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x40, 0x63, 0x3e, 0xa3, 0xb3, \
+  0xa8, 0x42, 0x31, 0xb8, 0x94, 0xf1, 0xb9, 0x60, 0x9c, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x40, 0x63, \
+  0x3e, 0xa3, 0xb3, 0xa8, 0x42, 0x31, 0xb8, 0x94, 0xf1, 0xb9, 0x60, 0x9c, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xfb, 0x77, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xf1, 0xaa, 0x84, 0xd0, 0x13, 0xd0, \
+  0x27, 0x04, 0x70, 0x1a, 0xcd, 0x5c, 0xc8, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x77, 0x72, 0x32, \
+  0x5f, 0x35, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3a, 0xfb, 0x50, 0x98, 0xc0, 0xe2, 0xa9, 0x27, 0x93, \
+  0x7b, 0xec, 0x36, 0xc4, 0x46, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x3a, 0xfb, 0x50, 0x98, 0xc0, 0xe2, 0xa9, 0x27, 0x93, 0x7b, 0xec, 0x36, 0xc4, 0x46, \
+  0x89, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, \
+  0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x6c, 0x61, 0x62, 0x65, \
+  0x6c, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xf1, 0xaa, 0x84, 0xd0, 0x13, 0xd0, \
+  0x27, 0x04, 0x70, 0x1a, 0xcd, 0x5c, 0xc8, 0xf1, 0xb8, 0x7f, 0x67, 0x24, 0x51, 0x4d, 0x4d, 0xa2, \
+  0x94, 0xf5, 0x4b, 0xa6, 0x41, 0x1f, 0xf2, 0x3a, 0xfb, 0x50, 0x98, 0xc0, 0xe2, 0xa9, 0x27, 0x93, \
+  0x7b, 0xec, 0x36, 0xc4, 0x46, 0xf1, 0x40, 0x63, 0x3e, 0xa3, 0xb3, 0xa8, 0x42, 0x31, 0xb8, 0x94, \
+  0xf1, 0xb9, 0x60, 0x9c\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr2_5 516u
+const dds_topic_descriptor_t XSpaceEnumLabel_wr2_5_desc =
+{
+  .m_size = sizeof (XSpaceEnumLabel_wr2_5),
+  .m_align = dds_alignof (XSpaceEnumLabel_wr2_5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumLabel::wr2_5",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumLabel_wr2_5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumLabel_wr2_5, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr2_5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumLabel_wr2_5, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr2_5 }
+};
+
@@ -0,0 +1,457 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/XSpaceMustUnderstand.c
+  Source: /root/repo/src/core/ddsc/tests/XSpaceMustUnderstand.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpaceMustUnderstand.h"
+
+static const uint32_t XSpaceMustUnderstand_rd1_ops [] =
+{
+  /* rd1 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_rd1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE 77439bc2536e32fca576ddb12713] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_rd1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x43, 0x9b, 0xc2, 0x53, 0x6e, 0x32, 0xfc, 0xa5, 0x76, 0xdd, \
+  0xb1, 0x27, 0x13, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_rd1 100u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_rd1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x77, 0x43, 0x9b, 0xc2, 0x53, 0x6e, 0x32, \
+  0xfc, 0xa5, 0x76, 0xdd, 0xb1, 0x27, 0x13, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x72, 0x64, 0x31, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x77, 0x43, 0x9b, 0xc2, 0x53, 0x6e, 0x32, 0xfc, 0xa5, 0x76, 0xdd, 0xb1, 0x27, 0x13, 0xf1, \
+  0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_rd1 206u
+const dds_topic_descriptor_t XSpaceMustUnderstand_rd1_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_rd1),
+  .m_align = dds_alignof (XSpaceMustUnderstand_rd1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::rd1",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceMustUnderstand_rd1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_rd1, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_rd1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_rd1, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_rd1 }
+};
+
+static const uint32_t XSpaceMustUnderstand_wr1_1_ops [] =
+{
+  /* wr1_1 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_1, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_1, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 84144485f2b274d966457b9eb5df] (#deps: 0)
+  [COMPLETE bf8c074204dd057693f72af1239a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x14, 0x44, 0x85, 0xf2, 0xb2, 0x74, 0xd9, 0x66, 0x45, 0x7b, \
+  0x9e, 0xb5, 0xdf, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0x8c, 0x07, 0x42, 0x04, 0xdd, 0x05, 0x76, 0x93, 0xf7, 0x2a, \
+  0xf1, 0x23, 0x9a, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_1 100u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_1 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x14, 0x44, 0x85, 0xf2, 0xb2, 0x74, \
+  0xd9, 0x66, 0x45, 0x7b, 0x9e, 0xb5, 0xdf, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0x8c, 0x07, 0x42, 0x04, 0xdd, 0x05, \
+  0x76, 0x93, 0xf7, 0x2a, 0xf1, 0x23, 0x9a, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x31, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbf, 0x8c, 0x07, 0x42, 0x04, 0xdd, 0x05, \
+  0x76, 0x93, 0xf7, 0x2a, 0xf1, 0x23, 0x9a, 0xf1, 0x84, 0x14, 0x44, 0x85, 0xf2, 0xb2, 0x74, 0xd9, \
+  0x66, 0x45, 0x7b, 0x9e, 0xb5, 0xdf\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_1 246u
+const dds_topic_descriptor_t XSpaceMustUnderstand_wr1_1_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_wr1_1),
+  .m_align = dds_alignof (XSpaceMustUnderstand_wr1_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::wr1_1",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpaceMustUnderstand_wr1_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_1, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_1, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_1 }
+};
+
+static const uint32_t XSpaceMustUnderstand_wr1_2_ops [] =
+{
+  /* wr1_2 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 4f648aa777bf1cb3e939c9935459] (#deps: 0)
+  [COMPLETE 1d929c9eea27b15995cfa975c972] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x64, 0x8a, 0xa7, 0x77, 0xbf, 0x1c, 0xb3, 0xe9, 0x39, 0xc9, \
+  0x93, 0x54, 0x59, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x1d, 0x92, 0x9c, 0x9e, 0xea, 0x27, 0xb1, 0x59, 0x95, 0xcf, 0xa9, \
+  0x75, 0xc9, 0x72, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_2 100u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_2 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0x64, 0x8a, 0xa7, 0x77, 0xbf, 0x1c, \
+  0xb3, 0xe9, 0x39, 0xc9, 0x93, 0x54, 0x59, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x1d, 0x92, 0x9c, 0x9e, 0xea, 0x27, 0xb1, \
+  0x59, 0x95, 0xcf, 0xa9, 0x75, 0xc9, 0x72, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x32, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x1d, 0x92, 0x9c, 0x9e, 0xea, 0x27, 0xb1, 0x59, 0x95, 0xcf, 0xa9, 0x75, 0xc9, 0x72, 0xf1, \
+  0x4f, 0x64, 0x8a, 0xa7, 0x77, 0xbf, 0x1c, 0xb3, 0xe9, 0x39, 0xc9, 0x93, 0x54, 0x59\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_2 206u
+const dds_topic_descriptor_t XSpaceMustUnderstand_wr1_2_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_wr1_2),
+  .m_align = dds_alignof (XSpaceMustUnderstand_wr1_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::wr1_2",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceMustUnderstand_wr1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_2, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_2, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_2 }
+};
+
+static const uint32_t XSpaceMustUnderstand_wr1_3_ops [] =
+{
+  /* wr1_3 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_3, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_3, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL cba4a10804cfdc48ccdb140ca35c] (#deps: 0)
+  [COMPLETE b5d71823d8dbb0b259e9d2ef493f] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0xa4, 0xa1, 0x08, 0x04, 0xcf, 0xdc, 0x48, 0xcc, 0xdb, 0x14, \
+  0x0c, 0xa3, 0x5c, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xd7, 0x18, 0x23, 0xd8, 0xdb, 0xb0, 0xb2, 0x59, 0xe9, 0xd2, \
+  0xef, 0x49, 0x3f, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_3 100u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_3 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xcb, 0xa4, 0xa1, 0x08, 0x04, 0xcf, 0xdc, \
+  0x48, 0xcc, 0xdb, 0x14, 0x0c, 0xa3, 0x5c, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xd7, 0x18, 0x23, 0xd8, 0xdb, 0xb0, \
+  0xb2, 0x59, 0xe9, 0xd2, 0xef, 0x49, 0x3f, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x33, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0xd7, 0x18, 0x23, 0xd8, 0xdb, 0xb0, \
+  0xb2, 0x59, 0xe9, 0xd2, 0xef, 0x49, 0x3f, 0xf1, 0xcb, 0xa4, 0xa1, 0x08, 0x04, 0xcf, 0xdc, 0x48, \
+  0xcc, 0xdb, 0x14, 0x0c, 0xa3, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_3 246u
+const dds_topic_descriptor_t XSpaceMustUnderstand_wr1_3_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_wr1_3),
+  .m_align = dds_alignof (XSpaceMustUnderstand_wr1_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::wr1_3",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpaceMustUnderstand_wr1_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_3, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_3, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_3 }
+};
+
+static const uint32_t XSpaceMustUnderstand_wr1_4_ops [] =
+{
+  /* wr1_4 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_wr1_4, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e4b1c4cbd714511dacd9da37d34e] (#deps: 0)
+  [COMPLETE 9c4e1ac8cf07c45a92cf87e38600] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_4 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe4, 0xb1, 0xc4, 0xcb, 0xd7, 0x14, 0x51, 0x1d, 0xac, 0xd9, 0xda, \
+  0x37, 0xd3, 0x4e, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x4e, 0x1a, 0xc8, 0xcf, 0x07, 0xc4, 0x5a, 0x92, 0xcf, 0x87, \
+  0xe3, 0x86, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_4 100u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_4 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe4, 0xb1, 0xc4, 0xcb, 0xd7, 0x14, 0x51, \
+  0x1d, 0xac, 0xd9, 0xda, 0x37, 0xd3, 0x4e, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x9c, 0x4e, 0x1a, 0xc8, 0xcf, 0x07, 0xc4, \
+  0x5a, 0x92, 0xcf, 0x87, 0xe3, 0x86, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x34, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x9c, 0x4e, 0x1a, 0xc8, 0xcf, 0x07, 0xc4, 0x5a, 0x92, 0xcf, 0x87, 0xe3, 0x86, 0x00, 0xf1, \
+  0xe4, 0xb1, 0xc4, 0xcb, 0xd7, 0x14, 0x51, 0x1d, 0xac, 0xd9, 0xda, 0x37, 0xd3, 0x4e\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_4 206u
+const dds_topic_descriptor_t XSpaceMustUnderstand_wr1_4_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_wr1_4),
+  .m_align = dds_alignof (XSpaceMustUnderstand_wr1_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::wr1_4",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceMustUnderstand_wr1_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_wr1_4, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr1_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_wr1_4, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr1_4 }
+};
+
+static const uint32_t XSpaceMustUnderstand_rd2_ops [] =
+{
+  /* rd2 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpaceMustUnderstand_rd2, f1), (3u << 16u) + 4u /* n2 */,
+  DDS_OP_RTS,
+
+  /* n2 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_n2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0d9e81c5e0e307f712b138fdca1d] (#deps: 1)
+   - [MINIMAL 35d1c05c2a091c52dacc29855659]
+  [COMPLETE a8b349cea290e92050e3c7f1b69f] (#deps: 1)
+   - [COMPLETE d368e4a53acf3f92db0db8e25f48]
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_rd2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0d, 0x9e, 0x81, 0xc5, 0xe0, 0xe3, 0x07, 0xf7, 0x12, 0xb1, 0x38, \
+  0xfd, 0xca, 0x1d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x35, 0xd1, 0xc0, 0x5c, 0x2a, 0x09, 0x1c, \
+  0x52, 0xda, 0xcc, 0x29, 0x85, 0x56, 0x59, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xa8, 0xb3, 0x49, \
+  0xce, 0xa2, 0x90, 0xe9, 0x20, 0x50, 0xe3, 0xc7, 0xf1, 0xb6, 0x9f, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd3, 0x68, 0xe4, 0xa5, 0x3a, 0xcf, 0x3f, 0x92, 0xdb, 0x0d, 0xb8, 0xe2, 0x5f, 0x48, 0x00, \
+  0x4d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_rd2 148u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_rd2 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x0d, 0x9e, 0x81, 0xc5, 0xe0, 0xe3, 0x07, \
+  0xf7, 0x12, 0xb1, 0x38, 0xfd, 0xca, 0x1d, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x35, 0xd1, 0xc0, 0x5c, 0x2a, \
+  0x09, 0x1c, 0x52, 0xda, 0xcc, 0x29, 0x85, 0x56, 0x59, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x35, 0xd1, \
+  0xc0, 0x5c, 0x2a, 0x09, 0x1c, 0x52, 0xda, 0xcc, 0x29, 0x85, 0x56, 0x59, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xa8, 0xb3, 0x49, \
+  0xce, 0xa2, 0x90, 0xe9, 0x20, 0x50, 0xe3, 0xc7, 0xf1, 0xb6, 0x9f, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, \
+  0x74, 0x61, 0x6e, 0x64, 0x3a, 0x3a, 0x72, 0x64, 0x32, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd3, \
+  0x68, 0xe4, 0xa5, 0x3a, 0xcf, 0x3f, 0x92, 0xdb, 0x0d, 0xb8, 0xe2, 0x5f, 0x48, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xd3, 0x68, 0xe4, 0xa5, 0x3a, 0xcf, \
+  0x3f, 0x92, 0xdb, 0x0d, 0xb8, 0xe2, 0x5f, 0x48, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xa8, 0xb3, 0x49, 0xce, 0xa2, 0x90, 0xe9, 0x20, 0x50, 0xe3, 0xc7, 0xf1, 0xb6, 0x9f, 0xf1, \
+  0x0d, 0x9e, 0x81, 0xc5, 0xe0, 0xe3, 0x07, 0xf7, 0x12, 0xb1, 0x38, 0xfd, 0xca, 0x1d, 0xf2, 0xd3, \
+  0x68, 0xe4, 0xa5, 0x3a, 0xcf, 0x3f, 0x92, 0xdb, 0x0d, 0xb8, 0xe2, 0x5f, 0x48, 0xf1, 0x35, 0xd1, \
+  0xc0, 0x5c, 0x2a, 0x09, 0x1c, 0x52, 0xda, 0xcc, 0x29, 0x85, 0x56, 0x59\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_rd2 412u
+const dds_topic_descriptor_t XSpaceMustUnderstand_rd2_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_rd2),
+  .m_align = dds_alignof (XSpaceMustUnderstand_rd2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::rd2",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpaceMustUnderstand_rd2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_rd2, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_rd2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_rd2, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_rd2 }
+};
+
+static const uint32_t XSpaceMustUnderstand_wr2_1_ops [] =
+{
+  /* wr2_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (XSpaceMustUnderstand_wr2_1, f1), (3u << 16u) + 4u /* n2_mu */,
+  DDS_OP_RTS,
+
+  /* n2_mu */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_n2_mu, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceMustUnderstand_n2_mu, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a71b71c775fba76d5ee1203aa3c1] (#deps: 1)
+   - [MINIMAL f182132db511e939d84d98e58189]
+  [COMPLETE f95cc56c799ec3b9db27333e2b05] (#deps: 1)
+   - [COMPLETE 4cfc011193f18db0d64fa1296bdf]
+*/
+#define TYPE_INFO_CDR_XSpaceMustUnderstand_wr2_1 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa7, 0x1b, 0x71, 0xc7, 0x75, 0xfb, 0xa7, 0x6d, 0x5e, 0xe1, 0x20, \
+  0x3a, 0xa3, 0xc1, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0x82, 0x13, 0x2d, 0xb5, 0x11, 0xe9, \
+  0x39, 0xd8, 0x4d, 0x98, 0xe5, 0x81, 0x89, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xc5, \
+  0x6c, 0x79, 0x9e, 0xc3, 0xb9, 0xdb, 0x27, 0x33, 0x3e, 0x2b, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x4c, 0xfc, 0x01, 0x11, 0x93, 0xf1, 0x8d, 0xb0, 0xd6, 0x4f, 0xa1, 0x29, 0x6b, 0xdf, 0x00, \
+  0x65, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr2_1 148u
+#define TYPE_MAP_CDR_XSpaceMustUnderstand_wr2_1 (const unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xa7, 0x1b, 0x71, 0xc7, 0x75, 0xfb, 0xa7, \
+  0x6d, 0x5e, 0xe1, 0x20, 0x3a, 0xa3, 0xc1, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf1, 0x82, 0x13, 0x2d, 0xb5, \
+  0x11, 0xe9, 0x39, 0xd8, 0x4d, 0x98, 0xe5, 0x81, 0x89, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xf1, 0x82, \
+  0x13, 0x2d, 0xb5, 0x11, 0xe9, 0x39, 0xd8, 0x4d, 0x98, 0xe5, 0x81, 0x89, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x04, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xc5, \
+  0x6c, 0x79, 0x9e, 0xc3, 0xb9, 0xdb, 0x27, 0x33, 0x3e, 0x2b, 0x05, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, \
+  0x74, 0x61, 0x6e, 0x64, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x31, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x4c, \
+  0xfc, 0x01, 0x11, 0x93, 0xf1, 0x8d, 0xb0, 0xd6, 0x4f, 0xa1, 0x29, 0x6b, 0xdf, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0xfc, 0x01, 0x11, 0x93, 0xf1, \
+  0x8d, 0xb0, 0xd6, 0x4f, 0xa1, 0x29, 0x6b, 0xdf, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x0c, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x4d, 0x75, 0x73, 0x74, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x74, 0x61, 0x6e, 0x64, \
+  0x3a, 0x3a, 0x6e, 0x32, 0x5f, 0x6d, 0x75, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x5c, 0xc5, 0x6c, 0x79, 0x9e, 0xc3, \
+  0xb9, 0xdb, 0x27, 0x33, 0x3e, 0x2b, 0x05, 0xf1, 0xa7, 0x1b, 0x71, 0xc7, 0x75, 0xfb, 0xa7, 0x6d, \
+  0x5e, 0xe1, 0x20, 0x3a, 0xa3, 0xc1, 0xf2, 0x4c, 0xfc, 0x01, 0x11, 0x93, 0xf1, 0x8d, 0xb0, 0xd6, \
+  0x4f, 0xa1, 0x29, 0x6b, 0xdf, 0xf1, 0xf1, 0x82, 0x13, 0x2d, 0xb5, 0x11, 0xe9, 0x39, 0xd8, 0x4d, \
+  0x98, 0xe5, 0x81, 0x89\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr2_1 452u
+const dds_topic_descriptor_t XSpaceMustUnderstand_wr2_1_desc =
+{
+  .m_size = sizeof (XSpaceMustUnderstand_wr2_1),
+  .m_align = dds_alignof (XSpaceMustUnderstand_wr2_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceMustUnderstand::wr2_1",
+  .m_keys = NULL,
+  .m_nops = 8,
+  .m_ops = XSpaceMustUnderstand_wr2_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceMustUnderstand_wr2_1, .sz = TYPE_INFO_CDR_SZ_XSpaceMustUnderstand_wr2_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceMustUnderstand_wr2_1, .sz = TYPE_MAP_CDR_SZ_XSpaceMustUnderstand_wr2_1 }
+};
+
@@ -0,0 +1,30 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/XSpaceNoTypeInfo.c
+  Source: /root/repo/src/core/ddsc/tests/XSpaceNoTypeInfo.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpaceNoTypeInfo.h"
+
+static const uint32_t XSpaceNoTypeInfo_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceNoTypeInfo_t1, long_1),
+  DDS_OP_RTS
+};
+
+const dds_topic_descriptor_t XSpaceNoTypeInfo_t1_desc =
+{
+  .m_size = sizeof (XSpaceNoTypeInfo_t1),
+  .m_align = dds_alignof (XSpaceNoTypeInfo_t1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceNoTypeInfo::t1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceNoTypeInfo_t1_ops,
+  .m_meta = ""
+};
+
@@ -0,0 +1,1035 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.c
+  Source: /root/repo/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpaceTypeConsistencyEnforcement.h"
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t1_1_ops [] =
+{
+  /* t1_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t1_1, f1), 5u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5c84762000545c754504d390fc31] (#deps: 0)
+  [COMPLETE d49c6782f6cbc9dc51a640e2fe91] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0x84, 0x76, 0x20, 0x00, 0x54, 0x5c, 0x75, 0x45, 0x04, 0xd3, \
+  0x90, 0xfc, 0x31, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0x9c, 0x67, 0x82, 0xf6, 0xcb, 0xc9, 0xdc, 0x51, 0xa6, 0x40, \
+  0xe2, 0xfe, 0x91, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_1 (const unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x5c, 0x84, 0x76, 0x20, 0x00, 0x54, 0x5c, \
+  0x75, 0x45, 0x04, 0xd3, 0x90, 0xfc, 0x31, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0x9c, 0x67, \
+  0x82, 0xf6, 0xcb, 0xc9, 0xdc, 0x51, 0xa6, 0x40, 0xe2, 0xfe, 0x91, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, \
+  0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, \
+  0x3a, 0x3a, 0x74, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x05, 0x04, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xd4, 0x9c, 0x67, 0x82, 0xf6, 0xcb, 0xc9, 0xdc, 0x51, 0xa6, 0x40, \
+  0xe2, 0xfe, 0x91, 0xf1, 0x5c, 0x84, 0x76, 0x20, 0x00, 0x54, 0x5c, 0x75, 0x45, 0x04, 0xd3, 0x90, \
+  0xfc, 0x31\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_1 226u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t1_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t1_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t1_1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t1_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t1_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t1_2_ops [] =
+{
+  /* t1_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t1_2, f1), 10u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c02e6f8614cb24a400fac8046274] (#deps: 0)
+  [COMPLETE cb2f146c2954f65f0e9f1cbdd769] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc0, 0x2e, 0x6f, 0x86, 0x14, 0xcb, 0x24, 0xa4, 0x00, 0xfa, 0xc8, \
+  0x04, 0x62, 0x74, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x2f, 0x14, 0x6c, 0x29, 0x54, 0xf6, 0x5f, 0x0e, 0x9f, 0x1c, \
+  0xbd, 0xd7, 0x69, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_2 (const unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc0, 0x2e, 0x6f, 0x86, 0x14, 0xcb, 0x24, \
+  0xa4, 0x00, 0xfa, 0xc8, 0x04, 0x62, 0x74, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x0a, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x2f, 0x14, \
+  0x6c, 0x29, 0x54, 0xf6, 0x5f, 0x0e, 0x9f, 0x1c, 0xbd, 0xd7, 0x69, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, \
+  0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, \
+  0x3a, 0x3a, 0x74, 0x31, 0x5f, 0x32, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x0a, 0x04, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xcb, 0x2f, 0x14, 0x6c, 0x29, 0x54, 0xf6, 0x5f, 0x0e, 0x9f, 0x1c, \
+  0xbd, 0xd7, 0x69, 0xf1, 0xc0, 0x2e, 0x6f, 0x86, 0x14, 0xcb, 0x24, 0xa4, 0x00, 0xfa, 0xc8, 0x04, \
+  0x62, 0x74\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_2 226u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t1_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t1_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t1_2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t1_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t1_3_ops [] =
+{
+  /* t1_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t1_3, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 496bd415ff7e9c8371a9e454906a] (#deps: 0)
+  [COMPLETE aec9a5eecc5a75551a49a6120992] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, \
+  0x54, 0x90, 0x6a, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xae, 0xc9, 0xa5, 0xee, 0xcc, 0x5a, 0x75, 0x55, 0x1a, 0x49, 0xa6, \
+  0x12, 0x09, 0x92, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_3 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_3 (const unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, \
+  0x83, 0x71, 0xa9, 0xe4, 0x54, 0x90, 0x6a, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xae, 0xc9, 0xa5, \
+  0xee, 0xcc, 0x5a, 0x75, 0x55, 0x1a, 0x49, 0xa6, 0x12, 0x09, 0x92, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, \
+  0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, \
+  0x3a, 0x3a, 0x74, 0x31, 0x5f, 0x33, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xae, 0xc9, 0xa5, 0xee, 0xcc, 0x5a, 0x75, 0x55, 0x1a, 0x49, 0xa6, \
+  0x12, 0x09, 0x92, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, 0x54, \
+  0x90, 0x6a\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_3 226u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t1_3_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t1_3),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t1_3),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t1_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t1_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t1_3, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t1_3, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t1_3 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t2_1_ops [] =
+{
+  /* t2_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (XSpaceTypeConsistencyEnforcement_t2_1, f1), 6u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b5cec2b90cc9ae6c260142d8d5c3] (#deps: 0)
+  [COMPLETE 7f803fc21e55d292fc8a9af81e10] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, 0x0c, 0xc9, 0xae, 0x6c, 0x26, 0x01, 0x42, \
+  0xd8, 0xd5, 0xc3, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x7f, 0x80, 0x3f, 0xc2, 0x1e, 0x55, 0xd2, 0x92, 0xfc, 0x8a, 0x9a, \
+  0xf8, 0x1e, 0x10, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_1 (const unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, 0x0c, 0xc9, 0xae, \
+  0x6c, 0x26, 0x01, 0x42, 0xd8, 0xd5, 0xc3, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, 0xbd, 0x19, 0x83, 0x6d, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7f, 0x80, 0x3f, 0xc2, 0x1e, 0x55, 0xd2, \
+  0x92, 0xfc, 0x8a, 0x9a, 0xf8, 0x1e, 0x10, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x32, \
+  0x5f, 0x31, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7f, 0x80, 0x3f, \
+  0xc2, 0x1e, 0x55, 0xd2, 0x92, 0xfc, 0x8a, 0x9a, 0xf8, 0x1e, 0x10, 0xf1, 0xb5, 0xce, 0xc2, 0xb9, \
+  0x0c, 0xc9, 0xae, 0x6c, 0x26, 0x01, 0x42, 0xd8, 0xd5, 0xc3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_1 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t2_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t2_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t2_1),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t2_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t2_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t2_2_ops [] =
+{
+  /* t2_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (XSpaceTypeConsistencyEnforcement_t2_2, f1), 11u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 9d26ad5188083f88ef1c2f112ba7] (#deps: 0)
+  [COMPLETE a5069cef387d7b7e42f7ec10e322] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x9d, 0x26, 0xad, 0x51, 0x88, 0x08, 0x3f, 0x88, 0xef, 0x1c, 0x2f, \
+  0x11, 0x2b, 0xa7, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x06, 0x9c, 0xef, 0x38, 0x7d, 0x7b, 0x7e, 0x42, 0xf7, 0xec, \
+  0x10, 0xe3, 0x22, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_2 (const unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x9d, 0x26, 0xad, 0x51, 0x88, 0x08, 0x3f, \
+  0x88, 0xef, 0x1c, 0x2f, 0x11, 0x2b, 0xa7, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0xbd, 0x19, 0x83, 0x6d, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x06, 0x9c, 0xef, 0x38, 0x7d, 0x7b, \
+  0x7e, 0x42, 0xf7, 0xec, 0x10, 0xe3, 0x22, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x32, \
+  0x5f, 0x32, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa5, 0x06, 0x9c, \
+  0xef, 0x38, 0x7d, 0x7b, 0x7e, 0x42, 0xf7, 0xec, 0x10, 0xe3, 0x22, 0xf1, 0x9d, 0x26, 0xad, 0x51, \
+  0x88, 0x08, 0x3f, 0x88, 0xef, 0x1c, 0x2f, 0x11, 0x2b, 0xa7\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_2 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t2_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t2_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t2_2),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t2_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t2_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t2_3_ops [] =
+{
+  /* t2_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (XSpaceTypeConsistencyEnforcement_t2_3, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d312da0775747bc77f062064d85c] (#deps: 0)
+  [COMPLETE 12f8bad0e8a77e028a557e9895b6] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, 0xc7, 0x7f, 0x06, 0x20, \
+  0x64, 0xd8, 0x5c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xf8, 0xba, 0xd0, 0xe8, 0xa7, 0x7e, 0x02, 0x8a, 0x55, 0x7e, \
+  0x98, 0x95, 0xb6, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_3 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_3 (const unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, \
+  0xc7, 0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xbd, 0x19, 0x83, 0x6d, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xf8, 0xba, 0xd0, 0xe8, 0xa7, 0x7e, \
+  0x02, 0x8a, 0x55, 0x7e, 0x98, 0x95, 0xb6, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x32, \
+  0x5f, 0x33, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xf8, 0xba, \
+  0xd0, 0xe8, 0xa7, 0x7e, 0x02, 0x8a, 0x55, 0x7e, 0x98, 0x95, 0xb6, 0xf1, 0xd3, 0x12, 0xda, 0x07, \
+  0x75, 0x74, 0x7b, 0xc7, 0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_3 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t2_3_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t2_3),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t2_3),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t2_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t2_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t2_3, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t2_3, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t2_3 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t3_1_ops [] =
+{
+  /* t3_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t3_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 247544daeea88e9565a105ac9204] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t3_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x75, 0x44, 0xda, 0xee, 0xa8, 0x8e, 0x95, 0x65, 0xa1, 0x05, \
+  0xac, 0x92, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t3_1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x75, 0x44, 0xda, 0xee, 0xa8, 0x8e, \
+  0x95, 0x65, 0xa1, 0x05, 0xac, 0x92, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x33, \
+  0x5f, 0x31, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x75, 0x44, \
+  0xda, 0xee, 0xa8, 0x8e, 0x95, 0x65, 0xa1, 0x05, 0xac, 0x92, 0x04, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_1 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t3_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t3_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t3_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t3_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t3_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t3_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t3_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t3_2_ops [] =
+{
+  /* t3_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t3_2, f1a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f868d719ffbe2a7274eee888f235] (#deps: 0)
+  [COMPLETE 8ef550eacc9b083f05b171e2d8c6] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t3_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf8, 0x68, 0xd7, 0x19, 0xff, 0xbe, 0x2a, 0x72, 0x74, 0xee, 0xe8, \
+  0x88, 0xf2, 0x35, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0xf5, 0x50, 0xea, 0xcc, 0x9b, 0x08, 0x3f, 0x05, 0xb1, 0x71, \
+  0xe2, 0xd8, 0xc6, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t3_2 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf8, 0x68, 0xd7, 0x19, 0xff, 0xbe, 0x2a, \
+  0x72, 0x74, 0xee, 0xe8, 0x88, 0xf2, 0x35, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x59, 0xeb, 0xb5, 0x70, 0x00, \
+  0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0xf5, 0x50, 0xea, 0xcc, 0x9b, 0x08, \
+  0x3f, 0x05, 0xb1, 0x71, 0xe2, 0xd8, 0xc6, 0x00, 0x56, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x33, \
+  0x5f, 0x32, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x61, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0xf5, 0x50, \
+  0xea, 0xcc, 0x9b, 0x08, 0x3f, 0x05, 0xb1, 0x71, 0xe2, 0xd8, 0xc6, 0xf1, 0xf8, 0x68, 0xd7, 0x19, \
+  0xff, 0xbe, 0x2a, 0x72, 0x74, 0xee, 0xe8, 0x88, 0xf2, 0x35\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_2 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t3_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t3_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t3_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t3_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t3_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t3_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t3_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t3_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t4_1_ops [] =
+{
+  /* t4_1 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t4_1, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpaceTypeConsistencyEnforcement_t4_1, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 6e08bdf9d28c50fea0d5d8a85aad] (#deps: 0)
+  [COMPLETE 32614859adb6bd017b93f1d36d8a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t4_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, 0xd2, 0x8c, 0x50, 0xfe, 0xa0, 0xd5, 0xd8, \
+  0xa8, 0x5a, 0xad, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x32, 0x61, 0x48, 0x59, 0xad, 0xb6, 0xbd, 0x01, 0x7b, 0x93, 0xf1, \
+  0xd3, 0x6d, 0x8a, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t4_1 (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, 0xd2, 0x8c, 0x50, \
+  0xfe, 0xa0, 0xd5, 0xd8, 0xa8, 0x5a, 0xad, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x81, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x32, 0x61, 0x48, 0x59, 0xad, 0xb6, 0xbd, 0x01, 0x7b, 0x93, 0xf1, \
+  0xd3, 0x6d, 0x8a, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, \
+  0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, \
+  0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x34, 0x5f, 0x31, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x32, 0x61, 0x48, \
+  0x59, 0xad, 0xb6, 0xbd, 0x01, 0x7b, 0x93, 0xf1, 0xd3, 0x6d, 0x8a, 0xf1, 0x6e, 0x08, 0xbd, 0xf9, \
+  0xd2, 0x8c, 0x50, 0xfe, 0xa0, 0xd5, 0xd8, 0xa8, 0x5a, 0xad\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_1 250u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t4_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t4_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t4_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t4_1",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t4_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t4_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t4_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t4_2_ops [] =
+{
+  /* t4_2 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t4_2, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpaceTypeConsistencyEnforcement_t4_2, _u.f1a), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 42da33c89edab2df17b7acdc7036] (#deps: 0)
+  [COMPLETE 9439cd9594f51127703b7b00e884] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t4_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xda, 0x33, 0xc8, 0x9e, 0xda, 0xb2, 0xdf, 0x17, 0xb7, 0xac, \
+  0xdc, 0x70, 0x36, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x39, 0xcd, 0x95, 0x94, 0xf5, 0x11, 0x27, 0x70, 0x3b, 0x7b, \
+  0x00, 0xe8, 0x84, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t4_2 (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xda, 0x33, 0xc8, 0x9e, 0xda, 0xb2, \
+  0xdf, 0x17, 0xb7, 0xac, 0xdc, 0x70, 0x36, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x59, 0xeb, 0xb5, 0x70, 0x82, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x39, 0xcd, 0x95, 0x94, 0xf5, 0x11, 0x27, 0x70, 0x3b, 0x7b, \
+  0x00, 0xe8, 0x84, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, \
+  0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, \
+  0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x34, 0x5f, 0x32, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x66, 0x31, 0x61, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x94, 0x39, 0xcd, \
+  0x95, 0x94, 0xf5, 0x11, 0x27, 0x70, 0x3b, 0x7b, 0x00, 0xe8, 0x84, 0xf1, 0x42, 0xda, 0x33, 0xc8, \
+  0x9e, 0xda, 0xb2, 0xdf, 0x17, 0xb7, 0xac, 0xdc, 0x70, 0x36\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_2 250u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t4_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t4_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t4_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t4_2",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t4_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t4_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t4_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t4_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t5_1_ops [] =
+{
+  /* t5_1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE f19f96711ef71820736ebee14af2] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, 0x20, 0x73, 0x6e, 0xbe, \
+  0xe1, 0x4a, 0xf2, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, \
+  0x20, 0x73, 0x6e, 0xbe, 0xe1, 0x4a, 0xf2, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x31, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x9f, 0x96, \
+  0x71, 0x1e, 0xf7, 0x18, 0x20, 0x73, 0x6e, 0xbe, 0xe1, 0x4a, 0xf2, 0xf1, 0x54, 0x72, 0xd8, 0x0f, \
+  0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_1 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t5_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t5_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t5_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t5_1",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t5_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t5_2_ops [] =
+{
+  /* t5_2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (XSpaceTypeConsistencyEnforcement_t5_2, parent), (3u << 16u) + 6u /* t5_1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_2, f2),
+  DDS_OP_RTS,
+
+  /* t5_1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 51c68b52c36ee12b9f42efb4169f] (#deps: 1)
+   - [MINIMAL 5472d80f8549173aaed47a3f5dd3]
+  [COMPLETE 12ba4378da27173f578656b07578] (#deps: 1)
+   - [COMPLETE f19f96711ef71820736ebee14af2]
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_2 (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x51, 0xc6, 0x8b, 0x52, 0xc3, 0x6e, 0xe1, 0x2b, 0x9f, 0x42, 0xef, \
+  0xb4, 0x16, 0x9f, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xba, 0x43, \
+  0x78, 0xda, 0x27, 0x17, 0x3f, 0x57, 0x86, 0x56, 0xb0, 0x75, 0x78, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, 0x20, 0x73, 0x6e, 0xbe, 0xe1, 0x4a, 0xf2, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_2 148u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_2 (const unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x51, 0xc6, 0x8b, 0x52, 0xc3, 0x6e, 0xe1, \
+  0x2b, 0x9f, 0x42, 0xef, 0xb4, 0x16, 0x9f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x54, 0x72, 0xd8, 0x0f, \
+  0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xba, 0x43, \
+  0x78, 0xda, 0x27, 0x17, 0x3f, 0x57, 0x86, 0x56, 0xb0, 0x75, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, \
+  0x20, 0x73, 0x6e, 0xbe, 0xe1, 0x4a, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, \
+  0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, \
+  0x3a, 0x3a, 0x74, 0x35, 0x5f, 0x32, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, 0x20, 0x73, 0x6e, \
+  0xbe, 0xe1, 0x4a, 0xf2, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, \
+  0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, \
+  0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x35, 0x5f, 0x31, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x12, 0xba, 0x43, 0x78, 0xda, 0x27, 0x17, \
+  0x3f, 0x57, 0x86, 0x56, 0xb0, 0x75, 0x78, 0xf1, 0x51, 0xc6, 0x8b, 0x52, 0xc3, 0x6e, 0xe1, 0x2b, \
+  0x9f, 0x42, 0xef, 0xb4, 0x16, 0x9f, 0xf2, 0xf1, 0x9f, 0x96, 0x71, 0x1e, 0xf7, 0x18, 0x20, 0x73, \
+  0x6e, 0xbe, 0xe1, 0x4a, 0xf2, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, \
+  0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_2 436u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t5_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t5_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t5_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t5_2",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t5_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t5_3_ops [] =
+{
+  /* t5_3 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_3, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_3, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8e2cdcc7448103cc6e37cb7a7044] (#deps: 0)
+  [COMPLETE 71a42eec121bf2973b89e857f68d] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_3 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x2c, 0xdc, 0xc7, 0x44, 0x81, 0x03, 0xcc, 0x6e, 0x37, 0xcb, \
+  0x7a, 0x70, 0x44, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xa4, 0x2e, 0xec, 0x12, 0x1b, 0xf2, 0x97, 0x3b, 0x89, 0xe8, \
+  0x57, 0xf6, 0x8d, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_3 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_3 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8e, 0x2c, 0xdc, 0xc7, 0x44, 0x81, 0x03, \
+  0xcc, 0x6e, 0x37, 0xcb, 0x7a, 0x70, 0x44, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xa4, 0x2e, 0xec, 0x12, 0x1b, 0xf2, \
+  0x97, 0x3b, 0x89, 0xe8, 0x57, 0xf6, 0x8d, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x33, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x71, 0xa4, 0x2e, 0xec, 0x12, 0x1b, 0xf2, 0x97, 0x3b, 0x89, 0xe8, \
+  0x57, 0xf6, 0x8d, 0xf1, 0x8e, 0x2c, 0xdc, 0xc7, 0x44, 0x81, 0x03, 0xcc, 0x6e, 0x37, 0xcb, 0x7a, \
+  0x70, 0x44\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_3 258u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t5_3_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t5_3),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t5_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t5_3",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t5_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_3, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_3, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_3 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t5_4_ops [] =
+{
+  /* t5_4 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_4, f1),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t5_4, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8f8ac2bb3ead32b5804660499247] (#deps: 0)
+  [COMPLETE 4a1336b2bbcd22724fecc06ac282] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_4 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x8a, 0xc2, 0xbb, 0x3e, 0xad, 0x32, 0xb5, 0x80, 0x46, 0x60, \
+  0x49, 0x92, 0x47, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x4a, 0x13, 0x36, 0xb2, 0xbb, 0xcd, 0x22, 0x72, 0x4f, 0xec, 0xc0, \
+  0x6a, 0xc2, 0x82, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_4 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_4 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x8a, 0xc2, 0xbb, 0x3e, 0xad, 0x32, \
+  0xb5, 0x80, 0x46, 0x60, 0x49, 0x92, 0x47, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x4a, 0x13, 0x36, 0xb2, 0xbb, 0xcd, 0x22, \
+  0x72, 0x4f, 0xec, 0xc0, 0x6a, 0xc2, 0x82, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x35, \
+  0x5f, 0x34, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x4a, 0x13, 0x36, 0xb2, 0xbb, 0xcd, 0x22, 0x72, 0x4f, 0xec, 0xc0, \
+  0x6a, 0xc2, 0x82, 0xf1, 0x8f, 0x8a, 0xc2, 0xbb, 0x3e, 0xad, 0x32, 0xb5, 0x80, 0x46, 0x60, 0x49, \
+  0x92, 0x47\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_4 258u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t5_4_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t5_4),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t5_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t5_4",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t5_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t5_4, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t5_4, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t5_4 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t6_1_ops [] =
+{
+  /* t6_1 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t6_1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE 3c507198eb0d34395fdac10d01cc] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t6_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3c, 0x50, 0x71, 0x98, 0xeb, 0x0d, 0x34, 0x39, 0x5f, 0xda, 0xc1, \
+  0x0d, 0x01, 0xcc, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t6_1 (const unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3c, 0x50, 0x71, 0x98, 0xeb, 0x0d, 0x34, \
+  0x39, 0x5f, 0xda, 0xc1, 0x0d, 0x01, 0xcc, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x36, \
+  0x5f, 0x31, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3c, 0x50, 0x71, \
+  0x98, 0xeb, 0x0d, 0x34, 0x39, 0x5f, 0xda, 0xc1, 0x0d, 0x01, 0xcc, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, \
+  0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_1 218u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t6_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t6_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t6_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t6_1",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t6_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t6_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t6_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t6_2_ops [] =
+{
+  /* t6_2 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 5, 0u,
+  DDS_OP_PLM | 6, 1u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t6_2, f1),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t6_2, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 37dc0caa53a36744253b12c4e6f6] (#deps: 0)
+  [COMPLETE 62863a94d6d9ab93d8163ff6c142] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t6_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xdc, 0x0c, 0xaa, 0x53, 0xa3, 0x67, 0x44, 0x25, 0x3b, 0x12, \
+  0xc4, 0xe6, 0xf6, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x86, 0x3a, 0x94, 0xd6, 0xd9, 0xab, 0x93, 0xd8, 0x16, 0x3f, \
+  0xf6, 0xc1, 0x42, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t6_2 (const unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xdc, 0x0c, 0xaa, 0x53, 0xa3, 0x67, \
+  0x44, 0x25, 0x3b, 0x12, 0xc4, 0xe6, 0xf6, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x86, 0x3a, 0x94, 0xd6, 0xd9, 0xab, \
+  0x93, 0xd8, 0x16, 0x3f, 0xf6, 0xc1, 0x42, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, \
+  0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x36, \
+  0x5f, 0x32, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x62, 0x86, 0x3a, 0x94, 0xd6, 0xd9, 0xab, 0x93, 0xd8, 0x16, 0x3f, \
+  0xf6, 0xc1, 0x42, 0xf1, 0x37, 0xdc, 0x0c, 0xaa, 0x53, 0xa3, 0x67, 0x44, 0x25, 0x3b, 0x12, 0xc4, \
+  0xe6, 0xf6\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_2 258u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t6_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t6_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t6_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t6_2",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t6_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t6_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t6_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t6_2 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t7_1_ops [] =
+{
+  /* t7_1 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t7_1, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpaceTypeConsistencyEnforcement_t7_1, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL add32b447e8167fac1f657872975] (#deps: 0)
+  [COMPLETE a0e5f14ad8cd11eaa72a2b8e5459] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t7_1 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xad, 0xd3, 0x2b, 0x44, 0x7e, 0x81, 0x67, 0xfa, 0xc1, 0xf6, 0x57, \
+  0x87, 0x29, 0x75, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xe5, 0xf1, 0x4a, 0xd8, 0xcd, 0x11, 0xea, 0xa7, 0x2a, 0x2b, \
+  0x8e, 0x54, 0x59, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_1 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t7_1 (const unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xad, 0xd3, 0x2b, 0x44, 0x7e, 0x81, 0x67, \
+  0xfa, 0xc1, 0xf6, 0x57, 0x87, 0x29, 0x75, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x02, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x81, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xe5, 0xf1, 0x4a, 0xd8, 0xcd, 0x11, 0xea, 0xa7, 0x2a, 0x2b, \
+  0x8e, 0x54, 0x59, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, \
+  0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, \
+  0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x74, 0x37, 0x5f, 0x31, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa0, 0xe5, 0xf1, \
+  0x4a, 0xd8, 0xcd, 0x11, 0xea, 0xa7, 0x2a, 0x2b, 0x8e, 0x54, 0x59, 0xf1, 0xad, 0xd3, 0x2b, 0x44, \
+  0x7e, 0x81, 0x67, 0xfa, 0xc1, 0xf6, 0x57, 0x87, 0x29, 0x75\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_1 250u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t7_1_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t7_1),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t7_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t7_1",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t7_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t7_1, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t7_1, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_1 }
+};
+
+static const uint32_t XSpaceTypeConsistencyEnforcement_t7_2_ops [] =
+{
+  /* t7_2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (XSpaceTypeConsistencyEnforcement_t7_2, _d), 2u, (12u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (XSpaceTypeConsistencyEnforcement_t7_2, _u.f1), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_2BY, 2, offsetof (XSpaceTypeConsistencyEnforcement_t7_2, _u.f2), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e98c3614c160d6d4c67231785692] (#deps: 0)
+  [COMPLETE 5b38989af6d96a6fa4b3561eeba8] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t7_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0x8c, 0x36, 0x14, 0xc1, 0x60, 0xd6, 0xd4, 0xc6, 0x72, 0x31, \
+  0x78, 0x56, 0x92, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x5b, 0x38, 0x98, 0x9a, 0xf6, 0xd9, 0x6a, 0x6f, 0xa4, 0xb3, 0x56, \
+  0x1e, 0xeb, 0xa8, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_2 100u
+#define TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t7_2 (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0x8c, 0x36, 0x14, 0xc1, 0x60, 0xd6, \
+  0xd4, 0xc6, 0x72, 0x31, 0x78, 0x56, 0x92, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x02, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x36, 0x67, 0xf6, 0xa0, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x5b, 0x38, 0x98, \
+  0x9a, 0xf6, 0xd9, 0x6a, 0x6f, 0xa4, 0xb3, 0x56, 0x1e, 0xeb, 0xa8, 0x00, 0x89, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x43, 0x6f, 0x6e, 0x73, 0x69, 0x73, \
+  0x74, 0x65, 0x6e, 0x63, 0x79, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, \
+  0x3a, 0x3a, 0x74, 0x37, 0x5f, 0x32, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x5b, 0x38, 0x98, 0x9a, 0xf6, 0xd9, 0x6a, 0x6f, 0xa4, 0xb3, 0x56, \
+  0x1e, 0xeb, 0xa8, 0xf1, 0xe9, 0x8c, 0x36, 0x14, 0xc1, 0x60, 0xd6, 0xd4, 0xc6, 0x72, 0x31, 0x78, \
+  0x56, 0x92\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_2 306u
+const dds_topic_descriptor_t XSpaceTypeConsistencyEnforcement_t7_2_desc =
+{
+  .m_size = sizeof (XSpaceTypeConsistencyEnforcement_t7_2),
+  .m_align = dds_alignof (XSpaceTypeConsistencyEnforcement_t7_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceTypeConsistencyEnforcement::t7_2",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = XSpaceTypeConsistencyEnforcement_t7_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceTypeConsistencyEnforcement_t7_2, .sz = TYPE_INFO_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceTypeConsistencyEnforcement_t7_2, .sz = TYPE_MAP_CDR_SZ_XSpaceTypeConsistencyEnforcement_t7_2 }
+};
+
@@ -0,0 +1,17 @@
+// Copyright(c) 2023 ZettaScale Technology and others
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License v. 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+// v. 1.0 which is available at
+// http://www.eclipse.org/org/documents/edl-v10.php.
+//
+// SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+
+#ifndef DDS_DDSC_TEST_BUILD_OPTIONS_H
+#define DDS_DDSC_TEST_BUILD_OPTIONS_H
+
+/* Whether or not address sanitizer is enabled */
+/* #undef DDS_BUILD_OPTION_WITH_ASAN */
+
+#endif // DDS_DDSC_TEST_BUILD_OPTIONS_H
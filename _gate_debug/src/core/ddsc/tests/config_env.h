@@ -0,0 +1,17 @@
+// Copyright(c) 2006 to 2018 ZettaScale Technology and others
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License v. 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+// v. 1.0 which is available at
+// http://www.eclipse.org/org/documents/edl-v10.php.
+//
+// SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+
+#ifndef CONFIG_ENV_H
+#define CONFIG_ENV_H
+
+#define CONFIG_ENV_SIMPLE_UDP           "file:///root/repo/src/core/ddsc/tests/config_simple_udp.xml"
+#define CONFIG_ENV_MAX_PARTICIPANTS     "0"
+
+#endif /* CONFIG_ENV_H */
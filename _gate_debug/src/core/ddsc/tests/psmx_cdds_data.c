@@ -0,0 +1,135 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/ddsc/tests/psmx_cdds_data.c
+  Source: /root/repo/src/core/ddsc/tests/psmx_cdds_data.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "psmx_cdds_data.h"
+
+static const uint32_t cdds_psmx_data_ops [] =
+{
+  /* cdds_psmx_data */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (cdds_psmx_data, sample_state), 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (cdds_psmx_data, data_type),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (cdds_psmx_data, psmx_instance_id),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (cdds_psmx_data, sample_size),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (cdds_psmx_data, guid), 16u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (cdds_psmx_data, timestamp),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (cdds_psmx_data, statusinfo),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (cdds_psmx_data, cdr_identifier),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY, offsetof (cdds_psmx_data, cdr_options),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (cdds_psmx_data, data),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 60ca52ef82625dd6eb4b0455e530] (#deps: 1)
+   - [MINIMAL d930af5c04f8d18f33a4b38aa6a7]
+  [COMPLETE f18f2f2922dd777c46fdccad3590] (#deps: 1)
+   - [COMPLETE 4cb93db8491ea2df8b886c22703c]
+*/
+#define TYPE_INFO_CDR_cdds_psmx_data (const unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x60, 0xca, 0x52, 0xef, 0x82, 0x62, 0x5d, 0xd6, 0xeb, 0x4b, 0x04, \
+  0x55, 0xe5, 0x30, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd9, 0x30, 0xaf, 0x5c, 0x04, 0xf8, 0xd1, \
+  0x8f, 0x33, 0xa4, 0xb3, 0x8a, 0xa6, 0xa7, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x8f, 0x2f, \
+  0x29, 0x22, 0xdd, 0x77, 0x7c, 0x46, 0xfd, 0xcc, 0xad, 0x35, 0x90, 0x00, 0x7b, 0x01, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x4c, 0xb9, 0x3d, 0xb8, 0x49, 0x1e, 0xa2, 0xdf, 0x8b, 0x88, 0x6c, 0x22, 0x70, 0x3c, 0x00, \
+  0x1b, 0x01, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_cdds_psmx_data 148u
+#define TYPE_MAP_CDR_cdds_psmx_data (const unsigned char []){ \
+  0x76, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x60, 0xca, 0x52, 0xef, 0x82, 0x62, 0x5d, \
+  0xd6, 0xeb, 0x4b, 0x04, 0x55, 0xe5, 0x30, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd9, 0x30, 0xaf, 0x5c, 0x04, \
+  0xf8, 0xd1, 0x8f, 0x33, 0xa4, 0xb3, 0x8a, 0xa6, 0xa7, 0x8a, 0x20, 0xb5, 0x64, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x17, 0xf7, 0x1d, 0x96, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x4c, 0xa6, 0xdd, 0xf4, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x14, 0x0f, 0x51, 0x1e, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x1e, 0x0c, 0xa5, 0xb1, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0xd7, 0xe6, 0xd5, 0x5b, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x82, 0xfb, 0xac, 0xe1, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xaa, 0x7e, 0xe4, 0xeb, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x62, 0xae, 0xce, 0x21, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, 0x8d, 0x77, 0x7f, 0x38, \
+  0xf1, 0xd9, 0x30, 0xaf, 0x5c, 0x04, 0xf8, 0xd1, 0x8f, 0x33, 0xa4, 0xb3, 0x8a, 0xa6, 0xa7, 0x00, \
+  0x76, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xfc, 0x72, 0x58, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x6f, 0x69, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, \
+  0xda, 0x30, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x33, 0xbc, 0xde, 0xab, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x0b, 0x86, 0x00, 0x00, 0xbb, 0x02, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x8f, 0x2f, 0x29, 0x22, 0xdd, 0x77, 0x7c, 0x46, 0xfd, 0xcc, \
+  0xad, 0x35, 0x90, 0x00, 0x77, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x73, 0x5f, 0x70, 0x73, 0x6d, \
+  0x78, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x4c, 0xb9, 0x3d, 0xb8, 0x49, \
+  0x1e, 0xa2, 0xdf, 0x8b, 0x88, 0x6c, 0x22, 0x70, 0x3c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x00, 0x70, 0x73, 0x6d, 0x78, \
+  0x5f, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x75, 0x69, 0x64, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x69, 0x6e, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x63, 0x64, 0x72, 0x5f, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x5f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0xf2, \
+  0x4c, 0xb9, 0x3d, 0xb8, 0x49, 0x1e, 0xa2, 0xdf, 0x8b, 0x88, 0x6c, 0x22, 0x70, 0x3c, 0x00, 0x00, \
+  0x17, 0x01, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x55, 0x4e, 0x49, \
+  0x54, 0x49, 0x41, 0x4c, 0x49, 0x5a, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x52, 0x41, 0x57, \
+  0x5f, 0x4b, 0x45, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x53, 0x41, 0x4d, 0x50, \
+  0x4c, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x52, 0x41, 0x57, 0x5f, 0x44, 0x41, 0x54, \
+  0x41, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x53, \
+  0x54, 0x41, 0x54, 0x45, 0x5f, 0x53, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x49, 0x5a, 0x45, 0x44, 0x5f, \
+  0x4b, 0x45, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x53, 0x41, 0x4d, 0x50, \
+  0x4c, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x53, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x49, \
+  0x5a, 0x45, 0x44, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xf1, 0x8f, 0x2f, 0x29, 0x22, 0xdd, 0x77, 0x7c, 0x46, 0xfd, 0xcc, \
+  0xad, 0x35, 0x90, 0xf1, 0x60, 0xca, 0x52, 0xef, 0x82, 0x62, 0x5d, 0xd6, 0xeb, 0x4b, 0x04, 0x55, \
+  0xe5, 0x30, 0xf2, 0x4c, 0xb9, 0x3d, 0xb8, 0x49, 0x1e, 0xa2, 0xdf, 0x8b, 0x88, 0x6c, 0x22, 0x70, \
+  0x3c, 0xf1, 0xd9, 0x30, 0xaf, 0x5c, 0x04, 0xf8, 0xd1, 0x8f, 0x33, 0xa4, 0xb3, 0x8a, 0xa6, 0xa7\
+}
+#define TYPE_MAP_CDR_SZ_cdds_psmx_data 1152u
+const dds_topic_descriptor_t cdds_psmx_data_desc =
+{
+  .m_size = sizeof (cdds_psmx_data),
+  .m_align = dds_alignof (cdds_psmx_data),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "cdds_psmx_data",
+  .m_keys = NULL,
+  .m_nops = 11,
+  .m_ops = cdds_psmx_data_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_cdds_psmx_data, .sz = TYPE_INFO_CDR_SZ_cdds_psmx_data },
+  .type_mapping = { .data = TYPE_MAP_CDR_cdds_psmx_data, .sz = TYPE_MAP_CDR_SZ_cdds_psmx_data }
+};
+
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_debug/src/core/ddsi/tests/cunit_ddsi.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o.d"
+  "/root/repo/src/core/ddsi/tests/entidx_cache.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/entidx_cache.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/entidx_cache.c.o.d"
+  "/root/repo/src/core/ddsi/tests/ipaddr.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/ipaddr.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/ipaddr.c.o.d"
+  "/root/repo/src/core/ddsi/tests/lease_wheel.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/lease_wheel.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/lease_wheel.c.o.d"
+  "/root/repo/src/core/ddsi/tests/locators.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/locators.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/locators.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist_generic.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_generic.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_generic.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist_leasedur.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o.d"
+  "/root/repo/src/core/ddsi/tests/pmd_message.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/pmd_message.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/pmd_message.c.o.d"
+  "/root/repo/src/core/ddsi/tests/radmin.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/radmin.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/radmin.c.o.d"
+  "/root/repo/src/core/ddsi/tests/security_msg.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/security_msg.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/security_msg.c.o.d"
+  "/root/repo/src/core/ddsi/tests/sendq.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sendq.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sendq.c.o.d"
+  "/root/repo/src/core/ddsi/tests/sysdeps.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sysdeps.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sysdeps.c.o.d"
+  "/root/repo/src/core/ddsi/tests/wraddrset.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/wraddrset.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/wraddrset.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/ucunit/CMakeFiles/ucunit.dir/DependInfo.cmake"
+  "/root/repo/_gate_debug/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../../../bin/cunit_ddsi"
+  "../../../../bin/cunit_ddsi.pdb"
+  "CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o"
+  "CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/entidx_cache.c.o"
+  "CMakeFiles/cunit_ddsi.dir/entidx_cache.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/ipaddr.c.o"
+  "CMakeFiles/cunit_ddsi.dir/ipaddr.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/lease_wheel.c.o"
+  "CMakeFiles/cunit_ddsi.dir/lease_wheel.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/locators.c.o"
+  "CMakeFiles/cunit_ddsi.dir/locators.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/plist.c.o"
+  "CMakeFiles/cunit_ddsi.dir/plist.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/plist_generic.c.o"
+  "CMakeFiles/cunit_ddsi.dir/plist_generic.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o"
+  "CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/pmd_message.c.o"
+  "CMakeFiles/cunit_ddsi.dir/pmd_message.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/radmin.c.o"
+  "CMakeFiles/cunit_ddsi.dir/radmin.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/security_msg.c.o"
+  "CMakeFiles/cunit_ddsi.dir/security_msg.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/sendq.c.o"
+  "CMakeFiles/cunit_ddsi.dir/sendq.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/sysdeps.c.o"
+  "CMakeFiles/cunit_ddsi.dir/sysdeps.c.o.d"
+  "CMakeFiles/cunit_ddsi.dir/wraddrset.c.o"
+  "CMakeFiles/cunit_ddsi.dir/wraddrset.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_ddsi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
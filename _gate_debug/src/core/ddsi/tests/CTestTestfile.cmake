@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/ddsi/tests
+# Build directory: /root/repo/_gate_debug/src/core/ddsi/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddsi_entidx_cache_hit_miss_invalidate "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_entidx_cache" "-t" "hit_miss_invalidate")
+set_tests_properties(CUnit_ddsi_entidx_cache_hit_miss_invalidate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_lease_wheel_stress "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_lease_wheel" "-t" "stress")
+set_tests_properties(CUnit_ddsi_lease_wheel_stress PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_ipaddr_is_nearby_address "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_ipaddr" "-t" "is_nearby_address")
+set_tests_properties(CUnit_ddsi_ipaddr_is_nearby_address PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_bogusproto "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "bogusproto")
+set_tests_properties(CUnit_ddsi_locator_from_string_bogusproto PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_cross1 "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_cross1")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_cross1 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_cross2 "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_cross2")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_cross2 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_udpv4mcgen "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "udpv4mcgen")
+set_tests_properties(CUnit_ddsi_locator_from_string_udpv4mcgen PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_invalid "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_invalid")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4 "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv6_invalid "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv6_invalid")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv6_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv6")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_ser_and_deser "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "ser_and_deser")
+set_tests_properties(CUnit_ddsi_plist_generic_ser_and_deser PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_unalias "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "unalias")
+set_tests_properties(CUnit_ddsi_plist_generic_unalias PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_invalid_input "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "invalid_input")
+set_tests_properties(CUnit_ddsi_plist_generic_invalid_input PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_optional "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "optional")
+set_tests_properties(CUnit_ddsi_plist_generic_optional PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_unalias_copy_merge "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist" "-t" "unalias_copy_merge")
+set_tests_properties(CUnit_ddsi_plist_unalias_copy_merge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_locator_lists_reject "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist" "-t" "locator_lists_reject")
+set_tests_properties(CUnit_ddsi_plist_locator_lists_reject PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_locator_lists_accept "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist" "-t" "locator_lists_accept")
+set_tests_properties(CUnit_ddsi_plist_locator_lists_accept PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_deser "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "deser")
+set_tests_properties(CUnit_ddsi_plist_leasedur_deser PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_ser_spdp "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "ser_spdp")
+set_tests_properties(CUnit_ddsi_plist_leasedur_ser_spdp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_ser_others "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "ser_others")
+set_tests_properties(CUnit_ddsi_plist_leasedur_ser_others PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxypp "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxypp")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxypp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxypp_def "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxypp_def")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxypp_def PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxyrd "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxyrd")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxyrd PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxyrd_def "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxyrd_def")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxyrd_def PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_pmd_message_valid "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_pmd_message" "-t" "valid")
+set_tests_properties(CUnit_ddsi_pmd_message_valid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_pmd_message_invalid_sequence "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_pmd_message" "-t" "invalid_sequence")
+set_tests_properties(CUnit_ddsi_pmd_message_invalid_sequence PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_pmd_message_bogus_header "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_pmd_message" "-t" "bogus_header")
+set_tests_properties(CUnit_ddsi_pmd_message_bogus_header PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_radmin_drop_gap_at_end "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_radmin" "-t" "drop_gap_at_end")
+set_tests_properties(CUnit_ddsi_radmin_drop_gap_at_end PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sendq_async_send "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_sendq" "-t" "async_send")
+set_tests_properties(CUnit_ddsi_sendq_async_send PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sendq_per_connection "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_sendq" "-t" "per_connection")
+set_tests_properties(CUnit_ddsi_sendq_per_connection PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sysdeps_log_stacktrace_self "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_sysdeps" "-t" "log_stacktrace_self")
+set_tests_properties(CUnit_ddsi_sysdeps_log_stacktrace_self PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sysdeps_log_stacktrace_other "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_sysdeps" "-t" "log_stacktrace_other")
+set_tests_properties(CUnit_ddsi_sysdeps_log_stacktrace_other PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_wraddrset_some_cases "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_wraddrset" "-t" "some_cases")
+set_tests_properties(CUnit_ddsi_wraddrset_some_cases PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_wraddrset_churn_benchmark "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_wraddrset" "-t" "churn_benchmark")
+set_tests_properties(CUnit_ddsi_wraddrset_churn_benchmark PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "300" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_security_msg_serializer "/root/repo/_gate_debug/bin/cunit_ddsi" "-s" "ddsi_security_msg" "-t" "serializer")
+set_tests_properties(CUnit_ddsi_security_msg_serializer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;32;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/discovery_bench"
+  "../../../../bin/discovery_bench.pdb"
+  "CMakeFiles/discovery_bench.dir/discovery_bench.c.o"
+  "CMakeFiles/discovery_bench.dir/discovery_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/discovery_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
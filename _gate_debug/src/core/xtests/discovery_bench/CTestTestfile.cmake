@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/discovery_bench
+# Build directory: /root/repo/_gate_debug/src/core/xtests/discovery_bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(discovery_bench "/root/repo/_gate_debug/bin/discovery_bench" "50" "6" "3" "2")
+set_tests_properties(discovery_bench PROPERTIES  TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/src/core/xtests/discovery_bench/CMakeLists.txt;23;add_test;/root/repo/src/core/xtests/discovery_bench/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/InitSampleDelivPub"
+  "../../../../bin/InitSampleDelivPub.pdb"
+  "CMakeFiles/InitSampleDelivPub.dir/InitSampleDelivData.c.o"
+  "CMakeFiles/InitSampleDelivPub.dir/InitSampleDelivData.c.o.d"
+  "CMakeFiles/InitSampleDelivPub.dir/publisher.c.o"
+  "CMakeFiles/InitSampleDelivPub.dir/publisher.c.o.d"
+  "InitSampleDelivData.c"
+  "InitSampleDelivData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/InitSampleDelivPub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,86 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/xtests/initsampledeliv/InitSampleDelivData.c
+  Source: /root/repo/src/core/xtests/initsampledeliv/InitSampleDelivData.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "InitSampleDelivData.h"
+
+static const uint32_t Msg_ops [] =
+{
+  /* Msg */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Msg, keyval),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Msg, seq),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Msg, tldepth),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Msg, final_seq),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Msg, seq_at_match), 2u,
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t Msg_keys[1] =
+{
+  { "keyval", 12, 0 }
+};
+
+/* Type Information:
+  [MINIMAL ee9d9a15b0f2b60eac69f727fb3e] (#deps: 0)
+  [COMPLETE 05ec4bbe4af4472bd40f529822bd] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Msg (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xee, 0x9d, 0x9a, 0x15, 0xb0, 0xf2, 0xb6, 0x0e, 0xac, 0x69, 0xf7, \
+  0x27, 0xfb, 0x3e, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x05, 0xec, 0x4b, 0xbe, 0x4a, 0xf4, 0x47, 0x2b, 0xd4, 0x0f, 0x52, \
+  0x98, 0x22, 0xbd, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Msg 100u
+#define TYPE_MAP_CDR_Msg (const unsigned char []){ \
+  0x86, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xee, 0x9d, 0x9a, 0x15, 0xb0, 0xf2, 0xb6, \
+  0x0e, 0xac, 0x69, 0xf7, 0x27, 0xfb, 0x3e, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x35, 0x25, 0x6e, 0x09, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xec, 0xf5, 0xe4, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x46, 0x01, 0x39, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x05, 0xec, 0x4b, 0xbe, 0x4a, 0xf4, 0x47, 0x2b, 0xd4, 0x0f, 0x52, \
+  0x98, 0x22, 0xbd, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4d, 0x73, 0x67, 0x00, 0x9b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x74, 0x6c, 0x64, 0x65, 0x70, 0x74, 0x68, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x5f, \
+  0x61, 0x74, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x05, 0xec, 0x4b, 0xbe, 0x4a, 0xf4, 0x47, 0x2b, 0xd4, 0x0f, 0x52, \
+  0x98, 0x22, 0xbd, 0xf1, 0xee, 0x9d, 0x9a, 0x15, 0xb0, 0xf2, 0xb6, 0x0e, 0xac, 0x69, 0xf7, 0x27, \
+  0xfb, 0x3e\
+}
+#define TYPE_MAP_CDR_SZ_Msg 386u
+const dds_topic_descriptor_t Msg_desc =
+{
+  .m_size = sizeof (Msg),
+  .m_align = dds_alignof (Msg),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Msg",
+  .m_keys = Msg_keys,
+  .m_nops = 6,
+  .m_ops = Msg_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Msg, .sz = TYPE_INFO_CDR_SZ_Msg },
+  .type_mapping = { .data = TYPE_MAP_CDR_Msg, .sz = TYPE_MAP_CDR_SZ_Msg }
+};
+
@@ -0,0 +1,39 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/xtests/initsampledeliv/InitSampleDelivData.h
+  Source: /root/repo/src/core/xtests/initsampledeliv/InitSampleDelivData.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_XTESTS_INITSAMPLEDELIV_INITSAMPLEDELIVDATA_H_C1396CBBD540F28A11620F48993451B9
+#define DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_XTESTS_INITSAMPLEDELIV_INITSAMPLEDELIVDATA_H_C1396CBBD540F28A11620F48993451B9
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Msg
+{
+  int32_t keyval;
+  int32_t seq;
+  int32_t tldepth;
+  int32_t final_seq;
+  int32_t seq_at_match[2];
+} Msg;
+
+extern const dds_topic_descriptor_t Msg_desc;
+
+#define Msg__alloc() \
+((Msg*) dds_alloc (sizeof (Msg)));
+
+#define Msg_free(d,o) \
+dds_sample_free ((d), &Msg_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__GATE_DEBUG_SRC_CORE_XTESTS_INITSAMPLEDELIV_INITSAMPLEDELIVDATA_H_C1396CBBD540F28A11620F48993451B9 */
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RhcTypes_generate"
+  "RhcTypes.c"
+  "RhcTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RhcTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/rhc_torture
+# Build directory: /root/repo/_gate_debug/src/core/xtests/rhc_torture
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rhc_torture "/root/repo/_gate_debug/bin/rhc_torture" "314159265" "0" "5000" "0" "1" "20")
+set_tests_properties(rhc_torture PROPERTIES  TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/src/core/xtests/rhc_torture/CMakeLists.txt;25;add_test;/root/repo/src/core/xtests/rhc_torture/CMakeLists.txt;0;")
@@ -0,0 +1,86 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_gate_debug/src/core/xtests/rhc_torture/RhcTypes.c
+  Source: /root/repo/src/core/xtests/rhc_torture/RhcTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "RhcTypes.h"
+
+static const uint32_t RhcTypes_T_ops [] =
+{
+  /* T */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (RhcTypes_T, k),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (RhcTypes_T, ks),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (RhcTypes_T, x),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (RhcTypes_T, y),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (RhcTypes_T, s),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: ks */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t RhcTypes_T_keys[2] =
+{
+  { "k", 11, 0 },
+  { "ks", 13, 1 }
+};
+
+/* Type Information:
+  [MINIMAL ed2e3d8e3d77fb4db96a89536f9f] (#deps: 0)
+  [COMPLETE 19bcecff5afd5dcec9041159a11c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_RhcTypes_T (const unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xed, 0x2e, 0x3d, 0x8e, 0x3d, 0x77, 0xfb, 0x4d, 0xb9, 0x6a, 0x89, \
+  0x53, 0x6f, 0x9f, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x19, 0xbc, 0xec, 0xff, 0x5a, 0xfd, 0x5d, 0xce, 0xc9, 0x04, 0x11, \
+  0x59, 0xa1, 0x1c, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_RhcTypes_T 100u
+#define TYPE_MAP_CDR_RhcTypes_T (const unsigned char []){ \
+  0x7c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xed, 0x2e, 0x3d, 0x8e, 0x3d, 0x77, 0xfb, \
+  0x4d, 0xb9, 0x6a, 0x89, 0x53, 0x6f, 0x9f, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x05, 0xf3, 0x9d, 0x8a, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0xa4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x19, 0xbc, 0xec, 0xff, 0x5a, 0xfd, 0x5d, \
+  0xce, 0xc9, 0x04, 0x11, 0x59, 0xa1, 0x1c, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x52, 0x68, 0x63, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x6b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6b, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x19, 0xbc, 0xec, 0xff, 0x5a, 0xfd, 0x5d, 0xce, 0xc9, 0x04, 0x11, 0x59, 0xa1, 0x1c, 0xf1, \
+  0xed, 0x2e, 0x3d, 0x8e, 0x3d, 0x77, 0xfb, 0x4d, 0xb9, 0x6a, 0x89, 0x53, 0x6f, 0x9f\
+}
+#define TYPE_MAP_CDR_SZ_RhcTypes_T 334u
+const dds_topic_descriptor_t RhcTypes_T_desc =
+{
+  .m_size = sizeof (RhcTypes_T),
+  .m_align = dds_alignof (RhcTypes_T),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "RhcTypes::T",
+  .m_keys = RhcTypes_T_keys,
+  .m_nops = 6,
+  .m_ops = RhcTypes_T_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_RhcTypes_T, .sz = TYPE_INFO_CDR_SZ_RhcTypes_T },
+  .type_mapping = { .data = TYPE_MAP_CDR_RhcTypes_T, .sz = TYPE_MAP_CDR_SZ_RhcTypes_T }
+};
+
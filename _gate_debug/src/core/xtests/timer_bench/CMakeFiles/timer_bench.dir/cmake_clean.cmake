@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/timer_bench"
+  "../../../../bin/timer_bench.pdb"
+  "CMakeFiles/timer_bench.dir/timer_bench.c.o"
+  "CMakeFiles/timer_bench.dir/timer_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/timer_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/timer_bench
+# Build directory: /root/repo/_gate_debug/src/core/xtests/timer_bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(timer_bench "/root/repo/_gate_debug/bin/timer_bench" "10000" "100000" "2")
+set_tests_properties(timer_bench PROPERTIES  TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/src/core/xtests/timer_bench/CMakeLists.txt;16;add_test;/root/repo/src/core/xtests/timer_bench/CMakeLists.txt;0;")
@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ddsrt/src/atomics.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/atomics.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/atomics.c.o.d"
+  "/root/repo/src/ddsrt/src/avl.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/avl.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/avl.c.o.d"
+  "/root/repo/src/ddsrt/src/bits.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/bits.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/bits.c.o.d"
+  "/root/repo/src/ddsrt/src/bswap.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/bswap.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/bswap.c.o.d"
+  "/root/repo/src/ddsrt/src/cdtors.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/cdtors.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/cdtors.c.o.d"
+  "/root/repo/src/ddsrt/src/circlist.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/circlist.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/circlist.c.o.d"
+  "/root/repo/src/ddsrt/src/dynlib/posix/dynlib.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/dynlib/posix/dynlib.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/dynlib/posix/dynlib.c.o.d"
+  "/root/repo/src/ddsrt/src/environ.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/environ.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/environ.c.o.d"
+  "/root/repo/src/ddsrt/src/environ/posix/environ.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/environ/posix/environ.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/environ/posix/environ.c.o.d"
+  "/root/repo/src/ddsrt/src/expand_vars.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/expand_vars.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/expand_vars.c.o.d"
+  "/root/repo/src/ddsrt/src/fibheap.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/fibheap.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/fibheap.c.o.d"
+  "/root/repo/src/ddsrt/src/filesystem/posix/filesystem.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/filesystem/posix/filesystem.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/filesystem/posix/filesystem.c.o.d"
+  "/root/repo/src/ddsrt/src/heap/posix/heap.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/heap/posix/heap.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/heap/posix/heap.c.o.d"
+  "/root/repo/src/ddsrt/src/hopscotch.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/hopscotch.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/hopscotch.c.o.d"
+  "/root/repo/src/ddsrt/src/ifaddrs.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/ifaddrs.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/ifaddrs.c.o.d"
+  "/root/repo/src/ddsrt/src/ifaddrs/posix/ifaddrs.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/ifaddrs/posix/ifaddrs.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/ifaddrs/posix/ifaddrs.c.o.d"
+  "/root/repo/src/ddsrt/src/io.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/io.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/io.c.o.d"
+  "/root/repo/src/ddsrt/src/log.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/log.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/log.c.o.d"
+  "/root/repo/src/ddsrt/src/md5.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/md5.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/md5.c.o.d"
+  "/root/repo/src/ddsrt/src/mh3.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/mh3.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/mh3.c.o.d"
+  "/root/repo/src/ddsrt/src/netstat/linux/netstat.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/netstat/linux/netstat.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/netstat/linux/netstat.c.o.d"
+  "/root/repo/src/ddsrt/src/process/posix/process.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/process/posix/process.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/process/posix/process.c.o.d"
+  "/root/repo/src/ddsrt/src/random.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/random.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/random.c.o.d"
+  "/root/repo/src/ddsrt/src/random/posix/random.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/random/posix/random.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/random/posix/random.c.o.d"
+  "/root/repo/src/ddsrt/src/retcode.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/retcode.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/retcode.c.o.d"
+  "/root/repo/src/ddsrt/src/rusage/posix/rusage.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/rusage/posix/rusage.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/rusage/posix/rusage.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets/posix/gethostname.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets/posix/gethostname.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets/posix/gethostname.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets/posix/socket.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets/posix/socket.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sockets/posix/socket.c.o.d"
+  "/root/repo/src/ddsrt/src/string.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/string.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/string.c.o.d"
+  "/root/repo/src/ddsrt/src/strtod.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/strtod.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/strtod.c.o.d"
+  "/root/repo/src/ddsrt/src/strtol.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/strtol.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/strtol.c.o.d"
+  "/root/repo/src/ddsrt/src/sync/posix/sync.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sync/posix/sync.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/sync/posix/sync.c.o.d"
+  "/root/repo/src/ddsrt/src/threads.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/threads.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/threads.c.o.d"
+  "/root/repo/src/ddsrt/src/threads/posix/threads.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/threads/posix/threads.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/threads/posix/threads.c.o.d"
+  "/root/repo/src/ddsrt/src/time.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/time.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/time.c.o.d"
+  "/root/repo/src/ddsrt/src/time/posix/time.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/time/posix/time.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/time/posix/time.c.o.d"
+  "/root/repo/src/ddsrt/src/timerwheel.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/timerwheel.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/timerwheel.c.o.d"
+  "/root/repo/src/ddsrt/src/xmlparser.c" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/xmlparser.c.o" "gcc" "src/ddsrt/CMakeFiles/ddsrt-internal.dir/src/xmlparser.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ddsrt/tests/atomics.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/atomics.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/atomics.c.o.d"
+  "/root/repo/src/ddsrt/tests/bits.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/bits.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/bits.c.o.d"
+  "/root/repo/_gate_debug/src/ddsrt/tests/cunit_ddsrt.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/cunit_ddsrt.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/cunit_ddsrt.c.o.d"
+  "/root/repo/src/ddsrt/tests/environ.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/environ.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/environ.c.o.d"
+  "/root/repo/src/ddsrt/tests/heap.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/heap.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/heap.c.o.d"
+  "/root/repo/src/ddsrt/tests/hopscotch.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/hopscotch.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/hopscotch.c.o.d"
+  "/root/repo/src/ddsrt/tests/ifaddrs.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/ifaddrs.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/ifaddrs.c.o.d"
+  "/root/repo/src/ddsrt/tests/log.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/log.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/log.c.o.d"
+  "/root/repo/src/ddsrt/tests/random.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/random.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/random.c.o.d"
+  "/root/repo/src/ddsrt/tests/retcode.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/retcode.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/retcode.c.o.d"
+  "/root/repo/src/ddsrt/tests/select.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/select.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/select.c.o.d"
+  "/root/repo/src/ddsrt/tests/socket.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/socket.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/socket.c.o.d"
+  "/root/repo/src/ddsrt/tests/string.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/string.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/string.c.o.d"
+  "/root/repo/src/ddsrt/tests/strlcpy.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/strlcpy.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/strlcpy.c.o.d"
+  "/root/repo/src/ddsrt/tests/strtoll.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/strtoll.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/strtoll.c.o.d"
+  "/root/repo/src/ddsrt/tests/sync.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/sync.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/sync.c.o.d"
+  "/root/repo/src/ddsrt/tests/thread.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/thread.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/thread.c.o.d"
+  "/root/repo/src/ddsrt/tests/thread_cleanup.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/thread_cleanup.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/thread_cleanup.c.o.d"
+  "/root/repo/src/ddsrt/tests/timerwheel.c" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/timerwheel.c.o" "gcc" "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/timerwheel.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/ucunit/CMakeFiles/ucunit.dir/DependInfo.cmake"
+  "/root/repo/_gate_debug/src/ddsrt/CMakeFiles/ddsrt-internal.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
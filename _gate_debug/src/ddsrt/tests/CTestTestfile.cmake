@@ -0,0 +1,192 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/ddsrt/tests
+# Build directory: /root/repo/_gate_debug/src/ddsrt/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddsrt_atomics_load_store "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "load_store")
+set_tests_properties(CUnit_ddsrt_atomics_load_store PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_compare_and_swap "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "compare_and_swap")
+set_tests_properties(CUnit_ddsrt_atomics_compare_and_swap PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_increment "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "increment")
+set_tests_properties(CUnit_ddsrt_atomics_increment PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_decrement "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "decrement")
+set_tests_properties(CUnit_ddsrt_atomics_decrement PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_add "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "add")
+set_tests_properties(CUnit_ddsrt_atomics_add PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_subtract "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "subtract")
+set_tests_properties(CUnit_ddsrt_atomics_subtract PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_and "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "and")
+set_tests_properties(CUnit_ddsrt_atomics_and PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_atomics_or "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_atomics" "-t" "or")
+set_tests_properties(CUnit_ddsrt_atomics_or PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_bits_ffs32u "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_bits" "-t" "ffs32u")
+set_tests_properties(CUnit_ddsrt_bits_ffs32u PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_environ_setenv "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_environ" "-t" "setenv")
+set_tests_properties(CUnit_ddsrt_environ_setenv PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_environ_getenv "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_environ" "-t" "getenv")
+set_tests_properties(CUnit_ddsrt_environ_getenv PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_environ_bad_name "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_environ" "-t" "bad_name")
+set_tests_properties(CUnit_ddsrt_environ_bad_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_environ_expand "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_environ" "-t" "expand")
+set_tests_properties(CUnit_ddsrt_environ_expand PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_environ_expand_sh "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_environ" "-t" "expand_sh")
+set_tests_properties(CUnit_ddsrt_environ_expand_sh PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_malloc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "malloc")
+set_tests_properties(CUnit_ddsrt_heap_malloc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_calloc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "calloc")
+set_tests_properties(CUnit_ddsrt_heap_calloc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_realloc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "realloc")
+set_tests_properties(CUnit_ddsrt_heap_realloc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_malloc_s "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "malloc_s")
+set_tests_properties(CUnit_ddsrt_heap_malloc_s PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_calloc_s "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "calloc_s")
+set_tests_properties(CUnit_ddsrt_heap_calloc_s PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_heap_ddsrt_realloc_s "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_heap" "-t" "ddsrt_realloc_s")
+set_tests_properties(CUnit_ddsrt_heap_ddsrt_realloc_s PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_getifaddrs_ipv4 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_getifaddrs" "-t" "ipv4")
+set_tests_properties(CUnit_ddsrt_getifaddrs_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_getifaddrs_null_filter "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_getifaddrs" "-t" "null_filter")
+set_tests_properties(CUnit_ddsrt_getifaddrs_null_filter PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_getifaddrs_empty_filter "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_getifaddrs" "-t" "empty_filter")
+set_tests_properties(CUnit_ddsrt_getifaddrs_empty_filter PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_getifaddrs_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_getifaddrs" "-t" "ipv6")
+set_tests_properties(CUnit_ddsrt_getifaddrs_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_getifaddrs_ipv4_n_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_getifaddrs" "-t" "ipv4_n_ipv6")
+set_tests_properties(CUnit_ddsrt_getifaddrs_ipv4_n_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_mutex_lock_conc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "mutex_lock_conc")
+set_tests_properties(CUnit_ddsrt_sync_mutex_lock_conc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_mutex_trylock "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "mutex_trylock")
+set_tests_properties(CUnit_ddsrt_sync_mutex_trylock PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_mutex_trylock_conc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "mutex_trylock_conc")
+set_tests_properties(CUnit_ddsrt_sync_mutex_trylock_conc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_once_conc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "once_conc")
+set_tests_properties(CUnit_ddsrt_sync_once_conc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_cond_waitfor "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "cond_waitfor")
+set_tests_properties(CUnit_ddsrt_sync_cond_waitfor PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_cond_waituntil "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "cond_waituntil")
+set_tests_properties(CUnit_ddsrt_sync_cond_waituntil PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sync_rwlock_trylock_conc "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sync" "-t" "rwlock_trylock_conc")
+set_tests_properties(CUnit_ddsrt_sync_rwlock_trylock_conc PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_strtoll "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "strtoll")
+set_tests_properties(CUnit_ddsrt_strtoll_strtoll PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_strtoull "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "strtoull")
+set_tests_properties(CUnit_ddsrt_strtoll_strtoull PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_atoll "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "atoll")
+set_tests_properties(CUnit_ddsrt_strtoll_atoll PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_atoull "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "atoull")
+set_tests_properties(CUnit_ddsrt_strtoll_atoull PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_lltostr "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "lltostr")
+set_tests_properties(CUnit_ddsrt_strtoll_lltostr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strtoll_ulltostr "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strtoll" "-t" "ulltostr")
+set_tests_properties(CUnit_ddsrt_strtoll_ulltostr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_thread_id "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread" "-t" "thread_id")
+set_tests_properties(CUnit_ddsrt_thread_thread_id PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_stacked_join "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread" "-t" "stacked_join")
+set_tests_properties(CUnit_ddsrt_thread_stacked_join PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_attribute "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread" "-t" "attribute")
+set_tests_properties(CUnit_ddsrt_thread_attribute PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_create_and_join "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread" "-t" "create_and_join")
+set_tests_properties(CUnit_ddsrt_thread_create_and_join PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_one "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_one")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_one PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two_pop_one_no_exec "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two_pop_one_no_exec")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two_pop_one_no_exec PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two_pop_one_exec "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two_pop_one_exec")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two_pop_one_exec PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two_pop_two_no_exec "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two_pop_two_no_exec")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two_pop_two_no_exec PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two_pop_two_exec_one "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two_pop_two_exec_one")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two_pop_two_exec_one PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_push_two_pop_two_exec_both "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "push_two_pop_two_exec_both")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_push_two_pop_two_exec_both PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_thread_cleanup_no_interference "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_thread_cleanup" "-t" "no_interference")
+set_tests_properties(CUnit_ddsrt_thread_cleanup_no_interference PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strcasecmp_basic "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strcasecmp" "-t" "basic")
+set_tests_properties(CUnit_ddsrt_strcasecmp_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strncasecmp_basic "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strncasecmp" "-t" "basic")
+set_tests_properties(CUnit_ddsrt_strncasecmp_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strncasecmp_empty "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strncasecmp" "-t" "empty")
+set_tests_properties(CUnit_ddsrt_strncasecmp_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strncasecmp_length "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strncasecmp" "-t" "length")
+set_tests_properties(CUnit_ddsrt_strncasecmp_length PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_str_replace_basic "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_str_replace" "-t" "basic")
+set_tests_properties(CUnit_ddsrt_str_replace_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strndup_exact_length "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strndup" "-t" "exact_length")
+set_tests_properties(CUnit_ddsrt_strndup_exact_length PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strndup_too_long "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strndup" "-t" "too_long")
+set_tests_properties(CUnit_ddsrt_strndup_too_long PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strndup_too_short "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strndup" "-t" "too_short")
+set_tests_properties(CUnit_ddsrt_strndup_too_short PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_str_trim_ord_space_basic "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_str_trim_ord_space" "-t" "basic")
+set_tests_properties(CUnit_ddsrt_str_trim_ord_space_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_only_log_file "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "only_log_file")
+set_tests_properties(CUnit_dds_log_only_log_file PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_same_file "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "same_file")
+set_tests_properties(CUnit_dds_log_same_file PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_same_sink_function "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "same_sink_function")
+set_tests_properties(CUnit_dds_log_same_sink_function PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_exact_same_sink "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "exact_same_sink")
+set_tests_properties(CUnit_dds_log_exact_same_sink PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_no_sink "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "no_sink")
+set_tests_properties(CUnit_dds_log_no_sink PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_newline_terminates "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "newline_terminates")
+set_tests_properties(CUnit_dds_log_newline_terminates PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_disabled_categories_discarded "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "disabled_categories_discarded")
+set_tests_properties(CUnit_dds_log_disabled_categories_discarded PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_synchronous_sink_changes "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "synchronous_sink_changes")
+set_tests_properties(CUnit_dds_log_synchronous_sink_changes PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_dds_log_fatal_aborts "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "dds_log" "-t" "fatal_aborts")
+set_tests_properties(CUnit_dds_log_fatal_aborts PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_hopscotch_concurrent "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_hopscotch" "-t" "concurrent")
+set_tests_properties(CUnit_ddsrt_hopscotch_concurrent PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "20" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_hopscotch_random "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_hopscotch" "-t" "random")
+set_tests_properties(CUnit_ddsrt_hopscotch_random PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "20" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_timerwheel_random "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_timerwheel" "-t" "random")
+set_tests_properties(CUnit_ddsrt_timerwheel_random PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_timerwheel_exact_time "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_timerwheel" "-t" "exact_time")
+set_tests_properties(CUnit_ddsrt_timerwheel_exact_time PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_random_mt19937 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_random" "-t" "mt19937")
+set_tests_properties(CUnit_ddsrt_random_mt19937 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_random_makeseed "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_random" "-t" "makeseed")
+set_tests_properties(CUnit_ddsrt_random_makeseed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_random_default_random "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_random" "-t" "default_random")
+set_tests_properties(CUnit_ddsrt_random_default_random PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_retcode_unknown "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_retcode" "-t" "unknown")
+set_tests_properties(CUnit_ddsrt_retcode_unknown PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_retcode_spotchecks "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_retcode" "-t" "spotchecks")
+set_tests_properties(CUnit_ddsrt_retcode_spotchecks PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strlcpy_dest_size "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strlcpy" "-t" "dest_size")
+set_tests_properties(CUnit_ddsrt_strlcpy_dest_size PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_strlcat_dest_size "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_strlcat" "-t" "dest_size")
+set_tests_properties(CUnit_ddsrt_strlcat_dest_size PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrfromstr_bad_family "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrfromstr" "-t" "bad_family")
+set_tests_properties(CUnit_ddsrt_sockaddrfromstr_bad_family PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrtostr_bad_sockaddr "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrtostr" "-t" "bad_sockaddr")
+set_tests_properties(CUnit_ddsrt_sockaddrtostr_bad_sockaddr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrtostr_no_space "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrtostr" "-t" "no_space")
+set_tests_properties(CUnit_ddsrt_sockaddrtostr_no_space PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrtostr_ipv4 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrtostr" "-t" "ipv4")
+set_tests_properties(CUnit_ddsrt_sockaddrtostr_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrtostr_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrtostr" "-t" "ipv6")
+set_tests_properties(CUnit_ddsrt_sockaddrtostr_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockets_gethostname "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockets" "-t" "gethostname")
+set_tests_properties(CUnit_ddsrt_sockets_gethostname PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrfromstr_ipv4 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrfromstr" "-t" "ipv4")
+set_tests_properties(CUnit_ddsrt_sockaddrfromstr_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_sockaddrfromstr_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_sockaddrfromstr" "-t" "ipv6")
+set_tests_properties(CUnit_ddsrt_sockaddrfromstr_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_gethostbyname_ipv4 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_gethostbyname" "-t" "ipv4")
+set_tests_properties(CUnit_ddsrt_gethostbyname_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_gethostbyname_ipv6 "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_gethostbyname" "-t" "ipv6")
+set_tests_properties(CUnit_ddsrt_gethostbyname_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_select_duration_to_timeval "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_select" "-t" "duration_to_timeval")
+set_tests_properties(CUnit_ddsrt_select_duration_to_timeval PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_select_timeout "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_select" "-t" "timeout")
+set_tests_properties(CUnit_ddsrt_select_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_select_send_recv "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_select" "-t" "send_recv")
+set_tests_properties(CUnit_ddsrt_select_send_recv PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsrt_select_sendmsg_recvmsg "/root/repo/_gate_debug/bin/cunit_ddsrt" "-s" "ddsrt_select" "-t" "sendmsg_recvmsg")
+set_tests_properties(CUnit_ddsrt_select_sendmsg_recvmsg PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_gate_debug/lib:" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;288;add_test;/root/repo/src/ddsrt/tests/CMakeLists.txt;82;add_cunit_executable;/root/repo/src/ddsrt/tests/CMakeLists.txt;0;")
@@ -0,0 +1,54 @@
+file(REMOVE_RECURSE
+  "../../lib/libcycloneddsidl.pdb"
+  "../../lib/libcycloneddsidl.so"
+  "../../lib/libcycloneddsidl.so.0"
+  "../../lib/libcycloneddsidl.so.0.11.0"
+  "CMakeFiles/idl.dir/src/annotation.c.o"
+  "CMakeFiles/idl.dir/src/annotation.c.o.d"
+  "CMakeFiles/idl.dir/src/descriptor_type_meta.c.o"
+  "CMakeFiles/idl.dir/src/descriptor_type_meta.c.o.d"
+  "CMakeFiles/idl.dir/src/directive.c.o"
+  "CMakeFiles/idl.dir/src/directive.c.o.d"
+  "CMakeFiles/idl.dir/src/expression.c.o"
+  "CMakeFiles/idl.dir/src/expression.c.o.d"
+  "CMakeFiles/idl.dir/src/file.c.o"
+  "CMakeFiles/idl.dir/src/file.c.o.d"
+  "CMakeFiles/idl.dir/src/hashid.c.o"
+  "CMakeFiles/idl.dir/src/hashid.c.o.d"
+  "CMakeFiles/idl.dir/src/heap.c.o"
+  "CMakeFiles/idl.dir/src/heap.c.o.d"
+  "CMakeFiles/idl.dir/src/keylist.c.o"
+  "CMakeFiles/idl.dir/src/keylist.c.o.d"
+  "CMakeFiles/idl.dir/src/md5.c.o"
+  "CMakeFiles/idl.dir/src/md5.c.o.d"
+  "CMakeFiles/idl.dir/src/parser.c.o"
+  "CMakeFiles/idl.dir/src/parser.c.o.d"
+  "CMakeFiles/idl.dir/src/print.c.o"
+  "CMakeFiles/idl.dir/src/print.c.o.d"
+  "CMakeFiles/idl.dir/src/processor.c.o"
+  "CMakeFiles/idl.dir/src/processor.c.o.d"
+  "CMakeFiles/idl.dir/src/scanner.c.o"
+  "CMakeFiles/idl.dir/src/scanner.c.o.d"
+  "CMakeFiles/idl.dir/src/scope.c.o"
+  "CMakeFiles/idl.dir/src/scope.c.o.d"
+  "CMakeFiles/idl.dir/src/string.c.o"
+  "CMakeFiles/idl.dir/src/string.c.o.d"
+  "CMakeFiles/idl.dir/src/symbol.c.o"
+  "CMakeFiles/idl.dir/src/symbol.c.o.d"
+  "CMakeFiles/idl.dir/src/tree.c.o"
+  "CMakeFiles/idl.dir/src/tree.c.o.d"
+  "CMakeFiles/idl.dir/src/vector.c.o"
+  "CMakeFiles/idl.dir/src/vector.c.o.d"
+  "CMakeFiles/idl.dir/src/visit.c.o"
+  "CMakeFiles/idl.dir/src/visit.c.o.d"
+  "include/idl/attributes.h"
+  "include/idl/endian.h"
+  "include/idl/md5.h"
+  "include/idl/misc.h"
+  "src/md5.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/idl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/idl/tests/annotation.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/annotation.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/annotation.c.o.d"
+  "/root/repo/_gate_debug/src/idl/tests/cunit_idl.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/cunit_idl.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/cunit_idl.c.o.d"
+  "/root/repo/src/idl/tests/enum.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/enum.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/enum.c.o.d"
+  "/root/repo/src/idl/tests/expression.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/expression.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/expression.c.o.d"
+  "/root/repo/src/idl/tests/file.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/file.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/file.c.o.d"
+  "/root/repo/src/idl/tests/forward.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/forward.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/forward.c.o.d"
+  "/root/repo/src/idl/tests/inheritance.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/inheritance.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/inheritance.c.o.d"
+  "/root/repo/src/idl/tests/module.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/module.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/module.c.o.d"
+  "/root/repo/src/idl/tests/parser.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/parser.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/parser.c.o.d"
+  "/root/repo/src/idl/tests/pragma.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/pragma.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/pragma.c.o.d"
+  "/root/repo/src/idl/tests/scanner.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/scanner.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/scanner.c.o.d"
+  "/root/repo/src/idl/tests/typedef.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/typedef.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/typedef.c.o.d"
+  "/root/repo/src/idl/tests/union.c" "src/idl/tests/CMakeFiles/cunit_idl.dir/union.c.o" "gcc" "src/idl/tests/CMakeFiles/cunit_idl.dir/union.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/ucunit/CMakeFiles/ucunit.dir/DependInfo.cmake"
+  "/root/repo/_gate_debug/src/idl/CMakeFiles/idl.dir/DependInfo.cmake"
+  "/root/repo/_gate_debug/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
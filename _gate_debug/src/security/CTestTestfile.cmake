@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/security
+# Build directory: /root/repo/_gate_debug/src/security
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("api")
+subdirs("core")
+subdirs("openssl")
+subdirs("builtin_plugins")
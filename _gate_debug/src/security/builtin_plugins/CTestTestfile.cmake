@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/security/builtin_plugins
+# Build directory: /root/repo/_gate_debug/src/security/builtin_plugins
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("access_control")
+subdirs("authentication")
+subdirs("cryptographic")
+subdirs("tests")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/security/openssl/src/openssl_support.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/__/__/openssl/src/openssl_support.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "/root/repo/src/security/builtin_plugins/access_control/src/access_control.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control.c.o.d"
+  "/root/repo/src/security/builtin_plugins/access_control/src/access_control_cache.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_cache.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_cache.c.o.d"
+  "/root/repo/src/security/builtin_plugins/access_control/src/access_control_objects.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_objects.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_objects.c.o.d"
+  "/root/repo/src/security/builtin_plugins/access_control/src/access_control_parser.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_parser.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_parser.c.o.d"
+  "/root/repo/src/security/builtin_plugins/access_control/src/access_control_utils.c" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_utils.c.o" "gcc" "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/src/access_control_utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_debug/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")